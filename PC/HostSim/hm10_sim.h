@@ -0,0 +1,127 @@
+/** @addtogroup hm10_ble
+ * @{
+ */
+
+/**@file
+ * @brief	HM-10 Host Simulation Header file.
+ *
+ * @defgroup hm10_sim HM-10 Host Simulation
+ * @{
+ *
+ * @brief   This module allows to run the unchanged code of the @ref hm10_ble and of its OTA layers on both ends of a
+ *          simulated Bluetooth Connection, by implementing the subset of the Teuniz RS-232 Library that they use (see
+ *          @ref RS232_SendBuf and @ref RS232_PollComport ) over a simulated link between two processes.
+ *
+ * @details The @ref run_hm10_sim_link function forks the current process into a Central and a Peripheral, each of
+ *          which initializes the @ref hm10_ble towards the @ref HM10_SIM_COMPORT Comport and then runs its own
+ *          function, so that each of them has its own copy of the state of every module. The data that each of them
+ *          sends is split into packets of up to @ref HM10_MAX_PACKET_SIZE bytes, as the HM-10 BT Device does, and each
+ *          packet is then handled as follows:<br><br>
+ *          - The packet is queued into a transmit buffer of @ref HM10_SIM_TX_BUFFER_SIZE bytes that is drained at the
+ *            simulated baud rate, as the one of a real RS-232 Port is, so that the sender only gets blocked while that
+ *            buffer is full.<br>
+ *          - The packet is then dropped, corrupted (i.e., one of its bits is flipped) or delayed by an extra amount of
+ *            time (i.e., reordered with respect to the packets that follow it), each with its own probability.<br>
+ *          - Otherwise, the packet becomes available to the receiver once the simulated one-way latency has elapsed.
+ *            <br><br>
+ * @details Both processes share the monotonic clock of the host machine, so that the times measured on each end can
+ *          be compared against each other (e.g., to check one-way latency estimates).
+ *
+ * @author 	Cesar Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026.
+ */
+
+#ifndef HM10_SIM_H_
+#define HM10_SIM_H_
+
+#include <stdint.h> // This library contains the aliases: uint8_t, uint16_t, uint32_t, etc.
+
+#define HM10_SIM_COMPORT                (1)         /**< @brief Comport towards which both ends of the simulated link initialize the @ref hm10_ble . */
+
+#ifndef HM10_SIM_TX_BUFFER_SIZE
+#define HM10_SIM_TX_BUFFER_SIZE         (4096U)     /**< @brief Length in bytes of the transmit buffer of each end of the simulated link. */
+#endif
+
+#ifndef HM10_SIM_MAX_PENDING_PACKETS
+#define HM10_SIM_MAX_PENDING_PACKETS    (1024U)     /**< @brief Largest number of packets that can be in flight towards each end of the simulated link at the same time, after which any additional packet is dropped. */
+#endif
+
+/**@brief	HM-10 Host Simulation Link Configuration.
+ *
+ * @details The probabilities are given in parts per ten thousand (e.g., 100 means 1%) and are applied independently to
+ *          each packet, in both directions.
+ */
+typedef struct {
+    uint32_t baudrate;          //!< Baud rate of the simulated line, with 10 bits per byte, or 0 for a line without a rate limit.
+    uint32_t latency_us;        //!< Time in microseconds that each packet takes to reach the other end after it has been sent.
+    uint32_t poll_delay_us;     //!< Poll Delay in microseconds with which both ends initialize the @ref hm10_ble (see @ref init_hm10_module ).
+    uint16_t loss;              //!< Probability of dropping each packet.
+    uint16_t corruption;        //!< Probability of flipping one bit of each packet.
+    uint16_t reorder;           //!< Probability of delaying each packet by an extra \c reorder_delay_us microseconds.
+    uint32_t reorder_delay_us;  //!< Extra delay in microseconds of the reordered packets.
+    uint32_t seed;              //!< Seed of the pseudo-random generator that decides which packets are impaired.
+    uint32_t cut_time_us;       //!< Time in microseconds, since the start of the run, after which every packet is dropped (i.e., the Bluetooth Connection is lost), or 0 to never lose it.
+} HM10_Sim_Link_Config;
+
+/**@brief	HM-10 Host Simulation Link Statistics of the current end of the simulated link.
+ */
+typedef struct {
+    uint32_t packets_sent;      //!< Number of packets that were sent, including the impaired ones.
+    uint32_t packets_dropped;   //!< Number of sent packets that were dropped.
+    uint32_t packets_corrupted; //!< Number of sent packets that had one of their bits flipped.
+    uint32_t packets_reordered; //!< Number of sent packets that were delayed by the extra reorder delay.
+    uint32_t bytes_sent;        //!< Number of bytes that were sent, including the ones of the impaired packets.
+    uint32_t bytes_received;    //!< Number of bytes that were received.
+} HM10_Sim_Link_Stats;
+
+/**@brief	Function that runs on one of the ends of the simulated link.
+ *
+ * @param arg   Argument that was given to the @ref run_hm10_sim_link function.
+ *
+ * @return  The number of operations that failed on that end.
+ */
+typedef int (*HM10_Sim_Peer)(void *arg);
+
+/**@brief	Runs a Central and a Peripheral function on both ends of a simulated link and waits for both of them to
+ *          return.
+ *
+ * @details The Peripheral runs in a child process, while the Central runs in the calling process, so that whatever the
+ *          Central measures remains available once this function returns. Any impairment, baud rate or latency of the
+ *          simulated link applies to both directions.
+ *
+ * @param[in] config    Pointer to the configuration of the simulated link.
+ * @param central       Function that runs on the Central end.
+ * @param peripheral    Function that runs on the Peripheral end.
+ * @param arg           Argument that is given to both the \p central and the \p peripheral functions.
+ *
+ * @return  The sum of the number of operations that failed on both ends, where a Peripheral that could not be run or
+ *          that crashed counts as one failure.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+int run_hm10_sim_link(const HM10_Sim_Link_Config *config, HM10_Sim_Peer central, HM10_Sim_Peer peripheral, void *arg);
+
+/**@brief	Gets the statistics of the current end of the simulated link.
+ *
+ * @param[out] stats    Pointer to the Memory Address into which the statistics will be stored.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+void get_hm10_sim_link_stats(HM10_Sim_Link_Stats *stats);
+
+/**@brief	Gets the current time of the monotonic clock that both ends of the simulated link share.
+ *
+ * @return  Current time in microseconds.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+uint64_t get_hm10_sim_time_us();
+
+#endif /* HM10_SIM_H_ */
+
+/** @} */ // hm10_sim
+
+/** @} */ // hm10_ble
@@ -0,0 +1,180 @@
+/** @addtogroup hm10_sim
+ * @{
+ */
+
+/**@file
+ * @brief	HM-10 OTA AES-CCM Throughput Benchmark.
+ *
+ * @details Measures the throughput of both implementations of the @ref hm10_ota_ccm (i.e., the one with the AES-NI
+ *          instructions, whenever the processor supports them, and the portable one) when encrypting and then
+ *          decrypting some data, for several data sizes, from the payload of a single HM-10 packet up to a large
+ *          message of the @ref hm10_ota_msg . For each of them, the time that the AES-CCM takes is also reported as a
+ *          percentage of the time that the same data takes to go through the line at the default baud rate of the
+ *          HM-10 BT Device (i.e., 9600 baud) and at its highest one (i.e., 230400 baud), where the latter is expected
+ *          to stay below @ref SIM_MAX_LINK_COST_PERCENT for the AES-NI implementation. Both implementations are also
+ *          checked against the Packet Vector #1 of the RFC 3610, against each other and against a forged tag.
+ *
+ * @author 	Cesar Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026.
+ */
+
+#include <stdio.h>	// Library from which "printf()" is located at.
+#include <string.h>	// Library from which "memcmp()" and "memcpy()" are located at.
+#include "hm10_sim.h" // HM-10 Host Simulation.
+#include "../Inc/hm10_ble_driver.h" // Custom Mortrack's Library to be able to initialize, send configuration commands and send and/or receive data to/from an HM-10 Bluetooth Device.
+#include "../Inc/hm10_ota_ccm.h" // Custom Mortrack's Library to encrypt and authenticate the data sent and received Over the Air via the HM-10 Bluetooth Device.
+
+#define SIM_LOW_BAUD_RATE           (9600U)     /**< @brief Default baud rate of the HM-10 BT Device. */
+#define SIM_HIGH_BAUD_RATE          (230400U)   /**< @brief Highest baud rate of the HM-10 BT Device. */
+#define SIM_MAX_DATA_SIZE           (1024U)     /**< @brief Length in bytes of the largest data that is encrypted. */
+#define SIM_HW_BYTES_PER_SIZE       (4U*1024U*1024U)  /**< @brief Bytes that are encrypted and decrypted for each data size with the AES-NI implementation. */
+#define SIM_SW_BYTES_PER_SIZE       (128U*1024U)      /**< @brief Bytes that are encrypted and decrypted for each data size with the portable implementation, which is much slower. */
+#define SIM_MAX_LINK_COST_PERCENT   (1.0)       /**< @brief Highest time that the AES-NI implementation may take, as a percentage of the time that its data takes to go through the line at @ref SIM_HIGH_BAUD_RATE . */
+#define SIM_VECTOR_AAD_SIZE         (8U)        /**< @brief Length in bytes of the associated data of the Packet Vector #1 of the RFC 3610. */
+#define SIM_VECTOR_DATA_SIZE        (23U)       /**< @brief Length in bytes of the data of the Packet Vector #1 of the RFC 3610. */
+
+static uint8_t key[HM10_OTA_CCM_KEY_SIZE] = {0xC0, 0xC1, 0xC2, 0xC3, 0xC4, 0xC5, 0xC6, 0xC7, 0xC8, 0xC9, 0xCA, 0xCB, 0xCC, 0xCD, 0xCE, 0xCF}; /**< @brief Key of the Packet Vector #1 of the RFC 3610, which is also used for the measurements. */
+static uint8_t nonce[HM10_OTA_CCM_NONCE_SIZE] = {0x00, 0x00, 0x00, 0x03, 0x02, 0x01, 0x00, 0xA0, 0xA1, 0xA2, 0xA3, 0xA4, 0xA5}; /**< @brief Nonce of the Packet Vector #1 of the RFC 3610, which is also used for the measurements. */
+static uint8_t data[SIM_MAX_DATA_SIZE];     /**< @brief Data that is encrypted and decrypted. */
+
+/**@brief	Checks the current implementation against the Packet Vector #1 of the RFC 3610 and against a forged tag.
+ *
+ * @param[out] ciphertext   Pointer to the Memory Address into which the ciphertext of @ref data and then its tag will
+ *                          be stored, so that both implementations can be compared.
+ *
+ * @return  The number of checks that did not succeed.
+ */
+static int check_implementation(uint8_t *ciphertext);
+
+/**@brief	Measures the current implementation of the AES-CCM for a certain data size.
+ *
+ * @param name          Name of the current implementation.
+ * @param size          Length in bytes of the data.
+ * @param is_hw         1 if the current implementation is the AES-NI one, whose cost must stay below @ref
+ *                      SIM_MAX_LINK_COST_PERCENT , or 0 otherwise.
+ *
+ * @return  0 if the data was decrypted back and its cost stayed within its limit, or 1 otherwise.
+ */
+static int run_size(const char *name, uint16_t size, uint8_t is_hw);
+
+int main(void)
+{
+    /** <b>Local variable sizes:</b> Data sizes of each measurement. */
+    static const uint16_t sizes[] = {HM10_MAX_PACKET_SIZE - 1, 64, 256, SIM_MAX_DATA_SIZE};
+    /** <b>Local variable hw_ciphertext:</b> Ciphertext and tag of the @ref data given by the AES-NI implementation. */
+    static uint8_t hw_ciphertext[SIM_MAX_DATA_SIZE + HM10_OTA_CCM_TAG_SIZE];
+    /** <b>Local variable sw_ciphertext:</b> Ciphertext and tag of the @ref data given by the portable implementation. */
+    static uint8_t sw_ciphertext[SIM_MAX_DATA_SIZE + HM10_OTA_CCM_TAG_SIZE];
+    /** <b>Local variable failures:</b> Number of checks and measurements that did not succeed. */
+    int failures = 0;
+
+    /* Check both implementations against the test vector and against each other. */
+    /** <b>Local variable is_hw_accelerated:</b> Flag indicating whether the processor supports the AES-NI implementation (i.e., 1) or not (i.e., 0). */
+    uint8_t is_hw_accelerated = is_hm10_ota_ccm_hw_accelerated();
+    failures += check_implementation(hw_ciphertext);
+    set_hm10_ota_ccm_hw_acceleration(0);
+    failures += check_implementation(sw_ciphertext);
+    failures += (memcmp(hw_ciphertext, sw_ciphertext, sizeof(hw_ciphertext)) != 0);
+
+    printf("HM-10 OTA AES-CCM throughput (encryption and decryption) and cost relative to the line time at %u and %u baud.\r\n",
+           SIM_LOW_BAUD_RATE, SIM_HIGH_BAUD_RATE);
+    printf("%-9s %10s %12s %12s %14s %14s\r\n", "Path", "Size [B]", "Time [ns]", "Rate [MB/s]", "@9600 [%]", "@230400 [%]");
+    if (is_hw_accelerated)
+    {
+        set_hm10_ota_ccm_hw_acceleration(1);
+        for (uint16_t i=0; i<sizeof(sizes)/sizeof(sizes[0]); i++)
+        {
+            failures += run_size("AES-NI", sizes[i], 1);
+        }
+    }
+    else
+    {
+        printf("AES-NI is not supported by this processor, so only the portable implementation is measured.\r\n");
+    }
+    set_hm10_ota_ccm_hw_acceleration(0);
+    for (uint16_t i=0; i<sizeof(sizes)/sizeof(sizes[0]); i++)
+    {
+        failures += run_size("Portable", sizes[i], 0);
+    }
+    set_hm10_ota_ccm_hw_acceleration(1);
+    printf("%d operation(s) failed.\r\n", failures);
+
+    return (failures == 0) ? 0 : 1;
+}
+
+static int check_implementation(uint8_t *ciphertext)
+{
+    /** <b>Local variable vector_aad:</b> Associated data of the Packet Vector #1 of the RFC 3610. */
+    static uint8_t vector_aad[SIM_VECTOR_AAD_SIZE] = {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07};
+    /** <b>Local variable vector_output:</b> Expected ciphertext followed by the expected tag of the Packet Vector #1 of the RFC 3610. */
+    static const uint8_t vector_output[SIM_VECTOR_DATA_SIZE + HM10_OTA_CCM_TAG_SIZE] = {
+        0x58, 0x8C, 0x97, 0x9A, 0x61, 0xC6, 0x63, 0xD2, 0xF0, 0x66, 0xD0, 0xC2, 0xC0, 0xF9, 0x89, 0x80,
+        0x6D, 0x5F, 0x6B, 0x61, 0xDA, 0xC3, 0x84, 0x17, 0xE8, 0xD1, 0x2C, 0xFD, 0xF9, 0x26, 0xE0
+    };
+    /** <b>Local variable ctx:</b> Context of the key. */
+    HM10_OTA_CCM_Context ctx;
+    /** <b>Local variable vector:</b> Data of the Packet Vector #1 of the RFC 3610, followed by its tag once it is encrypted. */
+    uint8_t vector[SIM_VECTOR_DATA_SIZE + HM10_OTA_CCM_TAG_SIZE];
+    /** <b>Local variable failures:</b> Number of checks that did not succeed. */
+    int failures = 0;
+    init_hm10_ota_ccm_context(&ctx, key);
+
+    /* Check the test vector. */
+    for (uint8_t i=0; i<SIM_VECTOR_DATA_SIZE; i++)
+    {
+        vector[i] = (uint8_t) (SIM_VECTOR_AAD_SIZE + i);
+    }
+    failures += (encrypt_hm10_ota_ccm(&ctx, nonce, vector_aad, SIM_VECTOR_AAD_SIZE, vector, SIM_VECTOR_DATA_SIZE, &vector[SIM_VECTOR_DATA_SIZE]) != HM10_EC_OK);
+    failures += (memcmp(vector, vector_output, sizeof(vector)) != 0);
+
+    /* Check that a forged tag is rejected. */
+    vector[SIM_VECTOR_DATA_SIZE] ^= 0x01U;
+    failures += (decrypt_hm10_ota_ccm(&ctx, nonce, vector_aad, SIM_VECTOR_AAD_SIZE, vector, SIM_VECTOR_DATA_SIZE, &vector[SIM_VECTOR_DATA_SIZE]) != HM10_EC_NA);
+
+    /* Encrypt the measured data, so that both implementations can be compared. */
+    for (uint16_t i=0; i<SIM_MAX_DATA_SIZE; i++)
+    {
+        data[i] = (uint8_t) (i*131 + 7);
+    }
+    memcpy(ciphertext, data, SIM_MAX_DATA_SIZE);
+    failures += (encrypt_hm10_ota_ccm(&ctx, nonce, NULL, 0, ciphertext, SIM_MAX_DATA_SIZE, &ciphertext[SIM_MAX_DATA_SIZE]) != HM10_EC_OK);
+    clear_hm10_ota_ccm_context(&ctx);
+
+    return failures;
+}
+
+static int run_size(const char *name, uint16_t size, uint8_t is_hw)
+{
+    /** <b>Local variable ctx:</b> Context of the key. */
+    HM10_OTA_CCM_Context ctx;
+    /** <b>Local variable tag:</b> Authentication tag of the data. */
+    uint8_t tag[HM10_OTA_CCM_TAG_SIZE];
+    /** <b>Local variable calls:</b> Number of times that the data is encrypted and decrypted. */
+    uint32_t calls = (is_hw ? SIM_HW_BYTES_PER_SIZE : SIM_SW_BYTES_PER_SIZE) / size;
+    /** <b>Local variable mismatches:</b> Number of times that the data was not decrypted back. */
+    uint32_t mismatches = 0;
+    init_hm10_ota_ccm_context(&ctx, key);
+
+    /** <b>Local variable start_time:</b> Time in microseconds at which the measurement started. */
+    uint64_t start_time = get_hm10_sim_time_us();
+    for (uint32_t i=0; i<calls; i++)
+    {
+        encrypt_hm10_ota_ccm(&ctx, nonce, NULL, 0, data, size, tag);
+        mismatches += (decrypt_hm10_ota_ccm(&ctx, nonce, NULL, 0, data, size, tag) != HM10_EC_OK);
+    }
+    /** <b>Local variable time_ns:</b> Time in nanoseconds that each encryption and decryption took. */
+    double time_ns = (get_hm10_sim_time_us() - start_time)*1e3/calls;
+    clear_hm10_ota_ccm_context(&ctx);
+    /** <b>Local variable low_cost:</b> Time of each encryption and decryption, as a percentage of the time that its data takes to go through the line at @ref SIM_LOW_BAUD_RATE . */
+    double low_cost = 100.0*time_ns / (size*10*1e9/SIM_LOW_BAUD_RATE);
+    /** <b>Local variable high_cost:</b> Time of each encryption and decryption, as a percentage of the time that its data takes to go through the line at @ref SIM_HIGH_BAUD_RATE . */
+    double high_cost = 100.0*time_ns / (size*10*1e9/SIM_HIGH_BAUD_RATE);
+    /** <b>Local variable is_failed:</b> Flag indicating whether the measurement failed (i.e., 1) or not (i.e., 0). */
+    uint8_t is_failed = (mismatches != 0) || (is_hw && (high_cost >= SIM_MAX_LINK_COST_PERCENT));
+    printf("%-9s %10u %12.1f %12.1f %14.5f %14.5f %s\r\n", name, size, time_ns, size*1e3/time_ns, low_cost, high_cost,
+           is_failed ? "(!)" : "");
+
+    return is_failed;
+}
+
+/** @} */
@@ -0,0 +1,298 @@
+/** @addtogroup hm10_sim
+ * @{
+ */
+
+/**@file
+ * @brief	HM-10 OTA COBS Framing Re-synchronization Harness.
+ *
+ * @details The Peripheral sends a fixed number of frames with the @ref hm10_ota_cobs to the Central over the simulated
+ *          link of the @ref hm10_sim at 9600 baud (i.e., the default baud rate of the HM-10 BT Device), and damages
+ *          every @ref SIM_DAMAGE_PERIOD th frame in the middle of its encoding on each of the following scenarios:
+ *          <br><br>
+ *          - No damage at all.<br>
+ *          - Some bytes of the frame are dropped.<br>
+ *          - A byte of the frame is corrupted into another non-zero value.<br>
+ *          - A stray delimiter is injected into the frame.<br>
+ *          - A burst of garbage without any delimiter is injected into the frame, which makes it longer than the
+ *            longest frame that can be received.<br><br>
+ *          Every byte of the frames is at least 0x80 and every frame is shorter than 127 bytes, so that each of them is
+ *          encoded as a single COBS block whose code is less than 0x80. Therefore, each kind of damage has a single
+ *          possible outcome: the dropped bytes leave the block shorter than its code, the corrupted byte keeps a valid
+ *          encoding and is only caught by the CRC32C that each frame carries, the stray delimiter splits the frame into
+ *          two pieces whose codes both exceed their lengths, and the garbage makes the frame overlong, so that the
+ *          receiver has to discard it up to its delimiter.
+ * @details The Central checks that only the damaged frames are lost, that every other frame (including the one right
+ *          after each damaged frame) is delivered intact and in order, and that the statistics of the @ref
+ *          hm10_ota_cobs count exactly the expected dropped frames and discarded bytes.
+ *
+ * @author 	Cesar Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026.
+ */
+
+#include <stdio.h>	// Library from which "printf()" is located at.
+#include <string.h>	// Library from which "memcmp()", "memmove()" and "memset()" are located at.
+#include "hm10_sim.h" // HM-10 Host Simulation.
+#include "../Inc/hm10_config.h" // This is the Mortrack's HM-10 library configuration file.
+#include "../Inc/hm10_ble_driver.h" // Custom Mortrack's Library to be able to initialize, send configuration commands and send and/or receive data to/from an HM-10 Bluetooth Device.
+#include "../Inc/hm10_crc32c.h" // Custom Mortrack's Library to calculate the CRC32C of the data sent and received Over the Air by the HM-10 Bluetooth Device.
+#include "../Inc/hm10_ota_cobs.h" // Custom Mortrack's Library to frame the data sent and received Over the Air via the HM-10 Bluetooth Device with COBS.
+
+#define SIM_BAUD_RATE               (9600U)     /**< @brief Baud rate of the simulated link, which is the default one of the HM-10 BT Device. */
+#define SIM_LATENCY_US              (15000U)    /**< @brief One-way latency in microseconds of the simulated link (i.e., about two Connection Intervals). */
+#define SIM_POLL_DELAY_US           (100000U)   /**< @brief Poll Delay in microseconds of both ends of the simulated link. */
+#define SIM_FRAME_COUNT             (60U)       /**< @brief Number of frames that are sent on each scenario. */
+#define SIM_DAMAGE_PERIOD           (6U)        /**< @brief Every this many frames, starting with the one at the middle of the period, one frame is damaged. */
+#define SIM_MAX_FRAME_SIZE          (64U)       /**< @brief Length in bytes of the largest frame that is sent. */
+#define SIM_HEADER_SIZE             (2U)        /**< @brief Length in bytes of the index that starts each frame. */
+#define SIM_CRC_SIZE                (8U)        /**< @brief Length in bytes of the CRC32C that ends each frame, which is sent as 8 nibbles so that none of its bytes is less than 0x80. */
+#define SIM_DROP_SIZE               (3U)        /**< @brief Number of bytes that are dropped from a damaged frame. */
+#define SIM_GARBAGE_SIZE            (HM10_OTA_COBS_MAX_ENCODED_SIZE(HM10_OTA_COBS_MAX_FRAME_SIZE) + 64U) /**< @brief Length in bytes of the burst of garbage that is injected into a damaged frame, which exceeds the longest encoded frame. */
+#define SIM_GARBAGE_BYTE            (0xA5U)     /**< @brief Value of every byte of the burst of garbage. */
+#define SIM_MAX_SILENT_POLLS        (3U)        /**< @brief Number of consecutive timeouts after which the Central stops waiting for frames. */
+
+/**@brief	Kinds of damage that the scenarios of the harness apply.
+ */
+typedef enum
+{
+    Sim_No_Damage       = 0U,   //!< The frames are sent intact.
+    Sim_Dropped_Bytes   = 1U,   //!< @ref SIM_DROP_SIZE bytes of the frame are dropped.
+    Sim_Corrupted_Byte  = 2U,   //!< A byte of the frame is corrupted into another non-zero value.
+    Sim_Stray_Delimiter = 3U,   //!< A delimiter is injected into the frame.
+    Sim_Garbage_Burst   = 4U    //!< A burst of @ref SIM_GARBAGE_SIZE bytes without any delimiter is injected into the frame.
+} Sim_Damage;
+
+/**@brief	Scenario of the harness.
+ */
+typedef struct {
+    const char *name;           //!< Name of the scenario.
+    Sim_Damage damage;          //!< Kind of damage that is applied to every damaged frame.
+    uint16_t delivered;         //!< Number of intact frames that the Central got.
+    uint16_t crc_errors;        //!< Number of frames that the Central got with a CRC32C that did not match.
+    uint16_t mismatches;        //!< Number of frames that the Central got with a valid CRC32C, but either with an unexpected content or out of order.
+    HM10_OTA_COBS_Stats stats;  //!< Statistics of the @ref hm10_ota_cobs that the Central got.
+} Sim_Scenario;
+
+/**@brief	Builds a frame, whose bytes are all at least 0x80.
+ *
+ * @param[out] frame    Pointer to the Memory Address into which the frame will be stored.
+ * @param index         Index of the frame.
+ *
+ * @return  Length in bytes of the frame.
+ */
+static uint16_t build_frame(uint8_t *frame, uint16_t index);
+
+/**@brief	Checks whether a frame is damaged on a scenario.
+ *
+ * @param index     Index of the frame.
+ * @param damage    Kind of damage of the scenario.
+ *
+ * @return  1 if the frame is damaged, or 0 otherwise.
+ */
+static uint8_t is_damaged(uint16_t index, Sim_Damage damage);
+
+/**@brief	Receives and checks the frames of a scenario (see @ref HM10_Sim_Peer ).
+ */
+static int run_central(void *arg);
+
+/**@brief	Sends and damages the frames of a scenario (see @ref HM10_Sim_Peer ).
+ */
+static int run_peripheral(void *arg);
+
+int main(void)
+{
+    /** <b>Local variable scenarios:</b> Scenarios of the harness. */
+    Sim_Scenario scenarios[] = {
+        {"no damage",           Sim_No_Damage,          0, 0, 0, {0}},
+        {"dropped bytes",       Sim_Dropped_Bytes,      0, 0, 0, {0}},
+        {"corrupted byte",      Sim_Corrupted_Byte,     0, 0, 0, {0}},
+        {"stray delimiter",     Sim_Stray_Delimiter,    0, 0, 0, {0}},
+        {"garbage burst",       Sim_Garbage_Burst,      0, 0, 0, {0}}
+    };
+    /** <b>Local variable failures:</b> Number of scenarios that did not succeed. */
+    int failures = 0;
+
+    printf("HM-10 OTA COBS Framing with %u frames, of which every %uth one is damaged, over a simulated link at %u baud.\r\n",
+           SIM_FRAME_COUNT, SIM_DAMAGE_PERIOD, SIM_BAUD_RATE);
+    printf("%-20s %10s %10s %11s %16s %18s\r\n", "Scenario", "Delivered", "Lost", "CRC errors", "Frames dropped",
+           "Bytes discarded");
+    for (uint16_t i=0; i<sizeof(scenarios)/sizeof(scenarios[0]); i++)
+    {
+        /** <b>Local variable config:</b> Configuration of the simulated link, which is clean so that only the injected damage is seen. */
+        HM10_Sim_Link_Config config = {SIM_BAUD_RATE, SIM_LATENCY_US, SIM_POLL_DELAY_US, 0, 0, 0, 0, i + 1, 0};
+        /** <b>Local variable damage:</b> Kind of damage of the current scenario. */
+        Sim_Damage damage = scenarios[i].damage;
+        /** <b>Local variable damaged:</b> Number of frames that are damaged. */
+        uint16_t damaged = 0;
+        /** <b>Local variable expected_discarded:</b> Number of bytes that the receiver must discard while re-synchronizing. */
+        uint32_t expected_discarded = 0;
+        /** <b>Local variable frame:</b> Buffer of a frame. */
+        uint8_t frame[SIM_MAX_FRAME_SIZE];
+        for (uint16_t index=0; index<SIM_FRAME_COUNT; index++)
+        {
+            if (is_damaged(index, damage))
+            {
+                damaged++;
+                /* The encoding of each frame is a single block, with its code, plus the garbage and the delimiter. */
+                expected_discarded += (damage == Sim_Garbage_Burst) ? (build_frame(frame, index) + 1 + SIM_GARBAGE_SIZE + 1) : 0;
+            }
+        }
+        /** <b>Local variable expected_dropped:</b> Number of frames that the receiver must drop because of their encoding or length, where a stray delimiter splits a frame into two invalid ones. */
+        uint32_t expected_dropped = ((damage == Sim_Dropped_Bytes) || (damage == Sim_Garbage_Burst)) ? damaged
+                                    : ((damage == Sim_Stray_Delimiter) ? 2U*damaged : 0);
+        /** <b>Local variable scenario_failures:</b> Number of operations of the current scenario that failed. */
+        int scenario_failures = run_hm10_sim_link(&config, run_central, run_peripheral, &scenarios[i]);
+
+        /* Only the damaged frames may be lost, and the statistics must count exactly what was damaged. */
+        if ((scenarios[i].delivered != (SIM_FRAME_COUNT - damaged)) || (scenarios[i].mismatches != 0)
+            || (scenarios[i].crc_errors != ((damage == Sim_Corrupted_Byte) ? damaged : 0))
+            || (scenarios[i].stats.frames_dropped != expected_dropped)
+            || (scenarios[i].stats.bytes_discarded != expected_discarded))
+        {
+            scenario_failures++;
+        }
+        printf("%-20s %10u %10u %11u %9u (%4u) %11u (%4u) %s\r\n", scenarios[i].name, scenarios[i].delivered,
+               SIM_FRAME_COUNT - scenarios[i].delivered, scenarios[i].crc_errors, scenarios[i].stats.frames_dropped,
+               expected_dropped, scenarios[i].stats.bytes_discarded, expected_discarded,
+               (scenario_failures == 0) ? "" : "(!)");
+        if (scenario_failures != 0)
+        {
+            failures++;
+        }
+    }
+    printf("Statistics of the receiver, with their expected values in parentheses.\r\n");
+    printf("%d operation(s) failed.\r\n", failures);
+
+    return (failures == 0) ? 0 : 1;
+}
+
+static uint16_t build_frame(uint8_t *frame, uint16_t index)
+{
+    /** <b>Local variable size:</b> Length in bytes of the frame before its CRC32C. */
+    uint16_t size = SIM_HEADER_SIZE + 8 + (index*13) % (SIM_MAX_FRAME_SIZE - SIM_HEADER_SIZE - SIM_CRC_SIZE - 8);
+    frame[0] = (uint8_t) (0x80U | (index & 0x7FU));
+    frame[1] = (uint8_t) (0x80U | (index >> 7));
+    for (uint16_t i=SIM_HEADER_SIZE; i<size; i++)
+    {
+        frame[i] = (uint8_t) (0x80U | ((index*31 + i*7) & 0x7FU));
+    }
+    /** <b>Local variable crc:</b> CRC32C of the frame before its CRC32C. */
+    uint32_t crc = calculate_hm10_crc32c(frame, size);
+    for (uint8_t i=0; i<SIM_CRC_SIZE; i++)
+    {
+        frame[size++] = (uint8_t) (0x80U | ((crc >> (4*i)) & 0x0FU));
+    }
+
+    return size;
+}
+
+static uint8_t is_damaged(uint16_t index, Sim_Damage damage)
+{
+    return (damage != Sim_No_Damage) && ((index % SIM_DAMAGE_PERIOD) == (SIM_DAMAGE_PERIOD/2));
+}
+
+static int run_central(void *arg)
+{
+    /** <b>Local variable p_scenario:</b> Pointer to the current scenario. */
+    Sim_Scenario *p_scenario = (Sim_Scenario *) arg;
+    /** <b>Local variable frame:</b> Buffer of the received frame. */
+    uint8_t frame[SIM_MAX_FRAME_SIZE];
+    /** <b>Local variable expected:</b> Buffer of the expected frame. */
+    uint8_t expected[SIM_MAX_FRAME_SIZE];
+    /** <b>Local variable size:</b> Length in bytes of the received frame. */
+    uint16_t size;
+    /** <b>Local variable next_index:</b> Lowest index that the next intact frame may have. */
+    uint16_t next_index = 0;
+    /** <b>Local variable silent_polls:</b> Number of consecutive timeouts. */
+    uint8_t silent_polls = 0;
+    reset_hm10_ota_cobs();
+
+    /* Receive every frame until nothing else arrives for a while, and check its CRC32C, its index and its content. */
+    while (silent_polls < SIM_MAX_SILENT_POLLS)
+    {
+        if (get_hm10_ota_cobs_frame(frame, sizeof(frame), &size) != HM10_EC_OK)
+        {
+            silent_polls++;
+            continue;
+        }
+        silent_polls = 0;
+        /** <b>Local variable crc:</b> CRC32C that the frame carries. */
+        uint32_t crc = 0;
+        for (uint8_t i=0; (size>=SIM_CRC_SIZE) && (i<SIM_CRC_SIZE); i++)
+        {
+            crc |= (uint32_t) (frame[size - SIM_CRC_SIZE + i] & 0x0FU) << (4*i);
+        }
+        if ((size < (SIM_HEADER_SIZE+SIM_CRC_SIZE)) || (crc != calculate_hm10_crc32c(frame, size - SIM_CRC_SIZE)))
+        {
+            p_scenario->crc_errors++;
+            continue;
+        }
+        /** <b>Local variable index:</b> Index of the received frame. */
+        uint16_t index = (uint16_t) ((frame[0] & 0x7FU) | ((frame[1] & 0x7FU) << 7));
+        if ((index < next_index) || (index >= SIM_FRAME_COUNT) || is_damaged(index, p_scenario->damage)
+            || (build_frame(expected, index) != size) || (memcmp(frame, expected, size) != 0))
+        {
+            p_scenario->mismatches++;
+            continue;
+        }
+        /* Every intact frame that was skipped, if any, is lost, which the caller sees in the number of delivered frames. */
+        next_index = index + 1;
+        p_scenario->delivered++;
+    }
+    get_hm10_ota_cobs_stats(&p_scenario->stats);
+
+    return 0;
+}
+
+static int run_peripheral(void *arg)
+{
+    /** <b>Local variable p_scenario:</b> Pointer to the current scenario. */
+    Sim_Scenario *p_scenario = (Sim_Scenario *) arg;
+    /** <b>Local variable frame:</b> Buffer of the frame that is sent. */
+    uint8_t frame[SIM_MAX_FRAME_SIZE];
+    /** <b>Local variable wire:</b> Encoded frame, as it is sent along with its damage and its delimiter. */
+    static uint8_t wire[HM10_OTA_COBS_MAX_ENCODED_SIZE(SIM_MAX_FRAME_SIZE) + SIM_GARBAGE_SIZE + 1];
+
+    for (uint16_t index=0; index<SIM_FRAME_COUNT; index++)
+    {
+        /** <b>Local variable wire_size:</b> Length in bytes of the encoded frame. */
+        uint16_t wire_size = encode_hm10_ota_cobs(frame, build_frame(frame, index), wire);
+        /** <b>Local variable middle:</b> Index of the encoded frame at which it is damaged. */
+        uint16_t middle = wire_size / 2;
+
+        /* Damage the frame in the middle of its encoding, as the link would. */
+        if (is_damaged(index, p_scenario->damage))
+        {
+            switch (p_scenario->damage)
+            {
+                case Sim_Dropped_Bytes:
+                    memmove(&wire[middle], &wire[middle + SIM_DROP_SIZE], wire_size - middle - SIM_DROP_SIZE);
+                    wire_size -= SIM_DROP_SIZE;
+                    break;
+                case Sim_Corrupted_Byte:
+                    wire[middle] ^= 0x3FU;
+                    break;
+                case Sim_Stray_Delimiter:
+                    memmove(&wire[middle + 1], &wire[middle], wire_size - middle);
+                    wire[middle] = HM10_OTA_COBS_DELIMITER;
+                    wire_size++;
+                    break;
+                case Sim_Garbage_Burst:
+                    memmove(&wire[middle + SIM_GARBAGE_SIZE], &wire[middle], wire_size - middle);
+                    memset(&wire[middle], SIM_GARBAGE_BYTE, SIM_GARBAGE_SIZE);
+                    wire_size += SIM_GARBAGE_SIZE;
+                    break;
+                default:
+                    break;
+            }
+        }
+        wire[wire_size++] = HM10_OTA_COBS_DELIMITER;
+        if (send_hm10_ota_data(wire, wire_size) != HM10_EC_OK)
+        {
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+/** @} */
@@ -0,0 +1,114 @@
+/** @addtogroup hm10_sim
+ * @{
+ */
+
+/**@file
+ * @brief	HM-10 CRC32C Throughput Benchmark.
+ *
+ * @details Measures the throughput of both implementations of the @ref hm10_crc32c (i.e., the one with the \c crc32
+ *          instructions of SSE4.2, whenever the processor supports them, and the table-driven one) for several data
+ *          sizes, from a single HM-10 packet up to a block of the @ref hm10_ota_file . For each of them, the time that
+ *          the CRC32C takes is also reported as a percentage of the time that the same data takes to go through the
+ *          line at the default baud rate of the HM-10 BT Device (i.e., 9600 baud) and at its highest one (i.e., 230400
+ *          baud), where the latter is expected to stay below @ref SIM_MAX_LINK_COST_PERCENT . Both implementations are
+ *          also checked against the standard check value of the CRC32C and against each other.
+ *
+ * @author 	Cesar Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026.
+ */
+
+#include <stdio.h>	// Library from which "printf()" is located at.
+#include "hm10_sim.h" // HM-10 Host Simulation.
+#include "../Inc/hm10_ble_driver.h" // Custom Mortrack's Library to be able to initialize, send configuration commands and send and/or receive data to/from an HM-10 Bluetooth Device.
+#include "../Inc/hm10_crc32c.h" // Custom Mortrack's Library to calculate the CRC32C of the data sent and received Over the Air.
+
+#define SIM_LOW_BAUD_RATE           (9600U)     /**< @brief Default baud rate of the HM-10 BT Device. */
+#define SIM_HIGH_BAUD_RATE          (230400U)   /**< @brief Highest baud rate of the HM-10 BT Device. */
+#define SIM_MAX_DATA_SIZE           (4096U)     /**< @brief Length in bytes of the largest data whose CRC32C is calculated. */
+#define SIM_BYTES_PER_SIZE          (64U*1024U*1024U)  /**< @brief Bytes whose CRC32C is calculated for each data size and implementation. */
+#define SIM_CHECK_VALUE             (0xE3069283U)   /**< @brief CRC32C of the ASCII string "123456789". */
+#define SIM_MAX_LINK_COST_PERCENT   (1.0)       /**< @brief Highest time that the CRC32C may take, as a percentage of the time that its data takes to go through the line at @ref SIM_HIGH_BAUD_RATE . */
+
+static uint8_t data[SIM_MAX_DATA_SIZE];     /**< @brief Data whose CRC32C is calculated. */
+static volatile uint32_t crc_sink;          /**< @brief Holds the calculated CRC32C values so that their calculation is not optimized away. */
+
+/**@brief	Measures the current implementation of the CRC32C for a certain data size.
+ *
+ * @param name  Name of the current implementation.
+ * @param size  Length in bytes of the data.
+ *
+ * @return  0 if its cost stayed below @ref SIM_MAX_LINK_COST_PERCENT , or 1 otherwise.
+ */
+static int run_size(const char *name, uint32_t size);
+
+int main(void)
+{
+    /** <b>Local variable sizes:</b> Data sizes of each measurement. */
+    static const uint32_t sizes[] = {HM10_MAX_PACKET_SIZE, 256, 1024, SIM_MAX_DATA_SIZE};
+    /** <b>Local variable check_string:</b> Data of the standard check value of the CRC32C. */
+    static uint8_t check_string[] = "123456789";
+    /** <b>Local variable failures:</b> Number of checks and measurements that did not succeed. */
+    int failures = 0;
+    for (uint32_t i=0; i<SIM_MAX_DATA_SIZE; i++)
+    {
+        data[i] = (uint8_t) (i*131 + 7);
+    }
+
+    /* Check both implementations against the check value and against each other. */
+    /** <b>Local variable is_hw_accelerated:</b> Flag indicating whether the processor supports the SSE4.2 implementation (i.e., 1) or not (i.e., 0). */
+    uint8_t is_hw_accelerated = is_hm10_crc32c_hw_accelerated();
+    /** <b>Local variable hw_crc:</b> CRC32C of the data with the default implementation. */
+    uint32_t hw_crc = calculate_hm10_crc32c(data, SIM_MAX_DATA_SIZE);
+    failures += (calculate_hm10_crc32c(check_string, 9) != SIM_CHECK_VALUE);
+    set_hm10_crc32c_hw_acceleration(0);
+    failures += (calculate_hm10_crc32c(check_string, 9) != SIM_CHECK_VALUE);
+    failures += (calculate_hm10_crc32c(data, SIM_MAX_DATA_SIZE) != hw_crc);
+
+    printf("HM-10 CRC32C throughput and cost relative to the line time at %u and %u baud.\r\n", SIM_LOW_BAUD_RATE, SIM_HIGH_BAUD_RATE);
+    printf("%-8s %10s %12s %12s %14s %14s\r\n", "Path", "Size [B]", "Time [ns]", "Rate [MB/s]", "@9600 [%]", "@230400 [%]");
+    if (is_hw_accelerated)
+    {
+        set_hm10_crc32c_hw_acceleration(1);
+        for (uint16_t i=0; i<sizeof(sizes)/sizeof(sizes[0]); i++)
+        {
+            failures += run_size("SSE4.2", sizes[i]);
+        }
+    }
+    else
+    {
+        printf("SSE4.2 is not supported by this processor, so only the table-driven implementation is measured.\r\n");
+    }
+    set_hm10_crc32c_hw_acceleration(0);
+    for (uint16_t i=0; i<sizeof(sizes)/sizeof(sizes[0]); i++)
+    {
+        failures += run_size("Table", sizes[i]);
+    }
+    set_hm10_crc32c_hw_acceleration(1);
+    printf("%d operation(s) failed.\r\n", failures);
+
+    return (failures == 0) ? 0 : 1;
+}
+
+static int run_size(const char *name, uint32_t size)
+{
+    /** <b>Local variable calls:</b> Number of times that the CRC32C of the data is calculated. */
+    uint32_t calls = SIM_BYTES_PER_SIZE / size;
+    /** <b>Local variable start_time:</b> Time in microseconds at which the measurement started. */
+    uint64_t start_time = get_hm10_sim_time_us();
+    for (uint32_t i=0; i<calls; i++)
+    {
+        crc_sink = calculate_hm10_crc32c(data, size);
+    }
+    /** <b>Local variable time_ns:</b> Time in nanoseconds that each calculation took. */
+    double time_ns = (get_hm10_sim_time_us() - start_time)*1e3/calls;
+    /** <b>Local variable low_cost:</b> Time of each calculation, as a percentage of the time that its data takes to go through the line at @ref SIM_LOW_BAUD_RATE . */
+    double low_cost = 100.0*time_ns / (size*10*1e9/SIM_LOW_BAUD_RATE);
+    /** <b>Local variable high_cost:</b> Time of each calculation, as a percentage of the time that its data takes to go through the line at @ref SIM_HIGH_BAUD_RATE . */
+    double high_cost = 100.0*time_ns / (size*10*1e9/SIM_HIGH_BAUD_RATE);
+    printf("%-8s %10u %12.1f %12.1f %14.5f %14.5f %s\r\n", name, size, time_ns, size*1e3/time_ns, low_cost, high_cost,
+           (high_cost < SIM_MAX_LINK_COST_PERCENT) ? "" : "(!)");
+
+    return (high_cost < SIM_MAX_LINK_COST_PERCENT) ? 0 : 1;
+}
+
+/** @} */
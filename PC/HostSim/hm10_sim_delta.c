@@ -0,0 +1,381 @@
+/** @addtogroup hm10_sim
+ * @{
+ */
+
+/**@file
+ * @brief	HM-10 OTA Delta Telemetry Codec Harness.
+ *
+ * @details Encodes streams of samples with the @ref hm10_ota_delta , acknowledging every packet as a receiver would,
+ *          and decodes each packet both with the @ref decode_hm10_ota_delta_packet function and with a byte-at-a-time
+ *          reference decoder of this harness, on the following scenarios:<br><br>
+ *          - Fields that change in small steps, with 1 field, with 4 fields (i.e., exactly one SSE2 vector) and with 7
+ *            fields (i.e., one SSE2 vector plus a scalar tail).<br>
+ *          - Flags that toggle independently, with the @ref HM10_OTA_Delta_XOR mode.<br>
+ *          - Fields that jump between INT32_MIN, INT32_MAX, -1, 0 and 1, whose differences wrap around and take the
+ *            longest varints, with both modes.<br>
+ *          - A field with large random jumps next to fields that change in small steps.<br><br>
+ *          Every decoded sample must match both the original sample and the output of the reference decoder. The
+ *          decoder must then decode the longest varint of a 32-bit field and reject the following malformed packets:
+ *          a varint whose last byte carries bits beyond the 32 bits of a field, a varint of 6 bytes, every truncation
+ *          of a valid packet, a packet with more varints than its samples require and a packet with its Reserved bits
+ *          set.
+ * @details The Makefile builds this harness twice: once as is, so that the SSE2 decoder is checked on x86 host
+ *          machines, and once with \c __SSE2__ undefined, so that the portable scalar decoder is checked against the
+ *          same reference decoder and therefore against the SSE2 one.
+ *
+ * @author 	Cesar Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026.
+ */
+
+#include <stdio.h>	// Library from which "printf()" is located at.
+#include <string.h>	// Library from which "memcmp()" and "memset()" are located at.
+#include "../Inc/hm10_ota_delta.h" // Custom Mortrack's Library to encode periodic telemetry samples as deltas Over the Air via the HM-10 Bluetooth Device.
+
+#define SIM_SAMPLE_COUNT            (240U)      /**< @brief Number of samples that are encoded on each scenario. */
+#define SIM_MAX_VARINT_SIZE         (5U)        /**< @brief Length in bytes of the longest varint of a 32-bit field. */
+
+/**@brief	Kinds of samples that the scenarios of the harness generate.
+ */
+typedef enum
+{
+    Sim_Small_Steps     = 0U,   //!< Each field changes by a few units from one sample to the next.
+    Sim_Flags           = 1U,   //!< Each of 8 bits of each field toggles independently.
+    Sim_Extremes        = 2U,   //!< Each field jumps between INT32_MIN, INT32_MAX, -1, 0 and 1.
+    Sim_Large_Jumps     = 3U    //!< The first field jumps randomly over the whole 32-bit range, while the rest change in small steps.
+} Sim_Sample_Kind;
+
+/**@brief	Scenario of the harness.
+ */
+typedef struct {
+    const char *name;           //!< Name of the scenario.
+    HM10_OTA_Delta_Mode mode;   //!< Mode with which the fields are encoded.
+    uint8_t field_count;        //!< Number of fields of each sample.
+    Sim_Sample_Kind kind;       //!< Kind of samples that are encoded.
+    uint16_t packets;           //!< Number of packets that were encoded.
+    uint32_t bytes;             //!< Total bytes of the encoded packets.
+    uint16_t mismatches;        //!< Number of samples that were not decoded back into the original one, either by the codec or by the reference decoder, or whose decoding failed.
+} Sim_Scenario;
+
+/**@brief	Malformed or boundary packet of the harness.
+ */
+typedef struct {
+    const char *name;                               //!< Name of the packet.
+    uint8_t packet[HM10_OTA_DELTA_PACKET_SIZE];     //!< Packet, which is decoded with a single field of the @ref HM10_OTA_Delta_Difference mode and without a reference.
+    uint8_t packet_size;                            //!< Length in bytes of the packet.
+    HM10_Status expected;                           //!< Return value that the decoder must give.
+    int32_t expected_field;                         //!< Field that the decoder must give whenever the \c expected member is @ref HM10_EC_OK .
+} Sim_Packet_Check;
+
+/**@brief	Generates a field of a sample of a scenario.
+ *
+ * @param kind      Kind of samples of the scenario.
+ * @param sample    Index of the sample.
+ * @param field     Index of the field.
+ *
+ * @return  The value of the field.
+ */
+static int32_t generate_field(Sim_Sample_Kind kind, uint16_t sample, uint8_t field);
+
+/**@brief	Decodes a packet one byte at a time, independently of the @ref hm10_ota_delta .
+ *
+ * @param mode              Mode with which the fields were encoded.
+ * @param field_count       Number of fields of each sample.
+ * @param[in] reference     Pointer to the fields of the sample against which the first sample was encoded.
+ * @param[in] packet        Pointer to the packet.
+ * @param packet_size       Length in bytes of the packet.
+ * @param[out] samples      Pointer to the Memory Address into which the decoded samples will be stored.
+ *
+ * @return  The number of decoded samples, or 0 if the packet is malformed.
+ */
+static uint8_t decode_reference(HM10_OTA_Delta_Mode mode, uint8_t field_count, const uint32_t *reference, const uint8_t *packet,
+                                uint8_t packet_size, uint32_t *samples);
+
+/**@brief	Encodes and decodes the samples of a scenario.
+ *
+ * @param[in,out] p_scenario    Pointer to the scenario.
+ *
+ * @return  The number of operations that failed.
+ */
+static int run_scenario(Sim_Scenario *p_scenario);
+
+/**@brief	Decodes every truncation of the first packet of a stream of samples, none of which may be decoded.
+ *
+ * @return  The number of truncations that were not rejected.
+ */
+static int run_truncations(void);
+
+int main(void)
+{
+    /** <b>Local variable scenarios:</b> Scenarios of the harness. */
+    Sim_Scenario scenarios[] = {
+        {"small steps, 1 field",    HM10_OTA_Delta_Difference,  1, Sim_Small_Steps,  0, 0, 0},
+        {"small steps, 4 fields",   HM10_OTA_Delta_Difference,  4, Sim_Small_Steps,  0, 0, 0},
+        {"small steps, 7 fields",   HM10_OTA_Delta_Difference,  7, Sim_Small_Steps,  0, 0, 0},
+        {"flags, 8 fields (XOR)",   HM10_OTA_Delta_XOR,         8, Sim_Flags,        0, 0, 0},
+        {"INT32 extremes, 3 fields", HM10_OTA_Delta_Difference, 3, Sim_Extremes,     0, 0, 0},
+        {"INT32 extremes (XOR)",    HM10_OTA_Delta_XOR,         3, Sim_Extremes,     0, 0, 0},
+        {"large jumps, 5 fields",   HM10_OTA_Delta_Difference,  5, Sim_Large_Jumps,  0, 0, 0}
+    };
+    /** <b>Local variable checks:</b> Malformed and boundary packets of the harness. */
+    Sim_Packet_Check checks[] = {
+        {"longest varint (INT32_MIN)",  {0, 0, 1, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F}, 8, HM10_EC_OK, INT32_MIN},
+        {"last varint byte above 0x0F", {0, 0, 1, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F}, 8, HM10_EC_ERR, 0},
+        {"varint of 6 bytes",           {0, 0, 1, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00}, 9, HM10_EC_ERR, 0},
+        {"unterminated varint",         {0, 0, 1, 0x81}, 4, HM10_EC_ERR, 0},
+        {"more varints than samples",   {0, 0, 1, 0x01, 0x01}, 5, HM10_EC_ERR, 0},
+        {"reserved bits set",           {0, 0, 0x11, 0x01}, 4, HM10_EC_ERR, 0}
+    };
+    /** <b>Local variable failures:</b> Number of scenarios and checks that did not succeed. */
+    int failures = 0;
+
+#if defined(__SSE2__)
+    printf("HM-10 OTA Delta Telemetry Codec with the SSE2 decoder, over %u samples per scenario.\r\n", SIM_SAMPLE_COUNT);
+#else
+    printf("HM-10 OTA Delta Telemetry Codec with the scalar decoder, over %u samples per scenario.\r\n", SIM_SAMPLE_COUNT);
+#endif
+    printf("%-28s %8s %8s %14s %12s\r\n", "Scenario", "Packets", "Bytes", "Bytes/sample", "Mismatches");
+    for (uint16_t i=0; i<sizeof(scenarios)/sizeof(scenarios[0]); i++)
+    {
+        /** <b>Local variable scenario_failures:</b> Number of operations of the current scenario that failed. */
+        int scenario_failures = run_scenario(&scenarios[i]);
+        printf("%-28s %8u %8u %14.2f %12u %s\r\n", scenarios[i].name, scenarios[i].packets, scenarios[i].bytes,
+               (double) scenarios[i].bytes / SIM_SAMPLE_COUNT, scenarios[i].mismatches, (scenario_failures == 0) ? "" : "(!)");
+        if (scenario_failures != 0)
+        {
+            failures++;
+        }
+    }
+
+    printf("%-28s %10s %10s\r\n", "Packet", "Expected", "Result");
+    for (uint16_t i=0; i<sizeof(checks)/sizeof(checks[0]); i++)
+    {
+        /** <b>Local variable ctx:</b> Context with which the packet is decoded. */
+        HM10_OTA_Delta_Context ctx;
+        /** <b>Local variable samples:</b> Decoded samples. */
+        int32_t samples[HM10_OTA_DELTA_MAX_SAMPLES];
+        /** <b>Local variable sample_count:</b> Number of decoded samples. */
+        uint8_t sample_count = 0;
+        init_hm10_ota_delta_context(&ctx, HM10_OTA_Delta_Difference, 1);
+        /** <b>Local variable ret:</b> Return value of a @ref HM10_Status function type. */
+        HM10_Status ret = decode_hm10_ota_delta_packet(&ctx, checks[i].packet, checks[i].packet_size, samples, &sample_count);
+        /** <b>Local variable is_ok:</b> Flag indicating whether the decoder gave the expected result (i.e., 1) or not (i.e., 0). */
+        uint8_t is_ok = (ret == checks[i].expected)
+                        && ((ret != HM10_EC_OK) || ((sample_count == 1) && (samples[0] == checks[i].expected_field)));
+        printf("%-28s %10s %10s %s\r\n", checks[i].name, (checks[i].expected == HM10_EC_OK) ? "decoded" : "rejected",
+               (ret == HM10_EC_OK) ? "decoded" : "rejected", is_ok ? "" : "(!)");
+        if (!is_ok)
+        {
+            failures++;
+        }
+    }
+    /** <b>Local variable truncation_failures:</b> Number of truncations of a valid packet that were not rejected. */
+    int truncation_failures = run_truncations();
+    printf("%-28s %10s %10s %s\r\n", "every truncation", "rejected", (truncation_failures == 0) ? "rejected" : "decoded",
+           (truncation_failures == 0) ? "" : "(!)");
+    if (truncation_failures != 0)
+    {
+        failures++;
+    }
+    printf("%d operation(s) failed.\r\n", failures);
+
+    return (failures == 0) ? 0 : 1;
+}
+
+static int32_t generate_field(Sim_Sample_Kind kind, uint16_t sample, uint8_t field)
+{
+    /** <b>Local variable extremes:</b> Values between which the fields of the @ref Sim_Extremes kind jump. */
+    static const int32_t extremes[] = {INT32_MIN, INT32_MAX, -1, 0, 1, INT32_MAX, INT32_MIN};
+    /** <b>Local variable hash:</b> Pseudo-random value of the field. */
+    uint32_t hash = ((uint32_t) sample*2654435761U) ^ ((uint32_t) field*40503U);
+    hash ^= hash >> 15;
+    hash *= 2246822519U;
+    hash ^= hash >> 13;
+
+    if ((kind == Sim_Large_Jumps) && (field == 0))
+    {
+        return (int32_t) hash;
+    }
+    switch (kind)
+    {
+        case Sim_Flags:
+            return (int32_t) (hash & 0x0F0FU);
+        case Sim_Extremes:
+            return extremes[(sample + 2*field) % (sizeof(extremes)/sizeof(extremes[0]))];
+        default:
+            return (int32_t) (1000*field + 3*sample + (hash % 7)) - 500;
+    }
+}
+
+static uint8_t decode_reference(HM10_OTA_Delta_Mode mode, uint8_t field_count, const uint32_t *reference, const uint8_t *packet,
+                                uint8_t packet_size, uint32_t *samples)
+{
+    /** <b>Local variable count:</b> Number of samples in the packet. */
+    uint8_t count = packet[2] & HM10_OTA_DELTA_COUNT_MASK;
+    /** <b>Local variable in:</b> Index of the next byte of the packet. */
+    uint8_t in = HM10_OTA_DELTA_HEADER_SIZE;
+
+    for (uint16_t v=0; v<(uint16_t) (count*field_count); v++)
+    {
+        /** <b>Local variable value:</b> Decoded varint. */
+        uint64_t value = 0;
+        /** <b>Local variable size:</b> Length in bytes of the varint. */
+        uint8_t size = 0;
+        do
+        {
+            if ((in >= packet_size) || (size == SIM_MAX_VARINT_SIZE))
+            {
+                return 0;
+            }
+            value |= ((uint64_t) (packet[in] & 0x7FU)) << (7*size);
+            size++;
+        }
+        while (packet[in++] & 0x80U);
+        if (value > UINT32_MAX)
+        {
+            return 0;
+        }
+        /** <b>Local variable previous:</b> Same field of the previous sample. */
+        uint32_t previous = (v < field_count) ? reference[v] : samples[v - field_count];
+        if (mode == HM10_OTA_Delta_XOR)
+        {
+            samples[v] = previous ^ (uint32_t) value;
+        }
+        else
+        {
+            samples[v] = previous + (((uint32_t) value >> 1) ^ (uint32_t) -(int32_t) (value & 1U));
+        }
+    }
+
+    return (in == packet_size) ? count : 0;
+}
+
+static int run_scenario(Sim_Scenario *p_scenario)
+{
+    /** <b>Local variable encoder:</b> Context of the encoder. */
+    HM10_OTA_Delta_Context encoder;
+    /** <b>Local variable decoder:</b> Context of the decoder. */
+    HM10_OTA_Delta_Context decoder;
+    /** <b>Local variable originals:</b> Fields of every sample of the scenario, one sample after the other. */
+    static int32_t originals[SIM_SAMPLE_COUNT*HM10_OTA_DELTA_MAX_FIELDS];
+    /** <b>Local variable decoded:</b> Samples decoded by the codec. */
+    int32_t decoded[HM10_OTA_DELTA_MAX_SAMPLES*HM10_OTA_DELTA_MAX_FIELDS];
+    /** <b>Local variable reference_decoded:</b> Samples decoded by the reference decoder. */
+    uint32_t reference_decoded[HM10_OTA_DELTA_MAX_SAMPLES*HM10_OTA_DELTA_MAX_FIELDS];
+    /** <b>Local variable reference:</b> Last sample of the last acknowledged packet, which is the reference of the next packet. */
+    uint32_t reference[HM10_OTA_DELTA_MAX_FIELDS] = {0};
+    /** <b>Local variable packet:</b> Encoded packet. */
+    uint8_t packet[HM10_OTA_DELTA_PACKET_SIZE];
+    /** <b>Local variable packet_size:</b> Length in bytes of the encoded packet. */
+    uint8_t packet_size;
+    /** <b>Local variable encoded_samples:</b> Number of samples that were encoded into the packet. */
+    uint8_t encoded_samples;
+    /** <b>Local variable sample_count:</b> Number of samples that the codec decoded from the packet. */
+    uint8_t sample_count;
+    /** <b>Local variable field_count:</b> Number of fields of each sample. */
+    uint8_t field_count = p_scenario->field_count;
+    /** <b>Local variable failures:</b> Number of operations that failed. */
+    int failures = 0;
+    for (uint16_t s=0; s<SIM_SAMPLE_COUNT; s++)
+    {
+        for (uint8_t f=0; f<field_count; f++)
+        {
+            originals[s*field_count + f] = generate_field(p_scenario->kind, s, f);
+        }
+    }
+    if ((init_hm10_ota_delta_context(&encoder, p_scenario->mode, field_count) != HM10_EC_OK)
+        || (init_hm10_ota_delta_context(&decoder, p_scenario->mode, field_count) != HM10_EC_OK))
+    {
+        return 1;
+    }
+
+    /* Encode, decode in both ways and acknowledge one packet at a time. */
+    for (uint16_t s=0; s<SIM_SAMPLE_COUNT; s+=encoded_samples)
+    {
+        if (encode_hm10_ota_delta_packet(&encoder, &originals[s*field_count], SIM_SAMPLE_COUNT - s, packet, &packet_size,
+                                         &encoded_samples) != HM10_EC_OK)
+        {
+            return failures + 1;
+        }
+        p_scenario->packets++;
+        p_scenario->bytes += packet_size;
+        if ((decode_hm10_ota_delta_packet(&decoder, packet, packet_size, decoded, &sample_count) != HM10_EC_OK)
+            || (sample_count != encoded_samples)
+            || (decode_reference(p_scenario->mode, field_count, reference, packet, packet_size, reference_decoded) != encoded_samples))
+        {
+            p_scenario->mismatches += encoded_samples;
+            failures++;
+            continue;
+        }
+        for (uint8_t i=0; i<encoded_samples; i++)
+        {
+            if ((memcmp(&decoded[i*field_count], &originals[(s+i)*field_count], field_count*sizeof(int32_t)) != 0)
+                || (memcmp(&reference_decoded[i*field_count], &originals[(s+i)*field_count], field_count*sizeof(int32_t)) != 0))
+            {
+                p_scenario->mismatches++;
+                failures++;
+            }
+        }
+        if (acknowledge_hm10_ota_delta_packet(&encoder, packet[0]) != HM10_EC_OK)
+        {
+            failures++;
+        }
+        memcpy(reference, &originals[(s+encoded_samples-1)*field_count], field_count*sizeof(uint32_t));
+    }
+
+    return failures;
+}
+
+static int run_truncations(void)
+{
+    /** <b>Local variable encoder:</b> Context of the encoder. */
+    HM10_OTA_Delta_Context encoder;
+    /** <b>Local variable decoder:</b> Context of the decoder. */
+    HM10_OTA_Delta_Context decoder;
+    /** <b>Local variable originals:</b> Fields of the samples, whose longest varints make the packet end at several varint boundaries. */
+    int32_t originals[HM10_OTA_DELTA_MAX_SAMPLES*3];
+    /** <b>Local variable decoded:</b> Decoded samples. */
+    int32_t decoded[HM10_OTA_DELTA_MAX_SAMPLES*3];
+    /** <b>Local variable packet:</b> Encoded packet. */
+    uint8_t packet[HM10_OTA_DELTA_PACKET_SIZE];
+    /** <b>Local variable packet_size:</b> Length in bytes of the encoded packet. */
+    uint8_t packet_size;
+    /** <b>Local variable encoded_samples:</b> Number of samples that were encoded into the packet. */
+    uint8_t encoded_samples;
+    /** <b>Local variable sample_count:</b> Number of decoded samples. */
+    uint8_t sample_count;
+    /** <b>Local variable failures:</b> Number of truncations that were not rejected. */
+    int failures = 0;
+    for (uint16_t s=0; s<HM10_OTA_DELTA_MAX_SAMPLES; s++)
+    {
+        for (uint8_t f=0; f<3; f++)
+        {
+            originals[s*3 + f] = generate_field((s == 0) ? Sim_Small_Steps : Sim_Extremes, s, f);
+        }
+    }
+    init_hm10_ota_delta_context(&encoder, HM10_OTA_Delta_Difference, 3);
+    if (encode_hm10_ota_delta_packet(&encoder, originals, HM10_OTA_DELTA_MAX_SAMPLES, packet, &packet_size, &encoded_samples) != HM10_EC_OK)
+    {
+        return 1;
+    }
+
+    /* Every length from the bare Packet Header up to one byte short of the whole packet must be rejected. */
+    for (uint8_t size=HM10_OTA_DELTA_HEADER_SIZE; size<packet_size; size++)
+    {
+        init_hm10_ota_delta_context(&decoder, HM10_OTA_Delta_Difference, 3);
+        if (decode_hm10_ota_delta_packet(&decoder, packet, size, decoded, &sample_count) != HM10_EC_ERR)
+        {
+            failures++;
+        }
+    }
+    /* The whole packet must still be decoded. */
+    init_hm10_ota_delta_context(&decoder, HM10_OTA_Delta_Difference, 3);
+    if ((decode_hm10_ota_delta_packet(&decoder, packet, packet_size, decoded, &sample_count) != HM10_EC_OK)
+        || (sample_count != encoded_samples) || (memcmp(decoded, originals, encoded_samples*3*sizeof(int32_t)) != 0))
+    {
+        failures++;
+    }
+
+    return failures;
+}
+
+/** @} */
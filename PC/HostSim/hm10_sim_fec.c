@@ -0,0 +1,186 @@
+/** @addtogroup hm10_sim
+ * @{
+ */
+
+/**@file
+ * @brief	HM-10 OTA Forward Error Correction Loss Harness.
+ *
+ * @details The Peripheral sends a fixed number of data packets through the @ref hm10_ota_fec to the Central over the
+ *          simulated link of the @ref hm10_sim at 9600 baud (i.e., the default baud rate of the HM-10 BT Device), for
+ *          several loss probabilities of the link and for several numbers of data packets (i.e., k) and parity packets
+ *          (i.e., m) per group, where the groups without parity packets are the reference of what is lost without FEC.
+ *          The Central checks that every data packet that it gets is delivered intact and in order, and reports how
+ *          many of them were delivered, how many of those were rebuilt from the parity packets, how many were lost and
+ *          the goodput (i.e., the application bytes delivered per second) from the start of the run until the last
+ *          data packet was delivered. Since no data packet is ever retransmitted, the lost ones are the residual loss
+ *          that the application would see.
+ *
+ * @author 	Cesar Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026.
+ */
+
+#include <stdio.h>	// Library from which "printf()" is located at.
+#include <string.h>	// Library from which "memcmp()" is located at.
+#include "hm10_sim.h" // HM-10 Host Simulation.
+#include "../Inc/hm10_ble_driver.h" // Custom Mortrack's Library to be able to initialize, send configuration commands and send and/or receive data to/from an HM-10 Bluetooth Device.
+#include "../Inc/hm10_ota_fec.h" // Custom Mortrack's Library to rebuild the packets that are lost Over the Air via the HM-10 Bluetooth Device.
+
+#define SIM_BAUD_RATE               (9600U)     /**< @brief Baud rate of the simulated link, which is the default one of the HM-10 BT Device. */
+#define SIM_LATENCY_US              (15000U)    /**< @brief One-way latency in microseconds of the simulated link (i.e., about two Connection Intervals). */
+#define SIM_POLL_DELAY_US           (200000U)   /**< @brief Poll Delay in microseconds of both ends of the simulated link. */
+#define SIM_PACKET_COUNT            (96U)       /**< @brief Number of data packets that are sent on each scenario. */
+#define SIM_MAX_SILENT_POLLS        (2U)        /**< @brief Number of consecutive timeouts after which the Central stops waiting for data packets. */
+
+/**@brief	Scenario of the harness.
+ */
+typedef struct {
+    uint16_t loss;              //!< Probability of dropping each packet (see @ref HM10_Sim_Link_Config ).
+    uint8_t data_shards;        //!< Number of data packets (i.e., k) of each group.
+    uint8_t parity_shards;      //!< Number of parity packets (i.e., m) of each group.
+    uint16_t delivered;         //!< Number of data packets that the Central got.
+    uint16_t mismatches;        //!< Number of data packets that the Central got either corrupted or out of order.
+    uint64_t time_us;           //!< Time in microseconds, since the start of the run, at which the Central got its last data packet.
+    HM10_OTA_FEC_Stats stats;   //!< Statistics of the @ref hm10_ota_fec of the Central.
+} Sim_Scenario;
+
+/**@brief	Fills a data packet with a pattern that depends on its index, whose first two bytes are the index itself.
+ *
+ * @param[out] data Pointer to the Memory Address into which the data packet will be stored.
+ * @param index     Index of the data packet.
+ */
+static void fill_packet(uint8_t *data, uint16_t index);
+
+/**@brief	Receives and checks the data packets of a scenario (see @ref HM10_Sim_Peer ).
+ */
+static int run_central(void *arg);
+
+/**@brief	Sends the data packets of a scenario (see @ref HM10_Sim_Peer ).
+ */
+static int run_peripheral(void *arg);
+
+int main(void)
+{
+    /** <b>Local variable losses:</b> Probabilities of dropping each packet of each scenario (see @ref HM10_Sim_Link_Config ). */
+    static const uint16_t losses[] = {0, 100, 300, 500};
+    /** <b>Local variable codes:</b> Number of data and parity packets per group of each scenario. */
+    static const uint8_t codes[][2] = {{8, 0}, {8, 1}, {8, 2}, {4, 2}};
+    /** <b>Local variable failures:</b> Number of scenarios that did not succeed. */
+    int failures = 0;
+
+    printf("HM-10 OTA Forward Error Correction of %u data packets of %u bytes over a simulated link at %u baud with a one-way latency of %u us (line rate = %u B/s).\r\n",
+           SIM_PACKET_COUNT, HM10_OTA_FEC_MAX_DATA_SIZE, SIM_BAUD_RATE, SIM_LATENCY_US, SIM_BAUD_RATE/10);
+    printf("%-9s %4s %4s %13s %10s %10s %6s %12s %14s\r\n", "Loss [%]", "k", "m", "Overhead [%]", "Delivered", "Recovered", "Lost",
+           "Time [ms]", "Goodput [B/s]");
+    for (uint16_t l=0; l<sizeof(losses)/sizeof(losses[0]); l++)
+    {
+        for (uint16_t c=0; c<sizeof(codes)/sizeof(codes[0]); c++)
+        {
+            /** <b>Local variable config:</b> Configuration of the simulated link. */
+            HM10_Sim_Link_Config config = {SIM_BAUD_RATE, SIM_LATENCY_US, SIM_POLL_DELAY_US, losses[l], 0, 0, 0, l*16 + c + 1, 0};
+            /** <b>Local variable scenario:</b> Current scenario. */
+            Sim_Scenario scenario = {losses[l], codes[c][0], codes[c][1], 0, 0, 0, {0}};
+            /** <b>Local variable scenario_failures:</b> Number of operations of the current scenario that failed. */
+            int scenario_failures = run_hm10_sim_link(&config, run_central, run_peripheral, &scenario);
+            printf("%-9.1f %4u %4u %13.1f %10u %10u %6u %12.1f %14.1f %s\r\n", losses[l]/100.0, scenario.data_shards,
+                   scenario.parity_shards, 100.0*scenario.parity_shards/scenario.data_shards, scenario.delivered,
+                   scenario.stats.data_packets_recovered, SIM_PACKET_COUNT - scenario.delivered, scenario.time_us/1e3,
+                   (scenario.time_us > 0) ? scenario.delivered*HM10_OTA_FEC_MAX_DATA_SIZE*1e6/scenario.time_us : 0.0,
+                   (scenario_failures == 0) ? "" : "(!)");
+            if (scenario_failures != 0)
+            {
+                failures++;
+            }
+        }
+    }
+    printf("%d operation(s) failed.\r\n", failures);
+
+    return (failures == 0) ? 0 : 1;
+}
+
+static void fill_packet(uint8_t *data, uint16_t index)
+{
+    data[0] = (uint8_t) index;
+    data[1] = (uint8_t) (index >> 8);
+    for (uint8_t i=2; i<HM10_OTA_FEC_MAX_DATA_SIZE; i++)
+    {
+        data[i] = (uint8_t) (index*31 + i*7);
+    }
+}
+
+static int run_central(void *arg)
+{
+    /** <b>Local variable p_scenario:</b> Pointer to the current scenario. */
+    Sim_Scenario *p_scenario = (Sim_Scenario *) arg;
+    if (init_hm10_ota_fec(p_scenario->data_shards, p_scenario->parity_shards) != HM10_EC_OK)
+    {
+        return 1;
+    }
+
+    /* Receive until nothing else arrives for a while, checking that the data packets are intact and in order. */
+    /** <b>Local variable data:</b> Buffer of the received data packet. */
+    uint8_t data[HM10_OTA_FEC_MAX_DATA_SIZE];
+    /** <b>Local variable expected:</b> Buffer of the expected data packet. */
+    uint8_t expected[HM10_OTA_FEC_MAX_DATA_SIZE];
+    /** <b>Local variable size:</b> Length in bytes of the received data packet. */
+    uint8_t size;
+    /** <b>Local variable next_index:</b> Lowest index that the next received data packet may have. */
+    uint16_t next_index = 0;
+    /** <b>Local variable silent_polls:</b> Number of consecutive timeouts. */
+    uint8_t silent_polls = 0;
+    /** <b>Local variable start_time:</b> Time in microseconds at which the run started. */
+    uint64_t start_time = get_hm10_sim_time_us();
+    while (silent_polls < SIM_MAX_SILENT_POLLS)
+    {
+        if (get_hm10_ota_fec_data(data, &size) != HM10_EC_OK)
+        {
+            silent_polls++;
+            continue;
+        }
+        silent_polls = 0;
+        p_scenario->time_us = get_hm10_sim_time_us() - start_time;
+        p_scenario->delivered++;
+        /** <b>Local variable index:</b> Index of the received data packet. */
+        uint16_t index = (uint16_t) (data[0] | (data[1] << 8));
+        fill_packet(expected, index);
+        if ((size!=HM10_OTA_FEC_MAX_DATA_SIZE) || (index<next_index) || (index>=SIM_PACKET_COUNT)
+            || (memcmp(data, expected, HM10_OTA_FEC_MAX_DATA_SIZE)!=0))
+        {
+            p_scenario->mismatches++;
+            continue;
+        }
+        next_index = index + 1;
+    }
+    get_hm10_ota_fec_stats(&p_scenario->stats);
+
+    /* Every data packet must be delivered intact and in order, and none may be lost over a clean link. */
+    if (p_scenario->mismatches != 0)
+    {
+        return p_scenario->mismatches;
+    }
+    return ((p_scenario->loss!=0) || (p_scenario->delivered==SIM_PACKET_COUNT)) ? 0 : 1;
+}
+
+static int run_peripheral(void *arg)
+{
+    /** <b>Local variable p_scenario:</b> Pointer to the current scenario. */
+    Sim_Scenario *p_scenario = (Sim_Scenario *) arg;
+    if (init_hm10_ota_fec(p_scenario->data_shards, p_scenario->parity_shards) != HM10_EC_OK)
+    {
+        return 1;
+    }
+
+    /** <b>Local variable data:</b> Buffer of the data packet that is sent. */
+    uint8_t data[HM10_OTA_FEC_MAX_DATA_SIZE];
+    for (uint16_t i=0; i<SIM_PACKET_COUNT; i++)
+    {
+        fill_packet(data, i);
+        if (send_hm10_ota_fec_data(data, HM10_OTA_FEC_MAX_DATA_SIZE) != HM10_EC_OK)
+        {
+            return 1;
+        }
+    }
+
+    return (flush_hm10_ota_fec() == HM10_EC_OK) ? 0 : 1;
+}
+
+/** @} */
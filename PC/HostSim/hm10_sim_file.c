@@ -0,0 +1,236 @@
+/** @addtogroup hm10_sim
+ * @{
+ */
+
+/**@file
+ * @brief	HM-10 OTA File Transfer Harness.
+ *
+ * @details The Central sends a file through the @ref hm10_ota_file to the Peripheral over the simulated link of the
+ *          @ref hm10_sim at 9600 baud (i.e., the default baud rate of the HM-10 BT Device) with the default block size
+ *          of that module, whose blocks take longer to go through the line than the Poll Delay of both ends. The
+ *          following scenarios are run in order, each of them on the files that the previous one left behind:<br><br>
+ *          - A transfer over a clean link.<br>
+ *          - A transfer over a link that drops and corrupts some of its packets.<br>
+ *          - A transfer whose Bluetooth Connection gets lost half way, which is expected to fail on both ends.<br>
+ *          - A transfer that resumes the previous one from the Checkpoint Files of both ends.<br>
+ *          - A transfer whose sender did not get the final ACK frame of the previous one (i.e., whose Checkpoint File
+ *            still points to the last block), which is expected to send that block only.<br><br>
+ *          For each scenario, the time that the transfer took, the bytes that the sender sent through the line and the
+ *          result of both ends are reported, and the received file is compared against the sent one.
+ *
+ * @author 	Cesar Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026.
+ */
+
+#include <stdio.h>	// Library from which "printf()", "fopen()", "fread()", "fwrite()" and "remove()" are located at.
+#include <string.h>	// Library from which "memcmp()" is located at.
+#include "hm10_sim.h" // HM-10 Host Simulation.
+#include "../Inc/hm10_config.h" // Custom Library for the HM-10 Driver Library.
+#include "../Inc/hm10_ble_driver.h" // Custom Mortrack's Library to be able to initialize, send configuration commands and send and/or receive data to/from an HM-10 Bluetooth Device.
+#include "../Inc/hm10_crc32c.h" // Custom Mortrack's Library to calculate the CRC32C of the data sent and received Over the Air.
+#include "../Inc/hm10_ota_file.h" // Custom Mortrack's Library to send and receive files Over the Air via the HM-10 Bluetooth Device.
+
+#define SIM_BAUD_RATE               (9600U)     /**< @brief Baud rate of the simulated link, which is the default one of the HM-10 BT Device. */
+#define SIM_LATENCY_US              (15000U)    /**< @brief One-way latency in microseconds of the simulated link (i.e., about two Connection Intervals). */
+#define SIM_POLL_DELAY_US           (500000U)   /**< @brief Poll Delay in microseconds of both ends of the simulated link. */
+#define SIM_FILE_SIZE               (4*HM10_OTA_FILE_BLOCK_SIZE + 100U) /**< @brief Length in bytes of the file that is sent. */
+#define SIM_SOURCE_PATH             "hm10_sim_file_source.bin"      /**< @brief Path of the file that is sent. */
+#define SIM_RECEIVED_PATH           "hm10_sim_file_received.bin"    /**< @brief Path of the file that is received. */
+#define SIM_SENDER_CHECKPOINT       "hm10_sim_file_sender.ckpt"     /**< @brief Path of the Checkpoint File of the sender. */
+#define SIM_RECEIVER_CHECKPOINT     "hm10_sim_file_receiver.ckpt"   /**< @brief Path of the Checkpoint File of the receiver. */
+
+/**@brief	Scenario of the harness.
+ */
+typedef struct {
+    const char *name;           //!< Name of the scenario.
+    uint16_t loss;              //!< Probability of dropping each packet (see @ref HM10_Sim_Link_Config ).
+    uint16_t corruption;        //!< Probability of flipping one bit of each packet (see @ref HM10_Sim_Link_Config ).
+    uint32_t cut_time_us;       //!< Time after which the Bluetooth Connection is lost (see @ref HM10_Sim_Link_Config ).
+    uint8_t is_fresh;           //!< Flag indicating whether the files of the previous scenario are deleted first (i.e., 1) or not (i.e., 0).
+    uint8_t is_final_ack_lost;  //!< Flag indicating whether the Checkpoint File of the sender is rewritten to point to the last block first (i.e., 1) or not (i.e., 0).
+    uint8_t is_success_expected;//!< Flag indicating whether both ends are expected to succeed (i.e., 1) or to fail (i.e., 0).
+    HM10_Status sender_status;  //!< Value that the @ref send_hm10_ota_file function returned.
+    uint64_t time_us;           //!< Time in microseconds that the Central measured until the transfer ended.
+    uint32_t bytes_on_line;     //!< Bytes that the Central sent through the line.
+} Sim_Scenario;
+
+static uint8_t file_data[SIM_FILE_SIZE];       /**< @brief Content of the file that is sent. */
+static uint8_t received_data[SIM_FILE_SIZE+1]; /**< @brief Content of the file that is received. */
+
+/**@brief	Writes the file that is sent, whose content is a pseudo-random pattern.
+ *
+ * @return  0 if the file was written, or 1 otherwise.
+ */
+static int write_source_file(void);
+
+/**@brief	Rewrites the Checkpoint File of the sender so that it points to the last block of the file.
+ *
+ * @return  0 if the Checkpoint File was written, or 1 otherwise.
+ */
+static int write_last_block_checkpoint(void);
+
+/**@brief	Compares the received file against the sent one.
+ *
+ * @return  0 if both files are equal, or 1 otherwise.
+ */
+static int compare_received_file(void);
+
+/**@brief	Sends the file and checks the result of the transfer against the expected one (see @ref HM10_Sim_Peer ).
+ */
+static int run_central(void *arg);
+
+/**@brief	Receives the file and checks the result of the transfer against the expected one (see @ref HM10_Sim_Peer ).
+ */
+static int run_peripheral(void *arg);
+
+int main(void)
+{
+    /** <b>Local variable scenarios:</b> Scenarios of the harness, in the order in which they are run. */
+    static Sim_Scenario scenarios[] = {
+        {"Clean link",              0,  0,  0,          1, 0, 1, HM10_EC_OK, 0, 0},
+        {"0.3% loss+corruption",    30, 30, 0,          1, 0, 1, HM10_EC_OK, 0, 0},
+        {"Connection lost at 2.5s", 0,  0,  2500000U,   1, 0, 0, HM10_EC_OK, 0, 0},
+        {"Resumed transfer",        0,  0,  0,          0, 0, 1, HM10_EC_OK, 0, 0},
+        {"Final ACK lost",          0,  0,  0,          0, 1, 1, HM10_EC_OK, 0, 0}
+    };
+    /** <b>Local variable failures:</b> Number of scenarios that did not end as expected. */
+    int failures = 0;
+
+    if (write_source_file() != 0)
+    {
+        printf("ERROR: The file \"%s\" could not be written.\r\n", SIM_SOURCE_PATH);
+        return 1;
+    }
+    printf("HM-10 OTA File Transfer of %u bytes in blocks of %u bytes over a simulated link at %u baud (line rate = %u B/s).\r\n",
+           SIM_FILE_SIZE, HM10_OTA_FILE_BLOCK_SIZE, SIM_BAUD_RATE, SIM_BAUD_RATE/10);
+    printf("%-26s %12s %12s %8s %8s\r\n", "Scenario", "Time [ms]", "Line bytes", "Sender", "Result");
+    for (uint16_t i=0; i<sizeof(scenarios)/sizeof(scenarios[0]); i++)
+    {
+        /** <b>Local variable p_scenario:</b> Pointer to the current scenario. */
+        Sim_Scenario *p_scenario = &scenarios[i];
+        /** <b>Local variable config:</b> Configuration of the simulated link. */
+        HM10_Sim_Link_Config config = {SIM_BAUD_RATE, SIM_LATENCY_US, SIM_POLL_DELAY_US, p_scenario->loss, p_scenario->corruption, 0, 0, i+1, p_scenario->cut_time_us};
+        /** <b>Local variable scenario_failures:</b> Number of operations of the current scenario that failed. */
+        int scenario_failures = 0;
+
+        if (p_scenario->is_fresh)
+        {
+            remove(SIM_RECEIVED_PATH);
+            remove(SIM_SENDER_CHECKPOINT);
+            remove(SIM_RECEIVER_CHECKPOINT);
+        }
+        if (p_scenario->is_final_ack_lost)
+        {
+            scenario_failures += write_last_block_checkpoint();
+        }
+        scenario_failures += run_hm10_sim_link(&config, run_central, run_peripheral, p_scenario);
+        if (p_scenario->is_success_expected)
+        {
+            scenario_failures += compare_received_file();
+        }
+        printf("%-26s %12.1f %12u %8d %8s\r\n", p_scenario->name, p_scenario->time_us/1e3, p_scenario->bytes_on_line,
+               p_scenario->sender_status, (scenario_failures == 0) ? "ok" : "(!)");
+        if (scenario_failures != 0)
+        {
+            failures++;
+        }
+    }
+    remove(SIM_SOURCE_PATH);
+    remove(SIM_RECEIVED_PATH);
+    remove(SIM_SENDER_CHECKPOINT);
+    remove(SIM_RECEIVER_CHECKPOINT);
+    printf("%d operation(s) failed.\r\n", failures);
+
+    return (failures == 0) ? 0 : 1;
+}
+
+static int write_source_file(void)
+{
+    /** <b>Local variable state:</b> State of the pseudo-random pattern. */
+    uint32_t state = 0x12345678U;
+    for (uint32_t i=0; i<SIM_FILE_SIZE; i++)
+    {
+        state = state*1664525U + 1013904223U;
+        file_data[i] = (uint8_t) (state >> 24);
+    }
+    /** <b>Local variable p_file:</b> Stream of the file that is sent. */
+    FILE *p_file = fopen(SIM_SOURCE_PATH, "wb");
+    if (p_file == NULL)
+    {
+        return 1;
+    }
+    /** <b>Local variable is_written:</b> Flag indicating whether the whole file was written (i.e., 1) or not (i.e., 0). */
+    int is_written = (fwrite(file_data, 1, SIM_FILE_SIZE, p_file) == SIM_FILE_SIZE);
+
+    return ((fclose(p_file)==0) && is_written) ? 0 : 1;
+}
+
+static int write_last_block_checkpoint(void)
+{
+    /** <b>Local variable checkpoint:</b> Content of the Checkpoint File of the sender. */
+    HM10_OTA_File_Checkpoint checkpoint;
+    checkpoint.magic = HM10_OTA_FILE_CHECKPOINT_MAGIC;
+    checkpoint.version = HM10_OTA_FILE_CHECKPOINT_VERSION;
+    checkpoint.reserved = 0;
+    checkpoint.file_size = SIM_FILE_SIZE;
+    checkpoint.file_crc = calculate_hm10_crc32c(file_data, SIM_FILE_SIZE);
+    checkpoint.confirmed_offset = SIM_FILE_SIZE - (SIM_FILE_SIZE%HM10_OTA_FILE_BLOCK_SIZE);
+
+    /** <b>Local variable p_file:</b> Stream of the Checkpoint File of the sender. */
+    FILE *p_file = fopen(SIM_SENDER_CHECKPOINT, "wb");
+    if (p_file == NULL)
+    {
+        return 1;
+    }
+    /** <b>Local variable is_written:</b> Flag indicating whether the whole Checkpoint File was written (i.e., 1) or not (i.e., 0). */
+    int is_written = (fwrite(&checkpoint, sizeof(checkpoint), 1, p_file) == 1);
+
+    return ((fclose(p_file)==0) && is_written) ? 0 : 1;
+}
+
+static int compare_received_file(void)
+{
+    /** <b>Local variable p_file:</b> Stream of the file that was received. */
+    FILE *p_file = fopen(SIM_RECEIVED_PATH, "rb");
+    if (p_file == NULL)
+    {
+        return 1;
+    }
+    /** <b>Local variable size:</b> Length in bytes of the file that was received. */
+    size_t size = fread(received_data, 1, sizeof(received_data), p_file);
+    fclose(p_file);
+
+    return ((size==SIM_FILE_SIZE) && (memcmp(received_data, file_data, SIM_FILE_SIZE)==0)) ? 0 : 1;
+}
+
+static int run_central(void *arg)
+{
+    /** <b>Local variable p_scenario:</b> Pointer to the current scenario. */
+    Sim_Scenario *p_scenario = (Sim_Scenario *) arg;
+    /** <b>Local variable start_time:</b> Time in microseconds at which the transfer started. */
+    uint64_t start_time = get_hm10_sim_time_us();
+    p_scenario->sender_status = send_hm10_ota_file(SIM_SOURCE_PATH, SIM_SENDER_CHECKPOINT);
+    p_scenario->time_us = get_hm10_sim_time_us() - start_time;
+    /** <b>Local variable link_stats:</b> Statistics of the simulated link. */
+    HM10_Sim_Link_Stats link_stats;
+    get_hm10_sim_link_stats(&link_stats);
+    p_scenario->bytes_on_line = link_stats.bytes_sent;
+
+    /* A resumed transfer must not send again the blocks that were already confirmed. */
+    if ((!p_scenario->is_fresh) && (link_stats.bytes_sent>=SIM_FILE_SIZE))
+    {
+        return 1;
+    }
+
+    return ((p_scenario->sender_status == HM10_EC_OK) == p_scenario->is_success_expected) ? 0 : 1;
+}
+
+static int run_peripheral(void *arg)
+{
+    /** <b>Local variable p_scenario:</b> Pointer to the current scenario. */
+    Sim_Scenario *p_scenario = (Sim_Scenario *) arg;
+
+    return ((receive_hm10_ota_file(SIM_RECEIVED_PATH, SIM_RECEIVER_CHECKPOINT) == HM10_EC_OK) == p_scenario->is_success_expected) ? 0 : 1;
+}
+
+/** @} */
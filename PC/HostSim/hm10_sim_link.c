@@ -0,0 +1,332 @@
+/** @addtogroup hm10_sim
+ * @{
+ */
+
+/**@file
+ * @brief	HM-10 Host Simulation Link.
+ *
+ * @details Implements the functions of the Teuniz RS-232 Library that the @ref hm10_ble uses over a simulated link
+ *          between two processes (see @ref hm10_sim ). Each packet travels through an \c AF_UNIX \c SOCK_SEQPACKET
+ *          socket along with the time at which it becomes available to the receiver, which keeps the packets that are
+ *          still in flight and hands out their bytes in the order of those times.
+ *
+ * @author 	Cesar Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026.
+ */
+
+#include <stdio.h>	// Library from which "printf()" and "fflush()" are located at.
+#include <stdlib.h> // Library from which "exit()" and "rand_r()" are located at.
+#include <string.h>	// Library from which "memcpy()" and "memmove()" are located at.
+#include <time.h> // Library from which "clock_gettime()" is located at.
+#include <unistd.h> // Library from which "fork()", "close()" and "usleep()" are located at.
+#include <sys/socket.h> // Library from which "socketpair()", "send()" and "recv()" are located at.
+#include <sys/wait.h> // Library from which "waitpid()" is located at.
+#include "hm10_sim.h" // HM-10 Host Simulation.
+#include "../Inc/hm10_ble_driver.h" // Custom Mortrack's Library to be able to initialize, send configuration commands and send and/or receive data to/from an HM-10 Bluetooth Device.
+#include "../RS232/rs232.h" // Library for using RS232 protocol, which is implemented here over the simulated link.
+
+#define SIM_PROBABILITY_SCALE       (10000U)    /**< @brief Value of a probability of 1 in @ref HM10_Sim_Link_Config . */
+
+/**@brief	Packet that travels through the simulated link.
+ */
+typedef struct {
+    uint64_t available_time;                //!< Time in microseconds at which the packet becomes available to the receiver.
+    uint8_t size;                           //!< Length in bytes of the packet.
+    uint8_t offset;                         //!< Number of bytes of the packet that the receiver has already read.
+    uint8_t data[HM10_MAX_PACKET_SIZE];     //!< Bytes of the packet.
+} Sim_Packet;
+
+static HM10_Sim_Link_Config link_config;                        /**< @brief Configuration of the simulated link. */
+static HM10_Sim_Link_Stats link_stats;                          /**< @brief Statistics of the current end of the simulated link. */
+static int link_socket = -1;                                    /**< @brief Socket of the current end of the simulated link. */
+static unsigned int link_seed;                                  /**< @brief State of the pseudo-random generator of the current end of the simulated link. */
+static uint64_t link_start_time;                                /**< @brief Time in microseconds at which the current run of the simulated link started. */
+static uint64_t line_free_time;                                 /**< @brief Time in microseconds at which the transmit buffer of the current end will have been drained. */
+static Sim_Packet pending_packets[HM10_SIM_MAX_PENDING_PACKETS]; /**< @brief Packets that have been received from the socket but that have not been completely read yet. */
+static uint16_t pending_count;                                  /**< @brief Number of packets in @ref pending_packets . */
+
+/**@brief	Indicates whether an event with a certain probability happens.
+ *
+ * @param probability   Probability of the event, in parts per ten thousand.
+ *
+ * @return  1 if the event happens, or 0 otherwise.
+ */
+static int happens(uint16_t probability);
+
+/**@brief	Gets the time in microseconds that a certain number of bytes take on the line.
+ *
+ * @param size  Number of bytes.
+ *
+ * @return  The time in microseconds, or 0 if the line has no rate limit.
+ */
+static uint64_t get_line_time_us(uint32_t size);
+
+/**@brief	Queues a packet into the transmit buffer and sends it through the socket, unless it gets dropped.
+ *
+ * @param[in] data  Pointer to the bytes of the packet.
+ * @param size      Length in bytes of the packet.
+ */
+static void send_packet(uint8_t *data, uint8_t size);
+
+/**@brief	Moves all the packets that are waiting in the socket into @ref pending_packets .
+ */
+static void receive_packets(void);
+
+int run_hm10_sim_link(const HM10_Sim_Link_Config *config, HM10_Sim_Peer central, HM10_Sim_Peer peripheral, void *arg)
+{
+    /** <b>Local variable sockets:</b> Sockets of both ends of the simulated link. */
+    int sockets[2];
+    if (socketpair(AF_UNIX, SOCK_SEQPACKET, 0, sockets) != 0)
+    {
+        perror("socketpair");
+        return 1;
+    }
+    link_config = *config;
+    link_start_time = get_hm10_sim_time_us();
+    memset(&link_stats, 0, sizeof(link_stats));
+    line_free_time = 0;
+    pending_count = 0;
+
+    /* Run the Peripheral in a child process and the Central in this one. */
+    fflush(stdout);
+    /** <b>Local variable pid:</b> Process ID of the Peripheral. */
+    pid_t pid = fork();
+    if (pid < 0)
+    {
+        perror("fork");
+        close(sockets[0]);
+        close(sockets[1]);
+        return 1;
+    }
+    /** <b>Local variable failures:</b> Number of operations that failed. */
+    int failures;
+    if (pid == 0)
+    {
+        close(sockets[0]);
+        link_socket = sockets[1];
+        link_seed = config->seed*2 + 1;
+        init_hm10_module(HM10_SIM_COMPORT, 0, config->poll_delay_us, 0);
+        failures = peripheral(arg);
+        fflush(stdout);
+        exit((failures > 255) ? 255 : failures);
+    }
+    close(sockets[1]);
+    link_socket = sockets[0];
+    link_seed = config->seed*2;
+    init_hm10_module(HM10_SIM_COMPORT, 0, config->poll_delay_us, 0);
+    failures = central(arg);
+
+    /* Wait for the Peripheral and add its failures to the ones of the Central. */
+    /** <b>Local variable status:</b> Exit status of the Peripheral. */
+    int status;
+    if ((waitpid(pid, &status, 0)!=pid) || (!WIFEXITED(status)))
+    {
+        failures++;
+    }
+    else
+    {
+        failures += WEXITSTATUS(status);
+    }
+    close(link_socket);
+    link_socket = -1;
+
+    return failures;
+}
+
+void get_hm10_sim_link_stats(HM10_Sim_Link_Stats *stats)
+{
+    *stats = link_stats;
+}
+
+uint64_t get_hm10_sim_time_us()
+{
+    /** <b>Local variable current_time:</b> Current time of the monotonic clock of our host machine. */
+    struct timespec current_time;
+    clock_gettime(CLOCK_MONOTONIC, &current_time);
+
+    return ((uint64_t) current_time.tv_sec)*1000000U + ((uint64_t) current_time.tv_nsec)/1000U;
+}
+
+int RS232_OpenComport(int comport_number, int baudrate, const char *mode, int flowctrl)
+{
+    (void) comport_number;
+    (void) baudrate;
+    (void) mode;
+    (void) flowctrl;
+    return 0;
+}
+
+int RS232_PollComport(int comport_number, unsigned char *buf, int size)
+{
+    (void) comport_number;
+    receive_packets();
+
+    /* Hand out the bytes of the available packets in the order in which they became available. */
+    /** <b>Local variable current_time:</b> Current time in microseconds. */
+    uint64_t current_time = get_hm10_sim_time_us();
+    /** <b>Local variable received:</b> Number of bytes that have been handed out. */
+    int received = 0;
+    while (received < size)
+    {
+        /** <b>Local variable next:</b> Index of the packet that became available first. */
+        int next = -1;
+        for (int i=0; i<pending_count; i++)
+        {
+            if ((pending_packets[i].available_time<=current_time) && ((next<0) || (pending_packets[i].available_time<pending_packets[next].available_time)))
+            {
+                next = i;
+            }
+        }
+        if (next < 0)
+        {
+            break;
+        }
+        /** <b>Local variable p_packet:</b> Pointer to the packet that became available first. */
+        Sim_Packet *p_packet = &pending_packets[next];
+        /** <b>Local variable chunk:</b> Number of bytes that are handed out from that packet. */
+        int chunk = p_packet->size - p_packet->offset;
+        if (chunk > (size-received))
+        {
+            chunk = size - received;
+        }
+        memcpy(&buf[received], &p_packet->data[p_packet->offset], chunk);
+        received += chunk;
+        p_packet->offset += chunk;
+        if (p_packet->offset == p_packet->size)
+        {
+            memmove(p_packet, p_packet+1, (pending_count-next-1)*sizeof(Sim_Packet));
+            pending_count--;
+        }
+    }
+    link_stats.bytes_received += received;
+
+    return received;
+}
+
+int RS232_SendByte(int comport_number, unsigned char byte)
+{
+    return (RS232_SendBuf(comport_number, &byte, 1) == 1) ? 0 : 1;
+}
+
+int RS232_SendBuf(int comport_number, unsigned char *buf, int size)
+{
+    (void) comport_number;
+    /** <b>Local variable packet_size:</b> Length in bytes of the current packet. */
+    int packet_size;
+    for (int sent=0; sent<size; sent+=packet_size)
+    {
+        packet_size = ((size-sent) > HM10_MAX_PACKET_SIZE) ? HM10_MAX_PACKET_SIZE : (size-sent);
+        send_packet(&buf[sent], (uint8_t) packet_size);
+    }
+
+    return size;
+}
+
+void RS232_CloseComport(int comport_number)
+{
+    (void) comport_number;
+}
+
+void RS232_flushRX(int comport_number)
+{
+    (void) comport_number;
+    receive_packets();
+
+    /* Discard the bytes that are already available, but not the ones that are still in flight. */
+    /** <b>Local variable current_time:</b> Current time in microseconds. */
+    uint64_t current_time = get_hm10_sim_time_us();
+    /** <b>Local variable kept:</b> Number of packets that are kept. */
+    uint16_t kept = 0;
+    for (int i=0; i<pending_count; i++)
+    {
+        if (pending_packets[i].available_time > current_time)
+        {
+            pending_packets[kept++] = pending_packets[i];
+        }
+    }
+    pending_count = kept;
+}
+
+void RS232_flushTX(int comport_number)
+{
+    (void) comport_number;
+}
+
+void RS232_flushRXTX(int comport_number)
+{
+    RS232_flushRX(comport_number);
+}
+
+static int happens(uint16_t probability)
+{
+    return (probability > 0) && ((uint32_t) (rand_r(&link_seed)%SIM_PROBABILITY_SCALE) < probability);
+}
+
+static uint64_t get_line_time_us(uint32_t size)
+{
+    if (link_config.baudrate == 0)
+    {
+        return 0;
+    }
+
+    return ((uint64_t) size*10*1000000) / link_config.baudrate;
+}
+
+static void send_packet(uint8_t *data, uint8_t size)
+{
+    /* Wait while the transmit buffer is full and then queue the packet at its end. */
+    /** <b>Local variable current_time:</b> Current time in microseconds. */
+    uint64_t current_time = get_hm10_sim_time_us();
+    /** <b>Local variable buffer_time:</b> Time in microseconds that a full transmit buffer takes to be drained. */
+    uint64_t buffer_time = get_line_time_us(HM10_SIM_TX_BUFFER_SIZE);
+    if (line_free_time < current_time)
+    {
+        line_free_time = current_time;
+    }
+    if ((line_free_time-current_time) > buffer_time)
+    {
+        usleep((useconds_t) (line_free_time - current_time - buffer_time));
+    }
+    line_free_time += get_line_time_us(size);
+    link_stats.packets_sent++;
+    link_stats.bytes_sent += size;
+
+    /* Impair the packet. */
+    if (((link_config.cut_time_us>0) && ((current_time-link_start_time)>=link_config.cut_time_us)) || happens(link_config.loss))
+    {
+        link_stats.packets_dropped++;
+        return;
+    }
+    /** <b>Local variable packet:</b> Packet that is sent through the socket. */
+    Sim_Packet packet;
+    packet.available_time = line_free_time + link_config.latency_us;
+    packet.size = size;
+    packet.offset = 0;
+    memcpy(packet.data, data, size);
+    if (happens(link_config.corruption))
+    {
+        packet.data[rand_r(&link_seed)%size] ^= (uint8_t) (1U << (rand_r(&link_seed)%8));
+        link_stats.packets_corrupted++;
+    }
+    if (happens(link_config.reorder))
+    {
+        packet.available_time += link_config.reorder_delay_us;
+        link_stats.packets_reordered++;
+    }
+    send(link_socket, &packet, sizeof(packet), 0);
+}
+
+static void receive_packets(void)
+{
+    /** <b>Local variable packet:</b> Packet that is received from the socket. */
+    Sim_Packet packet;
+    while (recv(link_socket, &packet, sizeof(packet), MSG_DONTWAIT) == (ssize_t) sizeof(packet))
+    {
+        if (pending_count < HM10_SIM_MAX_PENDING_PACKETS)
+        {
+            pending_packets[pending_count++] = packet;
+        }
+    }
+}
+
+/** @} */
@@ -0,0 +1,269 @@
+/** @addtogroup hm10_sim
+ * @{
+ */
+
+/**@file
+ * @brief	HM-10 OTA LZ Compression Benchmark.
+ *
+ * @details Measures the @ref hm10_ota_lz on messages of sensor data, which consist of text records with a timestamp
+ *          and several readings that slowly drift, as the ones that are typically streamed through an HM-10 BT Device.
+ *          The benchmark runs in two parts:<br><br>
+ *          - The codec alone, for several message sizes and for both of its modes, which reports the compression ratio
+ *            (i.e., the original bytes over the compressed ones) and the CPU cost of compressing and of decompressing
+ *            each byte.<br>
+ *          - The @ref hm10_ota_msg with its compression stage disabled and in its @ref HM10_OTA_LZ_Per_Message mode,
+ *            over the simulated link of the @ref hm10_sim at 9600 baud (i.e., the default baud rate of the HM-10 BT
+ *            Device), which reports the goodput (i.e., the application bytes delivered per second).<br><br>
+ *
+ * @author 	Cesar Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026.
+ */
+
+#include <stdio.h>	// Library from which "printf()" and "snprintf()" are located at.
+#include <string.h>	// Library from which "memcmp()" and "memcpy()" are located at.
+#include "hm10_sim.h" // HM-10 Host Simulation.
+#include "../Inc/hm10_ble_driver.h" // Custom Mortrack's Library to be able to initialize, send configuration commands and send and/or receive data to/from an HM-10 Bluetooth Device.
+#include "../Inc/hm10_ota_lz.h" // Custom Mortrack's Library to compress the data sent Over the Air by the HM-10 Bluetooth Device.
+#include "../Inc/hm10_ota_msg.h" // Custom Mortrack's Library to send and receive messages of any size Over the Air via the HM-10 Bluetooth Device.
+
+#define SIM_BAUD_RATE               (9600U)     /**< @brief Baud rate of the simulated link, which is the default one of the HM-10 BT Device. */
+#define SIM_LATENCY_US              (15000U)    /**< @brief One-way latency in microseconds of the simulated link (i.e., about two Connection Intervals). */
+#define SIM_POLL_DELAY_US           (500000U)   /**< @brief Poll Delay in microseconds of both ends of the simulated link. */
+#define SIM_MAX_MESSAGE_SIZE        (256U)      /**< @brief Length in bytes of the largest message of sensor data. */
+#define SIM_CODEC_MESSAGES          (4000U)     /**< @brief Number of messages that the codec compresses and decompresses for each message size and mode. */
+#define SIM_LINK_MESSAGE_SIZE       (128U)      /**< @brief Length in bytes of each message that is sent over the simulated link. */
+#define SIM_LINK_MESSAGES           (16U)       /**< @brief Number of messages that are sent over the simulated link for each mode. */
+#define SIM_MAX_SILENT_POLLS        (4U)        /**< @brief Number of consecutive timeouts after which the Peripheral stops waiting for messages. */
+#define SIM_ANSWER_TIMEOUT_US       (30000000U) /**< @brief Time in microseconds that the Central waits for the answer of the Peripheral, which includes the time that the data that is still in the transmit buffer takes to be sent. */
+
+/**@brief	Scenario of the part of the benchmark that runs over the simulated link.
+ */
+typedef struct {
+    HM10_OTA_LZ_Mode mode;      //!< Mode of the compression stage of the @ref hm10_ota_msg on both ends.
+    uint64_t time_us;           //!< Time in microseconds that the Central measured until all the messages were delivered.
+    uint32_t bytes_on_line;     //!< Bytes that the Central sent through the line.
+} Sim_Scenario;
+
+static uint8_t message[SIM_MAX_MESSAGE_SIZE];                                       /**< @brief Buffer of the message of sensor data that is either being sent or checked. */
+static uint8_t compressed[HM10_OTA_LZ_MAX_COMPRESSED_SIZE(SIM_MAX_MESSAGE_SIZE)];   /**< @brief Buffer of the compressed message. */
+static uint8_t decompressed[SIM_MAX_MESSAGE_SIZE];                                  /**< @brief Buffer of the decompressed message. */
+static HM10_OTA_LZ_Context compression_ctx;                                         /**< @brief Context with which the codec compresses. */
+static HM10_OTA_LZ_Context decompression_ctx;                                       /**< @brief Context with which the codec decompresses. */
+
+/**@brief	Fills @ref message with the text records of sensor data that follow a certain message.
+ *
+ * @param index Index of the message, which determines the timestamp and the readings of its records.
+ * @param size  Length in bytes of the message.
+ */
+static void fill_sensor_message(uint32_t index, uint16_t size);
+
+/**@brief	Measures the codec for a certain message size and mode.
+ *
+ * @param size  Length in bytes of each message.
+ * @param mode  Mode of the codec.
+ *
+ * @return  0 if every message was decompressed back into its original data, or 1 otherwise.
+ */
+static int run_codec(uint16_t size, HM10_OTA_LZ_Mode mode);
+
+/**@brief	Sends the messages of a scenario and waits for the answer of the Peripheral (see @ref HM10_Sim_Peer ).
+ */
+static int run_central(void *arg);
+
+/**@brief	Receives and checks the messages of a scenario and answers once all of them were received (see @ref
+ *          HM10_Sim_Peer ).
+ */
+static int run_peripheral(void *arg);
+
+int main(void)
+{
+    /** <b>Local variable sizes:</b> Message sizes of the part of the benchmark that measures the codec alone. */
+    static const uint16_t sizes[] = {32, 64, 128, SIM_MAX_MESSAGE_SIZE};
+    /** <b>Local variable modes:</b> Modes of the compression stage of the part of the benchmark that runs over the simulated link. */
+    static const HM10_OTA_LZ_Mode modes[] = {HM10_OTA_LZ_Disabled, HM10_OTA_LZ_Per_Message};
+    /** <b>Local variable failures:</b> Number of scenarios that did not succeed. */
+    int failures = 0;
+
+    /* Measure the codec alone. */
+    fill_sensor_message(0, 80);
+    printf("HM-10 OTA LZ Compression on sensor data (e.g., \"%.*s\").\r\n", 39, (char *) message);
+    printf("%-14s %-12s %8s %18s %20s\r\n", "Message [B]", "Mode", "Ratio", "Compress [ns/B]", "Decompress [ns/B]");
+    for (uint16_t i=0; i<sizeof(sizes)/sizeof(sizes[0]); i++)
+    {
+        failures += run_codec(sizes[i], HM10_OTA_LZ_Per_Message);
+        failures += run_codec(sizes[i], HM10_OTA_LZ_Per_Stream);
+    }
+
+    /* Measure the Message Layer over the simulated link, which must refuse the mode that keeps its window between messages. */
+    if (set_hm10_ota_message_compression(HM10_OTA_LZ_Per_Stream) != HM10_EC_ERR)
+    {
+        failures++;
+    }
+    printf("\r\nHM-10 OTA Message Layer with %u messages of %u bytes over a simulated link at %u baud (line rate = %u B/s).\r\n",
+           SIM_LINK_MESSAGES, SIM_LINK_MESSAGE_SIZE, SIM_BAUD_RATE, SIM_BAUD_RATE/10);
+    printf("%-14s %12s %14s %14s\r\n", "Compression", "Time [ms]", "Goodput [B/s]", "Line bytes");
+    for (uint16_t i=0; i<sizeof(modes)/sizeof(modes[0]); i++)
+    {
+        /** <b>Local variable config:</b> Configuration of the simulated link. */
+        HM10_Sim_Link_Config config = {SIM_BAUD_RATE, SIM_LATENCY_US, SIM_POLL_DELAY_US, 0, 0, 0, 0, 1, 0};
+        /** <b>Local variable scenario:</b> Current scenario. */
+        Sim_Scenario scenario = {modes[i], 0, 0};
+        /** <b>Local variable scenario_failures:</b> Number of operations of the current scenario that failed. */
+        int scenario_failures = run_hm10_sim_link(&config, run_central, run_peripheral, &scenario);
+        printf("%-14s %12.1f %14.1f %14u %s\r\n", (scenario.mode == HM10_OTA_LZ_Disabled) ? "Disabled" : "Per_Message", scenario.time_us/1e3,
+               (scenario.time_us > 0) ? SIM_LINK_MESSAGES*SIM_LINK_MESSAGE_SIZE*1e6/scenario.time_us : 0.0, scenario.bytes_on_line,
+               (scenario_failures == 0) ? "" : "(!)");
+        if (scenario_failures != 0)
+        {
+            failures++;
+        }
+    }
+    printf("%d operation(s) failed.\r\n", failures);
+
+    return (failures == 0) ? 0 : 1;
+}
+
+static void fill_sensor_message(uint32_t index, uint16_t size)
+{
+    /** <b>Local variable record:</b> Text of the current record, including its terminating null character. */
+    char record[64];
+    /** <b>Local variable filled:</b> Bytes of the message that have been filled so far. */
+    uint16_t filled = 0;
+    for (uint32_t n=index*16; filled<size; n++)
+    {
+        /** <b>Local variable length:</b> Length in bytes of the current record. */
+        int length = snprintf(record, sizeof(record), "T%07u,%+06.2f,%05.1f,%+05d,%+05d,%+05d\n", n*250, 21.5 + (int) (n%37)/20.0 - (int) (n%11)/25.0,
+                              45.0 + (int) (n%23)/10.0, (int) (n%7) - 3, (int) (n%5) - 2, 981 + (int) (n%3));
+        if (length > (size-filled))
+        {
+            length = size - filled;
+        }
+        memcpy(&message[filled], record, length);
+        filled += length;
+    }
+}
+
+static int run_codec(uint16_t size, HM10_OTA_LZ_Mode mode)
+{
+    /** <b>Local variable failures:</b> Number of messages that were not decompressed back into their original data. */
+    int failures = 0;
+    /** <b>Local variable compressed_bytes:</b> Bytes of all the compressed messages. */
+    uint64_t compressed_bytes = 0;
+    /** <b>Local variable compress_time:</b> Time in microseconds spent compressing. */
+    uint64_t compress_time = 0;
+    /** <b>Local variable decompress_time:</b> Time in microseconds spent decompressing. */
+    uint64_t decompress_time = 0;
+    /** <b>Local variable compressed_size:</b> Length in bytes of each compressed message. */
+    uint16_t compressed_size;
+    /** <b>Local variable decompressed_size:</b> Length in bytes of each decompressed message. */
+    uint16_t decompressed_size;
+    /** <b>Local variable start_time:</b> Time in microseconds at which the current measurement started. */
+    uint64_t start_time;
+
+    init_hm10_ota_lz_context(&compression_ctx, mode);
+    init_hm10_ota_lz_context(&decompression_ctx, mode);
+    for (uint32_t i=0; i<SIM_CODEC_MESSAGES; i++)
+    {
+        fill_sensor_message(i, size);
+        start_time = get_hm10_sim_time_us();
+        if (compress_hm10_ota_data(&compression_ctx, message, size, compressed, sizeof(compressed), &compressed_size) != HM10_EC_OK)
+        {
+            return 1;
+        }
+        compress_time += get_hm10_sim_time_us() - start_time;
+        start_time = get_hm10_sim_time_us();
+        if (decompress_hm10_ota_data(&decompression_ctx, compressed, compressed_size, decompressed, sizeof(decompressed), &decompressed_size) != HM10_EC_OK)
+        {
+            return 1;
+        }
+        decompress_time += get_hm10_sim_time_us() - start_time;
+        compressed_bytes += compressed_size;
+        if ((decompressed_size!=size) || (memcmp(decompressed, message, size)!=0))
+        {
+            failures++;
+        }
+    }
+    /** <b>Local variable original_bytes:</b> Bytes of all the original messages. */
+    uint64_t original_bytes = (uint64_t) size*SIM_CODEC_MESSAGES;
+    printf("%-14u %-12s %8.2f %18.1f %20.1f %s\r\n", size, (mode == HM10_OTA_LZ_Per_Message) ? "Per_Message" : "Per_Stream",
+           (double) original_bytes/compressed_bytes, compress_time*1e3/original_bytes, decompress_time*1e3/original_bytes,
+           (failures == 0) ? "" : "(!)");
+
+    return (failures == 0) ? 0 : 1;
+}
+
+static int run_central(void *arg)
+{
+    /** <b>Local variable p_scenario:</b> Pointer to the current scenario. */
+    Sim_Scenario *p_scenario = (Sim_Scenario *) arg;
+    if (set_hm10_ota_message_compression(p_scenario->mode) != HM10_EC_OK)
+    {
+        return 1;
+    }
+    /** <b>Local variable start_time:</b> Time in microseconds at which the first message started to be sent. */
+    uint64_t start_time = get_hm10_sim_time_us();
+    for (uint16_t i=0; i<SIM_LINK_MESSAGES; i++)
+    {
+        fill_sensor_message(i, SIM_LINK_MESSAGE_SIZE);
+        if (send_hm10_ota_message(message, SIM_LINK_MESSAGE_SIZE) != HM10_EC_OK)
+        {
+            return 1;
+        }
+    }
+    /** <b>Local variable link_stats:</b> Statistics of the simulated link. */
+    HM10_Sim_Link_Stats link_stats;
+    get_hm10_sim_link_stats(&link_stats);
+    p_scenario->bytes_on_line = link_stats.bytes_sent;
+
+    /* Wait for the answer of the Peripheral, which is sent once it has received the last message. */
+    /** <b>Local variable size:</b> Length in bytes of the answer. */
+    uint16_t size;
+    while (get_hm10_ota_message(decompressed, sizeof(decompressed), &size) != HM10_EC_OK)
+    {
+        if ((get_hm10_sim_time_us()-start_time) > SIM_ANSWER_TIMEOUT_US)
+        {
+            return 1;
+        }
+    }
+    p_scenario->time_us = get_hm10_sim_time_us() - start_time;
+
+    return 0;
+}
+
+static int run_peripheral(void *arg)
+{
+    /** <b>Local variable p_scenario:</b> Pointer to the current scenario. */
+    Sim_Scenario *p_scenario = (Sim_Scenario *) arg;
+    if (set_hm10_ota_message_compression(p_scenario->mode) != HM10_EC_OK)
+    {
+        return 1;
+    }
+    /** <b>Local variable size:</b> Length in bytes of each received message. */
+    uint16_t size;
+    /** <b>Local variable failures:</b> Number of messages that were not received as expected. */
+    int failures = 0;
+
+    for (uint16_t i=0, silent_polls=0; i<SIM_LINK_MESSAGES; )
+    {
+        if (get_hm10_ota_message(decompressed, sizeof(decompressed), &size) != HM10_EC_OK)
+        {
+            if (++silent_polls > SIM_MAX_SILENT_POLLS)
+            {
+                return failures + (SIM_LINK_MESSAGES - i);
+            }
+            continue;
+        }
+        silent_polls = 0;
+        fill_sensor_message(i, SIM_LINK_MESSAGE_SIZE);
+        if ((size!=SIM_LINK_MESSAGE_SIZE) || (memcmp(decompressed, message, size)!=0))
+        {
+            failures++;
+        }
+        i++;
+    }
+    message[0] = 0;
+
+    return failures + ((send_hm10_ota_message(message, 1) == HM10_EC_OK) ? 0 : 1);
+}
+
+/** @} */
@@ -0,0 +1,170 @@
+/** @addtogroup hm10_sim
+ * @{
+ */
+
+/**@file
+ * @brief	HM-10 OTA Message Layer Throughput Benchmark.
+ *
+ * @details The Central sends a fixed amount of data through the @ref hm10_ota_msg , split into messages of several
+ *          sizes, over the simulated link of the @ref hm10_sim at 9600 baud (i.e., the default baud rate of the HM-10
+ *          BT Device). The Peripheral checks the content of each message and then answers with a single message, so
+ *          that the Central measures the time from its first byte sent until the whole data was delivered. For each
+ *          message size, the goodput (i.e., the application bytes delivered per second), the bytes that went through
+ *          the line and the efficiency of the layer (i.e., the application bytes over the bytes on the line) are
+ *          reported.
+ *
+ * @author 	Cesar Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026.
+ */
+
+#include <stdio.h>	// Library from which "printf()" is located at.
+#include <string.h>	// Library from which "memcmp()" is located at.
+#include "hm10_sim.h" // HM-10 Host Simulation.
+#include "../Inc/hm10_config.h" // Custom Library for the HM-10 Driver Library.
+#include "../Inc/hm10_ble_driver.h" // Custom Mortrack's Library to be able to initialize, send configuration commands and send and/or receive data to/from an HM-10 Bluetooth Device.
+#include "../Inc/hm10_ota_msg.h" // Custom Mortrack's Library to send and receive messages of any size Over the Air via the HM-10 Bluetooth Device.
+
+#define SIM_BAUD_RATE               (9600U)     /**< @brief Baud rate of the simulated link, which is the default one of the HM-10 BT Device. */
+#define SIM_LATENCY_US              (15000U)    /**< @brief One-way latency in microseconds of the simulated link (i.e., about two Connection Intervals). */
+#define SIM_POLL_DELAY_US           (500000U)   /**< @brief Poll Delay in microseconds of both ends of the simulated link. */
+#define SIM_DATA_SIZE               (2048U)     /**< @brief Length in bytes of the data that is sent for each message size. */
+#define SIM_MAX_SILENT_POLLS        (4U)        /**< @brief Number of consecutive timeouts after which the Peripheral stops waiting for messages. */
+#define SIM_ANSWER_TIMEOUT_US       (30000000U) /**< @brief Time in microseconds that the Central waits for the answer of the Peripheral, which includes the time that the data that is still in the transmit buffer takes to be sent. */
+
+/**@brief	Scenario of the benchmark.
+ */
+typedef struct {
+    uint16_t message_size;      //!< Length in bytes of each message.
+    uint16_t message_count;     //!< Number of messages that are sent.
+    uint64_t time_us;           //!< Time in microseconds that the Central measured until the whole data was delivered.
+    uint32_t bytes_on_line;     //!< Bytes that the Central sent through the line.
+} Sim_Scenario;
+
+static uint8_t message[HM10_OTA_MSG_MAX_SIZE];     /**< @brief Buffer of the message that is either being sent or received. */
+
+/**@brief	Fills a message with a pattern that depends on its index.
+ *
+ * @param index Index of the message.
+ * @param size  Length in bytes of the message.
+ */
+static void fill_message(uint16_t index, uint16_t size);
+
+/**@brief	Sends the messages of a scenario and waits for the answer of the Peripheral (see @ref HM10_Sim_Peer ).
+ */
+static int run_central(void *arg);
+
+/**@brief	Receives and checks the messages of a scenario and answers once all of them were received (see @ref
+ *          HM10_Sim_Peer ).
+ */
+static int run_peripheral(void *arg);
+
+int main(void)
+{
+    /** <b>Local variable config:</b> Configuration of the simulated link. */
+    HM10_Sim_Link_Config config = {SIM_BAUD_RATE, SIM_LATENCY_US, SIM_POLL_DELAY_US, 0, 0, 0, 0, 1, 0};
+    /** <b>Local variable sizes:</b> Message sizes of each scenario. */
+    static const uint16_t sizes[] = {8, 18, 64, 256, 1024};
+    /** <b>Local variable failures:</b> Number of scenarios that did not succeed. */
+    int failures = 0;
+
+    printf("HM-10 OTA Message Layer over a simulated link at %u baud with a one-way latency of %u us (line rate = %u B/s).\r\n",
+           SIM_BAUD_RATE, SIM_LATENCY_US, SIM_BAUD_RATE/10);
+    printf("%-14s %8s %12s %14s %14s %12s\r\n", "Message [B]", "Count", "Time [ms]", "Goodput [B/s]", "Line bytes", "Efficiency");
+    for (uint16_t i=0; i<sizeof(sizes)/sizeof(sizes[0]); i++)
+    {
+        /** <b>Local variable scenario:</b> Current scenario. */
+        Sim_Scenario scenario = {sizes[i], SIM_DATA_SIZE/sizes[i], 0, 0};
+        /** <b>Local variable scenario_failures:</b> Number of operations of the current scenario that failed. */
+        int scenario_failures = run_hm10_sim_link(&config, run_central, run_peripheral, &scenario);
+        /** <b>Local variable payload:</b> Application bytes that were delivered. */
+        uint32_t payload = (uint32_t) scenario.message_size*scenario.message_count;
+        printf("%-14u %8u %12.1f %14.1f %14u %11.1f%% %s\r\n", scenario.message_size, scenario.message_count, scenario.time_us/1e3,
+               (scenario.time_us > 0) ? payload*1e6/scenario.time_us : 0.0, scenario.bytes_on_line,
+               (scenario.bytes_on_line > 0) ? 100.0*payload/scenario.bytes_on_line : 0.0, (scenario_failures == 0) ? "" : "(!)");
+        if (scenario_failures != 0)
+        {
+            failures++;
+        }
+    }
+    printf("%d operation(s) failed.\r\n", failures);
+
+    return (failures == 0) ? 0 : 1;
+}
+
+static void fill_message(uint16_t index, uint16_t size)
+{
+    for (uint16_t i=0; i<size; i++)
+    {
+        message[i] = (uint8_t) (index*31 + i);
+    }
+}
+
+static int run_central(void *arg)
+{
+    /** <b>Local variable p_scenario:</b> Pointer to the current scenario. */
+    Sim_Scenario *p_scenario = (Sim_Scenario *) arg;
+    /** <b>Local variable start_time:</b> Time in microseconds at which the first message started to be sent. */
+    uint64_t start_time = get_hm10_sim_time_us();
+    for (uint16_t i=0; i<p_scenario->message_count; i++)
+    {
+        fill_message(i, p_scenario->message_size);
+        if (send_hm10_ota_message(message, p_scenario->message_size) != HM10_EC_OK)
+        {
+            return 1;
+        }
+    }
+    /** <b>Local variable link_stats:</b> Statistics of the simulated link. */
+    HM10_Sim_Link_Stats link_stats;
+    get_hm10_sim_link_stats(&link_stats);
+    p_scenario->bytes_on_line = link_stats.bytes_sent;
+
+    /* Wait for the answer of the Peripheral, which is sent once it has received the last message. */
+    /** <b>Local variable size:</b> Length in bytes of the answer. */
+    uint16_t size;
+    while (get_hm10_ota_message(message, sizeof(message), &size) != HM10_EC_OK)
+    {
+        if ((get_hm10_sim_time_us()-start_time) > SIM_ANSWER_TIMEOUT_US)
+        {
+            return 1;
+        }
+    }
+    p_scenario->time_us = get_hm10_sim_time_us() - start_time;
+
+    return 0;
+}
+
+static int run_peripheral(void *arg)
+{
+    /** <b>Local variable p_scenario:</b> Pointer to the current scenario. */
+    Sim_Scenario *p_scenario = (Sim_Scenario *) arg;
+    /** <b>Local variable expected:</b> Buffer with the expected content of each message. */
+    static uint8_t expected[HM10_OTA_MSG_MAX_SIZE];
+    /** <b>Local variable size:</b> Length in bytes of each received message. */
+    uint16_t size;
+    /** <b>Local variable failures:</b> Number of messages that were not received as expected. */
+    int failures = 0;
+
+    for (uint16_t i=0, silent_polls=0; i<p_scenario->message_count; )
+    {
+        if (get_hm10_ota_message(expected, sizeof(expected), &size) != HM10_EC_OK)
+        {
+            if (++silent_polls > SIM_MAX_SILENT_POLLS)
+            {
+                return failures + (p_scenario->message_count - i);
+            }
+            continue;
+        }
+        silent_polls = 0;
+        fill_message(i, p_scenario->message_size);
+        if ((size!=p_scenario->message_size) || (memcmp(expected, message, size)!=0))
+        {
+            failures++;
+        }
+        i++;
+    }
+    message[0] = 0;
+
+    return failures + ((send_hm10_ota_message(message, 1) == HM10_EC_OK) ? 0 : 1);
+}
+
+/** @} */
@@ -0,0 +1,558 @@
+/** @addtogroup hm10_sim
+ * @{
+ */
+
+/**@file
+ * @brief	HM-10 OTA Channel Multiplexer Integrity Harness.
+ *
+ * @details The Peripheral sends a fixed number of messages of several sizes through the @ref hm10_ota_mux to the
+ *          Central over the simulated link of the @ref hm10_sim at 9600 baud (i.e., the default baud rate of the HM-10
+ *          BT Device), on the following scenarios:<br><br>
+ *          - All of the messages on the channel 0 over a clean link, which the Central receives with the @ref
+ *            hm10_ota_msg instead, so that the wire compatibility of both layers (including their CRC32C) is checked.
+ *            <br>
+ *          - The messages spread over all of the channels, over a clean link.<br>
+ *          - The messages spread over all of the channels, over a link that drops and corrupts some of its packets.
+ *            <br><br>
+ *          The Central checks that every message that it gets is intact, on the right channel and in order, and
+ *          reports how many of them were delivered and how many were dropped because of their CRC32C. Over a clean
+ *          link, every message must be delivered, while over the impaired link no corrupted message may be delivered.
+ * @details The scheduling of the multiplexer is then checked over a clean link, once with the @ref
+ *          HM10_OTA_Mux_Strict_Priority and once with the @ref HM10_OTA_Mux_Weighted_Fair scheduling policy. The
+ *          Peripheral queues a large backlog of single-segment messages on two bulk channels, whose weights are @ref
+ *          SIM_BULK_WEIGHT_LOW and @ref SIM_BULK_WEIGHT_HIGH , and sends it one segment per frame time (i.e., the line
+ *          time of a whole packet), as an application that paces the multiplexer to the rate of the line does, while
+ *          it enqueues a timestamped control message on the channel 0 at a varying point of every few frames. The
+ *          Central measures the queueing delay of each control message (i.e., its delay beyond the latency of the link
+ *          and its own line time), while the Peripheral counts the frame times that each control message waited (i.e.,
+ *          the segment that was already on the line plus every segment that the scheduler sent ahead of it) and how the
+ *          first @ref SIM_SHARE_WINDOW bulk segments were shared between both bulk channels, which it reports to the
+ *          Central at the end. The harness checks that:<br><br>
+ *          - With strict priority, no control message waits more than one frame time, and the bulk channel with the
+ *            lowest Channel ID takes the whole window.<br>
+ *          - With weighted-fair scheduling, no control message waits more than one frame time plus one turn of both
+ *            bulk channels, and the window is shared in proportion to their weights, within one turn.<br>
+ *          - Every control message and every bulk message is delivered.<br><br>
+ *          The bounds are checked on the counted frame times rather than on the measured queueing delays, since the
+ *          latter also carry the scheduling jitter of both processes of the host machine, so that they are only
+ *          reported.
+ *
+ * @author 	Cesar Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026.
+ */
+
+#include <stdio.h>	// Library from which "printf()" is located at.
+#include <stdlib.h>	// Library from which "abs()" is located at.
+#include <string.h>	// Library from which "memcmp()" is located at.
+#include <unistd.h>	// Library from which "usleep()" is located at.
+#include "hm10_sim.h" // HM-10 Host Simulation.
+#include "../Inc/hm10_config.h" // This is the Mortrack's HM-10 library configuration file.
+#include "../Inc/hm10_crc32c.h" // Custom Mortrack's Library to calculate the CRC32C of the data sent and received Over the Air by the HM-10 Bluetooth Device.
+#include "../Inc/hm10_ble_driver.h" // Custom Mortrack's Library to be able to initialize, send configuration commands and send and/or receive data to/from an HM-10 Bluetooth Device.
+#include "../Inc/hm10_ota_msg.h" // Custom Mortrack's Library to send and receive messages of any size Over the Air via the HM-10 Bluetooth Device.
+#include "../Inc/hm10_ota_mux.h" // Custom Mortrack's Library to multiplex several logical channels Over the Air via the HM-10 Bluetooth Device.
+
+#define SIM_BAUD_RATE               (9600U)     /**< @brief Baud rate of the simulated link, which is the default one of the HM-10 BT Device. */
+#define SIM_LATENCY_US              (15000U)    /**< @brief One-way latency in microseconds of the simulated link (i.e., about two Connection Intervals). */
+#define SIM_POLL_DELAY_US           (100000U)   /**< @brief Poll Delay in microseconds of both ends of the simulated link. */
+#define SIM_MESSAGE_COUNT           (48U)       /**< @brief Number of messages that are sent on each scenario. */
+#define SIM_MAX_MESSAGE_SIZE        (64U)       /**< @brief Length in bytes of the largest message that is sent. */
+#define SIM_MAX_SILENT_POLLS        (3U)        /**< @brief Number of consecutive rounds of timeouts after which the Central stops waiting for messages. */
+#define SIM_BULK_CHANNEL_LOW        (1U)        /**< @brief Bulk channel with the lowest Channel ID of the scheduling scenarios. */
+#define SIM_BULK_CHANNEL_HIGH       (2U)        /**< @brief Bulk channel with the highest Channel ID of the scheduling scenarios. */
+#define SIM_BULK_WEIGHT_LOW         (1U)        /**< @brief Weight of the @ref SIM_BULK_CHANNEL_LOW channel. */
+#define SIM_BULK_WEIGHT_HIGH        (3U)        /**< @brief Weight of the @ref SIM_BULK_CHANNEL_HIGH channel. */
+#define SIM_BULK_COUNT              (40U)       /**< @brief Number of messages that are queued on each bulk channel of the scheduling scenarios. */
+#define SIM_BULK_SIZE               (13U)       /**< @brief Length in bytes of each bulk message, which fills a whole segment along with its length and its CRC32C. */
+#define SIM_SHARE_WINDOW            (32U)       /**< @brief Number of bulk segments, sent while both bulk channels are still backlogged, over which their shares are measured. */
+#define SIM_CONTROL_COUNT           (16U)       /**< @brief Number of control messages that are sent on each scheduling scenario. */
+#define SIM_CONTROL_PERIOD          (6U)        /**< @brief Number of frame times between consecutive control messages. */
+#define SIM_CONTROL_SIZE            (10U)       /**< @brief Length in bytes of a control message: Type (1 byte), Sequence Number (1 byte) and the time at which it was enqueued (8 bytes). */
+#define SIM_REPORT_SIZE             (6U)        /**< @brief Length in bytes of the report message: Type (1 byte), the bulk segments that each bulk channel sent within the window (2 bytes each) and the highest number of frame times that a control message waited (1 byte). */
+#if HM10_OTA_MSG_CRC
+#define SIM_CRC_SIZE                (HM10_CRC32C_SIZE) /**< @brief Length in bytes of the CRC32C that the multiplexer appends to each message. */
+#else
+#define SIM_CRC_SIZE                (0)         /**< @brief Length in bytes of the CRC32C that the multiplexer appends to each message. */
+#endif
+#define SIM_TYPE_CONTROL            (0xC1U)     /**< @brief Type of the control messages. */
+#define SIM_TYPE_REPORT             (0xC2U)     /**< @brief Type of the report message. */
+
+/**@brief	Scenario of the harness.
+ */
+typedef struct {
+    const char *name;           //!< Name of the scenario.
+    uint8_t channels;           //!< Number of channels over which the messages are spread, where 0 means that the Central receives them with the @ref hm10_ota_msg .
+    uint16_t loss;              //!< Probability of dropping each packet (see @ref HM10_Sim_Link_Config ).
+    uint16_t corruption;        //!< Probability of flipping one bit of each packet (see @ref HM10_Sim_Link_Config ).
+    uint16_t delivered;         //!< Number of messages that the Central got.
+    uint16_t mismatches;        //!< Number of messages that the Central got either corrupted, on the wrong channel or out of order.
+    uint32_t crc_errors;        //!< Number of messages that the Central dropped because of their CRC32C.
+} Sim_Scenario;
+
+/**@brief	Scheduling scenario of the harness.
+ */
+typedef struct {
+    const char *name;                   //!< Name of the scenario.
+    HM10_OTA_Mux_Scheduling scheduling; //!< Scheduling policy of the multiplexer of the Peripheral.
+    uint16_t controls;                  //!< Number of control messages that the Central got.
+    uint16_t bulk_delivered;            //!< Number of bulk messages that the Central got.
+    int64_t max_queueing;               //!< Highest queueing delay in microseconds of the control messages.
+    int64_t total_queueing;             //!< Sum of the queueing delays in microseconds of the control messages.
+    uint16_t share_low;                 //!< Bulk segments that the @ref SIM_BULK_CHANNEL_LOW channel sent within the window, as reported by the Peripheral.
+    uint16_t share_high;                //!< Bulk segments that the @ref SIM_BULK_CHANNEL_HIGH channel sent within the window, as reported by the Peripheral.
+    uint8_t max_frames;                 //!< Highest number of frame times that a control message waited, as reported by the Peripheral.
+} Sim_Sched_Scenario;
+
+/**@brief	Gets the line time of some bytes over the simulated link.
+ *
+ * @param size  Length in bytes of the data.
+ *
+ * @return  The line time in microseconds.
+ */
+static int64_t get_line_time_us(uint32_t size);
+
+/**@brief	Sleeps until a time of the clock that both ends of the simulated link share, if it is still ahead.
+ *
+ * @param time  Time in microseconds until which to sleep.
+ */
+static void sleep_until(uint64_t time);
+
+/**@brief	Fills a message with a pattern that depends on its index, whose first two bytes are the index itself.
+ *
+ * @param[out] msg  Pointer to the Memory Address into which the message will be stored.
+ * @param index     Index of the message.
+ *
+ * @return  Length in bytes of the message.
+ */
+static uint16_t fill_message(uint8_t *msg, uint16_t index);
+
+/**@brief	Checks a received message and updates the counters of a scenario.
+ *
+ * @param[in,out] p_scenario    Pointer to the current scenario.
+ * @param channel               Channel on which the message was received.
+ * @param[in] msg               Pointer to the received message.
+ * @param size                  Length in bytes of the received message.
+ * @param[in,out] next_index    Pointer to the lowest index that the next message of the channel may have.
+ */
+static void check_message(Sim_Scenario *p_scenario, uint8_t channel, uint8_t *msg, uint16_t size, uint16_t *next_index);
+
+/**@brief	Receives and checks the messages of a scenario (see @ref HM10_Sim_Peer ).
+ */
+static int run_central(void *arg);
+
+/**@brief	Sends the messages of a scenario (see @ref HM10_Sim_Peer ).
+ */
+static int run_peripheral(void *arg);
+
+/**@brief	Measures the queueing delay of the control messages of a scheduling scenario and then receives its bulk
+ *          messages (see @ref HM10_Sim_Peer ).
+ */
+static int run_sched_central(void *arg);
+
+/**@brief	Sends the bulk backlog and the control messages of a scheduling scenario, paced to the rate of the line
+ *          (see @ref HM10_Sim_Peer ).
+ */
+static int run_sched_peripheral(void *arg);
+
+int main(void)
+{
+    /** <b>Local variable scenarios:</b> Scenarios of the harness. */
+    Sim_Scenario scenarios[] = {
+        {"channel 0 to msg layer",  0, 0,   0,   0, 0, 0},
+        {"4 channels, clean",       HM10_OTA_MUX_CHANNELS, 0, 0, 0, 0, 0},
+        {"4 channels, 1% loss+2% bit", HM10_OTA_MUX_CHANNELS, 100, 200, 0, 0, 0}
+    };
+    /** <b>Local variable sched_scenarios:</b> Scheduling scenarios of the harness. */
+    Sim_Sched_Scenario sched_scenarios[] = {
+        {"strict priority",         HM10_OTA_Mux_Strict_Priority, 0, 0, 0, 0, 0, 0, 0},
+        {"weighted fair (DRR)",     HM10_OTA_Mux_Weighted_Fair,   0, 0, 0, 0, 0, 0, 0}
+    };
+    /** <b>Local variable failures:</b> Number of scenarios that did not succeed. */
+    int failures = 0;
+
+    printf("HM-10 OTA Channel Multiplexer with %u messages of up to %u bytes over a simulated link at %u baud with a one-way latency of %u us.\r\n",
+           SIM_MESSAGE_COUNT, SIM_MAX_MESSAGE_SIZE, SIM_BAUD_RATE, SIM_LATENCY_US);
+    printf("%-28s %10s %12s %12s\r\n", "Scenario", "Delivered", "CRC errors", "Corrupted");
+    for (uint16_t i=0; i<sizeof(scenarios)/sizeof(scenarios[0]); i++)
+    {
+        /** <b>Local variable config:</b> Configuration of the simulated link. */
+        HM10_Sim_Link_Config config = {SIM_BAUD_RATE, SIM_LATENCY_US, SIM_POLL_DELAY_US, scenarios[i].loss, scenarios[i].corruption,
+                                       0, 0, i + 1, 0};
+        /** <b>Local variable scenario_failures:</b> Number of operations of the current scenario that failed. */
+        int scenario_failures = run_hm10_sim_link(&config, run_central, run_peripheral, &scenarios[i]);
+        printf("%-28s %10u %12u %12u %s\r\n", scenarios[i].name, scenarios[i].delivered, scenarios[i].crc_errors,
+               scenarios[i].mismatches, (scenario_failures == 0) ? "" : "(!)");
+        if (scenario_failures != 0)
+        {
+            failures++;
+        }
+    }
+
+    printf("Scheduling of %u control messages behind %u bulk messages on each of 2 channels with weights %u:%u, with a frame time of %lld us.\r\n",
+           SIM_CONTROL_COUNT, SIM_BULK_COUNT, SIM_BULK_WEIGHT_LOW, SIM_BULK_WEIGHT_HIGH, (long long) get_line_time_us(HM10_MAX_PACKET_SIZE));
+    printf("%-28s %10s %12s %12s %12s %8s\r\n", "Scenario", "Controls", "Avg queue", "Max queue", "Max frames", "Shares");
+    for (uint16_t i=0; i<sizeof(sched_scenarios)/sizeof(sched_scenarios[0]); i++)
+    {
+        /** <b>Local variable config:</b> Configuration of the simulated link. */
+        HM10_Sim_Link_Config config = {SIM_BAUD_RATE, SIM_LATENCY_US, SIM_POLL_DELAY_US, 0, 0, 0, 0, i + 1, 0};
+        /** <b>Local variable p_scenario:</b> Pointer to the current scheduling scenario. */
+        Sim_Sched_Scenario *p_scenario = &sched_scenarios[i];
+        /** <b>Local variable is_strict:</b> Flag indicating whether the scenario uses strict priority (i.e., 1) or weighted-fair scheduling (i.e., 0). */
+        uint8_t is_strict = (p_scenario->scheduling == HM10_OTA_Mux_Strict_Priority);
+        /** <b>Local variable bound:</b> Highest number of frame times that a control message may wait. */
+        uint8_t bound = is_strict ? 1 : (1 + SIM_BULK_WEIGHT_LOW + SIM_BULK_WEIGHT_HIGH);
+        /** <b>Local variable expected_low:</b> Bulk segments that the @ref SIM_BULK_CHANNEL_LOW channel must send within the window. */
+        int expected_low = is_strict ? SIM_SHARE_WINDOW : (SIM_SHARE_WINDOW*SIM_BULK_WEIGHT_LOW) / (SIM_BULK_WEIGHT_LOW+SIM_BULK_WEIGHT_HIGH);
+        /** <b>Local variable scenario_failures:</b> Number of operations of the current scenario that failed. */
+        int scenario_failures = run_hm10_sim_link(&config, run_sched_central, run_sched_peripheral, p_scenario);
+
+        /* Strict priority only lets the segment on the line hold a control message back and starves the other bulk
+           channel, while weighted-fair scheduling adds at most one turn of the bulk channels and follows their weights. */
+        if ((p_scenario->controls != SIM_CONTROL_COUNT) || (p_scenario->bulk_delivered != 2*SIM_BULK_COUNT)
+            || (p_scenario->max_frames == 0) || (p_scenario->max_frames > bound) || ((p_scenario->share_low + p_scenario->share_high) != SIM_SHARE_WINDOW)
+            || (abs(p_scenario->share_low - expected_low) > (is_strict ? 0 : (int) (SIM_BULK_WEIGHT_LOW + SIM_BULK_WEIGHT_HIGH))))
+        {
+            scenario_failures++;
+        }
+        printf("%-28s %10u %12lld %12lld %7u (%2u) %4u:%-3u %s\r\n", p_scenario->name, p_scenario->controls,
+               (long long) ((p_scenario->controls == 0) ? 0 : p_scenario->total_queueing/p_scenario->controls),
+               (long long) p_scenario->max_queueing, p_scenario->max_frames, bound, p_scenario->share_low, p_scenario->share_high,
+               (scenario_failures == 0) ? "" : "(!)");
+        if (scenario_failures != 0)
+        {
+            failures++;
+        }
+    }
+    printf("Queueing delays in microseconds, frame times waited with their bound in parentheses, and bulk segments of each bulk channel within the first %u of them.\r\n",
+           SIM_SHARE_WINDOW);
+    printf("%d operation(s) failed.\r\n", failures);
+
+    return (failures == 0) ? 0 : 1;
+}
+
+static int64_t get_line_time_us(uint32_t size)
+{
+    return ((int64_t) size*10*1000000) / SIM_BAUD_RATE;
+}
+
+static void sleep_until(uint64_t time)
+{
+    /** <b>Local variable now:</b> Current time in microseconds. */
+    uint64_t now = get_hm10_sim_time_us();
+    if (time > now)
+    {
+        usleep((useconds_t) (time - now));
+    }
+}
+
+static uint16_t fill_message(uint8_t *msg, uint16_t index)
+{
+    /** <b>Local variable size:</b> Length in bytes of the message. */
+    uint16_t size = 2 + (index*37) % (SIM_MAX_MESSAGE_SIZE - 1);
+    msg[0] = (uint8_t) index;
+    msg[1] = (uint8_t) (index >> 8);
+    for (uint16_t i=2; i<size; i++)
+    {
+        msg[i] = (uint8_t) (index*31 + i*7);
+    }
+
+    return size;
+}
+
+static void check_message(Sim_Scenario *p_scenario, uint8_t channel, uint8_t *msg, uint16_t size, uint16_t *next_index)
+{
+    /** <b>Local variable expected:</b> Buffer of the expected message. */
+    uint8_t expected[SIM_MAX_MESSAGE_SIZE];
+    /** <b>Local variable index:</b> Index of the received message. */
+    uint16_t index = (size >= 2) ? (uint16_t) (msg[0] | (msg[1] << 8)) : SIM_MESSAGE_COUNT;
+
+    p_scenario->delivered++;
+    if ((index<*next_index) || (index>=SIM_MESSAGE_COUNT) || ((p_scenario->channels!=0) && ((index%p_scenario->channels)!=channel))
+        || (fill_message(expected, index)!=size) || (memcmp(msg, expected, size)!=0))
+    {
+        p_scenario->mismatches++;
+        return;
+    }
+    *next_index = index + 1;
+}
+
+static int run_central(void *arg)
+{
+    /** <b>Local variable p_scenario:</b> Pointer to the current scenario. */
+    Sim_Scenario *p_scenario = (Sim_Scenario *) arg;
+    /** <b>Local variable msg:</b> Buffer of the received message. */
+    uint8_t msg[SIM_MAX_MESSAGE_SIZE];
+    /** <b>Local variable size:</b> Length in bytes of the received message. */
+    uint16_t size;
+    /** <b>Local variable next_indexes:</b> Lowest index that the next message of each channel may have. */
+    uint16_t next_indexes[HM10_OTA_MUX_CHANNELS] = {0};
+    /** <b>Local variable silent_polls:</b> Number of consecutive rounds in which nothing was received on any channel. */
+    uint8_t silent_polls = 0;
+
+    /* Receive with the Message Layer, which must understand the channel 0 of the multiplexer. */
+    if (p_scenario->channels == 0)
+    {
+        reset_hm10_ota_message_layer();
+        while (silent_polls < SIM_MAX_SILENT_POLLS)
+        {
+            if (get_hm10_ota_message(msg, sizeof(msg), &size) != HM10_EC_OK)
+            {
+                silent_polls++;
+                continue;
+            }
+            silent_polls = 0;
+            check_message(p_scenario, 0, msg, size, &next_indexes[0]);
+        }
+        /** <b>Local variable msg_stats:</b> Statistics of the @ref hm10_ota_msg . */
+        HM10_OTA_Msg_Stats msg_stats;
+        get_hm10_ota_message_stats(&msg_stats);
+        p_scenario->crc_errors = msg_stats.crc_errors;
+        return ((p_scenario->mismatches==0) && (p_scenario->delivered==SIM_MESSAGE_COUNT)) ? 0 : 1;
+    }
+
+    /* Receive on every channel until nothing else arrives for a while. */
+    init_hm10_ota_mux(HM10_OTA_Mux_Weighted_Fair);
+    while (silent_polls < SIM_MAX_SILENT_POLLS)
+    {
+        silent_polls++;
+        for (uint8_t channel=0; channel<p_scenario->channels; channel++)
+        {
+            while (get_hm10_ota_mux_message(channel, msg, sizeof(msg), &size) == HM10_EC_OK)
+            {
+                silent_polls = 0;
+                check_message(p_scenario, channel, msg, size, &next_indexes[channel]);
+            }
+        }
+    }
+    /** <b>Local variable mux_stats:</b> Statistics of the @ref hm10_ota_mux . */
+    HM10_OTA_Mux_Stats mux_stats;
+    get_hm10_ota_mux_stats(&mux_stats);
+    p_scenario->crc_errors = mux_stats.crc_errors;
+
+    /* No corrupted message may ever be delivered, and none may be lost over a clean link. */
+    if (p_scenario->mismatches != 0)
+    {
+        return p_scenario->mismatches;
+    }
+    return ((p_scenario->loss!=0) || (p_scenario->corruption!=0) || (p_scenario->delivered==SIM_MESSAGE_COUNT)) ? 0 : 1;
+}
+
+static int run_peripheral(void *arg)
+{
+    /** <b>Local variable p_scenario:</b> Pointer to the current scenario. */
+    Sim_Scenario *p_scenario = (Sim_Scenario *) arg;
+    /** <b>Local variable msg:</b> Buffer of the message that is sent. */
+    uint8_t msg[SIM_MAX_MESSAGE_SIZE];
+    init_hm10_ota_mux(HM10_OTA_Mux_Weighted_Fair);
+
+    /* Enqueue every message on its channel and then send all of them interleaved by the scheduler. */
+    for (uint16_t i=0; i<SIM_MESSAGE_COUNT; i++)
+    {
+        /** <b>Local variable size:</b> Length in bytes of the message. */
+        uint16_t size = fill_message(msg, i);
+        if (enqueue_hm10_ota_mux_message((p_scenario->channels == 0) ? 0 : i%p_scenario->channels, msg, size) != HM10_EC_OK)
+        {
+            return 1;
+        }
+    }
+    /** <b>Local variable ret:</b> Return value of a @ref HM10_Status function type. */
+    HM10_Status ret;
+    do
+    {
+        ret = send_hm10_ota_mux_segments(UINT16_MAX);
+    }
+    while (ret == HM10_EC_OK);
+
+    return (ret == HM10_EC_NA) ? 0 : 1;
+}
+
+static int run_sched_central(void *arg)
+{
+    /** <b>Local variable p_scenario:</b> Pointer to the current scheduling scenario. */
+    Sim_Sched_Scenario *p_scenario = (Sim_Sched_Scenario *) arg;
+    /** <b>Local variable msg:</b> Buffer of the received message. */
+    uint8_t msg[SIM_MAX_MESSAGE_SIZE];
+    /** <b>Local variable size:</b> Length in bytes of the received message. */
+    uint16_t size;
+    /** <b>Local variable base_delay:</b> Delay in microseconds of a control message that is not queued behind anything. */
+    int64_t base_delay = SIM_LATENCY_US + get_line_time_us(HM10_OTA_MSG_SEGMENT_HEADER_SIZE + 1 + SIM_CONTROL_SIZE + SIM_CRC_SIZE);
+    /** <b>Local variable is_reported:</b> Flag indicating whether the report message has been received (i.e., 1) or not (i.e., 0). */
+    uint8_t is_reported = 0;
+    /** <b>Local variable silent_polls:</b> Number of consecutive timeouts. */
+    uint8_t silent_polls = 0;
+    /** <b>Local variable failures:</b> Number of messages that were not the expected ones. */
+    int failures = 0;
+    init_hm10_ota_mux(p_scenario->scheduling);
+
+    /* Time every control message on the channel 0 as soon as it arrives, while the bulk messages wait in their RX queues. */
+    while ((!is_reported) && (silent_polls < SIM_MAX_SILENT_POLLS))
+    {
+        if (get_hm10_ota_mux_message(0, msg, sizeof(msg), &size) != HM10_EC_OK)
+        {
+            silent_polls++;
+            continue;
+        }
+        silent_polls = 0;
+        /** <b>Local variable now:</b> Time in microseconds at which the message was received. */
+        uint64_t now = get_hm10_sim_time_us();
+        if ((size == SIM_CONTROL_SIZE) && (msg[0] == SIM_TYPE_CONTROL) && (msg[1] == p_scenario->controls))
+        {
+            /** <b>Local variable enqueue_time:</b> Time in microseconds at which the Peripheral enqueued the control message. */
+            uint64_t enqueue_time = 0;
+            for (uint8_t i=0; i<8; i++)
+            {
+                enqueue_time |= ((uint64_t) msg[2+i]) << (8*i);
+            }
+            /** <b>Local variable queueing:</b> Queueing delay in microseconds of the control message. */
+            int64_t queueing = (int64_t) (now - enqueue_time) - base_delay;
+            p_scenario->total_queueing += queueing;
+            if (queueing > p_scenario->max_queueing)
+            {
+                p_scenario->max_queueing = queueing;
+            }
+            p_scenario->controls++;
+        }
+        else if ((size == SIM_REPORT_SIZE) && (msg[0] == SIM_TYPE_REPORT))
+        {
+            p_scenario->share_low = (uint16_t) (msg[1] | (msg[2] << 8));
+            p_scenario->share_high = (uint16_t) (msg[3] | (msg[4] << 8));
+            p_scenario->max_frames = msg[5];
+            is_reported = 1;
+        }
+        else
+        {
+            failures++;
+        }
+    }
+
+    /* Collect the bulk messages, which were already dispatched into their RX queues. */
+    for (uint8_t channel=SIM_BULK_CHANNEL_LOW; channel<=SIM_BULK_CHANNEL_HIGH; channel++)
+    {
+        while (get_hm10_ota_mux_message(channel, msg, sizeof(msg), &size) == HM10_EC_OK)
+        {
+            if ((size != SIM_BULK_SIZE) || (msg[0] != channel) || (msg[1] != (uint8_t) (p_scenario->bulk_delivered % SIM_BULK_COUNT)))
+            {
+                failures++;
+            }
+            p_scenario->bulk_delivered++;
+        }
+    }
+
+    return failures + (is_reported ? 0 : 1);
+}
+
+static int run_sched_peripheral(void *arg)
+{
+    /** <b>Local variable p_scenario:</b> Pointer to the current scheduling scenario. */
+    Sim_Sched_Scenario *p_scenario = (Sim_Sched_Scenario *) arg;
+    /** <b>Local variable msg:</b> Buffer of the message that is enqueued. */
+    uint8_t msg[SIM_BULK_SIZE];
+    /** <b>Local variable frame_time:</b> Line time in microseconds of a whole packet, with which the segments are paced. */
+    int64_t frame_time = get_line_time_us(HM10_MAX_PACKET_SIZE);
+    /** <b>Local variable mux_stats:</b> Statistics of the @ref hm10_ota_mux . */
+    HM10_OTA_Mux_Stats mux_stats;
+    /** <b>Local variable report:</b> Report message with the shares of both bulk channels within the window and the longest wait of the control messages. */
+    uint8_t report[SIM_REPORT_SIZE] = {SIM_TYPE_REPORT, 0, 0, 0, 0, 0};
+    /** <b>Local variable enqueue_marks:</b> Total segments that had been sent when each control message was enqueued. */
+    uint32_t enqueue_marks[SIM_CONTROL_COUNT];
+    /** <b>Local variable total_sent:</b> Total segments that had been sent before the current frame. */
+    uint32_t total_sent = 0;
+    /** <b>Local variable controls_sent:</b> Number of control messages that have been sent. */
+    uint8_t controls_sent = 0;
+    /** <b>Local variable is_measured:</b> Flag indicating whether the shares within the window have been taken (i.e., 1) or not (i.e., 0). */
+    uint8_t is_measured = 0;
+    /** <b>Local variable controls:</b> Number of control messages that have been enqueued. */
+    uint8_t controls = 0;
+    /** <b>Local variable ret:</b> Return value of a @ref HM10_Status function type. */
+    HM10_Status ret;
+    init_hm10_ota_mux(p_scenario->scheduling);
+    if ((set_hm10_ota_mux_weight(SIM_BULK_CHANNEL_LOW, SIM_BULK_WEIGHT_LOW) != HM10_EC_OK)
+        || (set_hm10_ota_mux_weight(SIM_BULK_CHANNEL_HIGH, SIM_BULK_WEIGHT_HIGH) != HM10_EC_OK))
+    {
+        return 1;
+    }
+
+    /* Queue the whole bulk backlog, whose messages carry their channel and their index. */
+    for (uint8_t channel=SIM_BULK_CHANNEL_LOW; channel<=SIM_BULK_CHANNEL_HIGH; channel++)
+    {
+        for (uint16_t i=0; i<SIM_BULK_COUNT; i++)
+        {
+            memset(msg, (int) i, sizeof(msg));
+            msg[0] = channel;
+            if (enqueue_hm10_ota_mux_message(channel, msg, SIM_BULK_SIZE) != HM10_EC_OK)
+            {
+                return 1;
+            }
+        }
+    }
+
+    /* Send one segment at the start of every frame time and enqueue a control message at a varying point of every few
+       frames, where the frames are timed from the start so that no delay of this process accumulates. */
+    /** <b>Local variable start_time:</b> Time in microseconds at which the first frame starts. */
+    uint64_t start_time = get_hm10_sim_time_us();
+    for (uint32_t frame=0; ; frame++)
+    {
+        /** <b>Local variable frame_start:</b> Time in microseconds at which the current frame starts. */
+        uint64_t frame_start = start_time + frame*frame_time;
+        sleep_until(frame_start);
+        ret = send_hm10_ota_mux_segments(1);
+        if ((ret == HM10_EC_ERR) || ((ret == HM10_EC_NA) && (controls == SIM_CONTROL_COUNT)))
+        {
+            break;
+        }
+        get_hm10_ota_mux_stats(&mux_stats);
+        if (mux_stats.segments_sent[0] != controls_sent)
+        {
+            /* The control message waited for the segment on the line plus every segment that was sent ahead of it. */
+            /** <b>Local variable frames:</b> Frame times that the control message that was just sent waited. */
+            uint32_t frames = 1 + total_sent - enqueue_marks[controls_sent++];
+            if (frames > report[5])
+            {
+                report[5] = (uint8_t) frames;
+            }
+        }
+        total_sent++;
+        if ((!is_measured) && ((mux_stats.segments_sent[SIM_BULK_CHANNEL_LOW]+mux_stats.segments_sent[SIM_BULK_CHANNEL_HIGH]) == SIM_SHARE_WINDOW))
+        {
+            report[1] = (uint8_t) mux_stats.segments_sent[SIM_BULK_CHANNEL_LOW];
+            report[2] = (uint8_t) (mux_stats.segments_sent[SIM_BULK_CHANNEL_LOW] >> 8);
+            report[3] = (uint8_t) mux_stats.segments_sent[SIM_BULK_CHANNEL_HIGH];
+            report[4] = (uint8_t) (mux_stats.segments_sent[SIM_BULK_CHANNEL_HIGH] >> 8);
+            is_measured = 1;
+        }
+        if (((frame%SIM_CONTROL_PERIOD) != (SIM_CONTROL_PERIOD-1)) || (controls == SIM_CONTROL_COUNT))
+        {
+            continue;
+        }
+        /** <b>Local variable early_time:</b> Time in microseconds, within the current frame, after which the control message is enqueued. */
+        int64_t early_time = (frame_time*((controls*7) % 10)) / 10;
+        sleep_until(frame_start + early_time);
+        /** <b>Local variable control:</b> Control message, which carries the time at which it was enqueued. */
+        uint8_t control[SIM_CONTROL_SIZE] = {SIM_TYPE_CONTROL, controls};
+        /** <b>Local variable now:</b> Time in microseconds at which the control message is enqueued. */
+        uint64_t now = get_hm10_sim_time_us();
+        for (uint8_t i=0; i<8; i++)
+        {
+            control[2+i] = (uint8_t) (now >> (8*i));
+        }
+        if (enqueue_hm10_ota_mux_message(0, control, SIM_CONTROL_SIZE) != HM10_EC_OK)
+        {
+            return 1;
+        }
+        enqueue_marks[controls++] = total_sent;
+    }
+    if ((ret != HM10_EC_NA) || (!is_measured))
+    {
+        return 1;
+    }
+
+    /* Report the shares of both bulk channels and the longest wait of the control messages to the Central on the channel 0. */
+    if (enqueue_hm10_ota_mux_message(0, report, SIM_REPORT_SIZE) != HM10_EC_OK)
+    {
+        return 1;
+    }
+
+    return (send_hm10_ota_mux_segments(UINT16_MAX) == HM10_EC_OK) ? 0 : 1;
+}
+
+/** @} */
@@ -0,0 +1,201 @@
+/** @addtogroup hm10_sim
+ * @{
+ */
+
+/**@file
+ * @brief	HM-10 OTA Ping Service Harness.
+ *
+ * @details The Central pings the Peripheral with the @ref hm10_ota_ping over the simulated link of the @ref hm10_sim at
+ *          9600 baud (i.e., the default baud rate of the HM-10 BT Device), on the following scenarios:<br><br>
+ *          - Every PING frame is sent on an idle line.<br>
+ *          - Every other PING frame is queued behind some filler data that the Central sends right before it, so that
+ *            only the direction from the Central to the Peripheral gets some extra queueing.<br><br>
+ *          Since both ends share the same clock, the true clock offset is 0 and the true one-way delay of each frame is
+ *          the latency of the link plus the line time of the frame and of whatever it is queued behind. The harness
+ *          reports the error of the estimated offset and of the estimated one-way delays of each direction against
+ *          those true values, and checks that:<br><br>
+ *          - The offset and the lowest one-way delay of each direction are within @ref SIM_TOLERANCE_US of their true
+ *            values, since the least delayed exchanges carry no queueing and the least scheduling jitter.<br>
+ *          - The 90th percentile of the outbound one-way delay is within @ref SIM_TOLERANCE_US plus the measured
+ *            scheduling jitter of its true value, where that jitter is the spread between the 90th percentile and the
+ *            minimum of the inbound one-way delay, which is never queued.<br>
+ *          - The outbound tail exceeds the inbound one by at least half the line time of the filler data only whenever
+ *            the PING frames are queued, which shows that the extra queueing is attributed to the right direction.
+ *            <br><br>
+ *          The medians are only reported, since half of the exchanges of the queued scenario are queued, so that the
+ *          nearest-rank median is the slowest unqueued exchange (i.e., a tail value) rather than a typical one.
+ *
+ * @author 	Cesar Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026.
+ */
+
+#include <stdio.h>	// Library from which "printf()" is located at.
+#include <stdlib.h>	// Library from which "llabs()" is located at.
+#include <string.h>	// Library from which "memset()" is located at.
+#include "hm10_sim.h" // HM-10 Host Simulation.
+#include "../Inc/hm10_ble_driver.h" // Custom Mortrack's Library to be able to initialize, send configuration commands and send and/or receive data to/from an HM-10 Bluetooth Device.
+#include "../Inc/hm10_ota_ping.h" // Custom Mortrack's Library to measure the RTT and the clock offset Over the Air via the HM-10 Bluetooth Device.
+
+#define SIM_BAUD_RATE               (9600U)     /**< @brief Baud rate of the simulated link, which is the default one of the HM-10 BT Device. */
+#define SIM_LATENCY_US              (15000U)    /**< @brief One-way latency in microseconds of the simulated link (i.e., about two Connection Intervals). */
+#define SIM_POLL_DELAY_US           (200000U)   /**< @brief Poll Delay in microseconds of both ends of the simulated link. */
+#define SIM_PING_COUNT              (40U)       /**< @brief Number of PING frames that are sent on each scenario. */
+#define SIM_FILLER_SIZE             (38U)       /**< @brief Length in bytes of the filler data that is queued before every other PING frame on the queued scenario. */
+#define SIM_MAX_SILENT_POLLS        (3U)        /**< @brief Number of consecutive timeouts after which the Peripheral stops responding. */
+#define SIM_TOLERANCE_US            (3000)      /**< @brief Largest error in microseconds that is accepted for the estimated offset and for the lowest estimated one-way delays, on top of which the measured scheduling jitter is accepted for the tails. */
+
+/**@brief	Scenario of the harness.
+ */
+typedef struct {
+    const char *name;           //!< Name of the scenario.
+    uint8_t is_queued;          //!< 1 if every other PING frame is queued behind the filler data, or 0 otherwise.
+    HM10_OTA_Ping_Stats stats;  //!< Statistics of the @ref hm10_ota_ping that the Central got.
+} Sim_Scenario;
+
+/**@brief	Gets the line time of some bytes over the simulated link.
+ *
+ * @param size  Length in bytes of the data.
+ *
+ * @return  The line time in microseconds.
+ */
+static int64_t get_line_time_us(uint32_t size);
+
+/**@brief	Checks whether an estimated value is within a tolerance of its true value.
+ *
+ * @param estimate  Estimated value in microseconds.
+ * @param truth     True value in microseconds.
+ * @param tolerance Largest accepted error in microseconds.
+ *
+ * @return  0 if the estimated value is within the \p tolerance param of the true one, or 1 otherwise.
+ */
+static int check_estimate(int64_t estimate, int64_t truth, int64_t tolerance);
+
+/**@brief	Pings the Peripheral and takes the statistics of a scenario (see @ref HM10_Sim_Peer ).
+ */
+static int run_central(void *arg);
+
+/**@brief	Responds to the PING frames of a scenario (see @ref HM10_Sim_Peer ).
+ */
+static int run_peripheral(void *arg);
+
+int main(void)
+{
+    /** <b>Local variable scenarios:</b> Scenarios of the harness. */
+    Sim_Scenario scenarios[] = {
+        {"idle line",               0, {0}},
+        {"queued outbound pings",   1, {0}}
+    };
+    /** <b>Local variable base_delay:</b> True one-way delay in microseconds of a frame that is not queued behind anything. */
+    int64_t base_delay = SIM_LATENCY_US + get_line_time_us(HM10_OTA_PING_PONG_SIZE);
+    /** <b>Local variable failures:</b> Number of scenarios that did not succeed. */
+    int failures = 0;
+
+    printf("HM-10 OTA Ping Service with %u pings over a simulated link at %u baud with a one-way latency of %u us.\r\n",
+           SIM_PING_COUNT, SIM_BAUD_RATE, SIM_LATENCY_US);
+    printf("%-24s %10s %10s %8s %12s %12s %8s %12s %12s\r\n", "Scenario", "Offset err", "Jitter", "Out p50", "Out min",
+           "Out p90", "In p50", "In min", "In p90");
+    for (uint16_t i=0; i<sizeof(scenarios)/sizeof(scenarios[0]); i++)
+    {
+        /** <b>Local variable config:</b> Configuration of the simulated link. */
+        HM10_Sim_Link_Config config = {SIM_BAUD_RATE, SIM_LATENCY_US, SIM_POLL_DELAY_US, 0, 0, 0, 0, i + 1, 0};
+        /** <b>Local variable stats:</b> Pointer to the statistics that the Central got. */
+        HM10_OTA_Ping_Stats *stats = &scenarios[i].stats;
+        /** <b>Local variable queued_delay:</b> True one-way delay in microseconds of the slowest 10% of the PING frames. */
+        int64_t queued_delay = base_delay + ((scenarios[i].is_queued) ? get_line_time_us(SIM_FILLER_SIZE) : 0);
+        /** <b>Local variable scenario_failures:</b> Number of operations of the current scenario that failed. */
+        int scenario_failures = run_hm10_sim_link(&config, run_central, run_peripheral, &scenarios[i]);
+
+        /** <b>Local variable jitter:</b> Scheduling jitter in microseconds of the unqueued inbound direction. */
+        int64_t jitter = (int64_t) stats->owd_in_p90 - stats->owd_in_min;
+        /** <b>Local variable tail_gap:</b> Extra delay in microseconds of the outbound tail over the inbound one. */
+        int64_t tail_gap = (int64_t) stats->owd_out_p90 - stats->owd_in_p90;
+
+        /* The clocks are shared, so the true offset is 0 and only the queued direction may have a slower tail. */
+        scenario_failures += check_estimate(stats->offset, 0, SIM_TOLERANCE_US);
+        scenario_failures += check_estimate(stats->owd_out_min, base_delay, SIM_TOLERANCE_US);
+        scenario_failures += check_estimate(stats->owd_in_min, base_delay, SIM_TOLERANCE_US);
+        scenario_failures += check_estimate(stats->owd_out_p90, queued_delay, SIM_TOLERANCE_US + jitter);
+        if ((scenarios[i].is_queued) != (tail_gap >= get_line_time_us(SIM_FILLER_SIZE)/2))
+        {
+            scenario_failures++;
+        }
+        printf("%-24s %10lld %10lld %8d %5d (%4lld) %5d (%4lld) %8d %5d (%4lld) %5d %s\r\n", scenarios[i].name,
+               (long long) stats->offset, (long long) jitter, stats->owd_out_p50,
+               stats->owd_out_min, (long long) (stats->owd_out_min - base_delay),
+               stats->owd_out_p90, (long long) (stats->owd_out_p90 - queued_delay), stats->owd_in_p50,
+               stats->owd_in_min, (long long) (stats->owd_in_min - base_delay),
+               stats->owd_in_p90, (scenario_failures == 0) ? "" : "(!)");
+        if (scenario_failures != 0)
+        {
+            failures++;
+        }
+    }
+    printf("One-way delays in microseconds, with their error against the true delays in parentheses.\r\n");
+    printf("%d operation(s) failed.\r\n", failures);
+
+    return (failures == 0) ? 0 : 1;
+}
+
+static int64_t get_line_time_us(uint32_t size)
+{
+    return ((int64_t) size*10*1000000) / SIM_BAUD_RATE;
+}
+
+static int check_estimate(int64_t estimate, int64_t truth, int64_t tolerance)
+{
+    return (llabs(estimate - truth) <= tolerance) ? 0 : 1;
+}
+
+static int run_central(void *arg)
+{
+    /** <b>Local variable p_scenario:</b> Pointer to the current scenario. */
+    Sim_Scenario *p_scenario = (Sim_Scenario *) arg;
+    /** <b>Local variable filler:</b> Filler data that is queued before every other PING frame on the queued scenario, which the responder discards. */
+    uint8_t filler[SIM_FILLER_SIZE];
+    /** <b>Local variable failures:</b> Number of PING frames that were not answered. */
+    int failures = 0;
+    memset(filler, 0, sizeof(filler));
+    init_hm10_ota_ping();
+
+    for (uint16_t i=0; i<SIM_PING_COUNT; i++)
+    {
+        if ((p_scenario->is_queued) && ((i%2) == 1) && (send_hm10_ota_data(filler, sizeof(filler)) != HM10_EC_OK))
+        {
+            failures++;
+        }
+        if (send_hm10_ota_ping(NULL) != HM10_EC_OK)
+        {
+            failures++;
+        }
+    }
+    if (get_hm10_ota_ping_stats(&p_scenario->stats) != HM10_EC_OK)
+    {
+        failures++;
+    }
+
+    return failures;
+}
+
+static int run_peripheral(void *arg)
+{
+    (void) arg;
+    /** <b>Local variable silent_polls:</b> Number of consecutive timeouts. */
+    uint8_t silent_polls = 0;
+    /** <b>Local variable ret:</b> Return value of a @ref HM10_Status function type. */
+    HM10_Status ret;
+
+    /* Respond to every PING frame, discarding the filler data, until nothing else arrives for a while. */
+    while (silent_polls < SIM_MAX_SILENT_POLLS)
+    {
+        ret = respond_hm10_ota_ping();
+        if (ret == HM10_EC_ERR)
+        {
+            return 1;
+        }
+        silent_polls = (ret == HM10_EC_NR) ? (uint8_t) (silent_polls + 1) : 0;
+    }
+
+    return 0;
+}
+
+/** @} */
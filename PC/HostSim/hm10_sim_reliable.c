@@ -0,0 +1,179 @@
+/** @addtogroup hm10_sim
+ * @{
+ */
+
+/**@file
+ * @brief	HM-10 OTA Reliable Transport Loss and Reorder Harness.
+ *
+ * @details The Central sends a fixed amount of data through the @ref hm10_ota_reliable to the Peripheral over the
+ *          simulated link of the @ref hm10_sim at 9600 baud (i.e., the default baud rate of the HM-10 BT Device), for
+ *          each window size and for each of the following links:<br><br>
+ *          - A clean link.<br>
+ *          - A link that drops some of its packets.<br>
+ *          - A link that drops, corrupts and reorders some of its packets.<br><br>
+ *          The Peripheral checks that the data is delivered complete and in order, while the Central measures the time
+ *          from its first byte sent until all of the data was acknowledged. For each scenario, the goodput (i.e., the
+ *          application bytes delivered per second) and the retransmissions, fast retransmissions and discarded frames
+ *          of the Central are reported.
+ *
+ * @author 	Cesar Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026.
+ */
+
+#include <stdio.h>	// Library from which "printf()" is located at.
+#include "hm10_sim.h" // HM-10 Host Simulation.
+#include "../Inc/hm10_ble_driver.h" // Custom Mortrack's Library to be able to initialize, send configuration commands and send and/or receive data to/from an HM-10 Bluetooth Device.
+#include "../Inc/hm10_ota_reliable.h" // Custom Mortrack's Library to reliably send and receive data Over the Air via the HM-10 Bluetooth Device.
+
+#define SIM_BAUD_RATE               (9600U)     /**< @brief Baud rate of the simulated link, which is the default one of the HM-10 BT Device. */
+#define SIM_LATENCY_US              (15000U)    /**< @brief One-way latency in microseconds of the simulated link (i.e., about two Connection Intervals). */
+#define SIM_POLL_DELAY_US           (50000U)    /**< @brief Poll Delay in microseconds of both ends of the simulated link, which is shorter than the expected RTT as the @ref hm10_ota_reliable recommends. */
+#define SIM_REORDER_DELAY_US        (60000U)    /**< @brief Extra delay in microseconds of the reordered packets. */
+#define SIM_DATA_SIZE               (1024U)     /**< @brief Length in bytes of the data that is sent on each scenario. */
+#define SIM_LINGER_US               (2000000U)  /**< @brief Time in microseconds without receiving anything after which the Peripheral stops, which lets it acknowledge the retransmissions of the last DATA frames if their ACK frames were lost. */
+
+/**@brief	Scenario of the harness.
+ */
+typedef struct {
+    uint8_t window_size;        //!< Window size with which both ends initialize the @ref hm10_ota_reliable .
+    uint64_t time_us;           //!< Time in microseconds that the Central measured until all of the data was acknowledged.
+    HM10_OTA_Reliable_Stats stats;  //!< Statistics of the @ref hm10_ota_reliable of the Central.
+} Sim_Scenario;
+
+/**@brief	Simulated link of the harness.
+ */
+typedef struct {
+    const char *name;           //!< Name of the simulated link.
+    uint16_t loss;              //!< Probability of dropping each packet (see @ref HM10_Sim_Link_Config ).
+    uint16_t corruption;        //!< Probability of flipping one bit of each packet (see @ref HM10_Sim_Link_Config ).
+    uint16_t reorder;           //!< Probability of reordering each packet (see @ref HM10_Sim_Link_Config ).
+} Sim_Link;
+
+/**@brief	Gets the byte of the data that is sent at a certain position.
+ *
+ * @param index Position of the byte within the data.
+ *
+ * @return  The byte at that position.
+ */
+static uint8_t get_data_byte(uint32_t index);
+
+/**@brief	Sends the data of a scenario and waits until all of it has been acknowledged (see @ref HM10_Sim_Peer ).
+ */
+static int run_central(void *arg);
+
+/**@brief	Receives and checks the data of a scenario (see @ref HM10_Sim_Peer ).
+ */
+static int run_peripheral(void *arg);
+
+int main(void)
+{
+    /** <b>Local variable links:</b> Simulated links of the harness. */
+    static const Sim_Link links[] = {
+        {"clean",                   0,   0,   0},
+        {"2% loss",                 200, 0,   0},
+        {"2% loss+1% bit+2% reord", 200, 100, 200}
+    };
+    /** <b>Local variable windows:</b> Window sizes of each scenario. */
+    static const uint8_t windows[] = {1, 2, 4, 8, HM10_OTA_RELIABLE_MAX_WINDOW_SIZE};
+    /** <b>Local variable failures:</b> Number of scenarios that did not succeed. */
+    int failures = 0;
+
+    printf("HM-10 OTA Reliable Transport of %u bytes over a simulated link at %u baud with a one-way latency of %u us (line rate = %u B/s).\r\n",
+           SIM_DATA_SIZE, SIM_BAUD_RATE, SIM_LATENCY_US, SIM_BAUD_RATE/10);
+    printf("%-24s %7s %12s %14s %8s %10s %10s\r\n", "Link", "Window", "Time [ms]", "Goodput [B/s]", "Retx", "Fast retx", "Discarded");
+    for (uint16_t l=0; l<sizeof(links)/sizeof(links[0]); l++)
+    {
+        for (uint16_t w=0; w<sizeof(windows)/sizeof(windows[0]); w++)
+        {
+            /** <b>Local variable config:</b> Configuration of the simulated link. */
+            HM10_Sim_Link_Config config = {SIM_BAUD_RATE, SIM_LATENCY_US, SIM_POLL_DELAY_US, links[l].loss, links[l].corruption,
+                                           links[l].reorder, SIM_REORDER_DELAY_US, l*16 + w + 1, 0};
+            /** <b>Local variable scenario:</b> Current scenario. */
+            Sim_Scenario scenario = {windows[w], 0, {0}};
+            /** <b>Local variable scenario_failures:</b> Number of operations of the current scenario that failed. */
+            int scenario_failures = run_hm10_sim_link(&config, run_central, run_peripheral, &scenario);
+            printf("%-24s %7u %12.1f %14.1f %8u %10u %10u %s\r\n", links[l].name, scenario.window_size, scenario.time_us/1e3,
+                   (scenario.time_us > 0) ? SIM_DATA_SIZE*1e6/scenario.time_us : 0.0, scenario.stats.retransmissions,
+                   scenario.stats.fast_retransmissions, scenario.stats.invalid_frames + scenario.stats.crc_errors,
+                   (scenario_failures == 0) ? "" : "(!)");
+            if (scenario_failures != 0)
+            {
+                failures++;
+            }
+        }
+    }
+    printf("%d operation(s) failed.\r\n", failures);
+
+    return (failures == 0) ? 0 : 1;
+}
+
+static uint8_t get_data_byte(uint32_t index)
+{
+    return (uint8_t) (index*7 + 3);
+}
+
+static int run_central(void *arg)
+{
+    /** <b>Local variable p_scenario:</b> Pointer to the current scenario. */
+    Sim_Scenario *p_scenario = (Sim_Scenario *) arg;
+    /** <b>Local variable data:</b> Data that is sent. */
+    static uint8_t data[SIM_DATA_SIZE];
+    for (uint32_t i=0; i<SIM_DATA_SIZE; i++)
+    {
+        data[i] = get_data_byte(i);
+    }
+    if (init_hm10_ota_reliable(p_scenario->window_size) != HM10_EC_OK)
+    {
+        return 1;
+    }
+
+    /** <b>Local variable start_time:</b> Time in microseconds at which the data started to be sent. */
+    uint64_t start_time = get_hm10_sim_time_us();
+    /** <b>Local variable ret:</b> Return value of a @ref HM10_Status function type. */
+    HM10_Status ret = send_hm10_ota_reliable_data(data, SIM_DATA_SIZE);
+    p_scenario->time_us = get_hm10_sim_time_us() - start_time;
+    get_hm10_ota_reliable_stats(&p_scenario->stats);
+
+    return (ret == HM10_EC_OK) ? 0 : 1;
+}
+
+static int run_peripheral(void *arg)
+{
+    /** <b>Local variable p_scenario:</b> Pointer to the current scenario. */
+    Sim_Scenario *p_scenario = (Sim_Scenario *) arg;
+    if (init_hm10_ota_reliable(p_scenario->window_size) != HM10_EC_OK)
+    {
+        return 1;
+    }
+
+    /* Receive until nothing else arrives for a while, so that the retransmissions after the last byte are also acknowledged. */
+    /** <b>Local variable data:</b> Buffer of the received data. */
+    uint8_t data[HM10_OTA_RELIABLE_MAX_PAYLOAD_SIZE];
+    /** <b>Local variable size:</b> Length in bytes of the data that was received on each call. */
+    uint16_t size;
+    /** <b>Local variable received:</b> Number of bytes that were received so far. */
+    uint32_t received = 0;
+    /** <b>Local variable mismatches:</b> Number of bytes that were not received as expected. */
+    int mismatches = 0;
+    /** <b>Local variable last_time:</b> Time in microseconds at which something was last received. */
+    uint64_t last_time = get_hm10_sim_time_us();
+    while ((get_hm10_sim_time_us()-last_time) < SIM_LINGER_US)
+    {
+        if (get_hm10_ota_reliable_data(data, sizeof(data), &size) != HM10_EC_OK)
+        {
+            continue;
+        }
+        last_time = get_hm10_sim_time_us();
+        for (uint16_t i=0; i<size; i++, received++)
+        {
+            if ((received>=SIM_DATA_SIZE) || (data[i]!=get_data_byte(received)))
+            {
+                mismatches++;
+            }
+        }
+    }
+
+    return ((mismatches==0) && (received==SIM_DATA_SIZE)) ? 0 : 1;
+}
+
+/** @} */
@@ -0,0 +1,294 @@
+/** @addtogroup hm10_sim
+ * @{
+ */
+
+/**@file
+ * @brief	HM-10 Schema Codec Benchmark.
+ *
+ * @details Measures the time that a telemetry message of exactly @ref HM10_MAX_PACKET_SIZE bytes takes to be encoded
+ *          and decoded with the C macros of the @ref hm10_schema , with its C++ front-end (see hm10_schema.hpp) and
+ *          with hand-written \c memcpy packing, which is what the @ref hm10_schema replaces. The three codecs are first
+ *          checked to give the same wire format. Then the Central sends some of those messages, encoded with the C++
+ *          front-end, over the simulated link of the @ref hm10_sim , and the Peripheral decodes them with the C macros
+ *          and checks them, which also checks that the C functions of the @ref hm10_ble can be called from C++.
+ *
+ * @note    The hand-written packing copies each member in the byte order of the host machine, so it only gives the
+ *          same wire format as the @ref hm10_schema on little-endian hosts, which is one of the reasons to replace it.
+ *
+ * @author 	Cesar Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026.
+ */
+
+#include <cstdio>	// Library from which "printf()" is located at.
+#include <cstring>	// Library from which "memcpy()" and "memcmp()" are located at.
+#include "../Inc/hm10_schema.hpp" // Custom Mortrack's Library to generate, from C++ templates, the encode and decode functions of a message.
+extern "C" {
+#include "hm10_sim.h" // HM-10 Host Simulation.
+#include "../Inc/hm10_schema.h" // Custom Mortrack's Library to generate, from C macros, the encode and decode functions of a message.
+}
+
+#define SIM_BAUD_RATE               (9600U)     /**< @brief Baud rate of the simulated link, which is the default one of the HM-10 BT Device. */
+#define SIM_LATENCY_US              (15000U)    /**< @brief One-way latency in microseconds of the simulated link (i.e., about two Connection Intervals). */
+#define SIM_POLL_DELAY_US           (200000U)   /**< @brief Poll Delay in microseconds of both ends of the simulated link. */
+#define SIM_SAMPLE_COUNT            (256U)      /**< @brief Number of different telemetry samples that are encoded and decoded in turns. */
+#define SIM_CALLS                   (16U*1024U*1024U)  /**< @brief Number of times that each codec encodes and decodes a sample. */
+#define SIM_LINK_SAMPLE_COUNT       (32U)       /**< @brief Number of telemetry samples that are sent over the simulated link. */
+
+/**@brief	Telemetry sample that is encoded and decoded, as a plain C++ struct.
+ */
+struct Telemetry {
+    uint32_t timestamp_ms;      //!< Timestamp in milliseconds.
+    int16_t temperature_cdeg;   //!< Temperature in hundredths of a Celsius degree.
+    uint16_t adc[4];            //!< Readings of four ADC channels.
+    float battery_v;            //!< Battery voltage in volts.
+    uint8_t flags;              //!< Status flags.
+};
+
+using Telemetry_Schema = hm10::Schema<&Telemetry::timestamp_ms, &Telemetry::temperature_cdeg, &Telemetry::adc,
+                                      &Telemetry::battery_v, &Telemetry::flags>;   /**< @brief C++ schema of the @ref Telemetry struct. */
+static_assert(Telemetry_Schema::wire_size == HM10_MAX_PACKET_SIZE, "The telemetry is expected to fill exactly one HM-10 packet.");
+
+#define TELEMETRY_SCHEMA(FIELD, ARRAY) \
+    FIELD(u32, timestamp_ms)           \
+    FIELD(i16, temperature_cdeg)       \
+    ARRAY(u16, adc, 4)                 \
+    FIELD(f32, battery_v)              \
+    FIELD(u8, flags)                    /**< @brief C schema with the same fields as the @ref Telemetry struct. */
+
+HM10_SCHEMA_DEFINE(Telemetry_Msg, telemetry_msg, TELEMETRY_SCHEMA)
+HM10_SCHEMA_ASSERT_FITS(Telemetry_Msg, TELEMETRY_SCHEMA, HM10_MAX_PACKET_SIZE);
+
+static Telemetry samples[SIM_SAMPLE_COUNT];         /**< @brief Telemetry samples, as C++ structs. */
+static Telemetry_Msg c_samples[SIM_SAMPLE_COUNT];   /**< @brief Telemetry samples, as the structs of the C schema. */
+static uint8_t wires[SIM_SAMPLE_COUNT][HM10_MAX_PACKET_SIZE];   /**< @brief Telemetry samples, encoded. */
+
+/**@brief	Makes the compiler assume that the memory towards which a pointer points to is read, so that the measured
+ *          code that writes it is not optimized away.
+ *
+ * @param[in] p Pointer to the memory.
+ */
+static inline void escape(void *p)
+{
+    __asm__ __volatile__("" : : "g"(p) : "memory");
+}
+
+/**@brief	Gets the telemetry sample at a certain index.
+ *
+ * @param index Index of the sample.
+ *
+ * @return  The sample.
+ */
+static Telemetry get_sample(uint32_t index);
+
+/**@brief	Encodes a telemetry sample with hand-written \c memcpy packing.
+ *
+ * @return  The length in bytes of the encoded sample.
+ */
+static uint16_t encode_by_hand(const Telemetry &msg, uint8_t *data);
+
+/**@brief	Decodes a telemetry sample with hand-written \c memcpy packing.
+ */
+static void decode_by_hand(Telemetry &msg, uint8_t *data);
+
+/**@brief	Checks whether two telemetry samples are equal.
+ *
+ * @return  1 if they are equal, or 0 otherwise.
+ */
+static int is_same_sample(const Telemetry &a, const Telemetry &b);
+
+/**@brief	Reports the time that each encode and each decode of a codec took.
+ *
+ * @param name          Name of the codec.
+ * @param encode_ns     Total time in nanoseconds of the encodes.
+ * @param decode_ns     Total time in nanoseconds of the decodes.
+ */
+static void report(const char *name, double encode_ns, double decode_ns);
+
+/**@brief	Sends some telemetry samples, encoded with the C++ front-end (see @ref HM10_Sim_Peer ).
+ */
+static int run_central(void *arg);
+
+/**@brief	Receives and checks the telemetry samples, decoded with the C macros (see @ref HM10_Sim_Peer ).
+ */
+static int run_peripheral(void *arg);
+
+int main(void)
+{
+    /** <b>Local variable buffers:</b> Wire format of a sample given by each codec. */
+    uint8_t buffers[3][HM10_MAX_PACKET_SIZE];
+    /** <b>Local variable decoded:</b> Sample decoded by a codec. */
+    Telemetry decoded;
+    /** <b>Local variable failures:</b> Number of checks that did not succeed. */
+    int failures = 0;
+    for (uint32_t i=0; i<SIM_SAMPLE_COUNT; i++)
+    {
+        samples[i] = get_sample(i);
+        std::memcpy(&c_samples[i], &samples[i], sizeof(Telemetry_Msg));
+    }
+
+    /* Check that the three codecs give the same wire format and decode it back. */
+    static_assert(sizeof(Telemetry_Msg) == sizeof(Telemetry), "Both structs are expected to have the same layout.");
+    for (uint32_t i=0; i<SIM_SAMPLE_COUNT; i++)
+    {
+        failures += (Telemetry_Schema::encode(samples[i], wires[i]) != HM10_MAX_PACKET_SIZE);
+        std::memcpy(buffers[0], wires[i], HM10_MAX_PACKET_SIZE);
+        failures += (encode_telemetry_msg(&c_samples[i], buffers[1]) != HM10_MAX_PACKET_SIZE);
+        failures += (encode_by_hand(samples[i], buffers[2]) != HM10_MAX_PACKET_SIZE);
+        failures += (std::memcmp(buffers[0], buffers[1], HM10_MAX_PACKET_SIZE) != 0);
+        failures += (std::memcmp(buffers[0], buffers[2], HM10_MAX_PACKET_SIZE) != 0);
+        failures += ((Telemetry_Schema::decode(decoded, buffers[0], HM10_MAX_PACKET_SIZE) != HM10_EC_OK) || !is_same_sample(decoded, samples[i]));
+        failures += (Telemetry_Schema::decode(decoded, buffers[0], HM10_MAX_PACKET_SIZE - 1) != HM10_EC_ERR);
+    }
+
+    printf("HM-10 Schema Codec of a %u-byte telemetry message, %u times each.\r\n", HM10_MAX_PACKET_SIZE, SIM_CALLS);
+    printf("%-14s %14s %14s\r\n", "Codec", "Encode [ns]", "Decode [ns]");
+    /** <b>Local variable start_time:</b> Time in microseconds at which a measurement started. */
+    uint64_t start_time = get_hm10_sim_time_us();
+    /** <b>Local variable encode_ns:</b> Total time in nanoseconds of the encodes of the current codec. */
+    double encode_ns;
+    for (uint32_t i=0; i<SIM_CALLS; i++)
+    {
+        encode_telemetry_msg(&c_samples[i % SIM_SAMPLE_COUNT], buffers[1]);
+        escape(buffers[1]);
+    }
+    encode_ns = (get_hm10_sim_time_us() - start_time)*1e3;
+    start_time = get_hm10_sim_time_us();
+    for (uint32_t i=0; i<SIM_CALLS; i++)
+    {
+        decode_telemetry_msg(&c_samples[0], wires[i % SIM_SAMPLE_COUNT], HM10_MAX_PACKET_SIZE);
+        escape(&c_samples[0]);
+    }
+    report("C macros", encode_ns, (get_hm10_sim_time_us() - start_time)*1e3);
+
+    start_time = get_hm10_sim_time_us();
+    for (uint32_t i=0; i<SIM_CALLS; i++)
+    {
+        Telemetry_Schema::encode(samples[i % SIM_SAMPLE_COUNT], buffers[0]);
+        escape(buffers[0]);
+    }
+    encode_ns = (get_hm10_sim_time_us() - start_time)*1e3;
+    start_time = get_hm10_sim_time_us();
+    for (uint32_t i=0; i<SIM_CALLS; i++)
+    {
+        Telemetry_Schema::decode(decoded, wires[i % SIM_SAMPLE_COUNT], HM10_MAX_PACKET_SIZE);
+        escape(&decoded);
+    }
+    report("C++ templates", encode_ns, (get_hm10_sim_time_us() - start_time)*1e3);
+
+    start_time = get_hm10_sim_time_us();
+    for (uint32_t i=0; i<SIM_CALLS; i++)
+    {
+        encode_by_hand(samples[i % SIM_SAMPLE_COUNT], buffers[2]);
+        escape(buffers[2]);
+    }
+    encode_ns = (get_hm10_sim_time_us() - start_time)*1e3;
+    start_time = get_hm10_sim_time_us();
+    for (uint32_t i=0; i<SIM_CALLS; i++)
+    {
+        decode_by_hand(decoded, wires[i % SIM_SAMPLE_COUNT]);
+        escape(&decoded);
+    }
+    report("memcpy", encode_ns, (get_hm10_sim_time_us() - start_time)*1e3);
+
+    /* Send some samples over the simulated link, from the C++ front-end to the C macros. */
+    /** <b>Local variable config:</b> Configuration of the simulated link. */
+    HM10_Sim_Link_Config config = {SIM_BAUD_RATE, SIM_LATENCY_US, SIM_POLL_DELAY_US, 0, 0, 0, 0, 1, 0};
+    /** <b>Local variable link_failures:</b> Number of samples that were not received as expected over the simulated link. */
+    int link_failures = run_hm10_sim_link(&config, run_central, run_peripheral, NULL);
+    printf("%u samples sent over the simulated link from the C++ front-end to the C macros %s\r\n", SIM_LINK_SAMPLE_COUNT,
+           (link_failures == 0) ? "were received intact." : "were NOT received intact (!)");
+    failures += link_failures;
+    printf("%d operation(s) failed.\r\n", failures);
+
+    return (failures == 0) ? 0 : 1;
+}
+
+static Telemetry get_sample(uint32_t index)
+{
+    /** <b>Local variable sample:</b> Telemetry sample at the requested index. */
+    Telemetry sample = {};
+    sample.timestamp_ms = 1000U*index + 7U;
+    sample.temperature_cdeg = (int16_t) (2500 - 37*(int32_t) index);
+    for (uint8_t i=0; i<4; i++)
+    {
+        sample.adc[i] = (uint16_t) (index*97U + i*1021U);
+    }
+    sample.battery_v = 3.0f + index/256.0f;
+    sample.flags = (uint8_t) (index ^ 0xA5U);
+
+    return sample;
+}
+
+static uint16_t encode_by_hand(const Telemetry &msg, uint8_t *data)
+{
+    std::memcpy(&data[0], &msg.timestamp_ms, 4);
+    std::memcpy(&data[4], &msg.temperature_cdeg, 2);
+    std::memcpy(&data[6], msg.adc, 8);
+    std::memcpy(&data[14], &msg.battery_v, 4);
+    data[18] = msg.flags;
+
+    return 19;
+}
+
+static void decode_by_hand(Telemetry &msg, uint8_t *data)
+{
+    std::memcpy(&msg.timestamp_ms, &data[0], 4);
+    std::memcpy(&msg.temperature_cdeg, &data[4], 2);
+    std::memcpy(msg.adc, &data[6], 8);
+    std::memcpy(&msg.battery_v, &data[14], 4);
+    msg.flags = data[18];
+}
+
+static int is_same_sample(const Telemetry &a, const Telemetry &b)
+{
+    return (a.timestamp_ms==b.timestamp_ms) && (a.temperature_cdeg==b.temperature_cdeg) && (std::memcmp(a.adc, b.adc, sizeof(a.adc))==0)
+           && (a.battery_v==b.battery_v) && (a.flags==b.flags);
+}
+
+static void report(const char *name, double encode_ns, double decode_ns)
+{
+    printf("%-14s %14.2f %14.2f\r\n", name, encode_ns/SIM_CALLS, decode_ns/SIM_CALLS);
+}
+
+static int run_central(void *)
+{
+    /** <b>Local variable packet:</b> Encoded sample. */
+    uint8_t packet[Telemetry_Schema::wire_size];
+    for (uint32_t i=0; i<SIM_LINK_SAMPLE_COUNT; i++)
+    {
+        if (send_hm10_ota_data(packet, Telemetry_Schema::encode(get_sample(i), packet)) != HM10_EC_OK)
+        {
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+static int run_peripheral(void *)
+{
+    /** <b>Local variable packet:</b> Received sample. */
+    uint8_t packet[HM10_SCHEMA_WIRE_SIZE(TELEMETRY_SCHEMA)];
+    /** <b>Local variable msg:</b> Decoded sample. */
+    Telemetry_Msg msg;
+    /** <b>Local variable received:</b> Decoded sample, as a C++ struct. */
+    Telemetry received;
+    /** <b>Local variable mismatches:</b> Number of samples that were not received as expected. */
+    int mismatches = 0;
+    for (uint32_t i=0; i<SIM_LINK_SAMPLE_COUNT; i++)
+    {
+        /** <b>Local variable expected:</b> Sample that is expected. */
+        Telemetry expected = get_sample(i);
+        if ((get_hm10_ota_data(packet, sizeof(packet)) != HM10_EC_OK) || (decode_telemetry_msg(&msg, packet, sizeof(packet)) != HM10_EC_OK))
+        {
+            mismatches++;
+            continue;
+        }
+        std::memcpy(&received, &msg, sizeof(msg));
+        mismatches += !is_same_sample(received, expected);
+    }
+
+    return mismatches;
+}
+
+/** @} */
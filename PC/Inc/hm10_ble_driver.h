@@ -461,6 +461,8 @@
 #define HM10_MAX_BLE_NAME_SIZE          (12)		/**< @brief Total maximum bytes that the BT Name of the HM-10 BT Device can have. */
 #define HM10_PIN_VALUE_SIZE             (6)			/**< @brief Length in bytes of the Pin value in a HM-10 BT device. */
 #define HM10_BT_ADDR_SIZE               (12)        /**< @brief Length in bytes (i.e., ASCII Characters without the colons) expected from any Bluetooth Address. */
+#define HM10_MAX_PACKET_SIZE            (19)        /**< @brief Total maximum bytes in a Tx/Rx package/Payload to/from the HM-10 BT Device. @note The documentation of the HM-10 BT Device states that there is a restriction of sending data from one HM-10 BT Device to another, whenever they establish a connection, of 19 bytes per request. Therefore, to manage things homogeneously, both the transmit and receive requests will be handled by this @ref hm10_ble with the same size limit of 19 bytes. */
+#define HM10_MAX_COMPORTS               (38)        /**< @brief Total number of Comports that are supported by the @ref teuniz_rs232_library (i.e., Comports 1 to 38). */
 
 /**@brief	HM-10 Exception codes.
  *
@@ -583,6 +585,50 @@ typedef enum
     HM10_BT_Normal_Address  	= 78U    //!< HM-10 Bluetooth Normal Address Type. @note \f$78_d = N_{ASCII}\f$.
 } HM10_BT_Address_Type;
 
+/**@brief	HM-10 Command Type definitions.
+ *
+ * @details These definitions identify each of the AT Commands that the @ref hm10_ble can send to the HM-10 BT Device.
+ *          They are used to learn, for each HM-10 BT Device and for each Command Type, how long it takes for the
+ *          HM-10 BT Device to respond (see @ref get_hm10_command_timeout ).
+ */
+typedef enum
+{
+    HM10_Cmd_Test                           = 0U,     //!< Test Command (see @ref send_hm10_test_cmd ).
+    HM10_Cmd_Reset                          = 1U,     //!< Reset Command (see @ref send_hm10_reset_cmd ).
+    HM10_Cmd_Renew                          = 2U,     //!< Renew Command (see @ref send_hm10_renew_cmd ).
+    HM10_Cmd_Set_Name                       = 3U,     //!< Set Name Command (see @ref set_hm10_name ).
+    HM10_Cmd_Get_Name                       = 4U,     //!< Get Name Command (see @ref get_hm10_name ).
+    HM10_Cmd_Set_Role                       = 5U,     //!< Set Role Command (see @ref set_hm10_role ).
+    HM10_Cmd_Get_Role                       = 6U,     //!< Get Role Command (see @ref get_hm10_role ).
+    HM10_Cmd_Set_Pin                        = 7U,     //!< Set Pin Command (see @ref set_hm10_pin ).
+    HM10_Cmd_Get_Pin                        = 8U,     //!< Get Pin Command (see @ref get_hm10_pin ).
+    HM10_Cmd_Set_Pin_Code_Mode              = 9U,     //!< Set Type Command (see @ref set_hm10_pin_code_mode ).
+    HM10_Cmd_Get_Pin_Code_Mode              = 10U,    //!< Get Type Command (see @ref get_hm10_pin_code_mode ).
+    HM10_Cmd_Set_Module_Work_Mode           = 11U,    //!< Set Mode Command (see @ref set_hm10_module_work_mode ).
+    HM10_Cmd_Get_Module_Work_Mode           = 12U,    //!< Get Mode Command (see @ref get_hm10_module_work_mode ).
+    HM10_Cmd_Set_Module_Work_Type           = 13U,    //!< Set IMME Command (see @ref set_hm10_module_work_type ).
+    HM10_Cmd_Get_Module_Work_Type           = 14U,    //!< Get IMME Command (see @ref get_hm10_module_work_type ).
+    HM10_Cmd_Set_Notify_Information_Mode    = 15U,    //!< Set NOTI Command (see @ref set_hm10_notify_information_mode ).
+    HM10_Cmd_Get_Notify_Information_Mode    = 16U,    //!< Get NOTI Command (see @ref get_hm10_notify_information_mode ).
+    HM10_Cmd_Get_BT_Address                 = 17U,    //!< Get Address Command (see @ref get_hm10_bt_address ).
+    HM10_Cmd_Connect_To_Address             = 18U,    //!< First Response of the Connect-To-Address Command (see @ref connect_hm10_to_bt_address ).
+    HM10_Cmd_Disconnect                     = 19U,    //!< Lost-Connection Command (see @ref disconnect_hm10_from_bt_address ).
+    HM10_Cmd_Types_Count                    = 20U     //!< Total number of Command Types. @note This is not a valid Command Type.
+} HM10_Command_Type;
+
+/**@brief	HM-10 Response Latency Estimate.
+ *
+ * @details This structure holds the exponentially weighted moving average and variance of the time that an HM-10 BT
+ *          Device takes to respond to a certain Command Type. This data can be exported and imported (see @ref
+ *          get_hm10_latency_estimate and @ref set_hm10_latency_estimate ) so that it can be persisted by the
+ *          application in between restarts.
+ */
+typedef struct {
+    uint32_t samples;      //!< Number of Response Latency samples that have been accumulated into this estimate.
+    uint32_t mean;         //!< Exponentially weighted moving average of the Response Latency in microseconds.
+    uint64_t variance;     //!< Exponentially weighted moving variance of the Response Latency in squared microseconds.
+} HM10_Latency_Estimate;
+
 /**@brief	Sends a Test Command to the HM-10 BT Device.
  *
  * @details The primary use of this function is to identify if the HM-10 BT Device is active and/or operational
@@ -986,6 +1032,33 @@ HM10_Status set_hm10_notify_information_mode(HM10_Notify_Information_Mode notify
  */
 HM10_Status get_hm10_notify_information_mode(HM10_Notify_Information_Mode *notify_mode);
 
+/**@brief	Sends a Get Address Command to the HM-10 BT Device and gets the Bluetooth Address of that Device.
+ *
+ * @details The received Bluetooth Address is a Static MAC Address Type (see @ref HM10_BT_Static_MAC ), which makes it
+ *          a value that will not change for a given HM-10 BT Device and, therefore, a value that can be used to
+ *          identify a particular HM-10 BT Device whenever it is connected to our host machine.
+ *
+ * @param[out] bt_addr  Pointer to the Memory Address into which the ASCII Characters standing for the Bluetooth Address
+ *                      (without the colons) of the HM-10 BT Device will be stored. This data consists of a size of
+ *                      exactly @ref HM10_BT_ADDR_SIZE bytes.
+ *
+ * @retval	HM10_EC_OK	if the Bluetooth Address was successfully received from the HM-10 BT Device.
+ * @retval  HM10_EC_NR  if there was no response from the HM-10 BT Device.
+ * @retval  HM10_EC_ERR <ul>
+ *                          <li>
+ *                              If, after sending the Get Address Command, the validation of the expected Get Address
+ *                              Response from the HM-10 BT Device was unsuccessful.
+ *                          </li>
+ *                          <li>
+ *                              If anything else went wrong.
+ *                          </li>
+ *                      </ul>
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+HM10_Status get_hm10_bt_address(char bt_addr[HM10_BT_ADDR_SIZE]);
+
 /**@brief	Sends a Connect-To-Address Command to the HM-10 BT Device (must be configured in Central Mode) and connects
  *          that Device with a desired Remote Bluetooth Device that should have already been configured in Peripheral
  *          Mode.
@@ -1066,6 +1139,8 @@ HM10_BT_Connection_Status disconnect_hm10_from_bt_address();
  *
  * @note    If there is no BT connection between the HM-10 BT Device and any other BT Device, the HM-10 BT Device
  *          will do nothing.
+ * @note    If the @ref hm10_ota_pacer is enabled, then the byte of data will be sent whenever that pacer allows it
+ *          instead of applying the \p send_bytes_delay given to the @ref init_hm10_module function.
  *
  * @param ble_ota_data  Byte of data that is desired to send OTA via the HM-10 BT Device.
  *
@@ -1083,6 +1158,10 @@ HM10_Status send_hm10_ota_byte_of_data(uint8_t ble_ota_data);
  * @note    If there is no BT connection between the HM-10 BT Device and any other BT Device, the HM-10 BT Device
  *          will do nothing.
  *
+ * @note    If the @ref hm10_ota_pacer is enabled, then the requested data will be sent in bursts of @ref
+ *          HM10_MAX_PACKET_SIZE bytes at the rate allowed by that pacer so that the buffer of the HM-10 BT Device does
+ *          not get overrun.
+ *
  * @param[out] ble_ota_data Pointer to the data that is desired to send OTA via the HM-10 BT Device.
  * @param size              Length in bytes of the data towards which the \p ble_ota_data param points to.
  *
@@ -1115,6 +1194,112 @@ HM10_Status send_hm10_ota_data(uint8_t *ble_ota_data, uint16_t size);
  */
 HM10_Status get_hm10_ota_data(uint8_t *ble_ota_data, uint16_t size);
 
+/**@brief   Gets whatever HM-10 Device's BT data has been received Over the Air (OTA) so far, without expecting any
+ *          particular number of bytes, by waiting for at least one byte to be received within the specified timeout.
+ *
+ * @details This is meant for the modules that find the boundaries of their own frames within the received bytes (e.g.,
+ *          @ref hm10_ota_cobs ), so that a single lost byte does not misalign all the data that follows it.
+ *
+ * @param[out] ble_ota_data Pointer to the Memory Address into which the received data from the HM-10 BT Device will be
+ *                          stored.
+ * @param max_size          Largest number of bytes that can be stored into the \p ble_ota_data param.
+ * @param[out] size         Pointer to the Memory Address into which the number of bytes that were received will be
+ *                          stored.
+ *
+ * @retval	HM10_EC_OK	if at least one byte was received OTA from the HM-10 BT Device.
+ * @retval  HM10_EC_NR  if no bytes were received OTA from the HM-10 BT Device.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+HM10_Status get_hm10_ota_available_data(uint8_t *ble_ota_data, uint16_t max_size, uint16_t *size);
+
+/**@brief	Gets the timeout that the @ref hm10_ble currently applies whenever waiting for the Response of a certain
+ *          Command Type from the current HM-10 BT Device.
+ *
+ * @details Each time that an HM-10 BT Device responds to a Command, the time that it took to respond is learned as an
+ *          exponentially weighted moving average and variance of its Response Latency for the corresponding Command
+ *          Type. The timeout is then calculated as \f$\mu + k\sigma\f$, where \f$k\f$ is @ref
+ *          HM10_ADAPTIVE_TIMEOUT_K , and it is clamped between @ref HM10_ADAPTIVE_TIMEOUT_MIN and @ref
+ *          HM10_ADAPTIVE_TIMEOUT_MAX .
+ * @details Until @ref HM10_ADAPTIVE_TIMEOUT_MIN_SAMPLES Response Latencies have been learned for a Command Type, or if
+ *          @ref HM10_ADAPTIVE_TIMEOUTS is disabled, the \p poll_delay given to the @ref init_hm10_module function is
+ *          used instead.
+ *
+ * @note    The Response Latencies are learned per Comport (i.e., for the HM-10 BT Device towards which the last call
+ *          of the @ref init_hm10_module function points to).
+ *
+ * @param command_type  Command Type whose timeout is desired to be obtained.
+ *
+ * @return  Timeout in microseconds for the requested Command Type.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+uint32_t get_hm10_command_timeout(HM10_Command_Type command_type);
+
+/**@brief	Exports the learned Response Latency of a certain Command Type of the current HM-10 BT Device.
+ *
+ * @param command_type      Command Type whose learned Response Latency is desired to be obtained.
+ * @param[out] estimate     Pointer to the Memory Address into which the learned Response Latency will be stored.
+ *
+ * @retval	HM10_EC_OK	if the learned Response Latency was successfully obtained.
+ * @retval  HM10_EC_NA  if @ref HM10_ADAPTIVE_TIMEOUTS is disabled.
+ * @retval  HM10_EC_ERR if the \p command_type param is not valid.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+HM10_Status get_hm10_latency_estimate(HM10_Command_Type command_type, HM10_Latency_Estimate *estimate);
+
+/**@brief	Imports a previously exported Response Latency of a certain Command Type into the current HM-10 BT Device.
+ *
+ * @param command_type  Command Type whose learned Response Latency is desired to be replaced.
+ * @param[in] estimate  Pointer to the Response Latency that is desired to be imported.
+ *
+ * @retval	HM10_EC_OK	if the Response Latency was successfully imported.
+ * @retval  HM10_EC_NA  if @ref HM10_ADAPTIVE_TIMEOUTS is disabled.
+ * @retval  HM10_EC_ERR if the \p command_type param is not valid.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+HM10_Status set_hm10_latency_estimate(HM10_Command_Type command_type, const HM10_Latency_Estimate *estimate);
+
+/**@brief	Forgets all the learned Response Latencies of the current HM-10 BT Device.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+void reset_hm10_latency_estimates();
+
+/**@brief	Changes the Comport towards which the @ref hm10_ble sends/receives data without changing any of the Delays
+ *          that were given to the @ref init_hm10_module function.
+ *
+ * @details This allows an application that handles several HM-10 BT Devices to point the @ref hm10_ble towards each of
+ *          them whenever it requires it (e.g., to validate each of their fingerprints on start-up).
+ *
+ * @param comport   Comport number from which it is desired that the @ref hm10_ble sends/receives data to/from the
+ *                  HM-10 BT Device.
+ *
+ * @retval	HM10_EC_OK	if the Comport was successfully changed.
+ * @retval  HM10_EC_ERR if the \p comport param is not valid.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+HM10_Status select_hm10_comport(int comport);
+
+/**@brief	Gets the Comport towards which the @ref hm10_ble is currently sending/receiving data.
+ *
+ * @return  Comport number that was last given to either the @ref init_hm10_module or the @ref select_hm10_comport
+ *          function.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+int get_hm10_comport();
+
 /**@brief	Initializes the @ref hm10_ble in order to be able to use its provided functions.
  *
  * @details This function persists the following data:<br><br>
@@ -1131,10 +1316,12 @@ HM10_Status get_hm10_ota_data(uint8_t *ble_ota_data, uint16_t size);
  *                                      before having send a byte of data through the TX of the RS-232 via the Teuniz
  *                                      Library. Note that a suggested value that should work fine for param is 1000
  *                                      microseconds.
- * @param poll_delay                    Delay in microseconds that is desired to request to the @ref hm10_ble to apply
- *                                      each time before calling the @ref RS232_PollComport function of the Teuniz
- *                                      Library. Note that a suggested value that should work fine for param is 500'000
- *                                      microseconds.
+ * @param poll_delay                    Maximum time in microseconds that is desired to request to the @ref hm10_ble to
+ *                                      wait for the data requested via the @ref RS232_PollComport function of the
+ *                                      Teuniz Library. This is used for the data received OTA and for the Responses of
+ *                                      any Command Type whose latency has not been learned yet (see @ref
+ *                                      get_hm10_command_timeout ). Note that a suggested value that should work fine
+ *                                      for param is 500'000 microseconds.
  * @param connect_to_address_timeout    Time in microseconds that is desired to request to our host machine for waiting
  *                                      for the HM-10 BT device's Connect-To-Address Response after sending a
  *                                      Connect-To-Address Command to it. Note that the maximum time that a Bluetooth
@@ -43,6 +43,122 @@
 #define ETX_OTA_VERBOSE             (0U)       /**< @brief Flag value used to enable the compiler to take into account the code of both the @ref hm10_ble library that displays detailed information about the processes made inside them via @ref printf with a \c 1 . Otherwise, a \c 0 for not displaying any messages at all with @ref printf . */
 #endif
 
+#ifndef HM10_RESET_AND_RENEW_CMDS_DELAY
+#define HM10_RESET_AND_RENEW_CMDS_DELAY     (1000000U) /**< @brief Designated time in microseconds for the Delay to be requested each time after either the Reset or the Renew Command is solicited to the HM-10 BT Device. @details In order to guarantee that any other AT Command will work as expected after Resetting the HM-10 BT Device, a Delay is needed in order to wait for the Device to complete the Reset Process. */
+#endif
+
+#ifndef HM10_ADAPTIVE_TIMEOUTS
+#define HM10_ADAPTIVE_TIMEOUTS              (1U)       /**< @brief Flag value used to enable the @ref hm10_ble to learn the Response Latency of each Command Type of each HM-10 BT Device and to use it to calculate the timeout of each of their Responses with a \c 1 . Otherwise, a \c 0 for always using the \p poll_delay given to the @ref init_hm10_module function as the timeout. */
+#endif
+
+#ifndef HM10_ADAPTIVE_TIMEOUT_K
+#define HM10_ADAPTIVE_TIMEOUT_K             (4U)       /**< @brief Number of standard deviations of the learned Response Latency that are added to its mean to calculate the timeout of a Response (see @ref get_hm10_command_timeout ). */
+#endif
+
+#ifndef HM10_ADAPTIVE_TIMEOUT_MIN
+#define HM10_ADAPTIVE_TIMEOUT_MIN           (20000U)   /**< @brief Lowest timeout in microseconds that can be calculated from a learned Response Latency. */
+#endif
+
+#ifndef HM10_ADAPTIVE_TIMEOUT_MAX
+#define HM10_ADAPTIVE_TIMEOUT_MAX           (2000000U) /**< @brief Highest timeout in microseconds that can be calculated from a learned Response Latency. */
+#endif
+
+#ifndef HM10_ADAPTIVE_TIMEOUT_MIN_SAMPLES
+#define HM10_ADAPTIVE_TIMEOUT_MIN_SAMPLES   (4U)       /**< @brief Number of Response Latency samples that have to be learned for a Command Type before its learned timeout is used instead of the \p poll_delay given to the @ref init_hm10_module function. */
+#endif
+
+#ifndef HM10_POLL_STEP_DELAY
+#define HM10_POLL_STEP_DELAY                (1000U)    /**< @brief Delay in microseconds that the @ref hm10_ble applies in between each consecutive poll of the RS-232 Port while waiting for some data. */
+#endif
+
+#ifndef HM10_OTA_PACER_PACKETS_PER_INTERVAL
+#define HM10_OTA_PACER_PACKETS_PER_INTERVAL (1U)       /**< @brief Number of packets of @ref HM10_MAX_PACKET_SIZE bytes that the HM-10 BT Device is assumed to forward OTA per each Bluetooth Connection Interval. This is used to derive the highest rate of the @ref hm10_ota_pacer . */
+#endif
+
+#ifndef HM10_OTA_PACER_BURST_PACKETS
+#define HM10_OTA_PACER_BURST_PACKETS        (2U)       /**< @brief Number of packets of @ref HM10_MAX_PACKET_SIZE bytes that the bucket of the @ref hm10_ota_pacer can hold (i.e., the largest burst of data that can be sent without waiting). */
+#endif
+
+#ifndef HM10_OTA_PACER_MIN_RATE
+#define HM10_OTA_PACER_MIN_RATE             (100U)     /**< @brief Lowest rate in bytes per second to which the @ref hm10_ota_pacer can be decreased whenever drops are reported to it. */
+#endif
+
+#ifndef HM10_OTA_PACER_ADDITIVE_INCREASE
+#define HM10_OTA_PACER_ADDITIVE_INCREASE    (19U)      /**< @brief Rate in bytes per second that the @ref hm10_ota_pacer is increased for each packet of @ref HM10_MAX_PACKET_SIZE bytes that is reported as echoed. */
+#endif
+
+#ifndef HM10_OTA_MSG_MAX_SIZE
+#define HM10_OTA_MSG_MAX_SIZE               (1024U)    /**< @brief Length in bytes of the largest message that can be sent or received via the @ref hm10_ota_msg , which also determines the length of its reassembly arena. This must be lower than 16383 bytes. */
+#endif
+
+#ifndef HM10_OTA_RELIABLE_INITIAL_RTO
+#define HM10_OTA_RELIABLE_INITIAL_RTO           (1000000U) /**< @brief Retransmission Timeout in microseconds that the @ref hm10_ota_reliable uses until the first Round Trip Time has been measured. */
+#endif
+
+#ifndef HM10_OTA_RELIABLE_MIN_RTO
+#define HM10_OTA_RELIABLE_MIN_RTO               (50000U)   /**< @brief Lowest Retransmission Timeout in microseconds that the @ref hm10_ota_reliable can derive from the measured Round Trip Time. */
+#endif
+
+#ifndef HM10_OTA_RELIABLE_MAX_RTO
+#define HM10_OTA_RELIABLE_MAX_RTO               (4000000U) /**< @brief Highest Retransmission Timeout in microseconds that the @ref hm10_ota_reliable can reach, including its exponential backoff. */
+#endif
+
+#ifndef HM10_OTA_RELIABLE_MAX_RETRANSMISSIONS
+#define HM10_OTA_RELIABLE_MAX_RETRANSMISSIONS   (8U)       /**< @brief Number of times that the @ref hm10_ota_reliable can retransmit a single DATA frame before giving up. */
+#endif
+
+#ifndef HM10_OTA_RELIABLE_DUPACK_THRESHOLD
+#define HM10_OTA_RELIABLE_DUPACK_THRESHOLD      (3U)       /**< @brief Number of ACK frames that have to selectively acknowledge later DATA frames while a DATA frame is still missing for the @ref hm10_ota_reliable to fast retransmit it. */
+#endif
+
+#ifndef HM10_OTA_MSG_CRC
+#define HM10_OTA_MSG_CRC                        (1U)       /**< @brief Flag used to enable the CRC32C that the @ref hm10_ota_msg and the @ref hm10_ota_mux append to each message with a 1 or, otherwise, to disable it with a 0. @note Both HM-10 BT Devices must use the same value. */
+#endif
+
+#ifndef HM10_OTA_COBS_MAX_FRAME_SIZE
+#define HM10_OTA_COBS_MAX_FRAME_SIZE            (1024U)    /**< @brief Length in bytes of the largest frame that can be sent or received via the @ref hm10_ota_cobs , before its encoding. */
+#endif
+
+#ifndef HM10_OTA_COBS_RX_RING_SIZE
+#define HM10_OTA_COBS_RX_RING_SIZE              (2048U)    /**< @brief Length in bytes of the ring buffer into which the @ref hm10_ota_cobs receives the encoded frames. This must be a power of 2 that is greater than the length of the largest encoded frame (see @ref HM10_OTA_COBS_MAX_ENCODED_SIZE ). */
+#endif
+
+#ifndef HM10_OTA_FILE_BLOCK_SIZE
+#define HM10_OTA_FILE_BLOCK_SIZE                (1024U)    /**< @brief Length in bytes of the largest block of a file that the @ref hm10_ota_file sends before waiting for its confirmation. This must not be greater than 65535 bytes. */
+#endif
+
+#ifndef HM10_OTA_FILE_MIN_RATE
+#define HM10_OTA_FILE_MIN_RATE                  (960U)     /**< @brief Lowest rate in bytes per second at which the line is assumed to carry the frames of the @ref hm10_ota_file (i.e., 9600 baud, which is the default one of the HM-10 BT Device). The sender waits for each response for as long as its frame could still be going through the line at this rate, plus two more times the \p poll_delay given to the @ref init_hm10_module function. */
+#endif
+
+#ifndef HM10_OTA_FILE_MAX_RETRIES
+#define HM10_OTA_FILE_MAX_RETRIES               (5U)       /**< @brief Number of consecutive timeouts after which the @ref hm10_ota_file considers that the Bluetooth Connection was lost, and of consecutive NAK frames after which the sender of that module gives up. */
+#endif
+
+#ifndef HM10_OTA_MUX_QUEUE_SIZE
+#define HM10_OTA_MUX_QUEUE_SIZE                 (4096U)    /**< @brief Length in bytes of each of the TX queues and of each of the RX queues of the @ref hm10_ota_mux , where each queued message takes 2 bytes more than its length. This must be a power of 2. */
+#endif
+
+#ifndef HM10_OTA_PING_MAX_SAMPLES
+#define HM10_OTA_PING_MAX_SAMPLES               (64U)      /**< @brief Number of the most recent exchanges whose samples the @ref hm10_ota_ping keeps to calculate its RTT percentiles and its drift estimation. */
+#endif
+
+#ifndef HM10_OTA_PING_FILTER_SIZE
+#define HM10_OTA_PING_FILTER_SIZE               (8U)       /**< @brief Number of the most recent exchanges among which the @ref hm10_ota_ping takes the clock offset from the one with the lowest RTT. This must not be greater than @ref HM10_OTA_PING_MAX_SAMPLES . */
+#endif
+
+#ifndef HM10_TRACE
+#define HM10_TRACE                              (0U)       /**< @brief Flag used to compile the trace points of the @ref hm10_trace , which timestamp each phase of the Commands and of the exchanges of data OTA, with a 1 or, otherwise, to leave them out of the compilation with a 0. */
+#endif
+
+#ifndef HM10_TRACE_RING_SIZE
+#define HM10_TRACE_RING_SIZE                    (256U)     /**< @brief Number of records that the trace ring of the @ref hm10_trace can hold before the newest ones overwrite the oldest ones. This must be a power of 2. */
+#endif
+
+#ifndef HM10_TRACE_RDTSC
+#define HM10_TRACE_RDTSC                        (0U)       /**< @brief Flag used to make the @ref hm10_trace timestamp its records with the Time Stamp Counter of the x86 processors (i.e., the \c rdtsc instruction), which is calibrated against the monotonic clock by @ref init_hm10_trace , with a 1 or, otherwise, with the nanoseconds of the monotonic clock of \c clock_gettime() with a 0. @note The Time Stamp Counter is only suitable on processors whose Time Stamp Counter is invariant (i.e., it does not change with the frequency of the processor). */
+#endif
+
 #endif /* HM10_CONFIG_H_ */
 
 /** @} */ // HM10_config
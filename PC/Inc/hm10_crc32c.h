@@ -0,0 +1,95 @@
+/** @addtogroup hm10_ble
+ * @{
+ */
+
+/**@file
+ * @brief	HM-10 CRC32C Header file.
+ *
+ * @defgroup hm10_crc32c HM-10 CRC32C
+ * @{
+ *
+ * @brief   This module provides the CRC32C (i.e., the Castagnoli CRC, with the reflected polynomial 0x82F63B78) with
+ *          which the integrity of the data sent and received Over the Air (OTA) can be validated.
+ *
+ * @details On x86 processors that support SSE4.2, the CRC32C is calculated with the \c crc32 instructions of that
+ *          instruction set, which is detected at runtime. Otherwise, a table-driven implementation is used instead.
+ * @details The CRC32C is validated by the following OTA layers of this library, each of which drops (or rejects with a
+ *          NAK frame) the data whose CRC32C does not match before it reaches the application:<br><br>
+ *          - @ref hm10_ota_msg : Each whole message (see @ref HM10_OTA_MSG_CRC ).<br>
+ *          - @ref hm10_ota_mux : Each whole message of each channel (see @ref HM10_OTA_MSG_CRC ).<br>
+ *          - @ref hm10_ota_reliable : Each frame, including its Frame Header.<br>
+ *          - @ref hm10_ota_file : Each frame, including its header, and the whole file.<br><br>
+ * @note    The data that is sent and received directly with the @ref send_hm10_ota_data and @ref get_hm10_ota_data
+ *          functions is not checked, since these functions do not frame it. Applications that use them directly have
+ *          to either append and validate a CRC32C themselves or use one of the layers above.
+ *
+ * @author 	Cesar Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026.
+ */
+
+#ifndef HM10_CRC32C_H_
+#define HM10_CRC32C_H_
+
+#include <stdint.h> // This library contains the aliases: uint8_t, uint16_t, uint32_t, etc.
+
+#define HM10_CRC32C_SIZE        (4)     /**< @brief Length in bytes of a CRC32C. */
+
+/**@brief	Calculates the CRC32C of some data.
+ *
+ * @param[in] data  Pointer to the data whose CRC32C is desired to be calculated.
+ * @param size      Length in bytes of the data towards which the \p data param points to.
+ *
+ * @return  The CRC32C of the data.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+uint32_t calculate_hm10_crc32c(uint8_t *data, uint32_t size);
+
+/**@brief	Continues the CRC32C of some data with more data, so that the CRC32C of data that is split into several
+ *          buffers can be calculated without having to copy it into a single one.
+ *
+ * @details Calling this function with the CRC32C of some data A and with some data B gives the same result as calling
+ *          the @ref calculate_hm10_crc32c function with the data A followed by the data B. Calling it with a \p crc
+ *          param of 0 gives the same result as calling the @ref calculate_hm10_crc32c function.
+ *
+ * @param crc       CRC32C of the data that precedes the \p data param.
+ * @param[in] data  Pointer to the data with which the CRC32C is desired to be continued.
+ * @param size      Length in bytes of the data towards which the \p data param points to.
+ *
+ * @return  The CRC32C of the preceding data followed by the \p data param.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+uint32_t update_hm10_crc32c(uint32_t crc, uint8_t *data, uint32_t size);
+
+/**@brief	Indicates whether the CRC32C is being calculated with the \c crc32 instructions of SSE4.2 or with the
+ *          table-driven implementation.
+ *
+ * @retval  1 if the SSE4.2 instructions are used.
+ * @retval  0 otherwise.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+uint8_t is_hm10_crc32c_hw_accelerated();
+
+/**@brief	Enables or disables the use of the \c crc32 instructions of SSE4.2 to calculate the CRC32C.
+ *
+ * @details Both implementations give the same results, so this is only meant to compare their throughput or to work
+ *          around a processor that wrongly reports its support of SSE4.2.
+ *
+ * @param is_enabled    1 to use the SSE4.2 instructions whenever the processor supports them, or 0 to always use the
+ *                      table-driven implementation.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+void set_hm10_crc32c_hw_acceleration(uint8_t is_enabled);
+
+#endif /* HM10_CRC32C_H_ */
+
+/** @} */ // hm10_crc32c
+
+/** @} */ // hm10_ble
@@ -0,0 +1,228 @@
+/** @addtogroup hm10_ble
+ * @{
+ */
+
+/**@file
+ * @brief	HM-10 Device Fingerprint Cache Header file.
+ *
+ * @defgroup hm10_fingerprint_cache HM-10 Device Fingerprint Cache
+ * @{
+ *
+ * @brief   This module provides a small, versioned and memory-mapped on-disk cache that records, per Comport, the
+ *          fingerprint of the HM-10 BT Device that was last found and configured on it, so that an application can
+ *          skip the rediscovery and reconfiguration of that Device whenever it is restarted.
+ *
+ * @details Each fingerprint holds the Bluetooth Address of the HM-10 BT Device (as obtained via the @ref
+ *          get_hm10_bt_address function), the baud rate with which its Comport was opened, the BT Role that was set to
+ *          it and a hash of the last profile (i.e., the set of configurations) that the application applied to it.
+ * @details On start-up, the application is expected to call the @ref init_hm10_module_with_fingerprint function (or
+ *          the @ref validate_hm10_fingerprint function if the @ref hm10_ble has already been initialized), which
+ *          validates the cached fingerprint of the requested Comport with a single AT Command exchange (i.e., the Get
+ *          Address Command). If that function returns @ref HM10_EC_OK , then the HM-10 BT Device on that Comport is
+ *          the same one, with the same profile, as the last time that it was configured and, therefore, the
+ *          application may skip configuring it again. Otherwise, the application should configure the HM-10 BT Device
+ *          as usual and then call the @ref store_hm10_fingerprint function.
+ *
+ * @code
+  #include "hm10_ble_driver/PC/Inc/hm10_ble_driver.h"
+  #include "hm10_ble_driver/PC/Inc/hm10_fingerprint_cache.h"
+
+  // NOTE: RS232_OpenComport() must have already been called with the following Comport.
+  int comport = 3;
+  uint32_t baudrate = 9600;
+  uint8_t profile[] = {HM10_Role_Central, HM10_Pin_Code_DISABLED, HM10_Notify_ENABLED}; // Whatever defines the configurations that the application applies to the HM-10 BT Device.
+  uint32_t profile_hash = get_hm10_profile_hash(profile, sizeof(profile));
+
+  open_hm10_fingerprint_cache("hm10_fingerprints.cache");
+  if (init_hm10_module_with_fingerprint(comport, 1000, 500000, 3000000, baudrate, HM10_Role_Central, profile_hash) != HM10_EC_OK)
+  {
+      // Configure the HM-10 BT Device here (e.g., set_hm10_role(), set_hm10_pin_code_mode(), etc.).
+      store_hm10_fingerprint(comport, baudrate, HM10_Role_Central, profile_hash);
+  }
+  close_hm10_fingerprint_cache();
+ * @endcode
+ *
+ * @author 	Cesar Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026.
+ */
+
+#ifndef HM10_FINGERPRINT_CACHE_H_
+#define HM10_FINGERPRINT_CACHE_H_
+
+#include <stdint.h> // This library contains the aliases: uint8_t, uint16_t, uint32_t, etc.
+#include "hm10_ble_driver.h" // Custom Mortrack's Library to be able to initialize, send configuration commands and send and/or receive data to/from an HM-10 Bluetooth Device.
+
+#define HM10_FINGERPRINT_CACHE_MAGIC        (0x30314D48U)   /**< @brief Value that must be at the beginning of a valid HM-10 Fingerprint Cache File (i.e., "HM10" in ASCII and in little endian). */
+#define HM10_FINGERPRINT_CACHE_VERSION      (1U)            /**< @brief Version of the layout of the HM-10 Fingerprint Cache File. @note Any Cache File with a different version will be discarded and re-initialized. */
+#define HM10_FINGERPRINT_CACHE_MAX_COMPORTS (HM10_MAX_COMPORTS) /**< @brief Total number of Comports for which the HM-10 Fingerprint Cache File has an entry (i.e., every Comport that is supported by @ref init_hm10_module ). */
+
+/**@brief	HM-10 Fingerprint Cache File Header.
+ *
+ * @details This is the first block of data stored in an HM-10 Fingerprint Cache File and it is used to validate that
+ *          such a file was generated by this @ref hm10_fingerprint_cache with the same layout.
+ */
+typedef struct __attribute__ ((__packed__)) {
+    uint32_t magic;             //!< Expected to contain the @ref HM10_FINGERPRINT_CACHE_MAGIC value.
+    uint16_t version;           //!< Expected to contain the @ref HM10_FINGERPRINT_CACHE_VERSION value.
+    uint16_t entries;           //!< Expected to contain the @ref HM10_FINGERPRINT_CACHE_MAX_COMPORTS value.
+} HM10_Fingerprint_Cache_Header;
+
+/**@brief	HM-10 Device Fingerprint.
+ *
+ * @details This structure holds the data with which an HM-10 BT Device, that was configured on a certain Comport, is
+ *          identified in the HM-10 Fingerprint Cache File.
+ */
+typedef struct __attribute__ ((__packed__)) {
+    uint8_t  is_valid;                      //!< Flag that indicates whether this fingerprint contains data (i.e., 1) or not (i.e., 0).
+    uint8_t  role;                          //!< BT Role that was set to the HM-10 BT Device (see @ref HM10_Role ).
+    uint16_t reserved;                      //!< Reserved for future use. This is always set to 0.
+    uint32_t baudrate;                      //!< Baud rate with which the Comport of the HM-10 BT Device was opened.
+    uint32_t profile_hash;                  //!< Hash of the last profile applied to the HM-10 BT Device (see @ref get_hm10_profile_hash ).
+    char     bt_addr[HM10_BT_ADDR_SIZE];    //!< Bluetooth Address of the HM-10 BT Device (see @ref get_hm10_bt_address ).
+} HM10_Fingerprint;
+
+/**@brief	Opens or creates the HM-10 Fingerprint Cache File at a desired File Path and memory-maps it.
+ *
+ * @details If the requested file does not exist, or if it has an invalid magic number, a different version or a
+ *          different size than the one expected by this @ref hm10_fingerprint_cache , then it will be (re)initialized
+ *          with no fingerprints in it.
+ *
+ * @param[in] file_path File Path of the HM-10 Fingerprint Cache File.
+ *
+ * @retval	HM10_EC_OK	if the HM-10 Fingerprint Cache File was successfully opened and memory-mapped.
+ * @retval  HM10_EC_ERR otherwise (e.g., if there is already an opened HM-10 Fingerprint Cache File).
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+HM10_Status open_hm10_fingerprint_cache(const char *file_path);
+
+/**@brief	Validates the cached fingerprint of a desired Comport against the HM-10 BT Device currently connected to it.
+ *
+ * @details The cached fingerprint is first compared against the given \p baudrate , \p role and \p profile_hash
+ *          params. Only if they match, a single Get Address Command is sent to the HM-10 BT Device (via the @ref
+ *          get_hm10_bt_address function) to confirm that it is the same Device that was cached.
+ *
+ * @note    The @ref init_hm10_module function must have already been called. The Get Address Command is sent to
+ *          the HM-10 BT Device of the requested \p comport even if the @ref hm10_ble is currently pointing towards a
+ *          different one, after which it is pointed back towards the Comport that it was using before.
+ *
+ * @param comport       Comport of the HM-10 BT Device whose fingerprint is desired to be validated.
+ * @param baudrate      Baud rate with which the \p comport was opened.
+ * @param role          BT Role that the application would set to the HM-10 BT Device.
+ * @param profile_hash  Hash of the profile that the application would apply to the HM-10 BT Device.
+ *
+ * @retval	HM10_EC_OK	if the cached fingerprint matches with the HM-10 BT Device and, therefore, its rediscovery and
+ *                      reconfiguration can be skipped.
+ * @retval  HM10_EC_NA  if there is no cached fingerprint for the requested Comport or if it does not match with the
+ *                      HM-10 BT Device (i.e., the HM-10 BT Device should be configured again).
+ * @retval  HM10_EC_NR  if there was no response from the HM-10 BT Device.
+ * @retval  HM10_EC_ERR otherwise.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+HM10_Status validate_hm10_fingerprint(int comport, uint32_t baudrate, HM10_Role role, uint32_t profile_hash);
+
+/**@brief	Initializes the @ref hm10_ble towards a desired Comport and then validates the cached fingerprint of that
+ *          Comport, so that an application can know on start-up whether it may skip the rediscovery and
+ *          reconfiguration of its HM-10 BT Device.
+ *
+ * @details This is equivalent to calling the @ref init_hm10_module function and then the @ref
+ *          validate_hm10_fingerprint function.
+ *
+ * @note    The HM-10 Fingerprint Cache File must have already been opened via the @ref open_hm10_fingerprint_cache
+ *          function.
+ *
+ * @param comport                       Same as the \p comport param of the @ref init_hm10_module function.
+ * @param send_bytes_delay              Same as the \p send_bytes_delay param of the @ref init_hm10_module function.
+ * @param poll_delay                    Same as the \p poll_delay param of the @ref init_hm10_module function.
+ * @param connect_to_address_timeout    Same as the \p connect_to_address_timeout param of the @ref init_hm10_module
+ *                                      function.
+ * @param baudrate                      Baud rate with which the \p comport was opened.
+ * @param role                          BT Role that the application would set to the HM-10 BT Device.
+ * @param profile_hash                  Hash of the profile that the application would apply to the HM-10 BT Device.
+ *
+ * @return  Same as the @ref validate_hm10_fingerprint function, except that @ref HM10_EC_ERR is also returned if the
+ *          @ref hm10_ble could not be initialized.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+HM10_Status init_hm10_module_with_fingerprint(int comport, uint32_t send_bytes_delay, uint32_t poll_delay, uint32_t connect_to_address_timeout, uint32_t baudrate, HM10_Role role, uint32_t profile_hash);
+
+/**@brief	Gets the Bluetooth Address of the HM-10 BT Device of a desired Comport and stores its fingerprint into the
+ *          HM-10 Fingerprint Cache File.
+ *
+ * @note    The @ref init_hm10_module function must have already been called. The Get Address Command is sent to
+ *          the HM-10 BT Device of the requested \p comport even if the @ref hm10_ble is currently pointing towards a
+ *          different one, after which it is pointed back towards the Comport that it was using before.
+ *
+ * @param comport       Comport of the HM-10 BT Device whose fingerprint is desired to be stored.
+ * @param baudrate      Baud rate with which the \p comport was opened.
+ * @param role          BT Role that was set to the HM-10 BT Device.
+ * @param profile_hash  Hash of the profile that was applied to the HM-10 BT Device.
+ *
+ * @retval	HM10_EC_OK	if the fingerprint was successfully stored.
+ * @retval  HM10_EC_NR  if there was no response from the HM-10 BT Device.
+ * @retval  HM10_EC_ERR otherwise.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+HM10_Status store_hm10_fingerprint(int comport, uint32_t baudrate, HM10_Role role, uint32_t profile_hash);
+
+/**@brief	Gets the cached fingerprint of a desired Comport.
+ *
+ * @param comport           Comport whose cached fingerprint is desired to be obtained.
+ * @param[out] fingerprint  Pointer to the Memory Address into which the cached fingerprint will be stored.
+ *
+ * @retval	HM10_EC_OK	if there is a cached fingerprint for the requested Comport.
+ * @retval  HM10_EC_NA  if there is no cached fingerprint for the requested Comport.
+ * @retval  HM10_EC_ERR otherwise.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+HM10_Status get_hm10_fingerprint(int comport, HM10_Fingerprint *fingerprint);
+
+/**@brief	Removes the cached fingerprint of a desired Comport so that its HM-10 BT Device gets configured again on
+ *          the next start-up.
+ *
+ * @param comport   Comport whose cached fingerprint is desired to be removed.
+ *
+ * @retval	HM10_EC_OK	if the cached fingerprint was successfully removed.
+ * @retval  HM10_EC_ERR otherwise.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+HM10_Status invalidate_hm10_fingerprint(int comport);
+
+/**@brief	Flushes and closes the currently opened HM-10 Fingerprint Cache File.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+void close_hm10_fingerprint_cache();
+
+/**@brief	Calculates the 32-bit FNV-1a hash of a desired profile.
+ *
+ * @details A profile is whatever data that defines the configurations that an application applies to its HM-10 BT
+ *          Device (e.g., BT Name, BT Role, Pin Code Mode, Pin, etc.).
+ *
+ * @param[in] profile   Pointer to the data of the profile.
+ * @param size          Length in bytes of the data towards which the \p profile param points to.
+ *
+ * @return  The 32-bit FNV-1a hash of the requested profile.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+uint32_t get_hm10_profile_hash(const uint8_t *profile, uint32_t size);
+
+#endif /* HM10_FINGERPRINT_CACHE_H_ */
+
+/** @} */ // hm10_fingerprint_cache
+
+/** @} */ // hm10_ble
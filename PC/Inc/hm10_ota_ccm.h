@@ -0,0 +1,142 @@
+/** @addtogroup hm10_ble
+ * @{
+ */
+
+/**@file
+ * @brief	HM-10 OTA AES-CCM Header file.
+ *
+ * @defgroup hm10_ota_ccm HM-10 OTA AES-CCM
+ * @{
+ *
+ * @brief   This module provides the AES-128-CCM Authenticated Encryption with Associated Data (AEAD) with which the
+ *          data sent and received Over the Air (OTA) can be protected at the application layer, since the Pin Code of
+ *          the HM-10 BT Device (see @ref set_hm10_pin ) does not provide any meaningful confidentiality.
+ *
+ * @details The CCM mode is implemented as in the NIST SP 800-38C (i.e., the same as in the RFC 3610), with a nonce of
+ *          @ref HM10_OTA_CCM_NONCE_SIZE bytes, a length field of 2 bytes and a tag of @ref HM10_OTA_CCM_TAG_SIZE bytes.
+ *          The data is encrypted and decrypted in place, and all the state of a key is held in a @ref
+ *          HM10_OTA_CCM_Context that is allocated by the application, so that no buffers are allocated per packet.
+ * @details On x86 processors that support AES-NI, which is detected at runtime, each block is encrypted with the
+ *          \c aesenc instructions, and the CBC-MAC and the CTR keystream blocks are encrypted two at a time so that
+ *          both chains run in parallel. Otherwise, a portable implementation is used instead, which calculates the
+ *          S-box arithmetically in GF(256) rather than with a lookup table so that its timing does not depend on the
+ *          key or on the data.
+ *
+ * @note    A nonce must never be used twice with the same key.
+ *
+ * @author 	Cesar Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026.
+ */
+
+#ifndef HM10_OTA_CCM_H_
+#define HM10_OTA_CCM_H_
+
+#include <stdint.h> // This library contains the aliases: uint8_t, uint16_t, uint32_t, etc.
+#include "hm10_ble_driver.h" // Custom Mortrack's Library to be able to initialize, send configuration commands and send and/or receive data to/from an HM-10 Bluetooth Device.
+
+#define HM10_OTA_CCM_KEY_SIZE           (16)    /**< @brief Length in bytes of an AES-128 key. */
+#define HM10_OTA_CCM_BLOCK_SIZE         (16)    /**< @brief Length in bytes of an AES block. */
+#define HM10_OTA_CCM_NONCE_SIZE         (13)    /**< @brief Length in bytes of a nonce, which leaves 2 bytes for the length of the data. */
+#define HM10_OTA_CCM_TAG_SIZE           (8)     /**< @brief Length in bytes of an authentication tag. */
+#define HM10_OTA_CCM_MAX_AAD_SIZE       (0xFEFFU)  /**< @brief Length in bytes of the largest associated data, which is the largest one whose length is encoded in 2 bytes. */
+
+/**@brief	HM-10 OTA AES-CCM Context.
+ *
+ * @details This holds the expanded key with which the data is encrypted and decrypted.
+ */
+typedef struct {
+    uint8_t round_keys[11*HM10_OTA_CCM_BLOCK_SIZE];     //!< Round keys of the AES-128 key schedule, in the order in which they are applied.
+    uint8_t is_aesni;                                   //!< Flag indicating whether the AES-NI instructions are used (i.e., 1) or not (i.e., 0).
+} HM10_OTA_CCM_Context;
+
+/**@brief	Initializes an HM-10 OTA AES-CCM Context with an AES-128 key.
+ *
+ * @param[out] ctx  Pointer to the context that is desired to be initialized.
+ * @param[in] key   Pointer to the key of @ref HM10_OTA_CCM_KEY_SIZE bytes.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+void init_hm10_ota_ccm_context(HM10_OTA_CCM_Context *ctx, uint8_t *key);
+
+/**@brief	Erases the expanded key held by an HM-10 OTA AES-CCM Context.
+ *
+ * @param[out] ctx  Pointer to the context that is desired to be erased.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+void clear_hm10_ota_ccm_context(HM10_OTA_CCM_Context *ctx);
+
+/**@brief	Encrypts some data in place and calculates its authentication tag.
+ *
+ * @param[in] ctx       Pointer to the context of the key.
+ * @param[in] nonce     Pointer to the nonce of @ref HM10_OTA_CCM_NONCE_SIZE bytes.
+ * @param[in] aad       Pointer to the associated data, which is authenticated but not encrypted, or \c NULL if there
+ *                      is none.
+ * @param aad_size      Length in bytes of the associated data, which must not be greater than @ref
+ *                      HM10_OTA_CCM_MAX_AAD_SIZE .
+ * @param[in,out] data  Pointer to the data that is desired to be encrypted, which will be overwritten with its
+ *                      ciphertext.
+ * @param size          Length in bytes of the data towards which the \p data param points to.
+ * @param[out] tag      Pointer to the Memory Address into which the authentication tag of @ref HM10_OTA_CCM_TAG_SIZE
+ *                      bytes will be stored.
+ *
+ * @retval	HM10_EC_OK	if the data was successfully encrypted.
+ * @retval  HM10_EC_ERR if the \p aad_size param is invalid.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+HM10_Status encrypt_hm10_ota_ccm(HM10_OTA_CCM_Context *ctx, uint8_t *nonce, uint8_t *aad, uint16_t aad_size, uint8_t *data, uint16_t size, uint8_t *tag);
+
+/**@brief	Decrypts some data in place and validates its authentication tag.
+ *
+ * @param[in] ctx       Pointer to the context of the key.
+ * @param[in] nonce     Pointer to the nonce of @ref HM10_OTA_CCM_NONCE_SIZE bytes.
+ * @param[in] aad       Pointer to the associated data, or \c NULL if there is none.
+ * @param aad_size      Length in bytes of the associated data, which must not be greater than @ref
+ *                      HM10_OTA_CCM_MAX_AAD_SIZE .
+ * @param[in,out] data  Pointer to the ciphertext that is desired to be decrypted, which will be overwritten with its
+ *                      plaintext if the authentication tag is valid, or with zeros otherwise.
+ * @param size          Length in bytes of the ciphertext towards which the \p data param points to.
+ * @param[in] tag       Pointer to the authentication tag of @ref HM10_OTA_CCM_TAG_SIZE bytes.
+ *
+ * @retval	HM10_EC_OK	if the data was successfully decrypted and authenticated.
+ * @retval  HM10_EC_NA  if the authentication tag does not match (i.e., the data was corrupted or forged).
+ * @retval  HM10_EC_ERR if the \p aad_size param is invalid.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+HM10_Status decrypt_hm10_ota_ccm(HM10_OTA_CCM_Context *ctx, uint8_t *nonce, uint8_t *aad, uint16_t aad_size, uint8_t *data, uint16_t size, uint8_t *tag);
+
+/**@brief	Indicates whether AES is being calculated with the AES-NI instructions or with the portable implementation.
+ *
+ * @retval  1 if the AES-NI instructions are used.
+ * @retval  0 otherwise.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+uint8_t is_hm10_ota_ccm_hw_accelerated();
+
+/**@brief	Enables or disables the use of the AES-NI instructions to calculate AES.
+ *
+ * @details Both implementations give the same results, so this is only meant to compare their throughput or to work
+ *          around a processor that wrongly reports its support of AES-NI. This only applies to the contexts that are
+ *          initialized afterwards with the @ref init_hm10_ota_ccm_context function.
+ *
+ * @param is_enabled    1 to use the AES-NI instructions whenever the processor supports them, or 0 to always use the
+ *                      portable implementation.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+void set_hm10_ota_ccm_hw_acceleration(uint8_t is_enabled);
+
+#endif /* HM10_OTA_CCM_H_ */
+
+/** @} */ // hm10_ota_ccm
+
+/** @} */ // hm10_ble
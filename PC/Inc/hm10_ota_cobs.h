@@ -0,0 +1,134 @@
+/** @addtogroup hm10_ble
+ * @{
+ */
+
+/**@file
+ * @brief	HM-10 OTA COBS Framing Header file.
+ *
+ * @defgroup hm10_ota_cobs HM-10 OTA COBS Framing
+ * @{
+ *
+ * @brief   This module provides a framing mode for the data sent and received Over the Air (OTA) that is based on the
+ *          Consistent Overhead Byte Stuffing (COBS), so that the receiver can find the boundaries of each frame without
+ *          knowing its length beforehand and can re-synchronize by itself after losing any byte.
+ *
+ * @details Each frame is encoded with COBS, which removes all of its bytes with the value 0x00 at a cost of at most one
+ *          byte per each 254 bytes of the frame (see @ref HM10_OTA_COBS_MAX_ENCODED_SIZE ), and is then sent followed
+ *          by a single @ref HM10_OTA_COBS_DELIMITER byte. Therefore, whenever a byte is lost OTA, only the frame that
+ *          contained it is affected, since the receiver starts again with the next frame as soon as it finds the next
+ *          delimiter.
+ * @details The received bytes are stored into a ring buffer of @ref HM10_OTA_COBS_RX_RING_SIZE bytes, which is scanned
+ *          for the delimiters 16 bytes at a time with SSE2 instructions, whenever SSE2 is available, and only once per
+ *          each received byte.
+ *
+ * @note    COBS does not detect a corrupted frame whose encoding is still valid, so it is recommended to validate the
+ *          integrity of the frames with a CRC (e.g., @ref calculate_hm10_crc32c ).
+ *
+ * @author 	Cesar Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026.
+ */
+
+#ifndef HM10_OTA_COBS_H_
+#define HM10_OTA_COBS_H_
+
+#include <stdint.h> // This library contains the aliases: uint8_t, uint16_t, uint32_t, etc.
+#include "hm10_ble_driver.h" // Custom Mortrack's Library to be able to initialize, send configuration commands and send and/or receive data to/from an HM-10 Bluetooth Device.
+
+#define HM10_OTA_COBS_DELIMITER                 (0x00U)     /**< @brief Value of the byte that is sent at the end of each encoded frame. */
+#define HM10_OTA_COBS_MAX_ENCODED_SIZE(size)    ((size) + ((size) / 254U) + 1U)    /**< @brief Length in bytes of the largest encoding of a frame of \p size bytes, without its delimiter. */
+
+/**@brief	HM-10 OTA COBS Framing Statistics.
+ */
+typedef struct {
+    uint32_t frames_sent;       //!< Number of frames that have been sent.
+    uint32_t frames_received;   //!< Number of frames that have been received and successfully decoded.
+    uint32_t frames_dropped;    //!< Number of received frames that were discarded because of an invalid encoding or length.
+    uint32_t bytes_discarded;   //!< Number of received bytes that were discarded while re-synchronizing with the next delimiter.
+} HM10_OTA_COBS_Stats;
+
+/**@brief	Encodes a frame with COBS.
+ *
+ * @param[in] src   Pointer to the frame that is desired to be encoded.
+ * @param size      Length in bytes of the frame towards which the \p src param points to.
+ * @param[out] dst  Pointer to the Memory Address into which the encoded frame will be stored, which must be able to
+ *                  hold @ref HM10_OTA_COBS_MAX_ENCODED_SIZE bytes for the \p size param.
+ *
+ * @return  Length in bytes of the encoded frame, without its delimiter.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+uint16_t encode_hm10_ota_cobs(uint8_t *src, uint16_t size, uint8_t *dst);
+
+/**@brief	Decodes a frame that was encoded with COBS.
+ *
+ * @param[in] src       Pointer to the encoded frame, without its delimiter.
+ * @param size          Length in bytes of the encoded frame towards which the \p src param points to.
+ * @param[out] dst      Pointer to the Memory Address into which the decoded frame will be stored.
+ * @param max_size      Largest number of bytes that can be stored into the \p dst param.
+ * @param[out] dst_size Pointer to the Memory Address into which the length in bytes of the decoded frame will be stored.
+ *
+ * @retval	HM10_EC_OK	if the frame was successfully decoded.
+ * @retval  HM10_EC_ERR if the encoding of the frame is invalid or if the decoded frame does not fit into the \p dst
+ *                      param.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+HM10_Status decode_hm10_ota_cobs(uint8_t *src, uint16_t size, uint8_t *dst, uint16_t max_size, uint16_t *dst_size);
+
+/**@brief	Discards all the bytes in the ring buffer of the receiver and resets the statistics of the HM-10 OTA COBS
+ *          Framing.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+void reset_hm10_ota_cobs();
+
+/**@brief	Encodes a frame with COBS and sends it Over the Air (OTA), followed by its delimiter, via the HM-10 BT
+ *          Device.
+ *
+ * @param[in] data  Pointer to the frame that is desired to be sent.
+ * @param size      Length in bytes of the frame towards which the \p data param points to, which must not be greater
+ *                  than @ref HM10_OTA_COBS_MAX_FRAME_SIZE .
+ *
+ * @retval	HM10_EC_OK	if the frame was successfully sent.
+ * @retval  HM10_EC_ERR otherwise.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+HM10_Status send_hm10_ota_cobs_frame(uint8_t *data, uint16_t size);
+
+/**@brief	Gets the next frame that has been received Over the Air (OTA) via the HM-10 BT Device.
+ *
+ * @details Any frame whose encoding is invalid, whose length is greater than @ref HM10_OTA_COBS_MAX_FRAME_SIZE or that
+ *          is empty is discarded, and this function continues with the next one.
+ *
+ * @param[out] data     Pointer to the Memory Address into which the frame will be stored.
+ * @param max_size      Largest number of bytes that can be stored into the \p data param.
+ * @param[out] size     Pointer to the Memory Address into which the length in bytes of the frame will be stored.
+ *
+ * @retval	HM10_EC_OK	if a frame was received.
+ * @retval  HM10_EC_NR  if no complete frame was received within the timeout of the @ref get_hm10_ota_available_data
+ *                      function. The bytes received so far are kept for the next call of this function.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+HM10_Status get_hm10_ota_cobs_frame(uint8_t *data, uint16_t max_size, uint16_t *size);
+
+/**@brief	Gets the statistics of the HM-10 OTA COBS Framing.
+ *
+ * @param[out] stats    Pointer to the Memory Address into which the statistics will be stored.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+void get_hm10_ota_cobs_stats(HM10_OTA_COBS_Stats *stats);
+
+#endif /* HM10_OTA_COBS_H_ */
+
+/** @} */ // hm10_ota_cobs
+
+/** @} */ // hm10_ble
@@ -0,0 +1,159 @@
+/** @addtogroup hm10_ble
+ * @{
+ */
+
+/**@file
+ * @brief	HM-10 OTA Delta Telemetry Codec Header file.
+ *
+ * @defgroup hm10_ota_delta HM-10 OTA Delta Telemetry Codec
+ * @{
+ *
+ * @brief   This module provides a codec for periodic telemetry frames that packs several samples into a single HM-10
+ *          packet, which is meant to be sent Over the Air (OTA) with the @ref send_hm10_ota_data function and to be
+ *          received with the @ref get_hm10_ota_data function.
+ *
+ * @details Each sample consists of a fixed number of 32-bit fields. Since most samples repeat the previous one with small
+ *          numeric changes, each field is encoded against the same field of a reference sample, either as its
+ *          difference mapped with a zig-zag encoding (see @ref HM10_OTA_Delta_Difference ) or as its XOR (see @ref
+ *          HM10_OTA_Delta_XOR ), and is then packed as an unsigned LEB128 varint. The first sample of each packet is
+ *          encoded against the last sample of a previous packet that the receiver has acknowledged, and each of the
+ *          next samples is encoded against the sample that precedes it within the same packet.
+ * @details Each packet has the following format:<br><br>
+ *          - Byte 0: Packet ID.<br>
+ *          - Byte 1: Packet ID of the reference packet.<br>
+ *          - Byte 2, Bit 7: Reference flag, which is set if the first sample is encoded against the reference packet
+ *            or cleared if it is encoded against a sample with all of its fields equal to 0.<br>
+ *          - Byte 2, Bits 4 to 6: Reserved. These are always set to 0.<br>
+ *          - Byte 2, Bits 0 to 3: Number of samples in the packet.<br>
+ *          - Bytes 3 to 18: Varints of the fields of the samples.<br><br>
+ * @details The receiver keeps the last sample of the last @ref HM10_OTA_DELTA_REFERENCES packets that it decoded, so a
+ *          lost packet only requires the application to keep acknowledging the received ones (see @ref
+ *          acknowledge_hm10_ota_delta_packet ) for the sender to use a valid reference again.
+ * @details On the PC, the decoder finds the end of all the varints of a packet at once with SSE2 instructions and
+ *          reconstructs 4 fields at a time from their references, whenever SSE2 is available.
+ *
+ * @author 	Cesar Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026.
+ */
+
+#ifndef HM10_OTA_DELTA_H_
+#define HM10_OTA_DELTA_H_
+
+#include <stdint.h> // This library contains the aliases: uint8_t, uint16_t, uint32_t, etc.
+#include "hm10_ble_driver.h" // Custom Mortrack's Library to be able to initialize, send configuration commands and send and/or receive data to/from an HM-10 Bluetooth Device.
+
+#define HM10_OTA_DELTA_PACKET_SIZE          (19)        /**< @brief Total maximum bytes of a packet of this codec, which matches the maximum length of an HM-10 packet. */
+#define HM10_OTA_DELTA_HEADER_SIZE          (3)         /**< @brief Length in bytes of the Packet Header. */
+#define HM10_OTA_DELTA_MAX_PAYLOAD_SIZE     (HM10_OTA_DELTA_PACKET_SIZE - HM10_OTA_DELTA_HEADER_SIZE)  /**< @brief Total maximum bytes of varints that a single packet can carry. */
+#define HM10_OTA_DELTA_MAX_FIELDS           (8)         /**< @brief Largest number of fields that a sample can have. */
+#define HM10_OTA_DELTA_MAX_SAMPLES          (15)        /**< @brief Largest number of samples that a single packet can carry. */
+#define HM10_OTA_DELTA_REFERENCES           (4)         /**< @brief Number of sent or received packets whose last sample is kept to be used as a reference. */
+#define HM10_OTA_DELTA_REFERENCE_FLAG       (0x80U)     /**< @brief Bit mask of the Reference flag in the Packet Header. */
+#define HM10_OTA_DELTA_RESERVED_MASK        (0x70U)     /**< @brief Bit mask of the Reserved bits in the Packet Header. */
+#define HM10_OTA_DELTA_COUNT_MASK           (0x0FU)     /**< @brief Bit mask of the number of samples in the Packet Header. */
+
+/**@brief	HM-10 OTA Delta Telemetry Codec Modes.
+ */
+typedef enum
+{
+    HM10_OTA_Delta_Difference   = 0U,    //!< Each field is encoded as the zig-zag mapped difference against its reference, which suits fields that slowly increase or decrease (e.g., temperatures).
+    HM10_OTA_Delta_XOR          = 1U     //!< Each field is encoded as the XOR against its reference, which suits fields whose bits change independently (e.g., flags).
+} HM10_OTA_Delta_Mode;
+
+/**@brief	Sample of a previous packet that can be used as a reference.
+ */
+typedef struct {
+    uint8_t packet_id;                              //!< Packet ID of the packet whose last sample this is.
+    uint8_t is_valid;                               //!< Flag indicating whether this reference holds a sample (i.e., 1) or not (i.e., 0).
+    uint32_t fields[HM10_OTA_DELTA_MAX_FIELDS];     //!< Fields of the sample.
+} HM10_OTA_Delta_Reference;
+
+/**@brief	HM-10 OTA Delta Telemetry Codec Context.
+ *
+ * @details A different context must be used to encode and to decode.
+ */
+typedef struct {
+    HM10_OTA_Delta_Mode mode;                                       //!< Mode with which the fields are encoded.
+    uint8_t field_count;                                            //!< Number of fields of each sample.
+    uint8_t next_packet_id;                                         //!< Packet ID that will be given to the next encoded packet (only used to encode).
+    HM10_OTA_Delta_Reference acked;                                 //!< Last sample of the last packet acknowledged by the receiver (only used to encode).
+    HM10_OTA_Delta_Reference references[HM10_OTA_DELTA_REFERENCES]; //!< Last sample of the last packets that were encoded or decoded.
+} HM10_OTA_Delta_Context;
+
+/**@brief	Initializes an HM-10 OTA Delta Telemetry Codec Context.
+ *
+ * @param[out] ctx      Pointer to the context that is desired to be initialized.
+ * @param mode          Mode with which the fields will be encoded.
+ * @param field_count   Number of fields of each sample, which must be within 1 and @ref HM10_OTA_DELTA_MAX_FIELDS .
+ *
+ * @retval	HM10_EC_OK	if the context was successfully initialized.
+ * @retval  HM10_EC_ERR if the \p field_count param is invalid.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+HM10_Status init_hm10_ota_delta_context(HM10_OTA_Delta_Context *ctx, HM10_OTA_Delta_Mode mode, uint8_t field_count);
+
+/**@brief	Encodes as many samples as they fit into a single packet.
+ *
+ * @param[in,out] ctx           Pointer to the context with which the samples will be encoded.
+ * @param[in] samples           Pointer to the samples that are desired to be encoded, where the fields of each sample
+ *                              are stored one after the other.
+ * @param sample_count          Number of samples towards which the \p samples param points to.
+ * @param[out] packet           Pointer to the Memory Address into which the encoded packet will be stored, which must
+ *                              be able to hold @ref HM10_OTA_DELTA_PACKET_SIZE bytes.
+ * @param[out] packet_size      Pointer to the Memory Address into which the length in bytes of the encoded packet will
+ *                              be stored.
+ * @param[out] encoded_samples  Pointer to the Memory Address into which the number of samples that were encoded into
+ *                              the packet will be stored, which will be at least 1.
+ *
+ * @retval	HM10_EC_OK	if at least one sample was encoded.
+ * @retval  HM10_EC_ERR if the \p sample_count param is 0 or if a single sample does not fit into a packet.
+ *
+ * @note    The varints of a single sample must not exceed @ref HM10_OTA_DELTA_MAX_PAYLOAD_SIZE bytes. Since the first
+ *          sample is encoded against a sample with all of its fields equal to 0 until a packet is acknowledged, it is
+ *          recommended to use fields whose magnitude is small (e.g., offsets from a known baseline).
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+HM10_Status encode_hm10_ota_delta_packet(HM10_OTA_Delta_Context *ctx, int32_t *samples, uint16_t sample_count, uint8_t *packet, uint8_t *packet_size, uint8_t *encoded_samples);
+
+/**@brief	Indicates to the encoder that the receiver has acknowledged a packet, so that its last sample is used as the
+ *          reference of the next encoded packets.
+ *
+ * @param[in,out] ctx   Pointer to the context with which the packet was encoded.
+ * @param packet_id     Packet ID of the acknowledged packet.
+ *
+ * @retval	HM10_EC_OK	if the reference was updated.
+ * @retval  HM10_EC_NA  if the packet is no longer among the last @ref HM10_OTA_DELTA_REFERENCES encoded ones.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+HM10_Status acknowledge_hm10_ota_delta_packet(HM10_OTA_Delta_Context *ctx, uint8_t packet_id);
+
+/**@brief	Decodes the samples of a packet that was encoded with the @ref encode_hm10_ota_delta_packet function.
+ *
+ * @param[in,out] ctx           Pointer to the context with which the packet will be decoded.
+ * @param[in] packet            Pointer to the packet.
+ * @param packet_size           Length in bytes of the packet towards which the \p packet param points to.
+ * @param[out] samples          Pointer to the Memory Address into which the decoded samples will be stored, which must
+ *                              be able to hold @ref HM10_OTA_DELTA_MAX_SAMPLES samples.
+ * @param[out] sample_count     Pointer to the Memory Address into which the number of decoded samples will be stored.
+ *
+ * @retval	HM10_EC_OK	if the packet was successfully decoded.
+ * @retval  HM10_EC_NA  if the reference packet of the packet is no longer among the last @ref
+ *                      HM10_OTA_DELTA_REFERENCES decoded ones.
+ * @retval  HM10_EC_ERR if the packet is malformed.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+HM10_Status decode_hm10_ota_delta_packet(HM10_OTA_Delta_Context *ctx, uint8_t *packet, uint8_t packet_size, int32_t *samples, uint8_t *sample_count);
+
+#endif /* HM10_OTA_DELTA_H_ */
+
+/** @} */ // hm10_ota_delta
+
+/** @} */ // hm10_ble
@@ -0,0 +1,132 @@
+/** @addtogroup hm10_ble
+ * @{
+ */
+
+/**@file
+ * @brief	HM-10 OTA Forward Error Correction Header file.
+ *
+ * @defgroup hm10_ota_fec HM-10 OTA Forward Error Correction
+ * @{
+ *
+ * @brief   This module provides an optional Forward Error Correction (FEC) layer on top of the @ref send_hm10_ota_data
+ *          and @ref get_hm10_ota_data functions, so that the receiver can rebuild the packets that are lost Over the
+ *          Air (OTA) without having to request their retransmission.
+ *
+ * @details The data packets are sent in groups of up to k packets, each of which is followed by m parity packets that
+ *          are calculated with a systematic Reed-Solomon code over GF(256) built from a Cauchy matrix. Therefore, the
+ *          receiver can rebuild all the data packets of a group whenever any k of its k + m packets are received, and
+ *          the overhead of this layer can be configured through the ratio m / k (see @ref init_hm10_ota_fec ).
+ * @details Each packet fits into a single HM-10 packet and has the following format:<br><br>
+ *          - Byte 0: Group ID.<br>
+ *          - Byte 1, Bits 4 to 7: Index of the packet within its group, where the indexes from 0 to k - 1 are for the
+ *            data packets and the indexes from k to k + m - 1 are for the parity packets.<br>
+ *          - Byte 1, Bits 0 to 3: For parity packets, the number of data packets in the group minus 1. For data
+ *            packets, this is always set to 0.<br>
+ *          - Bytes 2 to 18: Shard of the packet. For data packets, this consists of the length of the data followed by
+ *            the data itself. For parity packets, this consists of @ref HM10_OTA_FEC_SHARD_SIZE bytes of parity.<br><br>
+ * @details The GF(256) arithmetic is table-driven. On x86 processors that support SSSE3, which is detected at runtime,
+ *          each shard is multiplied by a constant 16 bytes at a time with the \c pshufb instruction and two 16-entry
+ *          nibble tables.
+ *
+ * @note    Both HM-10 BT Devices must use the same k and m values.
+ *
+ * @author 	Cesar Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026.
+ */
+
+#ifndef HM10_OTA_FEC_H_
+#define HM10_OTA_FEC_H_
+
+#include <stdint.h> // This library contains the aliases: uint8_t, uint16_t, uint32_t, etc.
+#include "hm10_ble_driver.h" // Custom Mortrack's Library to be able to initialize, send configuration commands and send and/or receive data to/from an HM-10 Bluetooth Device.
+
+#define HM10_OTA_FEC_HEADER_SIZE        (2)     /**< @brief Length in bytes of the Packet Header. */
+#define HM10_OTA_FEC_SHARD_SIZE         (HM10_MAX_PACKET_SIZE - HM10_OTA_FEC_HEADER_SIZE)  /**< @brief Length in bytes of a shard. */
+#define HM10_OTA_FEC_MAX_DATA_SIZE      (HM10_OTA_FEC_SHARD_SIZE - 1)  /**< @brief Total maximum bytes of data that a single data packet can carry. */
+#define HM10_OTA_FEC_MAX_SHARDS         (16)    /**< @brief Largest number of packets (i.e., k + m) in a group, which is limited by the 4 bits of the index of each packet. */
+
+/**@brief	HM-10 OTA Forward Error Correction Statistics.
+ */
+typedef struct {
+    uint32_t data_packets_sent;         //!< Number of data packets that have been sent.
+    uint32_t parity_packets_sent;       //!< Number of parity packets that have been sent.
+    uint32_t data_packets_received;     //!< Number of data packets that have been received.
+    uint32_t parity_packets_received;   //!< Number of parity packets that have been received.
+    uint32_t data_packets_recovered;    //!< Number of lost data packets that have been rebuilt from the parity packets.
+    uint32_t data_packets_lost;         //!< Number of lost data packets that could not be rebuilt, among the groups of which at least one packet was received.
+    uint32_t invalid_packets;           //!< Number of received packets that were discarded because of an invalid Packet Header.
+} HM10_OTA_FEC_Stats;
+
+/**@brief	Initializes the HM-10 OTA Forward Error Correction layer and resets its groups and its statistics.
+ *
+ * @param data_shards   Number of data packets (i.e., k) of each group.
+ * @param parity_shards Number of parity packets (i.e., m) of each group. The sum of both params must not be greater
+ *                      than @ref HM10_OTA_FEC_MAX_SHARDS .
+ *
+ * @retval	HM10_EC_OK	if the FEC layer was successfully initialized.
+ * @retval  HM10_EC_ERR if the given params are invalid.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+HM10_Status init_hm10_ota_fec(uint8_t data_shards, uint8_t parity_shards);
+
+/**@brief	Sends a data packet Over the Air (OTA) via the HM-10 BT Device and, if it completes a group, the parity
+ *          packets of that group.
+ *
+ * @param[in] data  Pointer to the data that is desired to be sent.
+ * @param size      Length in bytes of the data towards which the \p data param points to, which must be within 1 and
+ *                  @ref HM10_OTA_FEC_MAX_DATA_SIZE .
+ *
+ * @retval	HM10_EC_OK	if the packets were successfully sent.
+ * @retval  HM10_EC_ERR otherwise.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+HM10_Status send_hm10_ota_fec_data(uint8_t *data, uint8_t size);
+
+/**@brief	Sends the parity packets of the current group even if it has less than k data packets, which is meant to
+ *          be called whenever there is no more data to be sent for a while.
+ *
+ * @retval	HM10_EC_OK	if the parity packets were successfully sent or if the current group has no data packets.
+ * @retval  HM10_EC_ERR otherwise.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+HM10_Status flush_hm10_ota_fec();
+
+/**@brief	Gets the next data packet that has been received Over the Air (OTA) via the HM-10 BT Device, either as it
+ *          was received or as it was rebuilt from the parity packets of its group.
+ *
+ * @details The data packets are given in the same order in which they were sent. Whenever a data packet is lost and it
+ *          cannot be rebuilt, it is skipped once a packet of a later group is received.
+ *
+ * @param[out] data     Pointer to the Memory Address into which the data will be stored, which must be able to hold
+ *                      @ref HM10_OTA_FEC_MAX_DATA_SIZE bytes.
+ * @param[out] size     Pointer to the Memory Address into which the length in bytes of the data will be stored.
+ *
+ * @retval	HM10_EC_OK	if a data packet was given.
+ * @retval  HM10_EC_NR  if no data packet could be given within the timeout of the @ref get_hm10_ota_data function.
+ * @retval  HM10_EC_ERR if the FEC layer has not been initialized.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+HM10_Status get_hm10_ota_fec_data(uint8_t *data, uint8_t *size);
+
+/**@brief	Gets the statistics of the HM-10 OTA Forward Error Correction layer.
+ *
+ * @param[out] stats    Pointer to the Memory Address into which the statistics will be stored.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+void get_hm10_ota_fec_stats(HM10_OTA_FEC_Stats *stats);
+
+#endif /* HM10_OTA_FEC_H_ */
+
+/** @} */ // hm10_ota_fec
+
+/** @} */ // hm10_ble
@@ -0,0 +1,109 @@
+/** @addtogroup hm10_ble
+ * @{
+ */
+
+/**@file
+ * @brief	HM-10 OTA File Transfer Header file.
+ *
+ * @defgroup hm10_ota_file HM-10 OTA File Transfer
+ * @{
+ *
+ * @brief   This module provides the transfer of whole files (e.g., firmware images or configuration blobs) Over the Air
+ *          (OTA), which can be resumed from the last confirmed offset whenever the Bluetooth Connection is lost.
+ *
+ * @details The sender memory-maps the file that is desired to be sent and streams it directly from that memory-mapped
+ *          data, in blocks of up to @ref HM10_OTA_FILE_BLOCK_SIZE bytes, via the @ref send_hm10_ota_data function (and
+ *          therefore via the @ref hm10_ota_pacer , if it is enabled), so that the file is never copied into RAM. Each
+ *          block is sent along with its CRC32C and the receiver confirms it with an ACK frame only after it has
+ *          validated that CRC32C and has written the block into its own file.
+ * @details Both HM-10 BT Devices persist the last confirmed offset into a Checkpoint File (see @ref
+ *          HM10_OTA_File_Checkpoint ), which is identified with the size and the CRC32C of the whole file. Whenever a
+ *          transfer is started again with the same file, the sender proposes its confirmed offset and the receiver
+ *          agrees to resume from the lowest of that offset and its own, so that the transfer does not restart from
+ *          byte zero. The sender deletes its Checkpoint File once the whole file has been confirmed, while the
+ *          receiver keeps its own so that, if its final ACK frame is lost and the sender starts the transfer again,
+ *          only the last block is transferred again (i.e., an application may delete the Checkpoint File of the
+ *          receiver once it no longer expects that transfer to be retried).
+ * @details The frames of this module have the following formats, where all the multi-byte fields are in little
+ *          endian:<br><br>
+ *          - START frame: Type (1 byte), size of the file (4 bytes), CRC32C of the file (4 bytes) and proposed offset
+ *            (4 bytes), followed by the CRC32C of those 13 bytes (4 bytes).<br>
+ *          - BLOCK frame: Type (1 byte), offset of the block (4 bytes), length of the block (2 bytes) and CRC32C
+ *            (4 bytes), followed by the bytes of the block. That CRC32C covers both the first 7 bytes of the frame
+ *            and the bytes of the block, so that a corrupted offset or length is never trusted.<br>
+ *          - ACK and NAK frames: Type (1 byte) and the offset from which the receiver expects the next block (4 bytes),
+ *            followed by the CRC32C of those 5 bytes (4 bytes). An ACK confirms all the bytes before that offset,
+ *            while a NAK requests the sender to go back to it.<br><br>
+ *
+ * @note    Files larger than 4 GiB are not supported.
+ *
+ * @author 	Cesar Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026.
+ */
+
+#ifndef HM10_OTA_FILE_H_
+#define HM10_OTA_FILE_H_
+
+#include <stdint.h> // This library contains the aliases: uint8_t, uint16_t, uint32_t, etc.
+#include "hm10_ble_driver.h" // Custom Mortrack's Library to be able to initialize, send configuration commands and send and/or receive data to/from an HM-10 Bluetooth Device.
+
+#define HM10_OTA_FILE_CHECKPOINT_MAGIC      (0x4B434D48U)   /**< @brief Value that must be at the beginning of a valid Checkpoint File (i.e., "HMCK" in ASCII and in little endian). */
+#define HM10_OTA_FILE_CHECKPOINT_VERSION    (1U)            /**< @brief Version of the layout of the Checkpoint File. @note Any Checkpoint File with a different version will be ignored. */
+
+/**@brief	HM-10 OTA File Transfer Checkpoint.
+ *
+ * @details This is the whole content of a Checkpoint File.
+ */
+typedef struct __attribute__ ((__packed__)) {
+    uint32_t magic;             //!< Expected to contain the @ref HM10_OTA_FILE_CHECKPOINT_MAGIC value.
+    uint16_t version;           //!< Expected to contain the @ref HM10_OTA_FILE_CHECKPOINT_VERSION value.
+    uint16_t reserved;          //!< Reserved for future use. This is always set to 0.
+    uint32_t file_size;         //!< Size in bytes of the file that is being transferred.
+    uint32_t file_crc;          //!< CRC32C of the whole file that is being transferred.
+    uint32_t confirmed_offset;  //!< Offset up to which the receiver has confirmed the file.
+} HM10_OTA_File_Checkpoint;
+
+/**@brief	Sends a whole file Over the Air (OTA) via the HM-10 BT Device to another BT Device that is receiving it with
+ *          the @ref receive_hm10_ota_file function, resuming from the last confirmed offset if possible.
+ *
+ * @param[in] file_path         Path of the file that is desired to be sent.
+ * @param[in] checkpoint_path   Path of the Checkpoint File of the sender, or \c NULL if the transfer is not desired to
+ *                              be resumable from the side of the sender.
+ *
+ * @retval	HM10_EC_OK	if the whole file was confirmed by the receiver.
+ * @retval  HM10_EC_NR  if the receiver did not respond after @ref HM10_OTA_FILE_MAX_RETRIES consecutive retries (e.g.,
+ *                      because the Bluetooth Connection was lost). The transfer can be resumed later by calling this
+ *                      function again.
+ * @retval  HM10_EC_NA  if the receiver rejected the blocks with more than @ref HM10_OTA_FILE_MAX_RETRIES consecutive
+ *                      NAK frames (e.g., because the data is being corrupted).
+ * @retval  HM10_EC_ERR if the file could not be opened or memory-mapped, if it is larger than 4 GiB or if the data
+ *                      could not be sent.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+HM10_Status send_hm10_ota_file(const char *file_path, const char *checkpoint_path);
+
+/**@brief	Receives a whole file Over the Air (OTA) via the HM-10 BT Device from another BT Device that is sending it
+ *          with the @ref send_hm10_ota_file function, resuming from the last confirmed offset if possible.
+ *
+ * @param[in] file_path         Path of the file into which the received file will be written.
+ * @param[in] checkpoint_path   Path of the Checkpoint File of the receiver, or \c NULL if the transfer is not desired
+ *                              to be resumable from the side of the receiver.
+ *
+ * @retval	HM10_EC_OK	if the whole file was received.
+ * @retval  HM10_EC_NR  if no START frame was received or if the sender stopped sending BLOCK frames for @ref
+ *                      HM10_OTA_FILE_MAX_RETRIES consecutive timeouts. The transfer can be resumed later by calling this
+ *                      function again.
+ * @retval  HM10_EC_ERR if the file could not be written or if the data could not be sent.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+HM10_Status receive_hm10_ota_file(const char *file_path, const char *checkpoint_path);
+
+#endif /* HM10_OTA_FILE_H_ */
+
+/** @} */ // hm10_ota_file
+
+/** @} */ // hm10_ble
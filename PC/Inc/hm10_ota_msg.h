@@ -0,0 +1,176 @@
+/** @addtogroup hm10_ble
+ * @{
+ */
+
+/**@file
+ * @brief	HM-10 OTA Message Layer Header file.
+ *
+ * @defgroup hm10_ota_msg HM-10 OTA Message Layer
+ * @{
+ *
+ * @brief   This module provides a message layer on top of the @ref send_hm10_ota_data and @ref get_hm10_ota_data
+ *          functions so that messages larger than @ref HM10_MAX_PACKET_SIZE bytes can be sent and received Over the
+ *          Air (OTA) with their boundaries preserved.
+ *
+ * @details Each message is split into segments that fit into a single HM-10 packet. Each segment consists of a single
+ *          Segment Header byte followed by up to @ref HM10_OTA_MSG_MAX_SEGMENT_PAYLOAD_SIZE bytes of payload, where the
+ *          Segment Header has the following format:<br><br>
+ *          - Bit 7: Start flag, which is set only in the first segment of a message.<br>
+ *          - Bits 5 and 6: Reserved. These are always set to 0 (see @ref hm10_ota_mux , which uses them as a Channel
+ *            ID).<br>
+ *          - Bits 0 to 4: Length in bytes of the payload of the segment.<br><br>
+ * @details In addition, the payload of the first segment of a message starts with the total length of that message
+ *          encoded as an unsigned LEB128 varint (i.e., 1 byte for messages of up to 127 bytes and 2 bytes for larger
+ *          messages). Therefore, the overhead of this layer is of only 1 byte per packet plus 1 or 2 bytes per message.
+ * @details The receiver reads the Segment Header first and then the exact length of its payload, which is what allows
+ *          the @ref get_hm10_ota_data function to be used without knowing the size of the messages in advance. The
+ *          received segments are reassembled into a statically allocated and bounded arena of @ref
+ *          HM10_OTA_MSG_MAX_SIZE bytes, so that no dynamic memory is used by this layer.
+ * @details Whenever @ref HM10_OTA_MSG_CRC is enabled, the CRC32C of each message (see @ref hm10_crc32c ) is appended
+ *          to it, and the received messages whose CRC32C does not match are dropped before they reach the application.
+ * @details Optionally, the messages can be compressed before they are segmented and decompressed after they are
+ *          reassembled with the @ref hm10_ota_lz in its @ref HM10_OTA_LZ_Per_Message mode (see @ref
+ *          set_hm10_ota_message_compression ).
+ * @details Optionally, the (compressed) messages can also be encrypted and authenticated with the @ref hm10_ota_ccm
+ *          before their CRC32C is appended (see @ref set_hm10_ota_message_encryption ).
+ *
+ * @author 	Cesar Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026.
+ */
+
+#ifndef HM10_OTA_MSG_H_
+#define HM10_OTA_MSG_H_
+
+#include <stdint.h> // This library contains the aliases: uint8_t, uint16_t, uint32_t, etc.
+#include "hm10_ble_driver.h" // Custom Mortrack's Library to be able to initialize, send configuration commands and send and/or receive data to/from an HM-10 Bluetooth Device.
+#include "hm10_ota_lz.h" // Custom Mortrack's Library to compress the data sent Over the Air by the HM-10 Bluetooth Device.
+
+#define HM10_OTA_MSG_SEGMENT_HEADER_SIZE        (1)                                                        /**< @brief Length in bytes of the Segment Header. */
+#define HM10_OTA_MSG_MAX_SEGMENT_PAYLOAD_SIZE   (HM10_MAX_PACKET_SIZE - HM10_OTA_MSG_SEGMENT_HEADER_SIZE)  /**< @brief Total maximum bytes of payload that a single segment can carry. */
+#define HM10_OTA_MSG_START_FLAG                 (0x80U)                                                    /**< @brief Bit mask of the Start flag in the Segment Header. */
+#define HM10_OTA_MSG_RESERVED_MASK              (0x60U)                                                    /**< @brief Bit mask of the Reserved bits in the Segment Header. */
+#define HM10_OTA_MSG_LENGTH_MASK                (0x1FU)                                                    /**< @brief Bit mask of the payload length in the Segment Header. */
+#define HM10_OTA_MSG_MAX_LENGTH_PREFIX_SIZE     (2)                                                        /**< @brief Total maximum bytes of the varint that prefixes a message with its total length. */
+
+/**@brief	HM-10 OTA Message Layer Statistics.
+ */
+typedef struct {
+    uint32_t messages_sent;         //!< Number of messages that have been sent.
+    uint32_t messages_received;     //!< Number of messages that have been received and reassembled.
+    uint32_t segments_sent;         //!< Number of segments that have been sent.
+    uint32_t segments_received;     //!< Number of segments that have been received.
+    uint32_t segments_dropped;      //!< Number of received segments that were dropped (e.g., a continuation segment without a previous Start segment, or an invalid Segment Header).
+    uint32_t messages_dropped;      //!< Number of received messages that were dropped (e.g., because they were larger than @ref HM10_OTA_MSG_MAX_SIZE bytes or than the buffer of the application).
+    uint32_t crc_errors;            //!< Number of received messages that were dropped because their CRC32C did not match (see @ref HM10_OTA_MSG_CRC ).
+    uint32_t auth_errors;           //!< Number of received messages that were dropped by the encryption stage because their authentication tag did not match or because they were replayed (see @ref set_hm10_ota_message_encryption ).
+} HM10_OTA_Msg_Stats;
+
+/**@brief	Sends a message of any size of up to @ref HM10_OTA_MSG_MAX_SIZE bytes Over the Air (OTA) via the HM-10 BT
+ *          Device, by splitting it into segments that fit into a single HM-10 packet each.
+ *
+ * @param[in] msg   Pointer to the data of the message that is desired to be sent.
+ * @param size      Length in bytes of the message towards which the \p msg param points to.
+ *
+ * @retval	HM10_EC_OK	if the whole message was successfully sent.
+ * @retval  HM10_EC_ERR otherwise (e.g., if the message is larger than @ref HM10_OTA_MSG_MAX_SIZE bytes or if the
+ *                      sequence numbers of the key of the encryption stage have been exhausted).
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+HM10_Status send_hm10_ota_message(uint8_t *msg, uint16_t size);
+
+/**@brief	Receives the segments that arrive Over the Air (OTA) via the HM-10 BT Device until a whole message is
+ *          reassembled.
+ *
+ * @details If the segments stop arriving before a whole message has been reassembled, then this function returns @ref
+ *          HM10_EC_NR and the segments received so far are kept so that the reassembly can continue on the next call.
+ *
+ * @param[out] msg      Pointer to the Memory Address into which the received message will be stored.
+ * @param max_size      Length in bytes of the buffer towards which the \p msg param points to.
+ * @param[out] size     Pointer to the Memory Address into which the length in bytes of the received message will be
+ *                      stored.
+ *
+ * @retval	HM10_EC_OK	if a whole message was received.
+ * @retval  HM10_EC_NR  if no whole message was received within the timeout of the @ref get_hm10_ota_data function.
+ * @retval  HM10_EC_ERR if a whole message was received, but it did not fit into the buffer of the \p msg param or it
+ *                      could not be decompressed (in which case it is dropped).
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+HM10_Status get_hm10_ota_message(uint8_t *msg, uint16_t max_size, uint16_t *size);
+
+/**@brief	Discards any partially reassembled message and resets the compression stage.
+ *
+ * @details This is meant to be called whenever the Bluetooth Connection is lost or re-established. The compression
+ *          contexts of the compression stage are also reset, so that both sides start again from an empty window.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+void reset_hm10_ota_message_layer();
+
+/**@brief	Sets the mode of the compression stage of the HM-10 OTA Message Layer and resets its compression contexts.
+ *
+ * @details Whenever the compression stage is enabled, each message is compressed with the @ref hm10_ota_lz before it
+ *          is segmented by the @ref send_hm10_ota_message function and it is decompressed after it is reassembled by
+ *          the @ref get_hm10_ota_message function. The mode should be negotiated with the Remote BT Device through the
+ *          @ref get_hm10_ota_lz_capabilities and @ref negotiate_hm10_ota_lz_mode functions, with @ref
+ *          HM10_OTA_LZ_Per_Message as the desired mode.
+ *
+ * @note    The @ref HM10_OTA_LZ_Per_Stream mode is not supported by the Message Layer, since it drops the messages
+ *          that are not completely received or whose CRC32C does not match, after which the windows of both sides
+ *          would no longer match and every following message would be decompressed wrongly.
+ *
+ * @param mode  Desired mode of the compression stage. The compression stage is disabled by default.
+ *
+ * @retval	HM10_EC_OK	if the mode was set.
+ * @retval  HM10_EC_ERR if the \p mode param is @ref HM10_OTA_LZ_Per_Stream or an invalid mode, in which case the
+ *                      current mode is kept.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+HM10_Status set_hm10_ota_message_compression(HM10_OTA_LZ_Mode mode);
+
+/**@brief	Sets the key of the encryption stage of the HM-10 OTA Message Layer, which enables or disables it.
+ *
+ * @details Whenever the encryption stage is enabled, each (compressed) message is encrypted in place with AES-128-CCM
+ *          (see @ref hm10_ota_ccm ) and it is sent prefixed with its sequence number (4 bytes, in little endian) and
+ *          followed by its authentication tag of @ref HM10_OTA_CCM_TAG_SIZE bytes. The received messages whose
+ *          authentication tag does not match, or whose sequence number is not greater than the one of the last
+ *          authenticated message (i.e., replayed messages), are dropped before they reach the application.
+ * @details Both sides use the same key, but each one must use a different \p direction (e.g., 0 for the PC and 1 for
+ *          the other BT Device) so that the nonces of both directions never collide.
+ *
+ * @note    Calling this function restarts the sequence numbers. Therefore, a different key must be set every time
+ *          (e.g., a session key that is derived whenever the Bluetooth Connection is established), since reusing a key
+ *          would reuse its nonces.
+ *
+ * @param[in] key   Pointer to the AES-128 key of @ref HM10_OTA_CCM_KEY_SIZE bytes, or \c NULL to disable the
+ *                  encryption stage. The encryption stage is disabled by default.
+ * @param direction Direction bit (i.e., 0 or 1) of the nonces of the messages sent by this side.
+ *
+ * @retval	HM10_EC_OK	if the encryption stage was successfully configured.
+ * @retval  HM10_EC_ERR if the \p direction param is invalid.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+HM10_Status set_hm10_ota_message_encryption(uint8_t *key, uint8_t direction);
+
+/**@brief	Gets the statistics of the HM-10 OTA Message Layer.
+ *
+ * @param[out] stats    Pointer to the Memory Address into which the statistics will be stored.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+void get_hm10_ota_message_stats(HM10_OTA_Msg_Stats *stats);
+
+#endif /* HM10_OTA_MSG_H_ */
+
+/** @} */ // hm10_ota_msg
+
+/** @} */ // hm10_ble
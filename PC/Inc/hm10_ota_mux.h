@@ -0,0 +1,164 @@
+/** @addtogroup hm10_ble
+ * @{
+ */
+
+/**@file
+ * @brief	HM-10 OTA Channel Multiplexer Header file.
+ *
+ * @defgroup hm10_ota_mux HM-10 OTA Channel Multiplexer
+ * @{
+ *
+ * @brief   This module multiplexes up to @ref HM10_OTA_MUX_CHANNELS logical channels (e.g., control messages, bulk logs
+ *          and firmware updates) over the single Bluetooth Connection of the HM-10 BT Device, so that the messages of
+ *          one channel do not have to wait for a large transfer of another channel to finish.
+ *
+ * @details Each message is split into segments with the same format as the one of the @ref hm10_ota_msg , except that
+ *          bits 5 and 6 of the Segment Header (i.e., the Reserved bits of the @ref hm10_ota_msg ) hold the Channel ID.
+ *          Whenever @ref HM10_OTA_MSG_CRC is enabled, the CRC32C of each message (see @ref hm10_crc32c ) is appended
+ *          to it just as the @ref hm10_ota_msg does, and the received messages whose CRC32C does not match are dropped
+ *          before they reach their RX queue. Therefore, the channel 0 of this module is compatible with the @ref
+ *          hm10_ota_msg whenever the compression and encryption stages of the latter are disabled.
+ * @details Each channel has its own TX queue and its own RX queue, both of @ref HM10_OTA_MUX_QUEUE_SIZE bytes and
+ *          statically allocated. The messages are interleaved segment by segment, where the channel of each segment is
+ *          chosen by the scheduler (see @ref HM10_OTA_Mux_Scheduling ), so that a message of a channel waits at most
+ *          for a single segment of any other channel whenever the channel has the highest priority. The received
+ *          segments are reassembled directly into the RX queue of their channel.
+ *
+ * @code
+  #include "hm10_ble_driver/PC/Inc/hm10_ota_mux.h"
+
+  init_hm10_ota_mux(HM10_OTA_Mux_Strict_Priority); // The channel 0 (e.g., control messages) has the highest priority.
+  enqueue_hm10_ota_mux_message(2, firmware_chunk, firmware_chunk_size);
+  while (send_hm10_ota_mux_segments(4) == HM10_EC_OK)
+  {
+      // Any control message enqueued here into the channel 0 goes out before the next segment of the channel 2.
+  }
+ * @endcode
+ *
+ * @author 	Cesar Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026.
+ */
+
+#ifndef HM10_OTA_MUX_H_
+#define HM10_OTA_MUX_H_
+
+#include <stdint.h> // This library contains the aliases: uint8_t, uint16_t, uint32_t, etc.
+#include "hm10_ble_driver.h" // Custom Mortrack's Library to be able to initialize, send configuration commands and send and/or receive data to/from an HM-10 Bluetooth Device.
+#include "hm10_ota_msg.h" // Custom Mortrack's Library to send and receive messages larger than a single HM-10 packet.
+
+#define HM10_OTA_MUX_CHANNELS           (4)         /**< @brief Number of logical channels, which is limited by the 2 bits of the Channel ID. */
+#define HM10_OTA_MUX_CHANNEL_MASK       (HM10_OTA_MSG_RESERVED_MASK)  /**< @brief Bit mask of the Channel ID in the Segment Header. */
+#define HM10_OTA_MUX_CHANNEL_POS        (5U)        /**< @brief Bit position of the Channel ID in the Segment Header. */
+
+/**@brief	HM-10 OTA Channel Multiplexer Scheduling Policies.
+ */
+typedef enum
+{
+    HM10_OTA_Mux_Strict_Priority    = 0U,    //!< The next segment is always taken from the channel with the lowest Channel ID that has pending messages.
+    HM10_OTA_Mux_Weighted_Fair      = 1U     //!< The channels with pending messages take turns, where each channel sends as many segments per turn as its weight (i.e., Deficit Round Robin).
+} HM10_OTA_Mux_Scheduling;
+
+/**@brief	HM-10 OTA Channel Multiplexer Statistics.
+ */
+typedef struct {
+    uint32_t messages_sent[HM10_OTA_MUX_CHANNELS];      //!< Number of messages that have been sent on each channel.
+    uint32_t messages_received[HM10_OTA_MUX_CHANNELS];  //!< Number of messages that have been received on each channel.
+    uint32_t segments_sent[HM10_OTA_MUX_CHANNELS];      //!< Number of segments that have been sent on each channel.
+    uint32_t segments_dropped;                          //!< Number of received segments that were dropped (e.g., a continuation segment without a previous Start segment, or an invalid Segment Header).
+    uint32_t messages_dropped;                          //!< Number of received messages that were dropped (e.g., because they did not fit into the RX queue of their channel or into the buffer of the application).
+    uint32_t crc_errors;                                //!< Number of received messages that were dropped because their CRC32C did not match (see @ref HM10_OTA_MSG_CRC ).
+} HM10_OTA_Mux_Stats;
+
+/**@brief	Initializes the HM-10 OTA Channel Multiplexer, which discards all the queued messages, sets the weight of
+ *          each channel to 1 and resets the statistics.
+ *
+ * @param scheduling    Scheduling policy with which the channel of each sent segment will be chosen.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+void init_hm10_ota_mux(HM10_OTA_Mux_Scheduling scheduling);
+
+/**@brief	Sets the weight of a channel, which is the number of segments that it can send per turn whenever the @ref
+ *          HM10_OTA_Mux_Weighted_Fair scheduling policy is used.
+ *
+ * @param channel   Channel ID of the channel.
+ * @param weight    Desired weight, which must be at least 1.
+ *
+ * @retval	HM10_EC_OK	if the weight was successfully set.
+ * @retval  HM10_EC_ERR if any of the params is invalid.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+HM10_Status set_hm10_ota_mux_weight(uint8_t channel, uint8_t weight);
+
+/**@brief	Copies a message into the TX queue of a channel so that it is sent by the @ref send_hm10_ota_mux_segments
+ *          function.
+ *
+ * @param channel   Channel ID of the channel on which the message is desired to be sent.
+ * @param[in] msg   Pointer to the data of the message.
+ * @param size      Length in bytes of the message towards which the \p msg param points to, which must be lower than
+ *                  both 16383 bytes and @ref HM10_OTA_MUX_QUEUE_SIZE minus 2 bytes, minus the 4 bytes of its CRC32C
+ *                  whenever @ref HM10_OTA_MSG_CRC is enabled.
+ *
+ * @retval	HM10_EC_OK	if the message was queued.
+ * @retval  HM10_EC_NA  if the TX queue of the channel does not have enough free space at the moment.
+ * @retval  HM10_EC_ERR if any of the params is invalid.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+HM10_Status enqueue_hm10_ota_mux_message(uint8_t channel, uint8_t *msg, uint16_t size);
+
+/**@brief	Sends Over the Air (OTA) up to a certain number of segments of the queued messages, where the channel of each
+ *          segment is chosen by the scheduling policy.
+ *
+ * @details Sending a few segments per call allows the application to enqueue latency-sensitive messages in between,
+ *          which will then be sent before the remaining segments of the channels with a lower priority.
+ *
+ * @param max_segments  Largest number of segments that are desired to be sent.
+ *
+ * @retval	HM10_EC_OK	if at least one segment was sent.
+ * @retval  HM10_EC_NA  if there are no queued messages.
+ * @retval  HM10_EC_ERR if a segment could not be sent.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+HM10_Status send_hm10_ota_mux_segments(uint16_t max_segments);
+
+/**@brief	Gets the oldest message received on a certain channel, by receiving and dispatching the segments that arrive
+ *          Over the Air (OTA) into the RX queues of their channels until such a message is available.
+ *
+ * @param channel       Channel ID of the channel whose message is desired to be obtained.
+ * @param[out] msg      Pointer to the Memory Address into which the received message will be stored.
+ * @param max_size      Length in bytes of the buffer towards which the \p msg param points to.
+ * @param[out] size     Pointer to the Memory Address into which the length in bytes of the received message will be
+ *                      stored.
+ *
+ * @retval	HM10_EC_OK	if a message was obtained.
+ * @retval  HM10_EC_NR  if no message was received on the requested channel within the timeout of the @ref
+ *                      get_hm10_ota_data function. The messages received on other channels are kept in their RX queues.
+ * @retval  HM10_EC_ERR if the \p channel param is invalid or if the message did not fit into the buffer of the \p msg
+ *                      param (in which case it is dropped).
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+HM10_Status get_hm10_ota_mux_message(uint8_t channel, uint8_t *msg, uint16_t max_size, uint16_t *size);
+
+/**@brief	Gets the statistics of the HM-10 OTA Channel Multiplexer.
+ *
+ * @param[out] stats    Pointer to the Memory Address into which the statistics will be stored.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+void get_hm10_ota_mux_stats(HM10_OTA_Mux_Stats *stats);
+
+#endif /* HM10_OTA_MUX_H_ */
+
+/** @} */ // hm10_ota_mux
+
+/** @} */ // hm10_ble
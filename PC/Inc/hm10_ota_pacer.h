@@ -0,0 +1,126 @@
+/** @addtogroup hm10_ble
+ * @{
+ */
+
+/**@file
+ * @brief	HM-10 OTA Transmit Pacer Header file.
+ *
+ * @defgroup hm10_ota_pacer HM-10 OTA Transmit Pacer
+ * @{
+ *
+ * @brief   This module provides a token-bucket pacer that the @ref hm10_ble uses to send data Over the Air (OTA) in
+ *          bursts of @ref HM10_MAX_PACKET_SIZE bytes at the rate that the HM-10 BT Device is able to forward it.
+ *
+ * @details Whenever this pacer is enabled (see @ref init_hm10_ota_pacer ), both the @ref send_hm10_ota_data and the
+ *          @ref send_hm10_ota_byte_of_data functions will wait for enough tokens in the bucket of this pacer before
+ *          writing into the RS-232 Port instead of applying a fixed delay per byte. Otherwise, those functions will
+ *          behave as they did before this pacer was added.
+ * @details The highest rate of this pacer is derived from the baud rate of the RS-232 Port and from the Connection
+ *          Interval of the Bluetooth Connection. However, the actual rate is auto-tuned with an additive-increase /
+ *          multiplicative-decrease policy from the drops and echoes reported by the application or by a higher layer
+ *          protocol (see @ref report_hm10_ota_pacer_drop and @ref report_hm10_ota_pacer_echo ).
+ *
+ * @author 	Cesar Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026.
+ */
+
+#ifndef HM10_OTA_PACER_H_
+#define HM10_OTA_PACER_H_
+
+#include <stdint.h> // This library contains the aliases: uint8_t, uint16_t, uint32_t, etc.
+#include "hm10_ble_driver.h" // Custom Mortrack's Library to be able to initialize, send configuration commands and send and/or receive data to/from an HM-10 Bluetooth Device.
+
+/**@brief	HM-10 OTA Transmit Pacer Statistics.
+ */
+typedef struct {
+    uint32_t rate;              //!< Current rate of the pacer in bytes per second.
+    uint32_t max_rate;          //!< Highest rate of the pacer in bytes per second, as derived from the baud rate and the Connection Interval.
+    uint32_t achieved_rate;     //!< Average rate in bytes per second with which data has actually been sent since the pacer was initialized.
+    uint64_t bytes_sent;        //!< Total bytes that have been sent through the pacer.
+    uint32_t drops;             //!< Number of drops that have been reported to the pacer.
+    uint32_t echoes;            //!< Number of echoes that have been reported to the pacer.
+} HM10_OTA_Pacer_Stats;
+
+/**@brief	Initializes and enables the HM-10 OTA Transmit Pacer.
+ *
+ * @details The highest rate of the pacer is calculated as the lowest value between the rate that the RS-232 Port can
+ *          carry (i.e., \p baudrate over 10 bits per byte) and the rate at which the HM-10 BT Device can forward data
+ *          OTA (i.e., @ref HM10_OTA_PACER_PACKETS_PER_INTERVAL packets of @ref HM10_MAX_PACKET_SIZE bytes per each
+ *          \p connection_interval ).
+ *
+ * @param baudrate              Baud rate with which the RS-232 Port of the HM-10 BT Device was opened.
+ * @param connection_interval   Connection Interval in microseconds of the Bluetooth Connection of the HM-10 BT Device.
+ *
+ * @retval	HM10_EC_OK	if the pacer was successfully initialized.
+ * @retval  HM10_EC_ERR if any of the given params is 0.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+HM10_Status init_hm10_ota_pacer(uint32_t baudrate, uint32_t connection_interval);
+
+/**@brief	Disables the HM-10 OTA Transmit Pacer.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+void deinit_hm10_ota_pacer();
+
+/**@brief	Indicates whether the HM-10 OTA Transmit Pacer is enabled or not.
+ *
+ * @retval  1 if the pacer is enabled.
+ * @retval  0 otherwise.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+uint8_t is_hm10_ota_pacer_enabled();
+
+/**@brief	Waits until the HM-10 OTA Transmit Pacer has enough tokens to send a desired number of bytes and then
+ *          consumes them.
+ *
+ * @note    This function is called by the @ref hm10_ble before each burst of bytes that it sends OTA. Therefore, the
+ *          application does not need to call it.
+ *
+ * @note    If \p size is greater than the capacity of the bucket (i.e., @ref HM10_OTA_PACER_BURST_PACKETS times
+ *          @ref HM10_MAX_PACKET_SIZE bytes), then this function only waits until the bucket is full and then empties it.
+ *
+ * @param size  Number of bytes that are about to be sent OTA.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+void wait_for_hm10_ota_pacer(uint16_t size);
+
+/**@brief	Reports to the HM-10 OTA Transmit Pacer that some data sent OTA was lost, which will multiplicatively
+ *          decrease its rate.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+void report_hm10_ota_pacer_drop();
+
+/**@brief	Reports to the HM-10 OTA Transmit Pacer that some data sent OTA was confirmed to be received (e.g., echoed
+ *          back or acknowledged by the Remote BT Device), which will additively increase its rate.
+ *
+ * @param size  Number of bytes that were confirmed to be received.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+void report_hm10_ota_pacer_echo(uint16_t size);
+
+/**@brief	Gets the statistics of the HM-10 OTA Transmit Pacer.
+ *
+ * @param[out] stats    Pointer to the Memory Address into which the statistics will be stored.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+void get_hm10_ota_pacer_stats(HM10_OTA_Pacer_Stats *stats);
+
+#endif /* HM10_OTA_PACER_H_ */
+
+/** @} */ // hm10_ota_pacer
+
+/** @} */ // hm10_ble
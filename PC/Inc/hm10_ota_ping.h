@@ -0,0 +1,154 @@
+/** @addtogroup hm10_ble
+ * @{
+ */
+
+/**@file
+ * @brief	HM-10 OTA Ping Service Header file.
+ *
+ * @defgroup hm10_ota_ping HM-10 OTA Ping Service
+ * @{
+ *
+ * @brief   This module provides a ping/echo service with which the Round Trip Time (RTT) of the Bluetooth Connection of
+ *          the HM-10 BT Device is measured, and with which the clock of the Remote BT Device is synchronized against
+ *          the clock of our host machine, so that the timestamps of the data sent by the Remote BT Device can be
+ *          converted into our own clock (see @ref convert_hm10_ota_ping_remote_time ).
+ *
+ * @details The service uses the @ref send_hm10_ota_data and @ref get_hm10_ota_data functions, so it measures the same
+ *          path that the application experiences. The side that measures calls @ref send_hm10_ota_ping and the other
+ *          side calls @ref respond_hm10_ota_ping , both of them exclusively while the probe is taking place. Each
+ *          exchange has the following frames, where all the multi-byte fields are in little endian:<br><br>
+ *          - PING frame: Type (1 byte), Sequence Number (1 byte) and zero padding (16 bytes), so that it has the same
+ *            length as the PONG frame and both directions therefore take the same time through the line.<br>
+ *          - PONG frame: Type (1 byte), the Sequence Number of the PING frame (1 byte), the time of the responder at
+ *            which it received the PING frame (8 bytes) and the time of the responder at which it sent the PONG frame
+ *            (8 bytes).<br><br>
+ * @details All the times are in microseconds of a monotonic clock. With the time T1 at which the PING frame was sent,
+ *          the times T2 and T3 of the PONG frame and the time T4 at which the PONG frame was received, each exchange
+ *          gives, as in the NTP, an RTT of (T4 - T1) - (T3 - T2) and a clock offset of ((T2 - T1) + (T3 - T4)) / 2,
+ *          which is exact whenever both directions of the link have the same latency. The last @ref
+ *          HM10_OTA_PING_MAX_SAMPLES exchanges are kept, from which the RTT percentiles are calculated. The offset is
+ *          taken from the exchange with the lowest RTT among the most recent ones (i.e., the one with the least
+ *          queueing and therefore the most symmetric one), and the drift between both clocks is estimated as the
+ *          least-squares slope of the offsets of the exchanges whose RTT is not greater than the median.
+ * @details The one-way delay of each direction of each exchange is estimated by correcting T2 - T1 (i.e., from our host
+ *          machine to the Remote BT Device) and T4 - T3 (i.e., from the Remote BT Device to our host machine) with the
+ *          estimated offset at the time of the exchange (i.e., including the drift). Since the offset is taken from
+ *          the exchange with the lowest RTT, the minimums of both directions split that RTT evenly by construction,
+ *          so that a constant asymmetry of the link cannot be observed, while the extra delay of either direction
+ *          above its minimum (e.g., the queueing behind other data of one direction only) is attributed to the right
+ *          direction.
+ *
+ * @author 	Cesar Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026.
+ */
+
+#ifndef HM10_OTA_PING_H_
+#define HM10_OTA_PING_H_
+
+#include <stdint.h> // This library contains the aliases: uint8_t, uint16_t, uint32_t, etc.
+#include "hm10_ble_driver.h" // Custom Mortrack's Library to be able to initialize, send configuration commands and send and/or receive data to/from an HM-10 Bluetooth Device.
+
+#define HM10_OTA_PING_TYPE_PING         (0xE1U)     /**< @brief Type of the PING frames. */
+#define HM10_OTA_PING_TYPE_PONG         (0xE2U)     /**< @brief Type of the PONG frames. */
+#define HM10_OTA_PING_PING_SIZE         (18)        /**< @brief Length in bytes of a PING frame, which is padded to the length of the PONG frame. */
+#define HM10_OTA_PING_PONG_SIZE         (18)        /**< @brief Length in bytes of a PONG frame. */
+
+/**@brief	HM-10 OTA Ping Service Statistics.
+ */
+typedef struct {
+    uint32_t pings_sent;        //!< Number of PING frames that have been sent.
+    uint32_t pings_lost;        //!< Number of PING frames whose PONG frame was not received.
+    uint16_t samples;           //!< Number of exchanges from which the rest of these statistics were calculated.
+    uint32_t rtt_min;           //!< Lowest RTT in microseconds.
+    uint32_t rtt_p50;           //!< Median of the RTT in microseconds.
+    uint32_t rtt_p90;           //!< 90th percentile of the RTT in microseconds.
+    uint32_t rtt_p99;           //!< 99th percentile of the RTT in microseconds.
+    uint32_t rtt_max;           //!< Highest RTT in microseconds.
+    int64_t offset;             //!< Offset in microseconds of the clock of the Remote BT Device with respect to the clock of our host machine (i.e., remote time minus local time) at the time of the exchange with the lowest RTT among the most recent ones.
+    int32_t drift;              //!< Rate in parts per billion at which the @ref offset changes (i.e., how much faster the clock of the Remote BT Device runs), or 0 if it could not be estimated yet.
+    int32_t owd_out_min;        //!< Lowest estimated one-way delay in microseconds from our host machine to the Remote BT Device.
+    int32_t owd_out_p50;        //!< Median of the estimated one-way delay in microseconds from our host machine to the Remote BT Device.
+    int32_t owd_out_p90;        //!< 90th percentile of the estimated one-way delay in microseconds from our host machine to the Remote BT Device.
+    int32_t owd_in_min;         //!< Lowest estimated one-way delay in microseconds from the Remote BT Device to our host machine.
+    int32_t owd_in_p50;         //!< Median of the estimated one-way delay in microseconds from the Remote BT Device to our host machine.
+    int32_t owd_in_p90;         //!< 90th percentile of the estimated one-way delay in microseconds from the Remote BT Device to our host machine.
+} HM10_OTA_Ping_Stats;
+
+/**@brief	Discards all the samples and resets the statistics of the HM-10 OTA Ping Service.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+void init_hm10_ota_ping();
+
+/**@brief	Sends a PING frame Over the Air (OTA) and waits for its PONG frame, from which a sample of the RTT and of
+ *          the clock offset is taken.
+ *
+ * @details Any frame that is not the PONG frame of this PING frame (e.g., the late PONG frame of a previous PING frame)
+ *          is discarded.
+ *
+ * @param[out] rtt  Pointer to the Memory Address into which the measured RTT in microseconds will be stored, or \c NULL
+ *                  if it is not needed.
+ *
+ * @retval	HM10_EC_OK	if the PONG frame was received.
+ * @retval  HM10_EC_NR  if the PONG frame was not received within the timeout of the @ref get_hm10_ota_data function.
+ * @retval  HM10_EC_ERR if the PING frame could not be sent.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+HM10_Status send_hm10_ota_ping(uint32_t *rtt);
+
+/**@brief	Waits for a PING frame Over the Air (OTA) and responds to it with its PONG frame.
+ *
+ * @retval	HM10_EC_OK	if a PING frame was received and responded.
+ * @retval  HM10_EC_NA  if something other than a PING frame was received, which is discarded.
+ * @retval  HM10_EC_NR  if nothing was received within the timeout of the @ref get_hm10_ota_data function.
+ * @retval  HM10_EC_ERR if the PONG frame could not be sent.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+HM10_Status respond_hm10_ota_ping();
+
+/**@brief	Gets the statistics of the HM-10 OTA Ping Service, which are calculated from the samples that are kept.
+ *
+ * @param[out] stats    Pointer to the Memory Address into which the statistics will be stored.
+ *
+ * @retval	HM10_EC_OK	if the statistics were calculated.
+ * @retval  HM10_EC_NA  if no samples have been taken yet, in which case only the counters of the \p stats param are
+ *                      valid.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+HM10_Status get_hm10_ota_ping_stats(HM10_OTA_Ping_Stats *stats);
+
+/**@brief	Converts a time of the clock of the Remote BT Device into the clock of our host machine, by using the
+ *          estimated offset and drift between both clocks.
+ *
+ * @param remote_time   Time in microseconds of the clock of the Remote BT Device (e.g., the timestamp of a sample of
+ *                      one of its sensors).
+ *
+ * @return  The corresponding time in microseconds of the monotonic clock of our host machine, or the \p remote_time
+ *          param unchanged if no samples have been taken yet.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+uint64_t convert_hm10_ota_ping_remote_time(uint64_t remote_time);
+
+/**@brief	Gets the current time of the monotonic clock with which the HM-10 OTA Ping Service takes its samples.
+ *
+ * @return  The current time in microseconds.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+uint64_t get_hm10_ota_ping_time();
+
+#endif /* HM10_OTA_PING_H_ */
+
+/** @} */ // hm10_ota_ping
+
+/** @} */ // hm10_ble
@@ -0,0 +1,151 @@
+/** @addtogroup hm10_ble
+ * @{
+ */
+
+/**@file
+ * @brief	HM-10 OTA Reliable Transport Header file.
+ *
+ * @defgroup hm10_ota_reliable HM-10 OTA Reliable Transport
+ * @{
+ *
+ * @brief   This module provides an optional reliable transport on top of the @ref send_hm10_ota_data and @ref
+ *          get_hm10_ota_data functions, which guarantees that the data sent Over the Air (OTA) is delivered in order,
+ *          without duplicates and without losses, even when the HM-10 BT Devices drop some of it under RF stress.
+ *
+ * @details Instead of waiting for the confirmation of each packet before sending the next one (i.e., stop-and-wait),
+ *          this module keeps up to a configurable window of unacknowledged frames in flight. Each frame fits into a
+ *          single HM-10 packet and consists of a 2-byte Frame Header, followed by its payload and by the little-endian
+ *          CRC32C of both of them, where the Frame Header has the following format:<br><br>
+ *          - Byte 0, Bit 7: ACK flag, which is set only in ACK frames.<br>
+ *          - Byte 0, Bits 5 and 6: Reserved. These are always set to 0.<br>
+ *          - Byte 0, Bits 0 to 4: Length in bytes of the payload of the frame.<br>
+ *          - Byte 1: Sequence Number of a DATA frame or, in ACK frames, the Sequence Number of the next DATA frame that
+ *            the receiver expects (i.e., a cumulative ACK).<br><br>
+ * @details Whenever a received frame has an invalid Frame Header, a CRC32C that does not match or misses some of its
+ *          bytes, only its first byte is discarded and the next frame is searched from the byte that follows it, so
+ *          that the receiver resynchronizes with the frame boundaries after any corrupted or lost byte, without
+ *          discarding the valid frames that were already received after it. The frames that are discarded this way are
+ *          then recovered by the retransmissions of the sender.
+ * @details The payload of an ACK frame is a 16-bit little-endian Selective ACK (SACK) bitmap, where each bit n that is
+ *          set indicates that the DATA frame with Sequence Number "cumulative ACK + 1 + n" was also received. This
+ *          allows the sender to retransmit only the frames that were actually lost, either because their
+ *          Retransmission Timeout (RTO) expired or because @ref HM10_OTA_RELIABLE_DUPACK_THRESHOLD ACK frames reported
+ *          later frames as received while they were still missing (i.e., a fast retransmission).
+ * @details The RTO is derived from the Round Trip Time (RTT) measured with each ACK frame in the same way that TCP
+ *          does (i.e., from a smoothed RTT and its variation, with an exponential backoff on each timeout and without
+ *          measuring retransmitted frames). In addition, each lost frame is reported to the @ref hm10_ota_pacer via
+ *          @ref report_hm10_ota_pacer_drop and each acknowledged frame via @ref report_hm10_ota_pacer_echo.
+ *
+ * @note    Both HM-10 BT Devices must use this module at the same time and must call @ref init_hm10_ota_reliable
+ *          whenever their Bluetooth Connection is established, since the Sequence Numbers start at 0 on both sides.
+ * @note    The frames are received with the @ref get_hm10_ota_available_data function. Therefore, the retransmissions
+ *          can be made, at the earliest, after the \p poll_delay given to the @ref init_hm10_module function expires,
+ *          which is why it is recommended to use a \p poll_delay that is shorter than the expected RTT.
+ *
+ * @author 	Cesar Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026.
+ */
+
+#ifndef HM10_OTA_RELIABLE_H_
+#define HM10_OTA_RELIABLE_H_
+
+#include <stdint.h> // This library contains the aliases: uint8_t, uint16_t, uint32_t, etc.
+#include "hm10_ble_driver.h" // Custom Mortrack's Library to be able to initialize, send configuration commands and send and/or receive data to/from an HM-10 Bluetooth Device.
+#include "hm10_crc32c.h" // Custom Mortrack's Library to calculate the CRC32C of the data sent and received Over the Air.
+
+#define HM10_OTA_RELIABLE_HEADER_SIZE           (2)                                                        /**< @brief Length in bytes of the Frame Header. */
+#define HM10_OTA_RELIABLE_CRC_SIZE              (HM10_CRC32C_SIZE)                                         /**< @brief Length in bytes of the CRC32C that follows the payload of each frame. */
+#define HM10_OTA_RELIABLE_MAX_PAYLOAD_SIZE      (HM10_MAX_PACKET_SIZE - HM10_OTA_RELIABLE_HEADER_SIZE - HM10_OTA_RELIABLE_CRC_SIZE)     /**< @brief Total maximum bytes of payload that a single DATA frame can carry. */
+#define HM10_OTA_RELIABLE_ACK_PAYLOAD_SIZE      (2)                                                        /**< @brief Length in bytes of the payload of an ACK frame (i.e., its SACK bitmap). */
+#define HM10_OTA_RELIABLE_ACK_FLAG              (0x80U)                                                    /**< @brief Bit mask of the ACK flag in the Frame Header. */
+#define HM10_OTA_RELIABLE_RESERVED_MASK         (0x60U)                                                    /**< @brief Bit mask of the Reserved bits in the Frame Header. */
+#define HM10_OTA_RELIABLE_LENGTH_MASK           (0x1FU)                                                    /**< @brief Bit mask of the payload length in the Frame Header. */
+#define HM10_OTA_RELIABLE_MAX_WINDOW_SIZE       (16)                                                       /**< @brief Largest window, in frames, that can be used, which is limited by the length of the SACK bitmap. */
+
+/**@brief	HM-10 OTA Reliable Transport Statistics.
+ */
+typedef struct {
+    uint32_t frames_sent;           //!< Number of DATA frames that have been sent for the first time.
+    uint32_t retransmissions;       //!< Number of DATA frames that have been retransmitted because their RTO expired.
+    uint32_t fast_retransmissions;  //!< Number of DATA frames that have been retransmitted because later frames were selectively acknowledged.
+    uint32_t frames_received;       //!< Number of new DATA frames that have been received.
+    uint32_t duplicates_received;   //!< Number of DATA frames that were received more than once or outside of the window, and that were therefore discarded.
+    uint32_t acks_sent;             //!< Number of ACK frames that have been sent.
+    uint32_t acks_received;         //!< Number of ACK frames that have been received.
+    uint32_t invalid_frames;        //!< Number of times that the first byte of a received frame was discarded because of an invalid Frame Header or because some of its bytes were not received.
+    uint32_t crc_errors;            //!< Number of received frames that were discarded because their CRC32C did not match.
+    uint32_t srtt;                  //!< Smoothed RTT in microseconds, or 0 if it has not been measured yet.
+    uint32_t rto;                   //!< Current RTO in microseconds.
+} HM10_OTA_Reliable_Stats;
+
+/**@brief	Initializes the HM-10 OTA Reliable Transport with a desired window size and resets its Sequence Numbers,
+ *          its RTT estimation and its statistics.
+ *
+ * @param window_size   Maximum number of DATA frames that can be in flight without being acknowledged. This value
+ *                      must be within 1 and @ref HM10_OTA_RELIABLE_MAX_WINDOW_SIZE and both HM-10 BT Devices should
+ *                      use the same value.
+ *
+ * @retval	HM10_EC_OK	if the reliable transport was successfully initialized.
+ * @retval  HM10_EC_ERR if the \p window_size param is invalid.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+HM10_Status init_hm10_ota_reliable(uint8_t window_size);
+
+/**@brief	Sends some data Over the Air (OTA) via the HM-10 BT Device and waits until all of it has been acknowledged
+ *          by the Remote BT Device.
+ *
+ * @details The data is split into DATA frames of up to @ref HM10_OTA_RELIABLE_MAX_PAYLOAD_SIZE bytes, which are
+ *          retransmitted as many times as needed up to @ref HM10_OTA_RELIABLE_MAX_RETRANSMISSIONS times each. Any DATA
+ *          frames received from the Remote BT Device while waiting are acknowledged and kept for the @ref
+ *          get_hm10_ota_reliable_data function.
+ *
+ * @param[in] data  Pointer to the data that is desired to be sent.
+ * @param size      Length in bytes of the data towards which the \p data param points to.
+ *
+ * @retval	HM10_EC_OK	if all the data was sent and acknowledged.
+ * @retval  HM10_EC_ERR otherwise (e.g., if a DATA frame was retransmitted too many times, or if the reliable transport
+ *                      has not been initialized). In this case, the Bluetooth Connection should be considered as lost
+ *                      and @ref init_hm10_ota_reliable has to be called again before using this module.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+HM10_Status send_hm10_ota_reliable_data(uint8_t *data, uint32_t size);
+
+/**@brief	Gets the data that has been reliably received Over the Air (OTA) via the HM-10 BT Device, in the same order in
+ *          which it was sent by the Remote BT Device.
+ *
+ * @details This function receives and acknowledges frames until at least one DATA frame can be delivered in order and
+ *          then passes as many in-order DATA frames as they fit into the \p data param.
+ *
+ * @param[out] data     Pointer to the Memory Address into which the received data will be stored.
+ * @param max_size      Length in bytes of the buffer towards which the \p data param points to. This value must be at
+ *                      least @ref HM10_OTA_RELIABLE_MAX_PAYLOAD_SIZE.
+ * @param[out] size     Pointer to the Memory Address into which the length in bytes of the received data will be
+ *                      stored.
+ *
+ * @retval	HM10_EC_OK	if some data was received.
+ * @retval  HM10_EC_NR  if no data could be delivered within the timeout of the @ref get_hm10_ota_data function.
+ * @retval  HM10_EC_ERR if the \p max_size param is too small or if the reliable transport has not been initialized.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+HM10_Status get_hm10_ota_reliable_data(uint8_t *data, uint16_t max_size, uint16_t *size);
+
+/**@brief	Gets the statistics of the HM-10 OTA Reliable Transport.
+ *
+ * @param[out] stats    Pointer to the Memory Address into which the statistics will be stored.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+void get_hm10_ota_reliable_stats(HM10_OTA_Reliable_Stats *stats);
+
+#endif /* HM10_OTA_RELIABLE_H_ */
+
+/** @} */ // hm10_ota_reliable
+
+/** @} */ // hm10_ble
@@ -4,12 +4,14 @@
 
 #include "../Inc/hm10_ble_driver.h"
 #include "../Inc/hm10_config.h" // Custom Library for the HM-10 Driver Library.
+#include "../Inc/hm10_ota_pacer.h" // Custom Library for pacing the data sent OTA via the HM-10 BT Device.
+#include "../Inc/hm10_trace.h" // Custom Library for the trace points of the HM-10 Driver Library.
 #include "../RS232/rs232.h" // Library for using RS232 protocol.
 #include <unistd.h> // Library for using the "usleep()" function.
 #include <string.h>	// Library from which "memset()" and "memcpy()" are located at.
+#include <time.h> // Library from which "clock_gettime()" is located at.
 
 #define HM10_MAX_AT_COMMAND_SIZE							(19)       /**< @brief Total maximum bytes in a Tx/Rx AT Command of the HM-10 BT Device. */
-#define HM10_MAX_PACKET_SIZE								(19)       /**< @brief Total maximum bytes in a Tx/Rx package/Payload to/from the HM-10 BT Device. @note The documentation of the HM-10 BT Device states that there is a restriction of sending data from one HM-10 BT Device to another, whenever they establish a connection, of 19 bytes per request. Therefore, to manage things homogeneously, both the transmit and receive requests will be handled by this @ref hm10_ble with the same size limit of 19 bytes. */
 #define HM10_TEST_CMD_SIZE								    (2)        /**< @brief	Length in bytes of a Test Command in the HM-10 BT device. */
 #define HM10_RESET_CMD_SIZE								    (8)        /**< @brief	Length in bytes of a Reset Command in the HM-10 BT device. */
 #define HM10_RENEW_CMD_SIZE								    (8)        /**< @brief	Length in bytes of a Renew Command in the HM-10 BT device. */
@@ -42,11 +44,18 @@
 #define HM10_OK_RESPONSE_SIZE								(2)        /**< @brief	Length in bytes of a OK Response from the HM-10 BT device. */
 #define HM10_OK_LOST_RESPONSE_SIZE                          (7)        /**< @brief	Length in bytes of a whole OK+LOST Response from the HM-10 BT device. */
 #define HM10_OK_LOST_RESPONSE_SIZE_WITHOUT_THE_OK_PART      (5)        /**< @brief	Length in bytes of a OK+LOST Response from the HM-10 BT device, but without the OK part. */
+#define HM10_GET_ADDR_CMD_SIZE							    (8)        /**< @brief	Length in bytes of the Get Address Command of a HM-10 BT device. */
+#define HM10_GET_ADDR_RESPONSE_SIZE_WITHOUT_ADDRESS		    (8)        /**< @brief	Length in bytes of a Get Address Response from the HM-10 BT device but without considering the length of the Bluetooth Address. */
+#define HM10_LATENCY_MEAN_EWMA_SHIFT                        (3)        /**< @brief Right bit-shift that defines the weight (i.e., \f$\alpha = 1/2^{3}\f$) with which each new Response Latency sample is accumulated into the mean of the learned Response Latencies. */
+#define HM10_LATENCY_VARIANCE_EWMA_SHIFT                    (2)        /**< @brief Right bit-shift that defines the weight (i.e., \f$\beta = 1/2^{2}\f$) with which the squared deviation of each new Response Latency sample is accumulated into the variance of the learned Response Latencies. */
 
 static int teuniz_rs232_lib_comport;												                                              /**< @brief Global variable that will hold the converted value of the actual comport that was requested by the user but into its equivalent for the @ref teuniz_rs232_library (For more details, see the Table from @ref teuniz_rs232_library ). */
 static uint32_t teuniz_send_bytes_delay;                                                                                          /**< @brief Global variable that will hold the desired delay value in microseconds that the @ref hm10_ble is to apply before having send a byte of data through the TX of the RS-232 via the Teuniz Library. @note A value that should work fine for this Global Variable is 1000 microseconds. */
-static uint32_t teuniz_poll_delay;                                                                                                /**< @brief Global variable that will hold the desired delay value in microseconds that the @ref hm10_ble is to apply each time before calling the @ref RS232_PollComport function of the Teuniz Library. @note Although the @ref teuniz_rs232_library suggests to place an interval of 100 milliseconds, but it did not worked for me that way. Instead, it worked for me with 500ms. . */
+static uint32_t teuniz_poll_delay;                                                                                                /**< @brief Global variable that will hold the desired maximum time in microseconds that the @ref hm10_ble is to wait for the data requested via the @ref RS232_PollComport function of the Teuniz Library. @details This is the timeout used for the data received OTA and for the Responses of any Command Type whose latency has not been learned yet (see @ref get_hm10_command_timeout ). @note Although the @ref teuniz_rs232_library suggests to place an interval of 100 milliseconds, but it did not worked for me that way. Instead, it worked for me with 500ms. . */
 static uint32_t hm10_connect_to_address_timeout;                                                                                  /**< @brief Global variable that will hold the desired time in microseconds that our host machine will wait for the HM-10 BT device's Connect-To-Address Response after sending a Connect-To-Address Command to it. @note The maximum time that a Bluetooth Connection can be made with an HM-10 BT Device is 11 seconds. */
+#if HM10_ADAPTIVE_TIMEOUTS
+static HM10_Latency_Estimate latency_estimates[HM10_MAX_COMPORTS][HM10_Cmd_Types_Count];                                          /**< @brief Global table holding, per Comport (i.e., per HM-10 BT Device) and per Command Type, the learned Response Latency of the HM-10 BT Device. @details These estimates are used to calculate the timeout that is applied whenever waiting for the Response of each Command Type (see @ref get_hm10_command_timeout ). */
+#endif
 static uint8_t TxRx_Buffer[HM10_MAX_AT_COMMAND_SIZE];					                                                          /**< @brief Global buffer that will be used by our MCU/MPU to hold the whole data of a received response or a request to be send from/to the HM-10 BT Device. */
 static char HM10_Set_Name_resp_without_name_value[] = {'O', 'K', '+', 'S', 'e', 't', ':'};	          /**< @brief Pointer to the equivalent data of the BT Name Response that the HM-10 BT device sends back to our MCU/MPU whenever a Set Name request to the HM-10 BT device is processed successfully, but without the name value. */
 static char HM10_Get_Name_resp_without_name_value[] = {'O', 'K', '+', 'N', 'A', 'M', 'E', ':'};    /**< @brief Pointer to the equivalent data of a BT Name Response that the HM-10 BT device sends back to our MCU/MPU whenever a Get Name request to the HM-10 BT device is processed successfully, but without the name value. */
@@ -68,6 +77,7 @@ static char HM10_Reset_resp[] = {'O', 'K', '+', 'R', 'E', 'S', 'E', 'T'};
 static char HM10_Renew_resp[] = {'O', 'K', '+', 'R', 'E', 'N', 'E', 'W'};				          /**< @brief Pointer to the equivalent data of a Renew Response that the HM-10 BT device sends back to our MCU/MPU whenever a Restore to Factory Setup Request sent to the HM-10 BT device is processed successfully. */
 static char HM10_OK_LOST_resp[] = {'O', 'K', '+', 'L', 'O', 'S', 'T'};                                 /**< @brief Pointer to the equivalent data of an OK+LOST Response that the HM-10 BT device sends back to our MCU/MPU whenever, during a Bluetooth Connection, a test request sent to the HM-10 BT device is processed successfully. */
 static char HM10_OK_resp[] = {'O', 'K'};				                                                                  /**< @brief Pointer to the equivalent data of an OK Response that the HM-10 BT device sends back to our MCU/MPU whenever a test request sent to the HM-10 BT device is processed successfully. */
+static char HM10_Get_Addr_resp_without_address_value[] = {'O', 'K', '+', 'A', 'D', 'D', 'R', ':'};  /**< @brief Pointer to the equivalent data of a BT Address Response that the HM-10 BT device sends back to our MCU/MPU whenever a Get Address request to the HM-10 BT device is processed successfully, but without the Bluetooth Address value. */
 
 /**@brief	Numbers in ASCII code definitions.
  *
@@ -92,16 +102,101 @@ typedef enum
 	Number_9_in_ASCII	= 57U     //!< \f$9_{ASCII} = 57_d\f$.
 } Numbers_in_ASCII;
 
+/**@brief	Sends some data through the TX of the RS-232 Port.
+ *
+ * @param[in] tx_buffer Pointer to the Memory Address of the data that is desired to be sent.
+ * @param size          Length in bytes of the data that is desired to be sent.
+ *
+ * @return  The number of bytes that were sent, or -1 if the RS-232 Port could not be written.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+static int send_hm10_comport(uint8_t *tx_buffer, int size);
+
+/**@brief	Polls the RX of the RS-232 Port until a desired number of bytes are received or until a desired timeout
+ *          expires, whatever happens first.
+ *
+ * @details Unlike applying a single delay of @ref teuniz_poll_delay microseconds before polling the RS-232 Port, this
+ *          function returns as soon as the requested bytes have been received, which is what allows fast Responses of
+ *          the HM-10 BT Device to be processed fast.
+ *
+ * @param[out] rx_buffer    Pointer to the Memory Address into which the received bytes will be stored.
+ * @param size              Length in bytes that is expected to be received.
+ * @param timeout           Maximum time in microseconds that this function will wait for the requested bytes.
+ * @param[out] elapsed_time Pointer to the Memory Address into which the time in microseconds that this function waited
+ *                          will be stored. If this is not required, then pass a \c NULL value to this param.
+ *
+ * @return  The number of bytes that were received.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+static uint16_t poll_hm10_comport(uint8_t *rx_buffer, uint16_t size, uint32_t timeout, uint32_t *elapsed_time);
+
+/**@brief	Polls the RX of the RS-232 Port for a Response of the HM-10 BT Device to a certain Command Type, by using
+ *          the timeout for that Command Type (see @ref get_hm10_command_timeout ), and learns from the observed
+ *          Response Latency.
+ *
+ * @details Whenever the whole Response is received, its latency is accumulated into the learned Response Latency of
+ *          the corresponding Command Type of the current HM-10 BT Device. If the timeout expired before the whole
+ *          Response was received (including when nothing was received at all), then that timeout is considered to have
+ *          been too short and the doubled value of it is accumulated instead, so that the learned timeout backs off
+ *          exponentially, as the Retransmission Timeout of TCP does, until it is long enough again for a HM-10 BT Device
+ *          that has become slower.
+ *
+ * @param[out] rx_buffer    Pointer to the Memory Address into which the received Response will be stored.
+ * @param size              Length in bytes of the expected Response.
+ * @param command_type      Command Type to which the expected Response belongs to.
+ *
+ * @return  The number of bytes that were received.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+static uint16_t poll_hm10_response(uint8_t *rx_buffer, uint16_t size, HM10_Command_Type command_type);
+
+/**@brief	Accumulates a Response Latency sample into the learned Response Latency of a certain Command Type of the
+ *          current HM-10 BT Device.
+ *
+ * @param command_type  Command Type to which the Response Latency sample belongs to.
+ * @param latency       Response Latency sample in microseconds.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+static void learn_hm10_response_latency(HM10_Command_Type command_type, uint32_t latency);
+
+/**@brief	Gets the current time of a monotonic clock of our host machine.
+ *
+ * @return  Current time in microseconds.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+static uint64_t get_monotonic_time_us();
+
+/**@brief	Calculates the integer square root of a desired value.
+ *
+ * @param value Value whose integer square root is desired to be calculated.
+ *
+ * @return  The largest integer whose square is less than or equal to \p value .
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+static uint32_t isqrt64(uint64_t value);
+
 HM10_Status init_hm10_module(int comport, uint32_t send_bytes_delay, uint32_t poll_delay, uint32_t connect_to_address_timeout)
 {
     /* Validate the given comport value. */
     #if ETX_OTA_VERBOSE
         printf("Validating the given comport value...\r\n");
     #endif
-    if ((comport<1) || (comport>38))
+    if ((comport<1) || (comport>HM10_MAX_COMPORTS))
     {
         #if ETX_OTA_VERBOSE
-            printf("The given comport value does not have a valid value. Please input a comport between 1 and 38.\r\n");
+            printf("The given comport value does not have a valid value. Please input a comport between 1 and %d.\r\n", HM10_MAX_COMPORTS);
         #endif
         return HM10_EC_ERR;
     }
@@ -124,6 +219,25 @@ HM10_Status init_hm10_module(int comport, uint32_t send_bytes_delay, uint32_t po
     return HM10_EC_OK;
 }
 
+HM10_Status select_hm10_comport(int comport)
+{
+    if ((comport<1) || (comport>HM10_MAX_COMPORTS))
+    {
+        #if ETX_OTA_VERBOSE
+            printf("The given comport value does not have a valid value. Please input a comport between 1 and %d.\r\n", HM10_MAX_COMPORTS);
+        #endif
+        return HM10_EC_ERR;
+    }
+    teuniz_rs232_lib_comport = comport - 1;
+
+    return HM10_EC_OK;
+}
+
+int get_hm10_comport()
+{
+    return teuniz_rs232_lib_comport + 1;
+}
+
 HM10_Status send_hm10_test_cmd()
 {
     /* Flush the RS-232 Port's RX before starting. */
@@ -139,7 +253,7 @@ HM10_Status send_hm10_test_cmd()
 	/* Send the HM-10 Device's Test Command. */
     /** <b>Local variable len:</b> Used to hold the currently received or sent bytes of data over the Serial Port. */
     uint16_t len = 0;
-    len = RS232_SendBuf(teuniz_rs232_lib_comport, TxRx_Buffer, HM10_RESET_CMD_SIZE);
+    len = send_hm10_comport(TxRx_Buffer, HM10_RESET_CMD_SIZE);
     if (len != HM10_RESET_CMD_SIZE)
     {
         #if ETX_OTA_VERBOSE
@@ -149,8 +263,7 @@ HM10_Status send_hm10_test_cmd()
     }
 
     /* Receive the HM-10 Device's Test Response. */
-    usleep(teuniz_poll_delay);
-    len = RS232_PollComport(teuniz_rs232_lib_comport, TxRx_Buffer, HM10_OK_RESPONSE_SIZE);
+    len = poll_hm10_response(TxRx_Buffer, HM10_OK_RESPONSE_SIZE, HM10_Cmd_Test);
     if (len != HM10_OK_RESPONSE_SIZE)
     {
         #if ETX_OTA_VERBOSE
@@ -170,6 +283,7 @@ HM10_Status send_hm10_test_cmd()
 			return HM10_EC_ERR;
 		}
 	}
+	HM10_TRACE_POINT(HM10_Trace_Parse_Done, HM10_Cmd_Test);
 	#if ETX_OTA_VERBOSE
 		printf("DONE: A Test Command has been successfully sent to the HM-10 BT Device.\r\n");
 	#endif
@@ -198,7 +312,7 @@ HM10_Status send_hm10_reset_cmd()
     /* Send the HM-10 Device's Reset Command. */
     /** <b>Local variable len:</b> Used to hold the currently received or sent bytes of data over the Serial Port. */
     uint16_t len = 0;
-    len = RS232_SendBuf(teuniz_rs232_lib_comport, TxRx_Buffer, HM10_RESET_CMD_SIZE);
+    len = send_hm10_comport(TxRx_Buffer, HM10_RESET_CMD_SIZE);
     if (len != HM10_RESET_CMD_SIZE)
     {
         #if ETX_OTA_VERBOSE
@@ -208,8 +322,7 @@ HM10_Status send_hm10_reset_cmd()
     }
 
 	/* Receive the HM-10 Device's Reset Response. */
-    usleep(teuniz_poll_delay);
-    len = RS232_PollComport(teuniz_rs232_lib_comport, TxRx_Buffer, HM10_RESET_RESPONSE_SIZE);
+    len = poll_hm10_response(TxRx_Buffer, HM10_RESET_RESPONSE_SIZE, HM10_Cmd_Reset);
     if (len != HM10_RESET_RESPONSE_SIZE)
     {
         #if ETX_OTA_VERBOSE
@@ -229,6 +342,7 @@ HM10_Status send_hm10_reset_cmd()
 			return HM10_EC_ERR;
 		}
 	}
+	HM10_TRACE_POINT(HM10_Trace_Parse_Done, HM10_Cmd_Reset);
 	#if ETX_OTA_VERBOSE
 		printf("DONE: A Reset Command has been successfully sent to the HM-10 BT Device.\r\n");
     #endif
@@ -260,7 +374,7 @@ HM10_Status send_hm10_renew_cmd()
     /* Send the HM-10 Device's Renew Command. */
     /** <b>Local variable len:</b> Used to hold the currently received or sent bytes of data over the Serial Port. */
     uint16_t len = 0;
-    len = RS232_SendBuf(teuniz_rs232_lib_comport, TxRx_Buffer, HM10_RENEW_CMD_SIZE);
+    len = send_hm10_comport(TxRx_Buffer, HM10_RENEW_CMD_SIZE);
     if (len != HM10_RENEW_CMD_SIZE)
     {
         #if ETX_OTA_VERBOSE
@@ -270,8 +384,7 @@ HM10_Status send_hm10_renew_cmd()
     }
 
     /* Receive the HM-10 Device's Renew Response. */
-    usleep(teuniz_poll_delay);
-    len = RS232_PollComport(teuniz_rs232_lib_comport, TxRx_Buffer, HM10_RENEW_RESPONSE_SIZE);
+    len = poll_hm10_response(TxRx_Buffer, HM10_RENEW_RESPONSE_SIZE, HM10_Cmd_Renew);
     if (len != HM10_RENEW_RESPONSE_SIZE)
     {
         #if ETX_OTA_VERBOSE
@@ -291,6 +404,7 @@ HM10_Status send_hm10_renew_cmd()
             return HM10_EC_ERR;
         }
     }
+    HM10_TRACE_POINT(HM10_Trace_Parse_Done, HM10_Cmd_Renew);
     #if ETX_OTA_VERBOSE
         printf("DONE: A Renew Command has been successfully sent to the HM-10 BT Device.\r\n");
     #endif
@@ -340,7 +454,7 @@ HM10_Status set_hm10_name(uint8_t *hm10_name, uint8_t size)
 	/* Send the HM-10 Device's Set Name Command. */
     /** <b>Local variable len:</b> Used to hold the currently received or sent bytes of data over the Serial Port. */
     uint16_t len = 0;
-    len = RS232_SendBuf(teuniz_rs232_lib_comport, TxRx_Buffer, bytes_populated_in_TxRx_Buffer);
+    len = send_hm10_comport(TxRx_Buffer, bytes_populated_in_TxRx_Buffer);
     if (len != bytes_populated_in_TxRx_Buffer)
     {
         #if ETX_OTA_VERBOSE
@@ -351,8 +465,7 @@ HM10_Status set_hm10_name(uint8_t *hm10_name, uint8_t size)
 
 	/* Receive the HM-10 Device's Set Name Response. */
     bytes_populated_in_TxRx_Buffer = HM10_SET_NAME_RESPONSE_SIZE_WITHOUT_REQUESTED_NAME + size;
-    usleep(teuniz_poll_delay);
-    len = RS232_PollComport(teuniz_rs232_lib_comport, TxRx_Buffer, bytes_populated_in_TxRx_Buffer);
+    len = poll_hm10_response(TxRx_Buffer, bytes_populated_in_TxRx_Buffer, HM10_Cmd_Set_Name);
     if (len != bytes_populated_in_TxRx_Buffer)
     {
         #if ETX_OTA_VERBOSE
@@ -385,6 +498,7 @@ HM10_Status set_hm10_name(uint8_t *hm10_name, uint8_t size)
 			return HM10_EC_ERR;
 		}
 	}
+	HM10_TRACE_POINT(HM10_Trace_Parse_Done, HM10_Cmd_Set_Name);
 	#if ETX_OTA_VERBOSE
 		printf("DONE: A BT Name has been successfully set in the HM-10 BT Device.\r\n");
 	#endif
@@ -413,7 +527,7 @@ HM10_Status get_hm10_name(uint8_t *hm10_name, uint8_t *size)
 	/* Send the HM-10 Device's Get Name Command. */
     /** <b>Local variable len:</b> Used to hold the currently received or sent bytes of data over the Serial Port. */
     uint16_t len = 0;
-    len = RS232_SendBuf(teuniz_rs232_lib_comport, TxRx_Buffer, HM10_GET_NAME_CMD_SIZE);
+    len = send_hm10_comport(TxRx_Buffer, HM10_GET_NAME_CMD_SIZE);
     if (len != HM10_GET_NAME_CMD_SIZE)
     {
         #if ETX_OTA_VERBOSE
@@ -423,8 +537,7 @@ HM10_Status get_hm10_name(uint8_t *hm10_name, uint8_t *size)
     }
 
 	/* Receive the HM-10 Device's Get Name Response but just before the BT Name bytes. */
-    usleep(teuniz_poll_delay);
-    len = RS232_PollComport(teuniz_rs232_lib_comport, TxRx_Buffer, HM10_GET_NAME_RESPONSE_SIZE_WITHOUT_REQUESTED_NAME);
+    len = poll_hm10_response(TxRx_Buffer, HM10_GET_NAME_RESPONSE_SIZE_WITHOUT_REQUESTED_NAME, HM10_Cmd_Get_Name);
     if (len != HM10_GET_NAME_RESPONSE_SIZE_WITHOUT_REQUESTED_NAME)
     {
         #if ETX_OTA_VERBOSE
@@ -453,8 +566,7 @@ HM10_Status get_hm10_name(uint8_t *hm10_name, uint8_t *size)
 	{
 		/* Receive the next byte from the BT Name. */
         (*size)++;
-        usleep(teuniz_poll_delay);
-        uint16_t len = RS232_PollComport(teuniz_rs232_lib_comport, &TxRx_Buffer[bytes_validated_in_TxRx_Buffer++], 1);
+        uint16_t len = poll_hm10_comport(&TxRx_Buffer[bytes_validated_in_TxRx_Buffer++], 1, get_hm10_command_timeout(HM10_Cmd_Get_Name), NULL);
         if (len != 1)
         {
             #if ETX_OTA_VERBOSE
@@ -492,6 +604,7 @@ HM10_Status get_hm10_name(uint8_t *hm10_name, uint8_t *size)
 	/* Pass the BT Name from the Buffer that is storing it into the \p hm10_name param. */
 	memcpy(hm10_name, &TxRx_Buffer[HM10_GET_NAME_RESPONSE_SIZE_WITHOUT_REQUESTED_NAME], *size);
 
+	HM10_TRACE_POINT(HM10_Trace_Parse_Done, HM10_Cmd_Get_Name);
 	#if ETX_OTA_VERBOSE
 		printf("DONE: The BT Name has been successfully received from the HM-10 BT Device.\r\n");
 	#endif
@@ -533,7 +646,7 @@ HM10_Status set_hm10_role(HM10_Role ble_role)
 	/* Send the HM-10 Device's Set Role Command. */
     /** <b>Local variable len:</b> Used to hold the currently received or sent bytes of data over the Serial Port. */
     uint16_t len = 0;
-    len = RS232_SendBuf(teuniz_rs232_lib_comport, TxRx_Buffer, HM10_SET_ROLE_CMD_SIZE);
+    len = send_hm10_comport(TxRx_Buffer, HM10_SET_ROLE_CMD_SIZE);
     if (len != HM10_SET_ROLE_CMD_SIZE)
     {
         #if ETX_OTA_VERBOSE
@@ -543,8 +656,7 @@ HM10_Status set_hm10_role(HM10_Role ble_role)
     }
 
     /* Receive the HM-10 Device's Set Role Response. */
-    usleep(teuniz_poll_delay);
-    len = RS232_PollComport(teuniz_rs232_lib_comport, TxRx_Buffer, HM10_ROLE_RESPONSE_SIZE);
+    len = poll_hm10_response(TxRx_Buffer, HM10_ROLE_RESPONSE_SIZE, HM10_Cmd_Set_Role);
     if (len != HM10_ROLE_RESPONSE_SIZE)
     {
         #if ETX_OTA_VERBOSE
@@ -575,6 +687,7 @@ HM10_Status set_hm10_role(HM10_Role ble_role)
 		#endif
 		return HM10_EC_ERR;
 	}
+	HM10_TRACE_POINT(HM10_Trace_Parse_Done, HM10_Cmd_Set_Role);
 	#if ETX_OTA_VERBOSE
 		printf("DONE: A Role has been successfully set in the HM-10 BT Device.\r\n");
 	#endif
@@ -603,7 +716,7 @@ HM10_Status get_hm10_role(HM10_Role *ble_role)
 	/* Send the HM-10 Device's Get Role Command. */
     /** <b>Local variable len:</b> Used to hold the currently received or sent bytes of data over the Serial Port. */
     uint16_t len = 0;
-    len = RS232_SendBuf(teuniz_rs232_lib_comport, TxRx_Buffer, HM10_GET_ROLE_CMD_SIZE);
+    len = send_hm10_comport(TxRx_Buffer, HM10_GET_ROLE_CMD_SIZE);
     if (len != HM10_GET_ROLE_CMD_SIZE)
     {
         #if ETX_OTA_VERBOSE
@@ -613,8 +726,7 @@ HM10_Status get_hm10_role(HM10_Role *ble_role)
     }
 
 	/* Receive the HM-10 Device's Get Role Response. */
-    usleep(teuniz_poll_delay);
-    len = RS232_PollComport(teuniz_rs232_lib_comport, TxRx_Buffer, HM10_ROLE_RESPONSE_SIZE);
+    len = poll_hm10_response(TxRx_Buffer, HM10_ROLE_RESPONSE_SIZE, HM10_Cmd_Get_Role);
     if (len != HM10_ROLE_RESPONSE_SIZE)
     {
         #if ETX_OTA_VERBOSE
@@ -651,6 +763,7 @@ HM10_Status get_hm10_role(HM10_Role *ble_role)
 	}
 	*ble_role = TxRx_Buffer[bytes_compared];
 
+	HM10_TRACE_POINT(HM10_Trace_Parse_Done, HM10_Cmd_Get_Role);
 	#if ETX_OTA_VERBOSE
 		printf("DONE: The BT Role has been successfully received from the HM-10 BT Device.\r\n");
 	#endif
@@ -709,7 +822,7 @@ HM10_Status set_hm10_pin(uint8_t *pin)
 	/* Send the HM-10 Device's Set Pin Command. */
     /** <b>Local variable len:</b> Used to hold the currently received or sent bytes of data over the Serial Port. */
     uint16_t len = 0;
-    len = RS232_SendBuf(teuniz_rs232_lib_comport, TxRx_Buffer, HM10_SET_PIN_CMD_SIZE);
+    len = send_hm10_comport(TxRx_Buffer, HM10_SET_PIN_CMD_SIZE);
     if (len != HM10_SET_PIN_CMD_SIZE)
     {
         #if ETX_OTA_VERBOSE
@@ -719,8 +832,7 @@ HM10_Status set_hm10_pin(uint8_t *pin)
     }
 
 	/* Receive the HM-10 Device's Set Pin Response. */
-    usleep(teuniz_poll_delay);
-    len = RS232_PollComport(teuniz_rs232_lib_comport, TxRx_Buffer, HM10_PIN_RESPONSE_SIZE);
+    len = poll_hm10_response(TxRx_Buffer, HM10_PIN_RESPONSE_SIZE, HM10_Cmd_Set_Pin);
     if (len != HM10_PIN_RESPONSE_SIZE)
     {
         #if ETX_OTA_VERBOSE
@@ -755,6 +867,7 @@ HM10_Status set_hm10_pin(uint8_t *pin)
 		}
 	}
 
+	HM10_TRACE_POINT(HM10_Trace_Parse_Done, HM10_Cmd_Set_Pin);
 	#if ETX_OTA_VERBOSE
 		printf("DONE: A BT Pin has been successfully set in the HM-10 BT Device.\r\n");
 	#endif
@@ -783,7 +896,7 @@ HM10_Status get_hm10_pin(uint8_t *pin)
 	/* Send the HM-10 Device's Get Pin Command. */
     /** <b>Local variable len:</b> Used to hold the currently received or sent bytes of data over the Serial Port. */
     uint16_t len = 0;
-    len = RS232_SendBuf(teuniz_rs232_lib_comport, TxRx_Buffer, HM10_GET_PIN_CMD_SIZE);
+    len = send_hm10_comport(TxRx_Buffer, HM10_GET_PIN_CMD_SIZE);
     if (len != HM10_GET_PIN_CMD_SIZE)
     {
         #if ETX_OTA_VERBOSE
@@ -793,8 +906,7 @@ HM10_Status get_hm10_pin(uint8_t *pin)
     }
 
 	/* Receive the HM-10 Device's Get Pin Response. */
-    usleep(teuniz_poll_delay);
-    len = RS232_PollComport(teuniz_rs232_lib_comport, TxRx_Buffer, HM10_PIN_RESPONSE_SIZE);
+    len = poll_hm10_response(TxRx_Buffer, HM10_PIN_RESPONSE_SIZE, HM10_Cmd_Get_Pin);
     if (len != HM10_PIN_RESPONSE_SIZE)
     {
         #if ETX_OTA_VERBOSE
@@ -845,6 +957,7 @@ HM10_Status get_hm10_pin(uint8_t *pin)
 	/* Pass the BT Pin from the Buffer that is storing it into the \p pin param. */
 	memcpy(pin, &TxRx_Buffer[pin_resp_size_without_pin_value], HM10_PIN_VALUE_SIZE);
 
+	HM10_TRACE_POINT(HM10_Trace_Parse_Done, HM10_Cmd_Get_Pin);
 	#if ETX_OTA_VERBOSE
 		printf("DONE: The BT Pin has been successfully received from the HM-10 BT Device.\r\n");
 	#endif
@@ -886,7 +999,7 @@ HM10_Status set_hm10_pin_code_mode(HM10_Pin_Code_Mode pin_code_mode)
 	/* Send the HM-10 Device's Set Type Command. */
     /** <b>Local variable len:</b> Used to hold the currently received or sent bytes of data over the Serial Port. */
     uint16_t len = 0;
-    len = RS232_SendBuf(teuniz_rs232_lib_comport, TxRx_Buffer, HM10_SET_TYPE_CMD_SIZE);
+    len = send_hm10_comport(TxRx_Buffer, HM10_SET_TYPE_CMD_SIZE);
     if (len != HM10_SET_TYPE_CMD_SIZE)
     {
         #if ETX_OTA_VERBOSE
@@ -896,8 +1009,7 @@ HM10_Status set_hm10_pin_code_mode(HM10_Pin_Code_Mode pin_code_mode)
     }
 
 	/* Receive the HM-10 Device's Set Type Response. */
-    usleep(teuniz_poll_delay);
-    len = RS232_PollComport(teuniz_rs232_lib_comport, TxRx_Buffer, HM10_TYPE_RESPONSE_SIZE);
+    len = poll_hm10_response(TxRx_Buffer, HM10_TYPE_RESPONSE_SIZE, HM10_Cmd_Set_Pin_Code_Mode);
     if (len != HM10_TYPE_RESPONSE_SIZE)
     {
         #if ETX_OTA_VERBOSE
@@ -929,6 +1041,7 @@ HM10_Status set_hm10_pin_code_mode(HM10_Pin_Code_Mode pin_code_mode)
 		return HM10_EC_ERR;
 	}
 
+	HM10_TRACE_POINT(HM10_Trace_Parse_Done, HM10_Cmd_Set_Pin_Code_Mode);
 	#if ETX_OTA_VERBOSE
 		printf("DONE: The desired Pin Code Mode has been successfully set in the HM-10 BT Device.\r\n");
 	#endif
@@ -957,7 +1070,7 @@ HM10_Status get_hm10_pin_code_mode(HM10_Pin_Code_Mode *pin_code_mode)
 	/* Send the HM-10 Device's Get Type Command. */
     /** <b>Local variable len:</b> Used to hold the currently received or sent bytes of data over the Serial Port. */
     uint16_t len = 0;
-    len = RS232_SendBuf(teuniz_rs232_lib_comport, TxRx_Buffer, HM10_GET_TYPE_CMD_SIZE);
+    len = send_hm10_comport(TxRx_Buffer, HM10_GET_TYPE_CMD_SIZE);
     if (len != HM10_GET_TYPE_CMD_SIZE)
     {
         #if ETX_OTA_VERBOSE
@@ -967,8 +1080,7 @@ HM10_Status get_hm10_pin_code_mode(HM10_Pin_Code_Mode *pin_code_mode)
     }
 
 	/* Receive the HM-10 Device's Get Type Response. */
-    usleep(teuniz_poll_delay);
-    len = RS232_PollComport(teuniz_rs232_lib_comport, TxRx_Buffer, HM10_TYPE_RESPONSE_SIZE);
+    len = poll_hm10_response(TxRx_Buffer, HM10_TYPE_RESPONSE_SIZE, HM10_Cmd_Get_Pin_Code_Mode);
     if (len != HM10_TYPE_RESPONSE_SIZE)
     {
         #if ETX_OTA_VERBOSE
@@ -1007,6 +1119,7 @@ HM10_Status get_hm10_pin_code_mode(HM10_Pin_Code_Mode *pin_code_mode)
 	/* Pass the BT Pin Code Mode from the Buffer that is storing it into the \p pin_code_mode param. */
 	*pin_code_mode = TxRx_Buffer[type_resp_size_without_type_value];
 
+	HM10_TRACE_POINT(HM10_Trace_Parse_Done, HM10_Cmd_Get_Pin_Code_Mode);
 	#if ETX_OTA_VERBOSE
 		printf("DONE: The BT Pin Code Mode has been successfully received from the HM-10 BT Device.\r\n");
 	#endif
@@ -1049,7 +1162,7 @@ HM10_Status set_hm10_module_work_mode(HM10_Module_Work_Mode module_work_mode)
     /* Send the HM-10 Device's Set Mode Command. */
     /** <b>Local variable len:</b> Used to hold the currently received or sent bytes of data over the Serial Port. */
     uint16_t len = 0;
-    len = RS232_SendBuf(teuniz_rs232_lib_comport, TxRx_Buffer, HM10_SET_MODE_CMD_SIZE);
+    len = send_hm10_comport(TxRx_Buffer, HM10_SET_MODE_CMD_SIZE);
     if (len != HM10_SET_MODE_CMD_SIZE)
     {
         #if ETX_OTA_VERBOSE
@@ -1059,8 +1172,7 @@ HM10_Status set_hm10_module_work_mode(HM10_Module_Work_Mode module_work_mode)
     }
 
     /* Receive the HM-10 Device's Set Mode Response. */
-    usleep(teuniz_poll_delay);
-    len = RS232_PollComport(teuniz_rs232_lib_comport, TxRx_Buffer, HM10_MODE_RESPONSE_SIZE);
+    len = poll_hm10_response(TxRx_Buffer, HM10_MODE_RESPONSE_SIZE, HM10_Cmd_Set_Module_Work_Mode);
     if (len != HM10_MODE_RESPONSE_SIZE)
     {
         #if ETX_OTA_VERBOSE
@@ -1091,6 +1203,7 @@ HM10_Status set_hm10_module_work_mode(HM10_Module_Work_Mode module_work_mode)
         #endif
         return HM10_EC_ERR;
     }
+    HM10_TRACE_POINT(HM10_Trace_Parse_Done, HM10_Cmd_Set_Module_Work_Mode);
     #if ETX_OTA_VERBOSE
         printf("DONE: The desired Module Work Mode has been successfully set in the HM-10 BT Device.\r\n");
     #endif
@@ -1119,7 +1232,7 @@ HM10_Status get_hm10_module_work_mode(HM10_Module_Work_Mode *module_work_mode)
     /* Send the HM-10 Device's Get Type Command. */
     /** <b>Local variable len:</b> Used to hold the currently received or sent bytes of data over the Serial Port. */
     uint16_t len = 0;
-    len = RS232_SendBuf(teuniz_rs232_lib_comport, TxRx_Buffer, HM10_GET_MODE_CMD_SIZE);
+    len = send_hm10_comport(TxRx_Buffer, HM10_GET_MODE_CMD_SIZE);
     if (len != HM10_GET_MODE_CMD_SIZE)
     {
         #if ETX_OTA_VERBOSE
@@ -1129,8 +1242,7 @@ HM10_Status get_hm10_module_work_mode(HM10_Module_Work_Mode *module_work_mode)
     }
 
     /* Receive the HM-10 Device's Get Mode Response. */
-    usleep(teuniz_poll_delay);
-    len = RS232_PollComport(teuniz_rs232_lib_comport, TxRx_Buffer, HM10_MODE_RESPONSE_SIZE);
+    len = poll_hm10_response(TxRx_Buffer, HM10_MODE_RESPONSE_SIZE, HM10_Cmd_Get_Module_Work_Mode);
     if (len != HM10_MODE_RESPONSE_SIZE)
     {
         #if ETX_OTA_VERBOSE
@@ -1170,6 +1282,7 @@ HM10_Status get_hm10_module_work_mode(HM10_Module_Work_Mode *module_work_mode)
     /* Pass the HM-10's Module Work Mode from the Buffer that is storing it into the \p module_work_mode param. */
     *module_work_mode = TxRx_Buffer[mode_resp_size_without_module_work_mode_value];
 
+    HM10_TRACE_POINT(HM10_Trace_Parse_Done, HM10_Cmd_Get_Module_Work_Mode);
     #if ETX_OTA_VERBOSE
         printf("DONE: The Module Work Mode has been successfully received from the HM-10 BT Device.\r\n");
     #endif
@@ -1211,7 +1324,7 @@ HM10_Status set_hm10_module_work_type(HM10_Module_Work_Type module_work_type)
     /* Send the HM-10 Device's Set IMME Command. */
     /** <b>Local variable len:</b> Used to hold the currently received or sent bytes of data over the Serial Port. */
     uint16_t len = 0;
-    len = RS232_SendBuf(teuniz_rs232_lib_comport, TxRx_Buffer, HM10_SET_IMME_CMD_SIZE);
+    len = send_hm10_comport(TxRx_Buffer, HM10_SET_IMME_CMD_SIZE);
     if (len != HM10_SET_IMME_CMD_SIZE)
     {
         #if ETX_OTA_VERBOSE
@@ -1221,8 +1334,7 @@ HM10_Status set_hm10_module_work_type(HM10_Module_Work_Type module_work_type)
     }
 
     /* Receive the HM-10 Device's Set IMME Response. */
-    usleep(teuniz_poll_delay);
-    len = RS232_PollComport(teuniz_rs232_lib_comport, TxRx_Buffer, HM10_IMME_RESPONSE_SIZE);
+    len = poll_hm10_response(TxRx_Buffer, HM10_IMME_RESPONSE_SIZE, HM10_Cmd_Set_Module_Work_Type);
     if (len != HM10_IMME_RESPONSE_SIZE)
     {
         #if ETX_OTA_VERBOSE
@@ -1253,6 +1365,7 @@ HM10_Status set_hm10_module_work_type(HM10_Module_Work_Type module_work_type)
         #endif
         return HM10_EC_ERR;
     }
+    HM10_TRACE_POINT(HM10_Trace_Parse_Done, HM10_Cmd_Set_Module_Work_Type);
     #if ETX_OTA_VERBOSE
         printf("DONE: The desired Module Work Type has been successfully set in the HM-10 BT Device.\r\n");
     #endif
@@ -1281,7 +1394,7 @@ HM10_Status get_hm10_module_work_type(HM10_Module_Work_Type *module_work_type)
     /* Send the HM-10 Device's Get IMME Command. */
     /** <b>Local variable len:</b> Used to hold the currently received or sent bytes of data over the Serial Port. */
     uint16_t len = 0;
-    len = RS232_SendBuf(teuniz_rs232_lib_comport, TxRx_Buffer, HM10_GET_IMME_CMD_SIZE);
+    len = send_hm10_comport(TxRx_Buffer, HM10_GET_IMME_CMD_SIZE);
     if (len != HM10_GET_IMME_CMD_SIZE)
     {
         #if ETX_OTA_VERBOSE
@@ -1291,8 +1404,7 @@ HM10_Status get_hm10_module_work_type(HM10_Module_Work_Type *module_work_type)
     }
 
     /* Receive the HM-10 Device's Get IMME Response. */
-    usleep(teuniz_poll_delay);
-    len = RS232_PollComport(teuniz_rs232_lib_comport, TxRx_Buffer, HM10_IMME_RESPONSE_SIZE);
+    len = poll_hm10_response(TxRx_Buffer, HM10_IMME_RESPONSE_SIZE, HM10_Cmd_Get_Module_Work_Type);
     if (len != HM10_IMME_RESPONSE_SIZE)
     {
         #if ETX_OTA_VERBOSE
@@ -1330,6 +1442,7 @@ HM10_Status get_hm10_module_work_type(HM10_Module_Work_Type *module_work_type)
 
     /* Pass the HM-10's Module Work Type from the Buffer that is storing it into the \p module_work_type param. */
     *module_work_type = TxRx_Buffer[imme_resp_size_without_module_work_type_value];
+    HM10_TRACE_POINT(HM10_Trace_Parse_Done, HM10_Cmd_Get_Module_Work_Type);
     #if ETX_OTA_VERBOSE
         printf("DONE: The Module Work Type has been successfully received from the HM-10 BT Device.\r\n");
     #endif
@@ -1371,7 +1484,7 @@ HM10_Status set_hm10_notify_information_mode(HM10_Notify_Information_Mode notify
     /* Send the HM-10 Device's Set NOTI Command. */
     /** <b>Local variable len:</b> Used to hold the currently received or sent bytes of data over the Serial Port. */
     uint16_t len = 0;
-    len = RS232_SendBuf(teuniz_rs232_lib_comport, TxRx_Buffer, HM10_SET_NOTI_CMD_SIZE);
+    len = send_hm10_comport(TxRx_Buffer, HM10_SET_NOTI_CMD_SIZE);
     if (len != HM10_SET_NOTI_CMD_SIZE)
     {
         #if ETX_OTA_VERBOSE
@@ -1381,8 +1494,7 @@ HM10_Status set_hm10_notify_information_mode(HM10_Notify_Information_Mode notify
     }
 
     /* Receive the HM-10 Device's Set NOTI Response. */
-    usleep(teuniz_poll_delay);
-    len = RS232_PollComport(teuniz_rs232_lib_comport, TxRx_Buffer, HM10_NOTI_RESPONSE_SIZE);
+    len = poll_hm10_response(TxRx_Buffer, HM10_NOTI_RESPONSE_SIZE, HM10_Cmd_Set_Notify_Information_Mode);
     if (len != HM10_NOTI_RESPONSE_SIZE)
     {
         #if ETX_OTA_VERBOSE
@@ -1413,6 +1525,7 @@ HM10_Status set_hm10_notify_information_mode(HM10_Notify_Information_Mode notify
         #endif
         return HM10_EC_ERR;
     }
+    HM10_TRACE_POINT(HM10_Trace_Parse_Done, HM10_Cmd_Set_Notify_Information_Mode);
     #if ETX_OTA_VERBOSE
         printf("DONE: The desired Notify Information Mode has been successfully set in the HM-10 BT Device.\r\n");
     #endif
@@ -1441,7 +1554,7 @@ HM10_Status get_hm10_notify_information_mode(HM10_Notify_Information_Mode *notif
     /* Send the HM-10 Device's Get NOTI Command. */
     /** <b>Local variable len:</b> Used to hold the currently received or sent bytes of data over the Serial Port. */
     uint16_t len = 0;
-    len = RS232_SendBuf(teuniz_rs232_lib_comport, TxRx_Buffer, HM10_GET_NOTI_CMD_SIZE);
+    len = send_hm10_comport(TxRx_Buffer, HM10_GET_NOTI_CMD_SIZE);
     if (len != HM10_GET_NOTI_CMD_SIZE)
     {
         #if ETX_OTA_VERBOSE
@@ -1451,8 +1564,7 @@ HM10_Status get_hm10_notify_information_mode(HM10_Notify_Information_Mode *notif
     }
 
     /* Receive the HM-10 Device's Get NOTI Response. */
-    usleep(teuniz_poll_delay);
-    len = RS232_PollComport(teuniz_rs232_lib_comport, TxRx_Buffer, HM10_NOTI_RESPONSE_SIZE);
+    len = poll_hm10_response(TxRx_Buffer, HM10_NOTI_RESPONSE_SIZE, HM10_Cmd_Get_Notify_Information_Mode);
     if (len != HM10_NOTI_RESPONSE_SIZE)
     {
         #if ETX_OTA_VERBOSE
@@ -1490,6 +1602,7 @@ HM10_Status get_hm10_notify_information_mode(HM10_Notify_Information_Mode *notif
 
     /* Pass the HM-10's Notify Information Mode from the Buffer that is storing it into the \p notify_mode param. */
     *notify_mode = TxRx_Buffer[noti_resp_size_without_notify_mode_value];
+    HM10_TRACE_POINT(HM10_Trace_Parse_Done, HM10_Cmd_Get_Notify_Information_Mode);
     #if ETX_OTA_VERBOSE
         printf("DONE: The Notify Information Mode has been successfully received from the HM-10 BT Device.\r\n");
     #endif
@@ -1497,6 +1610,79 @@ HM10_Status get_hm10_notify_information_mode(HM10_Notify_Information_Mode *notif
     return HM10_EC_OK;
 }
 
+HM10_Status get_hm10_bt_address(char bt_addr[HM10_BT_ADDR_SIZE])
+{
+    /* Flush the RS-232 Port's RX before starting. */
+    RS232_flushRX(teuniz_rs232_lib_comport);
+
+    /* Populate the HM-10 Device's Get Address Command into the Tx/Rx Buffer. */
+    #if ETX_OTA_VERBOSE
+        printf("Sending Get Address Command to HM-10 BT Device...\r\n");
+    #endif
+    TxRx_Buffer[0] = 'A';
+    TxRx_Buffer[1] = 'T';
+    TxRx_Buffer[2] = '+';
+    TxRx_Buffer[3] = 'A';
+    TxRx_Buffer[4] = 'D';
+    TxRx_Buffer[5] = 'D';
+    TxRx_Buffer[6] = 'R';
+    TxRx_Buffer[7] = '?';
+
+    /* Send the HM-10 Device's Get Address Command. */
+    /** <b>Local variable len:</b> Used to hold the currently received or sent bytes of data over the Serial Port. */
+    uint16_t len = 0;
+    len = send_hm10_comport(TxRx_Buffer, HM10_GET_ADDR_CMD_SIZE);
+    if (len != HM10_GET_ADDR_CMD_SIZE)
+    {
+        #if ETX_OTA_VERBOSE
+            printf("ERROR: The transmission of the Get Address Command to HM-10 BT Device has failed.\r\n");
+        #endif
+        return HM10_EC_ERR;
+    }
+
+    /* Receive the HM-10 Device's Get Address Response but just before the Bluetooth Address bytes. */
+    len = poll_hm10_response(TxRx_Buffer, HM10_GET_ADDR_RESPONSE_SIZE_WITHOUT_ADDRESS, HM10_Cmd_Get_BT_Address);
+    if (len != HM10_GET_ADDR_RESPONSE_SIZE_WITHOUT_ADDRESS)
+    {
+        #if ETX_OTA_VERBOSE
+            printf("ERROR: A Get Address Response from the HM-10 BT Device was expected, but none was received (HM-10 Exception code = %d)\r\n", HM10_EC_NR);
+        #endif
+        return HM10_EC_NR;
+    }
+
+    /* Validate the HM-10 Device's Get Address Response part that was just received (i.e., The received data just before the Bluetooth Address bytes part). */
+    for (uint8_t bytes_compared=0; bytes_compared<HM10_GET_ADDR_RESPONSE_SIZE_WITHOUT_ADDRESS; bytes_compared++)
+    {
+        if (TxRx_Buffer[bytes_compared] != HM10_Get_Addr_resp_without_address_value[bytes_compared])
+        {
+            #if ETX_OTA_VERBOSE
+                printf("ERROR: A Get Address Response from the HM-10 BT Device was expected, but something else was received instead.\r\n");
+            #endif
+            return HM10_EC_ERR;
+        }
+    }
+
+    /* Receive the Bluetooth Address bytes part from the HM-10 Device's Get Address Response. */
+    // NOTE: The whole Get Address Response exceeds the size of the Tx/Rx Buffer, which is why the Bluetooth Address is received in a second request.
+    len = poll_hm10_comport(TxRx_Buffer, HM10_BT_ADDR_SIZE, get_hm10_command_timeout(HM10_Cmd_Get_BT_Address), NULL);
+    if (len != HM10_BT_ADDR_SIZE)
+    {
+        #if ETX_OTA_VERBOSE
+            printf("ERROR: A Bluetooth Address from the HM-10 BT Device was expected, but none was received (HM-10 Exception code = %d)\r\n", HM10_EC_NR);
+        #endif
+        return HM10_EC_NR;
+    }
+
+    /* Pass the Bluetooth Address from the Buffer that is storing it into the \p bt_addr param. */
+    memcpy(bt_addr, TxRx_Buffer, HM10_BT_ADDR_SIZE);
+    HM10_TRACE_POINT(HM10_Trace_Parse_Done, HM10_Cmd_Get_BT_Address);
+    #if ETX_OTA_VERBOSE
+        printf("DONE: The Bluetooth Address has been successfully received from the HM-10 BT Device.\r\n");
+    #endif
+
+    return HM10_EC_OK;
+}
+
 HM10_Status connect_hm10_to_bt_address(HM10_BT_Address_Type bt_addr_t, char bt_addr[12])
 {
     /* Validating given Bluetooth Address Type. */
@@ -1544,7 +1730,7 @@ HM10_Status connect_hm10_to_bt_address(HM10_BT_Address_Type bt_addr_t, char bt_a
     /** <b>Local variable len:</b> Used to hold the currently received or sent bytes of data over the Serial Port. */
     uint16_t len = 0;
 
-    len = RS232_SendBuf(teuniz_rs232_lib_comport, TxRx_Buffer, HM10_CONNECT_TO_ADDRESS_CMD_SIZE);
+    len = send_hm10_comport(TxRx_Buffer, HM10_CONNECT_TO_ADDRESS_CMD_SIZE);
     if (len != HM10_CONNECT_TO_ADDRESS_CMD_SIZE)
     {
         #if ETX_OTA_VERBOSE
@@ -1554,8 +1740,7 @@ HM10_Status connect_hm10_to_bt_address(HM10_BT_Address_Type bt_addr_t, char bt_a
     }
 
     /* Receive the part one of the HM-10 Device's Connect-To-Address Response. */
-    usleep(teuniz_poll_delay);
-    len = RS232_PollComport(teuniz_rs232_lib_comport, TxRx_Buffer, HM10_CONNECT_TO_ADDRESS_RESPONSE1_SIZE);
+    len = poll_hm10_response(TxRx_Buffer, HM10_CONNECT_TO_ADDRESS_RESPONSE1_SIZE, HM10_Cmd_Connect_To_Address);
     if (len != HM10_CONNECT_TO_ADDRESS_RESPONSE1_SIZE)
     {
         #if ETX_OTA_VERBOSE
@@ -1581,8 +1766,7 @@ HM10_Status connect_hm10_to_bt_address(HM10_BT_Address_Type bt_addr_t, char bt_a
     }
 
     /* Receive the part two of the HM-10 Device's Connect-To-Address Response. */
-    usleep(hm10_connect_to_address_timeout);
-    len = RS232_PollComport(teuniz_rs232_lib_comport, TxRx_Buffer, HM10_CONNECT_TO_ADDRESS_RESPONSE2_SIZE);
+    len = poll_hm10_comport(TxRx_Buffer, HM10_CONNECT_TO_ADDRESS_RESPONSE2_SIZE, hm10_connect_to_address_timeout, NULL);
     if (len != HM10_CONNECT_TO_ADDRESS_RESPONSE2_SIZE)
     {
         #if ETX_OTA_VERBOSE
@@ -1603,6 +1787,7 @@ HM10_Status connect_hm10_to_bt_address(HM10_BT_Address_Type bt_addr_t, char bt_a
             return HM10_EC_ERR;
         }
     }
+    HM10_TRACE_POINT(HM10_Trace_Parse_Done, HM10_Cmd_Connect_To_Address);
     #if ETX_OTA_VERBOSE
         printf("DONE: The HM-10 BT Device has successfully connected to the remote BT that has the requested BT Address of ");
         for (uint8_t i=0; i<10; i+=2)
@@ -1645,7 +1830,7 @@ HM10_BT_Connection_Status disconnect_hm10_from_bt_address()
     */
     /** <b>Local variable len:</b> Used to hold the currently received or sent bytes of data over the Serial Port. */
     uint16_t len = 0;
-    len = RS232_SendBuf(teuniz_rs232_lib_comport, TxRx_Buffer, HM10_TEST_CMD_SIZE);
+    len = send_hm10_comport(TxRx_Buffer, HM10_TEST_CMD_SIZE);
     if (len != HM10_TEST_CMD_SIZE)
     {
         #if ETX_OTA_VERBOSE
@@ -1655,8 +1840,7 @@ HM10_BT_Connection_Status disconnect_hm10_from_bt_address()
     }
 
     /* Receive the first part of the HM-10 Device's Lost-Connection Response. */
-    usleep(teuniz_poll_delay);
-    len = RS232_PollComport(teuniz_rs232_lib_comport, TxRx_Buffer, HM10_OK_RESPONSE_SIZE);
+    len = poll_hm10_response(TxRx_Buffer, HM10_OK_RESPONSE_SIZE, HM10_Cmd_Disconnect);
     if (len != HM10_OK_RESPONSE_SIZE)
     {
         #if ETX_OTA_VERBOSE
@@ -1680,8 +1864,7 @@ HM10_BT_Connection_Status disconnect_hm10_from_bt_address()
     }
 
     /* Receive the second part of the HM-10 Device's Lost-Connection Response. */
-    usleep(teuniz_poll_delay);
-    len = RS232_PollComport(teuniz_rs232_lib_comport, &TxRx_Buffer[bytes_compared], HM10_OK_LOST_RESPONSE_SIZE_WITHOUT_THE_OK_PART);
+    len = poll_hm10_comport(&TxRx_Buffer[bytes_compared], HM10_OK_LOST_RESPONSE_SIZE_WITHOUT_THE_OK_PART, get_hm10_command_timeout(HM10_Cmd_Disconnect), NULL);
     if (len != HM10_OK_LOST_RESPONSE_SIZE_WITHOUT_THE_OK_PART)
     {
         #if ETX_OTA_VERBOSE
@@ -1701,6 +1884,7 @@ HM10_BT_Connection_Status disconnect_hm10_from_bt_address()
             return HM10_BT_Connection_Status_Unknown;
         }
     }
+    HM10_TRACE_POINT(HM10_Trace_Parse_Done, HM10_Cmd_Disconnect);
     #if ETX_OTA_VERBOSE
         printf("DONE: The HM-10 Device has been disconnected from an on-going Bluetooth Connection.\r\n");
     #endif
@@ -1711,7 +1895,16 @@ HM10_BT_Connection_Status disconnect_hm10_from_bt_address()
 HM10_Status send_hm10_ota_byte_of_data(uint8_t ble_ota_data)
 {
     /* Send the requested byte of data Over the Air (OTA) via the HM-10 BT Device. */
-    if (RS232_SendBuf(teuniz_rs232_lib_comport, &ble_ota_data, 1) != 1)
+    if (is_hm10_ota_pacer_enabled())
+    {
+        wait_for_hm10_ota_pacer(1);
+        if (send_hm10_comport(&ble_ota_data, 1) != 1)
+        {
+            return HM10_EC_ERR;
+        }
+        return HM10_EC_OK;
+    }
+    if (send_hm10_comport(&ble_ota_data, 1) != 1)
     {
         return HM10_EC_ERR;
     }
@@ -1722,8 +1915,25 @@ HM10_Status send_hm10_ota_byte_of_data(uint8_t ble_ota_data)
 
 HM10_Status send_hm10_ota_data(uint8_t *ble_ota_data, uint16_t size)
 {
+    /* Send the requested data Over the Air (OTA) via the HM-10 BT Device in bursts at the rate allowed by the OTA Pacer, if it is enabled. */
+    if (is_hm10_ota_pacer_enabled())
+    {
+        /** <b>Local variable burst_size:</b> Length in bytes of the current burst of data to be sent. */
+        uint16_t burst_size;
+        for (uint16_t bytes_sent=0; bytes_sent<size; bytes_sent+=burst_size)
+        {
+            burst_size = ((size-bytes_sent) > HM10_MAX_PACKET_SIZE) ? HM10_MAX_PACKET_SIZE : (size-bytes_sent);
+            wait_for_hm10_ota_pacer(burst_size);
+            if (send_hm10_comport(&ble_ota_data[bytes_sent], burst_size) != burst_size)
+            {
+                return HM10_EC_ERR;
+            }
+        }
+        return HM10_EC_OK;
+    }
+
 	/* Send the requested data Over the Air (OTA) via the HM-10 BT Device. */
-    if (RS232_SendBuf(teuniz_rs232_lib_comport, ble_ota_data, size) != size)
+    if (send_hm10_comport(ble_ota_data, size) != size)
     {
         return HM10_EC_ERR;
     }
@@ -1734,8 +1944,7 @@ HM10_Status send_hm10_ota_data(uint8_t *ble_ota_data, uint16_t size)
 HM10_Status get_hm10_ota_data(uint8_t *ble_ota_data, uint16_t size)
 {
 	/* Receive the HM-10 Device's BT data that is received Over the Air (OTA), if there is any. */
-    usleep(teuniz_poll_delay);
-    uint16_t len = RS232_PollComport(teuniz_rs232_lib_comport, ble_ota_data, size);
+    uint16_t len = poll_hm10_comport(ble_ota_data, size, teuniz_poll_delay, NULL);
     if (len != size)
     {
         return HM10_EC_NR;
@@ -1744,4 +1953,261 @@ HM10_Status get_hm10_ota_data(uint8_t *ble_ota_data, uint16_t size)
 	return HM10_EC_OK;
 }
 
+HM10_Status get_hm10_ota_available_data(uint8_t *ble_ota_data, uint16_t max_size, uint16_t *size)
+{
+    /** <b>Local variable start_time:</b> Time in microseconds at which this function started to poll the RS-232 Port. */
+    uint64_t start_time = get_monotonic_time_us();
+    /** <b>Local variable len:</b> Bytes of data received in the last poll of the RS-232 Port. */
+    int len;
+
+    /* Poll the RS-232 Port until at least one byte is received or until the timeout expires. */
+    *size = 0;
+    do
+    {
+        len = RS232_PollComport(teuniz_rs232_lib_comport, ble_ota_data, max_size);
+        if (len > 0)
+        {
+            HM10_TRACE_POINT(HM10_Trace_First_RX_Byte, len);
+            HM10_TRACE_POINT(HM10_Trace_Last_RX_Byte, len);
+            *size = (uint16_t) len;
+            return HM10_EC_OK;
+        }
+        if ((get_monotonic_time_us()-start_time) >= teuniz_poll_delay)
+        {
+            return HM10_EC_NR;
+        }
+        usleep(HM10_POLL_STEP_DELAY);
+    }
+    while (1);
+}
+
+uint32_t get_hm10_command_timeout(HM10_Command_Type command_type)
+{
+#if HM10_ADAPTIVE_TIMEOUTS
+    if (command_type >= HM10_Cmd_Types_Count)
+    {
+        return teuniz_poll_delay;
+    }
+
+    /** <b>Local variable p_estimate:</b> Pointer to the learned Response Latency of the requested Command Type of the current HM-10 BT Device. */
+    HM10_Latency_Estimate *p_estimate = &latency_estimates[teuniz_rs232_lib_comport][command_type];
+    if (p_estimate->samples < HM10_ADAPTIVE_TIMEOUT_MIN_SAMPLES)
+    {
+        return teuniz_poll_delay;
+    }
+
+    /* Calculate the timeout as the mean plus k times the standard deviation of the learned Response Latency. */
+    /** <b>Local variable timeout:</b> Timeout in microseconds for the requested Command Type. */
+    uint64_t timeout = (uint64_t) p_estimate->mean + (uint64_t) HM10_ADAPTIVE_TIMEOUT_K*isqrt64(p_estimate->variance);
+    if (timeout < HM10_ADAPTIVE_TIMEOUT_MIN)
+    {
+        timeout = HM10_ADAPTIVE_TIMEOUT_MIN;
+    }
+    else if (timeout > HM10_ADAPTIVE_TIMEOUT_MAX)
+    {
+        timeout = HM10_ADAPTIVE_TIMEOUT_MAX;
+    }
+
+    return (uint32_t) timeout;
+#else
+    (void) command_type;
+    return teuniz_poll_delay;
+#endif
+}
+
+HM10_Status get_hm10_latency_estimate(HM10_Command_Type command_type, HM10_Latency_Estimate *estimate)
+{
+#if HM10_ADAPTIVE_TIMEOUTS
+    if (command_type >= HM10_Cmd_Types_Count)
+    {
+        return HM10_EC_ERR;
+    }
+    *estimate = latency_estimates[teuniz_rs232_lib_comport][command_type];
+
+    return HM10_EC_OK;
+#else
+    (void) command_type;
+    (void) estimate;
+    return HM10_EC_NA;
+#endif
+}
+
+HM10_Status set_hm10_latency_estimate(HM10_Command_Type command_type, const HM10_Latency_Estimate *estimate)
+{
+#if HM10_ADAPTIVE_TIMEOUTS
+    if (command_type >= HM10_Cmd_Types_Count)
+    {
+        return HM10_EC_ERR;
+    }
+    latency_estimates[teuniz_rs232_lib_comport][command_type] = *estimate;
+
+    return HM10_EC_OK;
+#else
+    (void) command_type;
+    (void) estimate;
+    return HM10_EC_NA;
+#endif
+}
+
+void reset_hm10_latency_estimates()
+{
+#if HM10_ADAPTIVE_TIMEOUTS
+    memset(latency_estimates[teuniz_rs232_lib_comport], 0, sizeof(latency_estimates[teuniz_rs232_lib_comport]));
+#endif
+}
+
+static int send_hm10_comport(uint8_t *tx_buffer, int size)
+{
+    HM10_TRACE_POINT(HM10_Trace_Send_Start, size);
+    /** <b>Local variable len:</b> Bytes of data that were sent. */
+    int len = RS232_SendBuf(teuniz_rs232_lib_comport, tx_buffer, size);
+    HM10_TRACE_POINT(HM10_Trace_Send_Done, len);
+
+    return len;
+}
+
+static uint16_t poll_hm10_comport(uint8_t *rx_buffer, uint16_t size, uint32_t timeout, uint32_t *elapsed_time)
+{
+    /** <b>Local variable start_time:</b> Time in microseconds at which this function started to poll the RS-232 Port. */
+    uint64_t start_time = get_monotonic_time_us();
+    /** <b>Local variable current_time:</b> Time in microseconds of the last time that the RS-232 Port was polled. */
+    uint64_t current_time;
+    /** <b>Local variable received:</b> Bytes of data that have been received so far. */
+    uint16_t received = 0;
+    /** <b>Local variable len:</b> Bytes of data received in the last poll of the RS-232 Port. */
+    int len;
+
+    do
+    {
+        len = RS232_PollComport(teuniz_rs232_lib_comport, &rx_buffer[received], size - received);
+        if (len > 0)
+        {
+            if (received == 0)
+            {
+                HM10_TRACE_POINT(HM10_Trace_First_RX_Byte, len);
+            }
+            received += len;
+            if (received >= size)
+            {
+                HM10_TRACE_POINT(HM10_Trace_Last_RX_Byte, received);
+            }
+        }
+        current_time = get_monotonic_time_us();
+        if ((received>=size) || ((current_time-start_time)>=timeout))
+        {
+            break;
+        }
+        usleep(HM10_POLL_STEP_DELAY);
+    }
+    while (1);
+
+    if (elapsed_time != NULL)
+    {
+        *elapsed_time = (uint32_t) (current_time - start_time);
+    }
+
+    return received;
+}
+
+static uint16_t poll_hm10_response(uint8_t *rx_buffer, uint16_t size, HM10_Command_Type command_type)
+{
+    /** <b>Local variable timeout:</b> Timeout in microseconds for the requested Command Type. */
+    uint32_t timeout = get_hm10_command_timeout(command_type);
+    /** <b>Local variable elapsed_time:</b> Time in microseconds that was waited for the Response. */
+    uint32_t elapsed_time;
+    /** <b>Local variable received:</b> Bytes of data of the Response that were received. */
+    uint16_t received = poll_hm10_comport(rx_buffer, size, timeout, &elapsed_time);
+
+    /* Back the timeout off whenever it expired, since the actual latency is only known to be longer than it. */
+    if (received == size)
+    {
+        learn_hm10_response_latency(command_type, elapsed_time);
+    }
+    else
+    {
+        learn_hm10_response_latency(command_type, (timeout > (UINT32_MAX/2)) ? UINT32_MAX : 2*timeout);
+    }
+
+    return received;
+}
+
+static void learn_hm10_response_latency(HM10_Command_Type command_type, uint32_t latency)
+{
+#if HM10_ADAPTIVE_TIMEOUTS
+    /** <b>Local variable p_estimate:</b> Pointer to the learned Response Latency of the requested Command Type of the current HM-10 BT Device. */
+    HM10_Latency_Estimate *p_estimate = &latency_estimates[teuniz_rs232_lib_comport][command_type];
+    if (latency > HM10_ADAPTIVE_TIMEOUT_MAX)
+    {
+        latency = HM10_ADAPTIVE_TIMEOUT_MAX;
+    }
+
+    /* Initialize the estimate with the first sample, as it is done for the Round-Trip Time estimate of TCP. */
+    if (p_estimate->samples == 0)
+    {
+        p_estimate->samples = 1;
+        p_estimate->mean = latency;
+        p_estimate->variance = ((uint64_t) latency/2) * ((uint64_t) latency/2);
+        return;
+    }
+
+    /* Accumulate the sample into the exponentially weighted moving average and variance. */
+    /** <b>Local variable deviation:</b> Difference in microseconds between the given sample and the current mean. */
+    int64_t deviation = (int64_t) latency - (int64_t) p_estimate->mean;
+    /** <b>Local variable squared_deviation:</b> Squared value of the @ref deviation Local Variable. */
+    uint64_t squared_deviation = (uint64_t) (deviation*deviation);
+    p_estimate->mean = (uint32_t) ((int64_t) p_estimate->mean + deviation/(1 << HM10_LATENCY_MEAN_EWMA_SHIFT));
+    if (squared_deviation >= p_estimate->variance)
+    {
+        p_estimate->variance += (squared_deviation - p_estimate->variance) >> HM10_LATENCY_VARIANCE_EWMA_SHIFT;
+    }
+    else
+    {
+        p_estimate->variance -= (p_estimate->variance - squared_deviation) >> HM10_LATENCY_VARIANCE_EWMA_SHIFT;
+    }
+    if (p_estimate->samples < UINT32_MAX)
+    {
+        p_estimate->samples++;
+    }
+#else
+    (void) command_type;
+    (void) latency;
+#endif
+}
+
+static uint64_t get_monotonic_time_us()
+{
+    /** <b>Local variable current_time:</b> Current time of the monotonic clock of our host machine. */
+    struct timespec current_time;
+    clock_gettime(CLOCK_MONOTONIC, &current_time);
+
+    return ((uint64_t) current_time.tv_sec)*1000000U + ((uint64_t) current_time.tv_nsec)/1000U;
+}
+
+static uint32_t isqrt64(uint64_t value)
+{
+    /** <b>Local variable root:</b> Integer square root calculated so far. */
+    uint64_t root = 0;
+    /** <b>Local variable bit:</b> Highest power of four that is less than or equal to the remaining \p value param. */
+    uint64_t bit = ((uint64_t) 1) << 62;
+    while (bit > value)
+    {
+        bit >>= 2;
+    }
+    while (bit != 0)
+    {
+        if (value >= root + bit)
+        {
+            value -= root + bit;
+            root = (root >> 1) + bit;
+        }
+        else
+        {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+
+    return (uint32_t) root;
+}
+
 /** @} */
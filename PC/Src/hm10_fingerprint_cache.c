@@ -0,0 +1,366 @@
+/** @addtogroup hm10_fingerprint_cache
+ * @{
+ */
+
+#include "../Inc/hm10_fingerprint_cache.h"
+#include "../Inc/hm10_config.h" // Custom Library for the HM-10 Driver Library.
+#include <stdio.h>	// Library from which "printf" is located at.
+#include <string.h>	// Library from which "memset()" and "memcpy()" are located at.
+#if defined(__linux__) || defined(__FreeBSD__)   /* Linux & FreeBSD */
+#include <fcntl.h> // Library from which "open()" is located at.
+#include <unistd.h> // Library from which "close()" and "ftruncate()" are located at.
+#include <sys/mman.h> // Library from which "mmap()", "msync()" and "munmap()" are located at.
+#include <sys/stat.h> // Library from which "fstat()" is located at.
+#else  /* windows */
+#include <windows.h> // Library from which "CreateFileMapping()" and "MapViewOfFile()" are located at.
+#endif
+
+#define HM10_FINGERPRINT_CACHE_FILE_SIZE    (sizeof(HM10_Fingerprint_Cache_Header) + sizeof(HM10_Fingerprint)*HM10_FINGERPRINT_CACHE_MAX_COMPORTS)  /**< @brief Length in bytes of a whole HM-10 Fingerprint Cache File. */
+#define HM10_FNV1A_OFFSET_BASIS             (2166136261U)   /**< @brief Offset basis of the 32-bit FNV-1a hash. */
+#define HM10_FNV1A_PRIME                    (16777619U)     /**< @brief Prime of the 32-bit FNV-1a hash. */
+
+static uint8_t *p_cache_file = NULL;                    /**< @brief Pointer to the memory-mapped data of the currently opened HM-10 Fingerprint Cache File, or \c NULL if there is none. */
+static HM10_Fingerprint *p_fingerprints = NULL;         /**< @brief Pointer to the first fingerprint contained in the memory-mapped data of the currently opened HM-10 Fingerprint Cache File. */
+#if defined(__linux__) || defined(__FreeBSD__)   /* Linux & FreeBSD */
+static int cache_file_descriptor = -1;                  /**< @brief File Descriptor of the currently opened HM-10 Fingerprint Cache File. */
+#else  /* windows */
+static HANDLE cache_file_handle = INVALID_HANDLE_VALUE; /**< @brief File Handle of the currently opened HM-10 Fingerprint Cache File. */
+static HANDLE cache_file_mapping = NULL;                /**< @brief File Mapping Handle of the currently opened HM-10 Fingerprint Cache File. */
+#endif
+
+/**@brief	Gets the fingerprint of a desired Comport from the currently opened HM-10 Fingerprint Cache File.
+ *
+ * @param comport   Comport whose fingerprint is desired to be obtained.
+ *
+ * @return  Pointer to the fingerprint of the requested Comport, or \c NULL if either there is no opened HM-10
+ *          Fingerprint Cache File or if the requested Comport is not valid.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+static HM10_Fingerprint *get_fingerprint_entry(int comport);
+
+/**@brief	Gets the Bluetooth Address of the HM-10 BT Device of a desired Comport.
+ *
+ * @details The @ref hm10_ble is pointed towards the requested Comport only while the Get Address Command is exchanged
+ *          and then it is pointed back towards the Comport that it was using before.
+ *
+ * @param comport           Comport of the HM-10 BT Device whose Bluetooth Address is desired to be obtained.
+ * @param[out] bt_addr      Pointer to the Memory Address into which the Bluetooth Address will be stored.
+ *
+ * @return  The Return value of the @ref get_hm10_bt_address function.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+static HM10_Status get_bt_address_of_comport(int comport, char bt_addr[HM10_BT_ADDR_SIZE]);
+
+/**@brief	Flushes the changes made on the memory-mapped data of the currently opened HM-10 Fingerprint Cache File
+ *          into the disk.
+ *
+ * @retval	HM10_EC_OK	if the changes were successfully flushed.
+ * @retval  HM10_EC_ERR otherwise.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+static HM10_Status sync_fingerprint_cache();
+
+HM10_Status open_hm10_fingerprint_cache(const char *file_path)
+{
+    if (p_cache_file != NULL)
+    {
+        #if ETX_OTA_VERBOSE
+            printf("ERROR: There is already an opened HM-10 Fingerprint Cache File.\r\n");
+        #endif
+        return HM10_EC_ERR;
+    }
+
+    /* Open (or create) the HM-10 Fingerprint Cache File with the expected size and memory-map it. */
+    /** <b>Local variable is_new_file:</b> Flag indicating whether the HM-10 Fingerprint Cache File did not have the expected size (i.e., 1) or not (i.e., 0). */
+    uint8_t is_new_file = 0;
+#if defined(__linux__) || defined(__FreeBSD__)   /* Linux & FreeBSD */
+    cache_file_descriptor = open(file_path, O_RDWR | O_CREAT, 0644);
+    if (cache_file_descriptor < 0)
+    {
+        #if ETX_OTA_VERBOSE
+            printf("ERROR: The HM-10 Fingerprint Cache File \"%s\" could not be opened.\r\n", file_path);
+        #endif
+        return HM10_EC_ERR;
+    }
+    /** <b>Local variable file_stats:</b> Holds the status data of the HM-10 Fingerprint Cache File (e.g., its size). */
+    struct stat file_stats;
+    if ((fstat(cache_file_descriptor, &file_stats)!=0) || (file_stats.st_size!=(off_t)HM10_FINGERPRINT_CACHE_FILE_SIZE))
+    {
+        is_new_file = 1;
+        if (ftruncate(cache_file_descriptor, HM10_FINGERPRINT_CACHE_FILE_SIZE) != 0)
+        {
+            close(cache_file_descriptor);
+            cache_file_descriptor = -1;
+            return HM10_EC_ERR;
+        }
+    }
+    /** <b>Local variable p_mapped:</b> Pointer to the memory-mapped data of the HM-10 Fingerprint Cache File. */
+    void *p_mapped = mmap(NULL, HM10_FINGERPRINT_CACHE_FILE_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED, cache_file_descriptor, 0);
+    if (p_mapped == MAP_FAILED)
+    {
+        close(cache_file_descriptor);
+        cache_file_descriptor = -1;
+        return HM10_EC_ERR;
+    }
+#else  /* windows */
+    cache_file_handle = CreateFileA(file_path, GENERIC_READ | GENERIC_WRITE, 0, NULL, OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (cache_file_handle == INVALID_HANDLE_VALUE)
+    {
+        #if ETX_OTA_VERBOSE
+            printf("ERROR: The HM-10 Fingerprint Cache File \"%s\" could not be opened.\r\n", file_path);
+        #endif
+        return HM10_EC_ERR;
+    }
+    if (GetFileSize(cache_file_handle, NULL) != HM10_FINGERPRINT_CACHE_FILE_SIZE)
+    {
+        is_new_file = 1;
+    }
+    cache_file_mapping = CreateFileMappingA(cache_file_handle, NULL, PAGE_READWRITE, 0, HM10_FINGERPRINT_CACHE_FILE_SIZE, NULL);
+    if (cache_file_mapping == NULL)
+    {
+        CloseHandle(cache_file_handle);
+        cache_file_handle = INVALID_HANDLE_VALUE;
+        return HM10_EC_ERR;
+    }
+    /** <b>Local variable p_mapped:</b> Pointer to the memory-mapped data of the HM-10 Fingerprint Cache File. */
+    void *p_mapped = MapViewOfFile(cache_file_mapping, FILE_MAP_ALL_ACCESS, 0, 0, HM10_FINGERPRINT_CACHE_FILE_SIZE);
+    if (p_mapped == NULL)
+    {
+        CloseHandle(cache_file_mapping);
+        CloseHandle(cache_file_handle);
+        cache_file_mapping = NULL;
+        cache_file_handle = INVALID_HANDLE_VALUE;
+        return HM10_EC_ERR;
+    }
+#endif
+    p_cache_file = (uint8_t *) p_mapped;
+    p_fingerprints = (HM10_Fingerprint *) &p_cache_file[sizeof(HM10_Fingerprint_Cache_Header)];
+
+    /* Validate the HM-10 Fingerprint Cache File Header and re-initialize the whole file if it does not match. */
+    /** <b>Local variable header:</b> Copy of the Header of the HM-10 Fingerprint Cache File. */
+    HM10_Fingerprint_Cache_Header header;
+    memcpy(&header, p_cache_file, sizeof(HM10_Fingerprint_Cache_Header));
+    if (is_new_file || (header.magic!=HM10_FINGERPRINT_CACHE_MAGIC) || (header.version!=HM10_FINGERPRINT_CACHE_VERSION) || (header.entries!=HM10_FINGERPRINT_CACHE_MAX_COMPORTS))
+    {
+        #if ETX_OTA_VERBOSE
+            printf("The HM-10 Fingerprint Cache File \"%s\" is either new or outdated and it will be re-initialized.\r\n", file_path);
+        #endif
+        memset(p_cache_file, 0, HM10_FINGERPRINT_CACHE_FILE_SIZE);
+        header.magic = HM10_FINGERPRINT_CACHE_MAGIC;
+        header.version = HM10_FINGERPRINT_CACHE_VERSION;
+        header.entries = HM10_FINGERPRINT_CACHE_MAX_COMPORTS;
+        memcpy(p_cache_file, &header, sizeof(HM10_Fingerprint_Cache_Header));
+        return sync_fingerprint_cache();
+    }
+
+    return HM10_EC_OK;
+}
+
+HM10_Status validate_hm10_fingerprint(int comport, uint32_t baudrate, HM10_Role role, uint32_t profile_hash)
+{
+    /** <b>Local variable p_fingerprint:</b> Pointer to the cached fingerprint of the requested Comport. */
+    HM10_Fingerprint *p_fingerprint = get_fingerprint_entry(comport);
+    if (p_fingerprint == NULL)
+    {
+        return HM10_EC_ERR;
+    }
+
+    /* Compare the cached fingerprint against the requested data before sending any AT Command. */
+    if ((p_fingerprint->is_valid!=1) || (p_fingerprint->baudrate!=baudrate) || (p_fingerprint->role!=role) || (p_fingerprint->profile_hash!=profile_hash))
+    {
+        #if ETX_OTA_VERBOSE
+            printf("There is no matching HM-10 fingerprint cached for the Comport %d.\r\n", comport);
+        #endif
+        return HM10_EC_NA;
+    }
+
+    /* Confirm that the HM-10 BT Device is the same one as the cached one with a single AT Command exchange. */
+    /** <b>Local variable bt_addr:</b> Bluetooth Address received from the HM-10 BT Device. */
+    char bt_addr[HM10_BT_ADDR_SIZE];
+    /** <b>Local variable ret:</b> Return value of a @ref HM10_Status function type. */
+    HM10_Status ret = get_bt_address_of_comport(comport, bt_addr);
+    if (ret != HM10_EC_OK)
+    {
+        return ret;
+    }
+    if (memcmp(bt_addr, p_fingerprint->bt_addr, HM10_BT_ADDR_SIZE) != 0)
+    {
+        #if ETX_OTA_VERBOSE
+            printf("The HM-10 BT Device on the Comport %d is not the same one as the cached one.\r\n", comport);
+        #endif
+        return HM10_EC_NA;
+    }
+    #if ETX_OTA_VERBOSE
+        printf("DONE: The cached HM-10 fingerprint for the Comport %d has been validated successfully.\r\n", comport);
+    #endif
+
+    return HM10_EC_OK;
+}
+
+HM10_Status init_hm10_module_with_fingerprint(int comport, uint32_t send_bytes_delay, uint32_t poll_delay, uint32_t connect_to_address_timeout, uint32_t baudrate, HM10_Role role, uint32_t profile_hash)
+{
+    /** <b>Local variable ret:</b> Return value of a @ref HM10_Status function type. */
+    HM10_Status ret = init_hm10_module(comport, send_bytes_delay, poll_delay, connect_to_address_timeout);
+    if (ret != HM10_EC_OK)
+    {
+        return ret;
+    }
+
+    return validate_hm10_fingerprint(comport, baudrate, role, profile_hash);
+}
+
+HM10_Status store_hm10_fingerprint(int comport, uint32_t baudrate, HM10_Role role, uint32_t profile_hash)
+{
+    /** <b>Local variable p_fingerprint:</b> Pointer to the cached fingerprint of the requested Comport. */
+    HM10_Fingerprint *p_fingerprint = get_fingerprint_entry(comport);
+    if (p_fingerprint == NULL)
+    {
+        return HM10_EC_ERR;
+    }
+
+    /* Get the Bluetooth Address of the HM-10 BT Device. */
+    /** <b>Local variable fingerprint:</b> Fingerprint that will be stored for the requested Comport. */
+    HM10_Fingerprint fingerprint;
+    memset(&fingerprint, 0, sizeof(HM10_Fingerprint));
+    /** <b>Local variable ret:</b> Return value of a @ref HM10_Status function type. */
+    HM10_Status ret = get_bt_address_of_comport(comport, fingerprint.bt_addr);
+    if (ret != HM10_EC_OK)
+    {
+        return ret;
+    }
+
+    /* Store the fingerprint and flush it into the disk. */
+    fingerprint.is_valid = 1;
+    fingerprint.role = role;
+    fingerprint.baudrate = baudrate;
+    fingerprint.profile_hash = profile_hash;
+    memcpy(p_fingerprint, &fingerprint, sizeof(HM10_Fingerprint));
+
+    return sync_fingerprint_cache();
+}
+
+HM10_Status get_hm10_fingerprint(int comport, HM10_Fingerprint *fingerprint)
+{
+    /** <b>Local variable p_fingerprint:</b> Pointer to the cached fingerprint of the requested Comport. */
+    HM10_Fingerprint *p_fingerprint = get_fingerprint_entry(comport);
+    if (p_fingerprint == NULL)
+    {
+        return HM10_EC_ERR;
+    }
+    if (p_fingerprint->is_valid != 1)
+    {
+        return HM10_EC_NA;
+    }
+    memcpy(fingerprint, p_fingerprint, sizeof(HM10_Fingerprint));
+
+    return HM10_EC_OK;
+}
+
+HM10_Status invalidate_hm10_fingerprint(int comport)
+{
+    /** <b>Local variable p_fingerprint:</b> Pointer to the cached fingerprint of the requested Comport. */
+    HM10_Fingerprint *p_fingerprint = get_fingerprint_entry(comport);
+    if (p_fingerprint == NULL)
+    {
+        return HM10_EC_ERR;
+    }
+    memset(p_fingerprint, 0, sizeof(HM10_Fingerprint));
+
+    return sync_fingerprint_cache();
+}
+
+void close_hm10_fingerprint_cache()
+{
+    if (p_cache_file == NULL)
+    {
+        return;
+    }
+    sync_fingerprint_cache();
+#if defined(__linux__) || defined(__FreeBSD__)   /* Linux & FreeBSD */
+    munmap(p_cache_file, HM10_FINGERPRINT_CACHE_FILE_SIZE);
+    close(cache_file_descriptor);
+    cache_file_descriptor = -1;
+#else  /* windows */
+    UnmapViewOfFile(p_cache_file);
+    CloseHandle(cache_file_mapping);
+    CloseHandle(cache_file_handle);
+    cache_file_mapping = NULL;
+    cache_file_handle = INVALID_HANDLE_VALUE;
+#endif
+    p_cache_file = NULL;
+    p_fingerprints = NULL;
+}
+
+uint32_t get_hm10_profile_hash(const uint8_t *profile, uint32_t size)
+{
+    /** <b>Local variable hash:</b> FNV-1a hash calculated so far. */
+    uint32_t hash = HM10_FNV1A_OFFSET_BASIS;
+    for (uint32_t i=0; i<size; i++)
+    {
+        hash ^= profile[i];
+        hash *= HM10_FNV1A_PRIME;
+    }
+
+    return hash;
+}
+
+static HM10_Fingerprint *get_fingerprint_entry(int comport)
+{
+    if (p_cache_file == NULL)
+    {
+        #if ETX_OTA_VERBOSE
+            printf("ERROR: There is no opened HM-10 Fingerprint Cache File.\r\n");
+        #endif
+        return NULL;
+    }
+    if ((comport<1) || (comport>HM10_FINGERPRINT_CACHE_MAX_COMPORTS))
+    {
+        #if ETX_OTA_VERBOSE
+            printf("ERROR: The given comport value does not have a valid value. Please input a comport between 1 and %d.\r\n", HM10_FINGERPRINT_CACHE_MAX_COMPORTS);
+        #endif
+        return NULL;
+    }
+
+    return &p_fingerprints[comport - 1];
+}
+
+static HM10_Status get_bt_address_of_comport(int comport, char bt_addr[HM10_BT_ADDR_SIZE])
+{
+    /** <b>Local variable previous_comport:</b> Comport towards which the @ref hm10_ble was pointing before this function was called. */
+    int previous_comport = get_hm10_comport();
+    /** <b>Local variable ret:</b> Return value of a @ref HM10_Status function type. */
+    HM10_Status ret = select_hm10_comport(comport);
+    if (ret != HM10_EC_OK)
+    {
+        return ret;
+    }
+    ret = get_hm10_bt_address(bt_addr);
+    select_hm10_comport(previous_comport);
+
+    return ret;
+}
+
+static HM10_Status sync_fingerprint_cache()
+{
+#if defined(__linux__) || defined(__FreeBSD__)   /* Linux & FreeBSD */
+    if (msync(p_cache_file, HM10_FINGERPRINT_CACHE_FILE_SIZE, MS_SYNC) != 0)
+#else  /* windows */
+    if (FlushViewOfFile(p_cache_file, HM10_FINGERPRINT_CACHE_FILE_SIZE) == 0)
+#endif
+    {
+        #if ETX_OTA_VERBOSE
+            printf("ERROR: The HM-10 Fingerprint Cache File could not be flushed into the disk.\r\n");
+        #endif
+        return HM10_EC_ERR;
+    }
+
+    return HM10_EC_OK;
+}
+
+/** @} */
@@ -0,0 +1,479 @@
+/** @addtogroup hm10_ota_ccm
+ * @{
+ */
+
+#include "../Inc/hm10_ota_ccm.h"
+#include <string.h>	// Library from which "memset()" and "memcpy()" are located at.
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <wmmintrin.h> // Library from which the AES-NI intrinsics are located at.
+#define HM10_OTA_CCM_AESNI_SUPPORT  (1)     /**< @brief Flag indicating whether the compiler can generate the AES-NI implementation (i.e., 1) or not (i.e., 0). */
+#else
+#define HM10_OTA_CCM_AESNI_SUPPORT  (0)     /**< @brief Flag indicating whether the compiler can generate the AES-NI implementation (i.e., 1) or not (i.e., 0). */
+#endif
+
+#define AES128_ROUNDS               (10)    /**< @brief Number of rounds of AES-128. */
+#define CCM_LENGTH_FIELD_SIZE       (2)     /**< @brief Length in bytes of the field in which the length of the data is encoded (i.e., the "L" parameter of CCM). */
+#define CCM_ADATA_FLAG              (0x40U) /**< @brief Flag of the first byte of the B0 block indicating that there is associated data. */
+
+static int8_t is_aesni_available = -1;      /**< @brief Flag indicating whether AES-NI is available (i.e., 1), not available (i.e., 0) or whether it has not been detected yet (i.e., -1). */
+
+/**@brief	Multiplies two elements of GF(256) with the AES polynomial, without any branches nor lookup tables.
+ *
+ * @param a First factor.
+ * @param b Second factor.
+ *
+ * @return  The product of \p a and \p b .
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+static uint8_t gf256_mul(uint8_t a, uint8_t b);
+
+/**@brief	Calculates the AES S-box of a byte (i.e., its multiplicative inverse in GF(256) followed by the affine
+ *          transformation) without any branches nor lookup tables.
+ *
+ * @param x Byte whose S-box is desired to be calculated.
+ *
+ * @return  The S-box of \p x .
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+static uint8_t aes_sbox(uint8_t x);
+
+/**@brief	Encrypts a single block with the portable implementation of AES-128.
+ *
+ * @param[in] round_keys    Pointer to the round keys.
+ * @param[in,out] block     Pointer to the block that is desired to be encrypted, which will be overwritten with its
+ *                          ciphertext.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+static void encrypt_block_with_portable_aes(uint8_t *round_keys, uint8_t *block);
+
+#if HM10_OTA_CCM_AESNI_SUPPORT
+/**@brief	Encrypts a single block with the AES-NI instructions.
+ *
+ * @param[in] round_keys    Pointer to the round keys.
+ * @param[in,out] block     Pointer to the block that is desired to be encrypted, which will be overwritten with its
+ *                          ciphertext.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+__attribute__((target("aes,sse2"))) static void encrypt_block_with_aesni(uint8_t *round_keys, uint8_t *block);
+
+/**@brief	Encrypts two independent blocks with the AES-NI instructions, whose rounds are interleaved so that the
+ *          latency of the \c aesenc instruction of one block is hidden behind the one of the other block.
+ *
+ * @param[in] round_keys    Pointer to the round keys.
+ * @param[in,out] block_a   Pointer to the first block, which will be overwritten with its ciphertext.
+ * @param[in,out] block_b   Pointer to the second block, which will be overwritten with its ciphertext.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+__attribute__((target("aes,sse2"))) static void encrypt_two_blocks_with_aesni(uint8_t *round_keys, uint8_t *block_a, uint8_t *block_b);
+#endif
+
+/**@brief	Encrypts a single block with AES-128, by using the implementation selected in a context.
+ *
+ * @param[in] ctx           Pointer to the context of the key.
+ * @param[in,out] block     Pointer to the block that is desired to be encrypted, which will be overwritten with its
+ *                          ciphertext.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+static void encrypt_block(HM10_OTA_CCM_Context *ctx, uint8_t *block);
+
+/**@brief	Encrypts two independent blocks with AES-128, by using the implementation selected in a context.
+ *
+ * @param[in] ctx           Pointer to the context of the key.
+ * @param[in,out] block_a   Pointer to the first block, which will be overwritten with its ciphertext.
+ * @param[in,out] block_b   Pointer to the second block, which will be overwritten with its ciphertext.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+static void encrypt_two_blocks(HM10_OTA_CCM_Context *ctx, uint8_t *block_a, uint8_t *block_b);
+
+/**@brief	Fills a CTR block of CCM with a certain nonce and counter.
+ *
+ * @param[out] block    Pointer to the block that is desired to be filled.
+ * @param[in] nonce     Pointer to the nonce.
+ * @param counter       Value of the counter.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+static void set_counter_block(uint8_t *block, uint8_t *nonce, uint16_t counter);
+
+/**@brief	Starts the CBC-MAC of CCM, by encrypting the B0 block and by processing the associated data.
+ *
+ * @param[in] ctx       Pointer to the context of the key.
+ * @param[out] mac      Pointer to the block into which the current value of the CBC-MAC will be stored.
+ * @param[in] nonce     Pointer to the nonce.
+ * @param[in] aad       Pointer to the associated data.
+ * @param aad_size      Length in bytes of the associated data.
+ * @param size          Length in bytes of the data that will be encrypted or decrypted.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+static void start_cbc_mac(HM10_OTA_CCM_Context *ctx, uint8_t *mac, uint8_t *nonce, uint8_t *aad, uint16_t aad_size, uint16_t size);
+
+void init_hm10_ota_ccm_context(HM10_OTA_CCM_Context *ctx, uint8_t *key)
+{
+    /** <b>Local variable rcon:</b> Round constant of the current round of the key schedule. */
+    uint8_t rcon = 0x01U;
+    /** <b>Local variable temp:</b> Word from which the next word of the key schedule is calculated. */
+    uint8_t temp[4];
+    /** <b>Local variable carry:</b> Byte that is rotated out of the \c temp local variable. */
+    uint8_t carry;
+
+    /* Expand the key, whose round keys have the same layout for both the portable and the AES-NI implementations. */
+    memcpy(ctx->round_keys, key, HM10_OTA_CCM_KEY_SIZE);
+    for (uint8_t i=4; i<4*(AES128_ROUNDS+1); i++)
+    {
+        memcpy(temp, &ctx->round_keys[4*(i-1)], sizeof(temp));
+        if ((i%4) == 0)
+        {
+            carry = temp[0];
+            temp[0] = aes_sbox(temp[1]) ^ rcon;
+            temp[1] = aes_sbox(temp[2]);
+            temp[2] = aes_sbox(temp[3]);
+            temp[3] = aes_sbox(carry);
+            rcon = gf256_mul(rcon, 0x02U);
+        }
+        for (uint8_t j=0; j<4; j++)
+        {
+            ctx->round_keys[4*i + j] = ctx->round_keys[4*(i-4) + j] ^ temp[j];
+        }
+    }
+    ctx->is_aesni = is_hm10_ota_ccm_hw_accelerated();
+}
+
+void clear_hm10_ota_ccm_context(HM10_OTA_CCM_Context *ctx)
+{
+    /** <b>Local variable p:</b> Pointer to the context through which the stores cannot be optimized away by the compiler. */
+    volatile uint8_t *p = (volatile uint8_t *) ctx;
+    for (uint16_t i=0; i<sizeof(HM10_OTA_CCM_Context); i++)
+    {
+        p[i] = 0;
+    }
+}
+
+HM10_Status encrypt_hm10_ota_ccm(HM10_OTA_CCM_Context *ctx, uint8_t *nonce, uint8_t *aad, uint16_t aad_size, uint8_t *data, uint16_t size, uint8_t *tag)
+{
+    /** <b>Local variable mac:</b> Current value of the CBC-MAC. */
+    uint8_t mac[HM10_OTA_CCM_BLOCK_SIZE];
+    /** <b>Local variable keystream:</b> Current block of the CTR keystream. */
+    uint8_t keystream[HM10_OTA_CCM_BLOCK_SIZE];
+    /** <b>Local variable n:</b> Number of bytes of the data in the current block. */
+    uint16_t n;
+
+    if (aad_size > HM10_OTA_CCM_MAX_AAD_SIZE)
+    {
+        return HM10_EC_ERR;
+    }
+    start_cbc_mac(ctx, mac, nonce, aad, aad_size, size);
+
+    /* Authenticate and encrypt each block, whose CBC-MAC and keystream blocks do not depend on each other. */
+    for (uint32_t offset=0; offset<size; offset+=HM10_OTA_CCM_BLOCK_SIZE)
+    {
+        n = ((size - offset) < HM10_OTA_CCM_BLOCK_SIZE) ? (size - offset) : HM10_OTA_CCM_BLOCK_SIZE;
+        set_counter_block(keystream, nonce, (uint16_t) (offset/HM10_OTA_CCM_BLOCK_SIZE + 1));
+        for (uint16_t i=0; i<n; i++)
+        {
+            mac[i] ^= data[offset + i];
+        }
+        encrypt_two_blocks(ctx, mac, keystream);
+        for (uint16_t i=0; i<n; i++)
+        {
+            data[offset + i] ^= keystream[i];
+        }
+    }
+
+    /* Encrypt the CBC-MAC with the first block of the keystream to obtain the tag. */
+    set_counter_block(keystream, nonce, 0);
+    encrypt_block(ctx, keystream);
+    for (uint8_t i=0; i<HM10_OTA_CCM_TAG_SIZE; i++)
+    {
+        tag[i] = mac[i] ^ keystream[i];
+    }
+
+    return HM10_EC_OK;
+}
+
+HM10_Status decrypt_hm10_ota_ccm(HM10_OTA_CCM_Context *ctx, uint8_t *nonce, uint8_t *aad, uint16_t aad_size, uint8_t *data, uint16_t size, uint8_t *tag)
+{
+    /** <b>Local variable mac:</b> Current value of the CBC-MAC. */
+    uint8_t mac[HM10_OTA_CCM_BLOCK_SIZE];
+    /** <b>Local variable keystream:</b> Current block of the CTR keystream. */
+    uint8_t keystream[HM10_OTA_CCM_BLOCK_SIZE];
+    /** <b>Local variable n:</b> Number of bytes of the data in the current block. */
+    uint16_t n;
+    /** <b>Local variable diff:</b> Accumulated difference between the expected and the received tags. */
+    uint8_t diff = 0;
+
+    if (aad_size > HM10_OTA_CCM_MAX_AAD_SIZE)
+    {
+        return HM10_EC_ERR;
+    }
+    start_cbc_mac(ctx, mac, nonce, aad, aad_size, size);
+
+    /* Decrypt and authenticate each block, where the keystream block of the next block is encrypted along with the
+       CBC-MAC of the current one, since the CBC-MAC needs the plaintext of the current block. */
+    if (size > 0)
+    {
+        set_counter_block(keystream, nonce, 1);
+        encrypt_block(ctx, keystream);
+    }
+    for (uint32_t offset=0; offset<size; offset+=HM10_OTA_CCM_BLOCK_SIZE)
+    {
+        n = ((size - offset) < HM10_OTA_CCM_BLOCK_SIZE) ? (size - offset) : HM10_OTA_CCM_BLOCK_SIZE;
+        for (uint16_t i=0; i<n; i++)
+        {
+            data[offset + i] ^= keystream[i];
+            mac[i] ^= data[offset + i];
+        }
+        if ((offset + HM10_OTA_CCM_BLOCK_SIZE) < size)
+        {
+            set_counter_block(keystream, nonce, (uint16_t) (offset/HM10_OTA_CCM_BLOCK_SIZE + 2));
+            encrypt_two_blocks(ctx, mac, keystream);
+        }
+        else
+        {
+            encrypt_block(ctx, mac);
+        }
+    }
+
+    /* Compare the tags in constant time and erase the plaintext if they do not match. */
+    set_counter_block(keystream, nonce, 0);
+    encrypt_block(ctx, keystream);
+    for (uint8_t i=0; i<HM10_OTA_CCM_TAG_SIZE; i++)
+    {
+        diff |= (uint8_t) (mac[i] ^ keystream[i] ^ tag[i]);
+    }
+    if (diff != 0)
+    {
+        memset(data, 0, size);
+        return HM10_EC_NA;
+    }
+
+    return HM10_EC_OK;
+}
+
+uint8_t is_hm10_ota_ccm_hw_accelerated()
+{
+    if (is_aesni_available == -1)
+    {
+#if HM10_OTA_CCM_AESNI_SUPPORT
+        __builtin_cpu_init();
+        is_aesni_available = (__builtin_cpu_supports("aes") && __builtin_cpu_supports("sse2")) ? 1 : 0;
+#else
+        is_aesni_available = 0;
+#endif
+    }
+
+    return (uint8_t) is_aesni_available;
+}
+
+void set_hm10_ota_ccm_hw_acceleration(uint8_t is_enabled)
+{
+    /* Detect the support of AES-NI again whenever it is enabled. */
+    is_aesni_available = is_enabled ? -1 : 0;
+}
+
+static uint8_t gf256_mul(uint8_t a, uint8_t b)
+{
+    /** <b>Local variable product:</b> Accumulated product. */
+    uint8_t product = 0;
+
+    for (uint8_t i=0; i<8; i++)
+    {
+        product ^= (uint8_t) (-(b & 1U)) & a;
+        a = (uint8_t) ((a << 1) ^ ((uint8_t) (-(a >> 7)) & 0x1BU));
+        b >>= 1;
+    }
+
+    return product;
+}
+
+static uint8_t aes_sbox(uint8_t x)
+{
+    /** <b>Local variable x2:</b> The \p x param raised to the power of 2. */
+    uint8_t x2 = gf256_mul(x, x);
+    /** <b>Local variable x3:</b> The \p x param raised to the power of 3. */
+    uint8_t x3 = gf256_mul(x2, x);
+    /** <b>Local variable x12:</b> The \p x param raised to the power of 12. */
+    uint8_t x12;
+    /** <b>Local variable inv:</b> The \p x param raised to the power of 254, which is its multiplicative inverse (or 0 if \p x is 0). */
+    uint8_t inv;
+
+    /* Calculate x^254 with a fixed chain of multiplications (i.e., 254 = 240 + 12 + 2). */
+    x12 = gf256_mul(x3, x3);
+    x12 = gf256_mul(x12, x12);
+    inv = gf256_mul(x12, x3);           // x^15
+    inv = gf256_mul(inv, inv);          // x^30
+    inv = gf256_mul(inv, inv);          // x^60
+    inv = gf256_mul(inv, inv);          // x^120
+    inv = gf256_mul(inv, inv);          // x^240
+    inv = gf256_mul(inv, x12);          // x^252
+    inv = gf256_mul(inv, x2);           // x^254
+
+    /* Apply the affine transformation. */
+    return inv ^ (uint8_t) ((inv << 1) | (inv >> 7)) ^ (uint8_t) ((inv << 2) | (inv >> 6))
+               ^ (uint8_t) ((inv << 3) | (inv >> 5)) ^ (uint8_t) ((inv << 4) | (inv >> 4)) ^ 0x63U;
+}
+
+static void encrypt_block_with_portable_aes(uint8_t *round_keys, uint8_t *block)
+{
+    /** <b>Local variable state:</b> State of AES, in which the byte of the row r and the column c is at the index r + 4*c. */
+    uint8_t state[HM10_OTA_CCM_BLOCK_SIZE];
+    /** <b>Local variable t:</b> XOR of the four bytes of the current column. */
+    uint8_t t;
+    /** <b>Local variable a0:</b> First byte of the current column before the MixColumns step. */
+    uint8_t a0;
+
+    for (uint8_t i=0; i<HM10_OTA_CCM_BLOCK_SIZE; i++)
+    {
+        state[i] = block[i] ^ round_keys[i];
+    }
+    for (uint8_t round=1; round<=AES128_ROUNDS; round++)
+    {
+        /* SubBytes and ShiftRows. */
+        for (uint8_t i=0; i<HM10_OTA_CCM_BLOCK_SIZE; i++)
+        {
+            block[i] = aes_sbox(state[(i + 4*(i%4)) % HM10_OTA_CCM_BLOCK_SIZE]);
+        }
+
+        /* MixColumns, which is skipped in the last round. */
+        if (round != AES128_ROUNDS)
+        {
+            for (uint8_t c=0; c<HM10_OTA_CCM_BLOCK_SIZE; c+=4)
+            {
+                a0 = block[c];
+                t = block[c] ^ block[c+1] ^ block[c+2] ^ block[c+3];
+                block[c] ^= t ^ gf256_mul(block[c] ^ block[c+1], 0x02U);
+                block[c+1] ^= t ^ gf256_mul(block[c+1] ^ block[c+2], 0x02U);
+                block[c+2] ^= t ^ gf256_mul(block[c+2] ^ block[c+3], 0x02U);
+                block[c+3] ^= t ^ gf256_mul(block[c+3] ^ a0, 0x02U);
+            }
+        }
+
+        /* AddRoundKey. */
+        for (uint8_t i=0; i<HM10_OTA_CCM_BLOCK_SIZE; i++)
+        {
+            state[i] = block[i] ^ round_keys[HM10_OTA_CCM_BLOCK_SIZE*round + i];
+        }
+    }
+    memcpy(block, state, HM10_OTA_CCM_BLOCK_SIZE);
+}
+
+#if HM10_OTA_CCM_AESNI_SUPPORT
+__attribute__((target("aes,sse2"))) static void encrypt_block_with_aesni(uint8_t *round_keys, uint8_t *block)
+{
+    /** <b>Local variable x:</b> State of the block. */
+    __m128i x = _mm_xor_si128(_mm_loadu_si128((__m128i *) block), _mm_loadu_si128((__m128i *) round_keys));
+
+    for (uint8_t round=1; round<AES128_ROUNDS; round++)
+    {
+        x = _mm_aesenc_si128(x, _mm_loadu_si128((__m128i *) &round_keys[HM10_OTA_CCM_BLOCK_SIZE*round]));
+    }
+    x = _mm_aesenclast_si128(x, _mm_loadu_si128((__m128i *) &round_keys[HM10_OTA_CCM_BLOCK_SIZE*AES128_ROUNDS]));
+    _mm_storeu_si128((__m128i *) block, x);
+}
+
+__attribute__((target("aes,sse2"))) static void encrypt_two_blocks_with_aesni(uint8_t *round_keys, uint8_t *block_a, uint8_t *block_b)
+{
+    /** <b>Local variable key:</b> Current round key. */
+    __m128i key = _mm_loadu_si128((__m128i *) round_keys);
+    /** <b>Local variable a:</b> State of the first block. */
+    __m128i a = _mm_xor_si128(_mm_loadu_si128((__m128i *) block_a), key);
+    /** <b>Local variable b:</b> State of the second block. */
+    __m128i b = _mm_xor_si128(_mm_loadu_si128((__m128i *) block_b), key);
+
+    for (uint8_t round=1; round<AES128_ROUNDS; round++)
+    {
+        key = _mm_loadu_si128((__m128i *) &round_keys[HM10_OTA_CCM_BLOCK_SIZE*round]);
+        a = _mm_aesenc_si128(a, key);
+        b = _mm_aesenc_si128(b, key);
+    }
+    key = _mm_loadu_si128((__m128i *) &round_keys[HM10_OTA_CCM_BLOCK_SIZE*AES128_ROUNDS]);
+    _mm_storeu_si128((__m128i *) block_a, _mm_aesenclast_si128(a, key));
+    _mm_storeu_si128((__m128i *) block_b, _mm_aesenclast_si128(b, key));
+}
+#endif
+
+static void encrypt_block(HM10_OTA_CCM_Context *ctx, uint8_t *block)
+{
+#if HM10_OTA_CCM_AESNI_SUPPORT
+    if (ctx->is_aesni)
+    {
+        encrypt_block_with_aesni(ctx->round_keys, block);
+        return;
+    }
+#endif
+    encrypt_block_with_portable_aes(ctx->round_keys, block);
+}
+
+static void encrypt_two_blocks(HM10_OTA_CCM_Context *ctx, uint8_t *block_a, uint8_t *block_b)
+{
+#if HM10_OTA_CCM_AESNI_SUPPORT
+    if (ctx->is_aesni)
+    {
+        encrypt_two_blocks_with_aesni(ctx->round_keys, block_a, block_b);
+        return;
+    }
+#endif
+    encrypt_block_with_portable_aes(ctx->round_keys, block_a);
+    encrypt_block_with_portable_aes(ctx->round_keys, block_b);
+}
+
+static void set_counter_block(uint8_t *block, uint8_t *nonce, uint16_t counter)
+{
+    block[0] = CCM_LENGTH_FIELD_SIZE - 1;
+    memcpy(&block[1], nonce, HM10_OTA_CCM_NONCE_SIZE);
+    block[HM10_OTA_CCM_BLOCK_SIZE - 2] = (uint8_t) (counter >> 8);
+    block[HM10_OTA_CCM_BLOCK_SIZE - 1] = (uint8_t) counter;
+}
+
+static void start_cbc_mac(HM10_OTA_CCM_Context *ctx, uint8_t *mac, uint8_t *nonce, uint8_t *aad, uint16_t aad_size, uint16_t size)
+{
+    /** <b>Local variable pos:</b> Position in the current block at which the next byte of the associated data is XORed. */
+    uint8_t pos;
+
+    /* Encrypt the B0 block, which holds the flags, the nonce and the length of the data. */
+    mac[0] = (uint8_t) (((aad_size > 0) ? CCM_ADATA_FLAG : 0U) | (((HM10_OTA_CCM_TAG_SIZE - 2)/2) << 3) | (CCM_LENGTH_FIELD_SIZE - 1));
+    memcpy(&mac[1], nonce, HM10_OTA_CCM_NONCE_SIZE);
+    mac[HM10_OTA_CCM_BLOCK_SIZE - 2] = (uint8_t) (size >> 8);
+    mac[HM10_OTA_CCM_BLOCK_SIZE - 1] = (uint8_t) size;
+    encrypt_block(ctx, mac);
+    if (aad_size == 0)
+    {
+        return;
+    }
+
+    /* Process the associated data, which is preceded by its length and padded with zeros up to a whole block. */
+    mac[0] ^= (uint8_t) (aad_size >> 8);
+    mac[1] ^= (uint8_t) aad_size;
+    pos = 2;
+    for (uint16_t i=0; i<aad_size; i++)
+    {
+        mac[pos++] ^= aad[i];
+        if (pos == HM10_OTA_CCM_BLOCK_SIZE)
+        {
+            encrypt_block(ctx, mac);
+            pos = 0;
+        }
+    }
+    if (pos != 0)
+    {
+        encrypt_block(ctx, mac);
+    }
+}
+
+/** @} */
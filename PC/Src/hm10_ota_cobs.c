@@ -0,0 +1,316 @@
+/** @addtogroup hm10_ota_cobs
+ * @{
+ */
+
+#include "../Inc/hm10_ota_cobs.h"
+#include "../Inc/hm10_config.h" // This is the Mortrack's HM-10 library configuration file.
+#include <stdio.h>	// Library from which "printf" is located at.
+#include <string.h>	// Library from which "memset()" and "memcpy()" are located at.
+#if defined(__SSE2__)
+#include <emmintrin.h> // Library from which the SSE2 intrinsics are located at.
+#endif
+
+#define HM10_OTA_COBS_MAX_WIRE_SIZE     (HM10_OTA_COBS_MAX_ENCODED_SIZE(HM10_OTA_COBS_MAX_FRAME_SIZE))  /**< @brief Length in bytes of the largest encoded frame, without its delimiter. */
+#define HM10_OTA_COBS_RX_RING_MASK      (HM10_OTA_COBS_RX_RING_SIZE - 1U)                               /**< @brief Bit mask with which a position of the ring buffer of the receiver is wrapped into an index. */
+#define HM10_OTA_COBS_MAX_BLOCK_CODE    (0xFFU)                                                         /**< @brief Code of a COBS block of 254 bytes, which is not followed by a byte with the value 0x00. */
+
+#if ((HM10_OTA_COBS_RX_RING_SIZE & HM10_OTA_COBS_RX_RING_MASK) != 0) || (HM10_OTA_COBS_RX_RING_SIZE <= HM10_OTA_COBS_MAX_WIRE_SIZE)
+#error "HM10_OTA_COBS_RX_RING_SIZE must be a power of 2 that is greater than the length of the largest encoded frame."
+#endif
+
+static uint8_t tx_buffer[HM10_OTA_COBS_MAX_WIRE_SIZE + 1];     /**< @brief Buffer into which each frame is encoded, together with its delimiter, before being sent. */
+static uint8_t rx_ring[HM10_OTA_COBS_RX_RING_SIZE];            /**< @brief Ring buffer into which the encoded frames are received. */
+static uint8_t rx_frame[HM10_OTA_COBS_MAX_WIRE_SIZE];          /**< @brief Buffer into which an encoded frame is copied out of the ring buffer before being decoded, in case that it wraps around. */
+static uint32_t rx_head = 0;                                   /**< @brief Position of the ring buffer into which the next received byte will be stored. */
+static uint32_t rx_tail = 0;                                   /**< @brief Position of the ring buffer at which the oldest encoded frame starts. */
+static uint32_t rx_scanned = 0;                                /**< @brief Position of the ring buffer up to which the bytes have already been scanned without finding a delimiter. */
+static uint8_t is_rx_resyncing = 0;                            /**< @brief Flag indicating whether the bytes of an overlong frame are being discarded until the next delimiter (i.e., 1) or not (i.e., 0). */
+static HM10_OTA_COBS_Stats cobs_stats;                         /**< @brief Statistics of the HM-10 OTA COBS Framing. */
+
+/**@brief	Finds the first delimiter within some contiguous bytes.
+ *
+ * @param[in] data  Pointer to the bytes that are desired to be scanned.
+ * @param size      Length in bytes of the data towards which the \p data param points to.
+ *
+ * @return  The offset of the first delimiter or, if there is none, the \p size param.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+static uint32_t find_delimiter(uint8_t *data, uint32_t size);
+
+/**@brief	Finds the first delimiter among the bytes of the ring buffer that have not been scanned yet.
+ *
+ * @param[out] position Pointer to the Memory Address into which the position of the delimiter will be stored.
+ *
+ * @retval	1 if a delimiter was found.
+ * @retval  0 otherwise.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+static uint8_t find_delimiter_in_rx_ring(uint32_t *position);
+
+uint16_t encode_hm10_ota_cobs(uint8_t *src, uint16_t size, uint8_t *dst)
+{
+    /** <b>Local variable code_index:</b> Index of the \p dst param at which the code of the current block is stored. */
+    uint16_t code_index = 0;
+    /** <b>Local variable dst_size:</b> Bytes that have been stored into the \p dst param so far. */
+    uint16_t dst_size = 1;
+    /** <b>Local variable code:</b> Code of the current block (i.e., its length plus 1). */
+    uint8_t code = 1;
+
+    for (uint16_t i=0; i<size; i++)
+    {
+        if (src[i] == 0)
+        {
+            dst[code_index] = code;
+            code_index = dst_size++;
+            code = 1;
+            continue;
+        }
+        dst[dst_size++] = src[i];
+        if (++code == HM10_OTA_COBS_MAX_BLOCK_CODE)
+        {
+            dst[code_index] = code;
+            code_index = dst_size++;
+            code = 1;
+        }
+    }
+    dst[code_index] = code;
+
+    return dst_size;
+}
+
+HM10_Status decode_hm10_ota_cobs(uint8_t *src, uint16_t size, uint8_t *dst, uint16_t max_size, uint16_t *dst_size)
+{
+    /** <b>Local variable i:</b> Index of the next byte of the \p src param to be decoded. */
+    uint16_t i = 0;
+    /** <b>Local variable block_size:</b> Length in bytes of the current block. */
+    uint16_t block_size;
+
+    *dst_size = 0;
+    while (i < size)
+    {
+        /* Validate the code of the current block and copy its bytes. */
+        if (src[i] == 0)
+        {
+            return HM10_EC_ERR;
+        }
+        block_size = src[i] - 1;
+        if (((uint32_t) i+1+block_size > size) || ((uint32_t) *dst_size+block_size > max_size))
+        {
+            return HM10_EC_ERR;
+        }
+        memcpy(&dst[*dst_size], &src[i+1], block_size);
+        *dst_size += block_size;
+
+        /* Restore the byte with the value 0x00 that ended the block, unless it is the last block or a full one. */
+        i += 1 + block_size;
+        if ((block_size<(HM10_OTA_COBS_MAX_BLOCK_CODE-1)) && (i<size))
+        {
+            if (*dst_size == max_size)
+            {
+                return HM10_EC_ERR;
+            }
+            dst[(*dst_size)++] = 0;
+        }
+    }
+
+    return HM10_EC_OK;
+}
+
+void reset_hm10_ota_cobs()
+{
+    rx_head = 0;
+    rx_tail = 0;
+    rx_scanned = 0;
+    is_rx_resyncing = 0;
+    memset(&cobs_stats, 0, sizeof(HM10_OTA_COBS_Stats));
+}
+
+HM10_Status send_hm10_ota_cobs_frame(uint8_t *data, uint16_t size)
+{
+    if (size > HM10_OTA_COBS_MAX_FRAME_SIZE)
+    {
+        return HM10_EC_ERR;
+    }
+
+    /** <b>Local variable tx_size:</b> Length in bytes of the encoded frame, together with its delimiter. */
+    uint16_t tx_size = encode_hm10_ota_cobs(data, size, tx_buffer);
+    tx_buffer[tx_size++] = HM10_OTA_COBS_DELIMITER;
+    if (send_hm10_ota_data(tx_buffer, tx_size) != HM10_EC_OK)
+    {
+        return HM10_EC_ERR;
+    }
+    cobs_stats.frames_sent++;
+
+    return HM10_EC_OK;
+}
+
+HM10_Status get_hm10_ota_cobs_frame(uint8_t *data, uint16_t max_size, uint16_t *size)
+{
+    /** <b>Local variable delimiter:</b> Position of the ring buffer at which the delimiter of the oldest frame is. */
+    uint32_t delimiter;
+    /** <b>Local variable frame_size:</b> Length in bytes of the oldest encoded frame, without its delimiter. */
+    uint32_t frame_size;
+    /** <b>Local variable start:</b> Index of the ring buffer at which the oldest encoded frame starts. */
+    uint32_t start;
+    /** <b>Local variable contiguous_size:</b> Bytes of the ring buffer that can be stored or read without wrapping around. */
+    uint32_t contiguous_size;
+    /** <b>Local variable received:</b> Bytes that were received in the last read of the OTA data. */
+    uint16_t received;
+
+    do
+    {
+        if (find_delimiter_in_rx_ring(&delimiter))
+        {
+            /* Take the oldest frame out of the ring buffer, skipping the empty frames and the overlong ones. */
+            frame_size = delimiter - rx_tail;
+            if ((is_rx_resyncing) || (frame_size>HM10_OTA_COBS_MAX_WIRE_SIZE))
+            {
+                if (!is_rx_resyncing)
+                {
+                    cobs_stats.frames_dropped++;
+                }
+                cobs_stats.bytes_discarded += frame_size + 1;
+                is_rx_resyncing = 0;
+                rx_tail = delimiter + 1;
+                rx_scanned = rx_tail;
+                continue;
+            }
+            if (frame_size == 0)
+            {
+                rx_tail = delimiter + 1;
+                rx_scanned = rx_tail;
+                continue;
+            }
+            start = rx_tail & HM10_OTA_COBS_RX_RING_MASK;
+            contiguous_size = HM10_OTA_COBS_RX_RING_SIZE - start;
+            if (contiguous_size >= frame_size)
+            {
+                memcpy(rx_frame, &rx_ring[start], frame_size);
+            }
+            else
+            {
+                memcpy(rx_frame, &rx_ring[start], contiguous_size);
+                memcpy(&rx_frame[contiguous_size], rx_ring, frame_size-contiguous_size);
+            }
+            rx_tail = delimiter + 1;
+            rx_scanned = rx_tail;
+
+            /* Decode the frame. */
+            if (decode_hm10_ota_cobs(rx_frame, (uint16_t) frame_size, data, max_size, size) != HM10_EC_OK)
+            {
+                #if ETX_OTA_VERBOSE
+                    printf("WARNING: A COBS frame with an invalid encoding was received and it will be discarded.\r\n");
+                #endif
+                cobs_stats.frames_dropped++;
+                continue;
+            }
+            cobs_stats.frames_received++;
+            return HM10_EC_OK;
+        }
+
+        /* Discard an overlong frame up to its delimiter so that the ring buffer never gets full. */
+        if ((rx_head-rx_tail) > HM10_OTA_COBS_MAX_WIRE_SIZE)
+        {
+            #if ETX_OTA_VERBOSE
+                printf("WARNING: An overlong COBS frame is being received and it will be discarded up to its delimiter.\r\n");
+            #endif
+            if (!is_rx_resyncing)
+            {
+                cobs_stats.frames_dropped++;
+                is_rx_resyncing = 1;
+            }
+            cobs_stats.bytes_discarded += rx_head - rx_tail;
+            rx_tail = rx_head;
+            rx_scanned = rx_head;
+        }
+
+        /* Receive more bytes into the free space of the ring buffer. */
+        start = rx_head & HM10_OTA_COBS_RX_RING_MASK;
+        contiguous_size = HM10_OTA_COBS_RX_RING_SIZE - start;
+        if (contiguous_size > (HM10_OTA_COBS_RX_RING_SIZE-(rx_head-rx_tail)))
+        {
+            contiguous_size = HM10_OTA_COBS_RX_RING_SIZE - (rx_head-rx_tail);
+        }
+        if (contiguous_size > UINT16_MAX)
+        {
+            contiguous_size = UINT16_MAX;
+        }
+        if (get_hm10_ota_available_data(&rx_ring[start], (uint16_t) contiguous_size, &received) != HM10_EC_OK)
+        {
+            return HM10_EC_NR;
+        }
+        rx_head += received;
+    }
+    while (1);
+}
+
+void get_hm10_ota_cobs_stats(HM10_OTA_COBS_Stats *stats)
+{
+    memcpy(stats, &cobs_stats, sizeof(HM10_OTA_COBS_Stats));
+}
+
+static uint32_t find_delimiter(uint8_t *data, uint32_t size)
+{
+    /** <b>Local variable i:</b> Offset of the next byte to be scanned. */
+    uint32_t i = 0;
+#if defined(__SSE2__)
+    /* Compare 16 bytes at a time against the delimiter and gather the result with a single instruction. */
+    /** <b>Local variable delimiters:</b> Vector with the delimiter in each of its 16 lanes. */
+    __m128i delimiters = _mm_set1_epi8((char) HM10_OTA_COBS_DELIMITER);
+    /** <b>Local variable matches:</b> Bit mask of the bytes, among the current 16 ones, that are a delimiter. */
+    uint32_t matches;
+    for (; (i+16)<=size; i+=16)
+    {
+        matches = (uint32_t) _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *) &data[i]), delimiters));
+        if (matches != 0)
+        {
+            return i + (uint32_t) __builtin_ctz(matches);
+        }
+    }
+#endif
+    for (; i<size; i++)
+    {
+        if (data[i] == HM10_OTA_COBS_DELIMITER)
+        {
+            return i;
+        }
+    }
+
+    return size;
+}
+
+static uint8_t find_delimiter_in_rx_ring(uint32_t *position)
+{
+    /** <b>Local variable start:</b> Index of the ring buffer at which the scan starts. */
+    uint32_t start;
+    /** <b>Local variable contiguous_size:</b> Bytes that can be scanned without wrapping around the ring buffer. */
+    uint32_t contiguous_size;
+    /** <b>Local variable offset:</b> Offset of the first delimiter within the scanned bytes. */
+    uint32_t offset;
+
+    /* Scan the bytes that have not been scanned yet in up to two contiguous parts of the ring buffer. */
+    while (rx_scanned != rx_head)
+    {
+        start = rx_scanned & HM10_OTA_COBS_RX_RING_MASK;
+        contiguous_size = HM10_OTA_COBS_RX_RING_SIZE - start;
+        if (contiguous_size > (rx_head-rx_scanned))
+        {
+            contiguous_size = rx_head - rx_scanned;
+        }
+        offset = find_delimiter(&rx_ring[start], contiguous_size);
+        if (offset < contiguous_size)
+        {
+            *position = rx_scanned + offset;
+            return 1;
+        }
+        rx_scanned += contiguous_size;
+    }
+
+    return 0;
+}
+
+/** @} */
@@ -0,0 +1,622 @@
+/** @addtogroup hm10_ota_fec
+ * @{
+ */
+
+#include "../Inc/hm10_ota_fec.h"
+#include <stdio.h>	// Library from which "printf" is located at.
+#include <string.h>	// Library from which "memset()" and "memcpy()" are located at.
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <tmmintrin.h> // Library from which the SSSE3 intrinsics are located at.
+#define HM10_OTA_FEC_SSSE3_SUPPORT      (1)     /**< @brief Flag indicating whether the compiler can generate the SSSE3 implementation (i.e., 1) or not (i.e., 0). */
+#else
+#define HM10_OTA_FEC_SSSE3_SUPPORT      (0)     /**< @brief Flag indicating whether the compiler can generate the SSSE3 implementation (i.e., 1) or not (i.e., 0). */
+#endif
+
+#define HM10_OTA_FEC_GF_POLYNOMIAL      (0x11DU)                        /**< @brief Primitive polynomial with which the GF(256) is generated (i.e., \f$x^8 + x^4 + x^3 + x^2 + 1\f$). */
+#define HM10_OTA_FEC_PARITY_X_OFFSET    (HM10_OTA_FEC_MAX_SHARDS)       /**< @brief Element of GF(256) that identifies the first parity row of the Cauchy matrix, which must be different from the elements that identify the data columns (i.e., 0 to @ref HM10_OTA_FEC_MAX_SHARDS minus 1). */
+#define HM10_OTA_FEC_QUEUE_SIZE         (2 * HM10_OTA_FEC_MAX_SHARDS)   /**< @brief Number of data shards that can be waiting to be given to the application. */
+#define HM10_OTA_FEC_INDEX_POS          (4U)                            /**< @brief Bit position of the index of a packet in the byte 1 of its Packet Header. */
+#define HM10_OTA_FEC_DATA_COUNT_MASK    (0x0FU)                         /**< @brief Bit mask of the number of data packets minus 1 in the byte 1 of the Packet Header. */
+
+static uint8_t gf_exp[512];                                                     /**< @brief Antilogarithm table of GF(256), duplicated so that the sum of two logarithms can be looked up without its modulo. */
+static uint8_t gf_log[256];                                                     /**< @brief Logarithm table of GF(256). */
+static int8_t is_ssse3_available = -1;                                          /**< @brief Flag indicating whether SSSE3 is available (i.e., 1), not available (i.e., 0) or whether it has not been detected yet (i.e., -1). */
+static uint8_t is_fec_initialized = 0;                                          /**< @brief Flag indicating whether the FEC layer has been initialized (i.e., 1) or not (i.e., 0). */
+static uint8_t k;                                                               /**< @brief Number of data packets of each group. */
+static uint8_t m;                                                               /**< @brief Number of parity packets of each group. */
+static uint8_t tx_shards[HM10_OTA_FEC_MAX_SHARDS][HM10_OTA_FEC_SHARD_SIZE];     /**< @brief Data shards of the group that is being sent. */
+static uint8_t tx_count;                                                        /**< @brief Number of data shards of the group that is being sent. */
+static uint8_t tx_group_id;                                                     /**< @brief Group ID of the group that is being sent. */
+static uint8_t rx_shards[HM10_OTA_FEC_MAX_SHARDS][HM10_OTA_FEC_SHARD_SIZE];     /**< @brief Data and parity shards of the group that is being received. */
+static uint16_t rx_present;                                                     /**< @brief Bit mask of the shards of the group that is being received that are available (i.e., received or rebuilt). */
+static uint8_t rx_group_id;                                                     /**< @brief Group ID of the group that is being received. */
+static uint8_t rx_is_group_active = 0;                                          /**< @brief Flag indicating whether a group is being received (i.e., 1) or not (i.e., 0). */
+static uint8_t rx_is_group_done;                                                /**< @brief Flag indicating whether all the data shards of the group that is being received have been given to the queue (i.e., 1) or not (i.e., 0). */
+static uint8_t rx_data_count;                                                   /**< @brief Number of data shards of the group that is being received, which is assumed to be k until a parity packet states otherwise. */
+static uint8_t rx_next_deliver;                                                 /**< @brief Index of the next data shard of the group that is being received that is to be given to the queue. */
+static uint8_t queue[HM10_OTA_FEC_QUEUE_SIZE][HM10_OTA_FEC_SHARD_SIZE];         /**< @brief Data shards that are waiting to be given to the application. */
+static uint8_t queue_head;                                                      /**< @brief Index of the oldest data shard in the queue. */
+static uint8_t queue_count;                                                     /**< @brief Number of data shards in the queue. */
+static uint8_t packet_buffer[HM10_MAX_PACKET_SIZE];                             /**< @brief Buffer that holds a whole packet that is either being sent or received. */
+static HM10_OTA_FEC_Stats fec_stats;                                            /**< @brief Statistics of the HM-10 OTA Forward Error Correction layer. */
+
+/**@brief	Multiplies two elements of GF(256).
+ *
+ * @param a First element.
+ * @param b Second element.
+ *
+ * @return  The product of both elements.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+static uint8_t gf_mul(uint8_t a, uint8_t b);
+
+/**@brief	Gets the multiplicative inverse of a non-zero element of GF(256).
+ *
+ * @param a Element whose inverse is desired.
+ *
+ * @return  The inverse of the element.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+static uint8_t gf_inv(uint8_t a);
+
+/**@brief	Gets a coefficient of the Cauchy matrix with which the parity shards are calculated.
+ *
+ * @param parity_row    Index of the parity shard (i.e., from 0 to m - 1).
+ * @param data_column   Index of the data shard (i.e., from 0 to k - 1).
+ *
+ * @return  The coefficient by which the data shard is multiplied to calculate the parity shard.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+static uint8_t get_cauchy_coefficient(uint8_t parity_row, uint8_t data_column);
+
+/**@brief	Multiplies a shard by a constant and adds the result into another shard (i.e., dst += c * src).
+ *
+ * @param[in,out] dst   Pointer to the shard into which the result is added.
+ * @param[in] src       Pointer to the shard that is multiplied.
+ * @param c             Constant by which the \p src shard is multiplied.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+static void multiply_and_add_shard(uint8_t *dst, uint8_t *src, uint8_t c);
+
+#if HM10_OTA_FEC_SSSE3_SUPPORT
+/**@brief	Multiplies a shard by a constant and adds the result into another shard with the \c pshufb instruction of
+ *          SSSE3.
+ *
+ * @param[in,out] dst   Pointer to the shard into which the result is added.
+ * @param[in] src       Pointer to the shard that is multiplied.
+ * @param c             Constant by which the \p src shard is multiplied.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+__attribute__((target("ssse3"))) static void multiply_and_add_shard_with_ssse3(uint8_t *dst, uint8_t *src, uint8_t c);
+#endif
+
+/**@brief	Sends the parity packets of the group that is being sent and starts a new group.
+ *
+ * @retval	HM10_EC_OK	if the parity packets were successfully sent.
+ * @retval  HM10_EC_ERR otherwise.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+static HM10_Status send_parity_packets();
+
+/**@brief	Receives a single packet Over the Air (OTA) and processes it.
+ *
+ * @retval	HM10_EC_OK	if a packet was received and processed.
+ * @retval  HM10_EC_NA  if a packet was received, but it was discarded because of an invalid Packet Header.
+ * @retval  HM10_EC_NR  if no packet was received.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+static HM10_Status process_incoming_packet();
+
+/**@brief	Rebuilds the missing data shards of the group that is being received, if enough shards are available, and
+ *          gives to the queue the data shards that are now in order.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+static void recover_and_deliver();
+
+/**@brief	Gives to the queue the remaining data shards of the group that is being received, skipping the lost ones.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+static void finalize_group();
+
+/**@brief	Adds a data shard into the queue.
+ *
+ * @param[in] shard Pointer to the data shard.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+static void push_into_queue(uint8_t *shard);
+
+HM10_Status init_hm10_ota_fec(uint8_t data_shards, uint8_t parity_shards)
+{
+    if ((data_shards==0) || ((data_shards+parity_shards) > HM10_OTA_FEC_MAX_SHARDS))
+    {
+        return HM10_EC_ERR;
+    }
+
+    /* Generate the logarithm and antilogarithm tables of GF(256). */
+    /** <b>Local variable x:</b> Current power of the generator of GF(256). */
+    uint16_t x = 1;
+    for (uint16_t i=0; i<255; i++)
+    {
+        gf_exp[i] = (uint8_t) x;
+        gf_exp[i+255] = (uint8_t) x;
+        gf_log[x] = (uint8_t) i;
+        x <<= 1;
+        if (x & 0x100U)
+        {
+            x ^= HM10_OTA_FEC_GF_POLYNOMIAL;
+        }
+    }
+    gf_exp[510] = gf_exp[0];
+    gf_exp[511] = gf_exp[1];
+
+    /* Reset the groups and the statistics. */
+    k = data_shards;
+    m = parity_shards;
+    tx_count = 0;
+    tx_group_id = 0;
+    rx_is_group_active = 0;
+    queue_head = 0;
+    queue_count = 0;
+    memset(&fec_stats, 0, sizeof(HM10_OTA_FEC_Stats));
+    is_fec_initialized = 1;
+
+    return HM10_EC_OK;
+}
+
+HM10_Status send_hm10_ota_fec_data(uint8_t *data, uint8_t size)
+{
+    if ((!is_fec_initialized) || (size==0) || (size>HM10_OTA_FEC_MAX_DATA_SIZE))
+    {
+        return HM10_EC_ERR;
+    }
+
+    /* Keep the data shard, padded with zeros, to calculate the parity of its group. */
+    /** <b>Local variable shard:</b> Pointer to the data shard. */
+    uint8_t *shard = tx_shards[tx_count];
+    shard[0] = size;
+    memcpy(&shard[1], data, size);
+    memset(&shard[1+size], 0, HM10_OTA_FEC_MAX_DATA_SIZE-size);
+
+    /* Send the data packet without its padding. */
+    packet_buffer[0] = tx_group_id;
+    packet_buffer[1] = (uint8_t) (tx_count << HM10_OTA_FEC_INDEX_POS);
+    memcpy(&packet_buffer[HM10_OTA_FEC_HEADER_SIZE], shard, 1+size);
+    if (send_hm10_ota_data(packet_buffer, HM10_OTA_FEC_HEADER_SIZE+1+size) != HM10_EC_OK)
+    {
+        return HM10_EC_ERR;
+    }
+    fec_stats.data_packets_sent++;
+
+    /* Send the parity packets if the group is complete. */
+    if (++tx_count == k)
+    {
+        return send_parity_packets();
+    }
+
+    return HM10_EC_OK;
+}
+
+HM10_Status flush_hm10_ota_fec()
+{
+    if (!is_fec_initialized)
+    {
+        return HM10_EC_ERR;
+    }
+    if (tx_count == 0)
+    {
+        return HM10_EC_OK;
+    }
+
+    return send_parity_packets();
+}
+
+HM10_Status get_hm10_ota_fec_data(uint8_t *data, uint8_t *size)
+{
+    if (!is_fec_initialized)
+    {
+        return HM10_EC_ERR;
+    }
+
+    /* Receive packets until a data shard is in the queue. */
+    while (queue_count == 0)
+    {
+        if (process_incoming_packet() == HM10_EC_NR)
+        {
+            return HM10_EC_NR;
+        }
+    }
+
+    /** <b>Local variable shard:</b> Pointer to the oldest data shard in the queue. */
+    uint8_t *shard = queue[queue_head];
+    *size = shard[0];
+    memcpy(data, &shard[1], shard[0]);
+    queue_head = (queue_head + 1) % HM10_OTA_FEC_QUEUE_SIZE;
+    queue_count--;
+
+    return HM10_EC_OK;
+}
+
+void get_hm10_ota_fec_stats(HM10_OTA_FEC_Stats *stats)
+{
+    memcpy(stats, &fec_stats, sizeof(HM10_OTA_FEC_Stats));
+}
+
+static uint8_t gf_mul(uint8_t a, uint8_t b)
+{
+    if ((a==0) || (b==0))
+    {
+        return 0;
+    }
+    return gf_exp[gf_log[a] + gf_log[b]];
+}
+
+static uint8_t gf_inv(uint8_t a)
+{
+    return gf_exp[255 - gf_log[a]];
+}
+
+static uint8_t get_cauchy_coefficient(uint8_t parity_row, uint8_t data_column)
+{
+    return gf_inv((uint8_t) ((HM10_OTA_FEC_PARITY_X_OFFSET + parity_row) ^ data_column));
+}
+
+static void multiply_and_add_shard(uint8_t *dst, uint8_t *src, uint8_t c)
+{
+    if (c == 0)
+    {
+        return;
+    }
+#if HM10_OTA_FEC_SSSE3_SUPPORT
+    if (is_ssse3_available == -1)
+    {
+        __builtin_cpu_init();
+        is_ssse3_available = __builtin_cpu_supports("ssse3") ? 1 : 0;
+    }
+    if (is_ssse3_available)
+    {
+        multiply_and_add_shard_with_ssse3(dst, src, c);
+        return;
+    }
+#endif
+
+    /** <b>Local variable log_c:</b> Logarithm of the \p c param. */
+    uint16_t log_c = gf_log[c];
+    for (uint8_t i=0; i<HM10_OTA_FEC_SHARD_SIZE; i++)
+    {
+        if (src[i] != 0)
+        {
+            dst[i] ^= gf_exp[log_c + gf_log[src[i]]];
+        }
+    }
+}
+
+#if HM10_OTA_FEC_SSSE3_SUPPORT
+__attribute__((target("ssse3"))) static void multiply_and_add_shard_with_ssse3(uint8_t *dst, uint8_t *src, uint8_t c)
+{
+    /* Split the multiplication by the constant into one lookup for each nibble of each byte. */
+    /** <b>Local variable low_products:</b> Products of the \p c param by each possible value of a low nibble. */
+    uint8_t low_products[16];
+    /** <b>Local variable high_products:</b> Products of the \p c param by each possible value of a high nibble. */
+    uint8_t high_products[16];
+    for (uint8_t x=0; x<16; x++)
+    {
+        low_products[x] = gf_mul(c, x);
+        high_products[x] = gf_mul(c, (uint8_t) (x << 4));
+    }
+    /** <b>Local variable low_table:</b> Vector with the products of the low nibbles. */
+    __m128i low_table = _mm_loadu_si128((const __m128i *) low_products);
+    /** <b>Local variable high_table:</b> Vector with the products of the high nibbles. */
+    __m128i high_table = _mm_loadu_si128((const __m128i *) high_products);
+    /** <b>Local variable nibble_mask:</b> Vector with the value 0x0F in each of its 16 lanes. */
+    __m128i nibble_mask = _mm_set1_epi8(0x0F);
+    /** <b>Local variable s:</b> Vector with 16 bytes of the \p src shard. */
+    __m128i s;
+    /** <b>Local variable product:</b> Vector with the products of 16 bytes of the \p src shard by the \p c param. */
+    __m128i product;
+
+    /* Multiply 16 bytes at a time and then the remaining ones. */
+    /** <b>Local variable i:</b> Index of the next byte of the shards to be processed. */
+    uint8_t i = 0;
+    for (; (i+16)<=HM10_OTA_FEC_SHARD_SIZE; i+=16)
+    {
+        s = _mm_loadu_si128((const __m128i *) &src[i]);
+        product = _mm_xor_si128(_mm_shuffle_epi8(low_table, _mm_and_si128(s, nibble_mask)),
+                                _mm_shuffle_epi8(high_table, _mm_and_si128(_mm_srli_epi64(s, 4), nibble_mask)));
+        _mm_storeu_si128((__m128i *) &dst[i], _mm_xor_si128(_mm_loadu_si128((const __m128i *) &dst[i]), product));
+    }
+    for (; i<HM10_OTA_FEC_SHARD_SIZE; i++)
+    {
+        dst[i] ^= low_products[src[i] & 0x0FU] ^ high_products[src[i] >> 4];
+    }
+}
+#endif
+
+static HM10_Status send_parity_packets()
+{
+    /** <b>Local variable parity:</b> Pointer to the parity shard within the packet buffer. */
+    uint8_t *parity = &packet_buffer[HM10_OTA_FEC_HEADER_SIZE];
+    for (uint8_t j=0; j<m; j++)
+    {
+        memset(parity, 0, HM10_OTA_FEC_SHARD_SIZE);
+        for (uint8_t i=0; i<tx_count; i++)
+        {
+            multiply_and_add_shard(parity, tx_shards[i], get_cauchy_coefficient(j, i));
+        }
+        packet_buffer[0] = tx_group_id;
+        packet_buffer[1] = (uint8_t) (((k+j) << HM10_OTA_FEC_INDEX_POS) | ((tx_count-1) & HM10_OTA_FEC_DATA_COUNT_MASK));
+        if (send_hm10_ota_data(packet_buffer, HM10_MAX_PACKET_SIZE) != HM10_EC_OK)
+        {
+            return HM10_EC_ERR;
+        }
+        fec_stats.parity_packets_sent++;
+    }
+    tx_group_id++;
+    tx_count = 0;
+
+    return HM10_EC_OK;
+}
+
+static HM10_Status process_incoming_packet()
+{
+    /* Receive the Packet Header and then the shard whose length depends on the type of packet. */
+    if (get_hm10_ota_data(packet_buffer, HM10_OTA_FEC_HEADER_SIZE) != HM10_EC_OK)
+    {
+        return HM10_EC_NR;
+    }
+    /** <b>Local variable group_id:</b> Group ID of the received packet. */
+    uint8_t group_id = packet_buffer[0];
+    /** <b>Local variable index:</b> Index of the received packet within its group. */
+    uint8_t index = packet_buffer[1] >> HM10_OTA_FEC_INDEX_POS;
+    /** <b>Local variable data_count:</b> Number of data packets of the group, as stated by a parity packet. */
+    uint8_t data_count = (packet_buffer[1] & HM10_OTA_FEC_DATA_COUNT_MASK) + 1;
+    /** <b>Local variable shard:</b> Pointer to the shard within the packet buffer. */
+    uint8_t *shard = &packet_buffer[HM10_OTA_FEC_HEADER_SIZE];
+    if ((index<k) && (data_count==1))
+    {
+        if (get_hm10_ota_data(shard, 1) != HM10_EC_OK)
+        {
+            return HM10_EC_NR;
+        }
+        if ((shard[0]==0) || (shard[0]>HM10_OTA_FEC_MAX_DATA_SIZE))
+        {
+            fec_stats.invalid_packets++;
+            return HM10_EC_NA;
+        }
+        if (get_hm10_ota_data(&shard[1], shard[0]) != HM10_EC_OK)
+        {
+            return HM10_EC_NR;
+        }
+        memset(&shard[1+shard[0]], 0, HM10_OTA_FEC_MAX_DATA_SIZE-shard[0]);
+    }
+    else if ((index>=k) && (index<(k+m)) && (data_count<=k))
+    {
+        if (get_hm10_ota_data(shard, HM10_OTA_FEC_SHARD_SIZE) != HM10_EC_OK)
+        {
+            return HM10_EC_NR;
+        }
+    }
+    else
+    {
+        #if ETX_OTA_VERBOSE
+            printf("WARNING: An invalid FEC Packet Header (0x%02X 0x%02X) was received and it will be discarded.\r\n", packet_buffer[0], packet_buffer[1]);
+        #endif
+        fec_stats.invalid_packets++;
+        return HM10_EC_NA;
+    }
+
+    /* Start a new group whenever a packet of a later group is received. */
+    if ((!rx_is_group_active) || (group_id!=rx_group_id))
+    {
+        if (rx_is_group_active)
+        {
+            if ((uint8_t) (group_id-rx_group_id) >= 128)
+            {
+                return HM10_EC_OK;
+            }
+            finalize_group();
+        }
+        rx_group_id = group_id;
+        rx_present = 0;
+        rx_data_count = k;
+        rx_next_deliver = 0;
+        rx_is_group_done = 0;
+        rx_is_group_active = 1;
+    }
+    if ((rx_is_group_done) || (rx_present & (1U << index)))
+    {
+        return HM10_EC_OK;
+    }
+
+    /* Keep the shard and give to the queue the data shards that are now in order. */
+    memcpy(rx_shards[index], shard, HM10_OTA_FEC_SHARD_SIZE);
+    rx_present |= (uint16_t) (1U << index);
+    if (index < k)
+    {
+        fec_stats.data_packets_received++;
+    }
+    else
+    {
+        fec_stats.parity_packets_received++;
+        rx_data_count = data_count;
+    }
+    recover_and_deliver();
+
+    return HM10_EC_OK;
+}
+
+static void recover_and_deliver()
+{
+    /* Find the missing data shards and the available parity shards. */
+    /** <b>Local variable missing:</b> Indexes of the missing data shards. */
+    uint8_t missing[HM10_OTA_FEC_MAX_SHARDS];
+    /** <b>Local variable missing_count:</b> Number of missing data shards. */
+    uint8_t missing_count = 0;
+    /** <b>Local variable rows:</b> Indexes of the available parity shards (i.e., their rows in the Cauchy matrix). */
+    uint8_t rows[HM10_OTA_FEC_MAX_SHARDS];
+    /** <b>Local variable row_count:</b> Number of available parity shards. */
+    uint8_t row_count = 0;
+    for (uint8_t i=0; i<rx_data_count; i++)
+    {
+        if (!(rx_present & (1U << i)))
+        {
+            missing[missing_count++] = i;
+        }
+    }
+    for (uint8_t j=0; j<m; j++)
+    {
+        if (rx_present & (1U << (k+j)))
+        {
+            rows[row_count++] = j;
+        }
+    }
+
+    /* Rebuild the missing data shards by solving the system made of the Cauchy matrix and the available shards. */
+    if ((missing_count>0) && (row_count>=missing_count))
+    {
+        /** <b>Local variable a:</b> Square submatrix of the Cauchy matrix for the missing data shards. */
+        uint8_t a[HM10_OTA_FEC_MAX_SHARDS][HM10_OTA_FEC_MAX_SHARDS];
+        /** <b>Local variable rhs:</b> Parity shards without the contribution of the available data shards. */
+        uint8_t rhs[HM10_OTA_FEC_MAX_SHARDS][HM10_OTA_FEC_SHARD_SIZE];
+        /** <b>Local variable factor:</b> Factor with which a row is eliminated or scaled. */
+        uint8_t factor;
+        /** <b>Local variable tmp:</b> Temporary shard used to swap two rows. */
+        uint8_t tmp[HM10_OTA_FEC_SHARD_SIZE];
+        for (uint8_t r=0; r<missing_count; r++)
+        {
+            for (uint8_t c=0; c<missing_count; c++)
+            {
+                a[r][c] = get_cauchy_coefficient(rows[r], missing[c]);
+            }
+            memcpy(rhs[r], rx_shards[k+rows[r]], HM10_OTA_FEC_SHARD_SIZE);
+            for (uint8_t i=0; i<rx_data_count; i++)
+            {
+                if (rx_present & (1U << i))
+                {
+                    multiply_and_add_shard(rhs[r], rx_shards[i], get_cauchy_coefficient(rows[r], i));
+                }
+            }
+        }
+
+        /* Apply a Gauss-Jordan elimination, which always succeeds since every square submatrix of a Cauchy matrix is invertible. */
+        for (uint8_t c=0; c<missing_count; c++)
+        {
+            for (uint8_t r=c; r<missing_count; r++)
+            {
+                if (a[r][c] != 0)
+                {
+                    if (r != c)
+                    {
+                        memcpy(tmp, a[r], missing_count);
+                        memcpy(a[r], a[c], missing_count);
+                        memcpy(a[c], tmp, missing_count);
+                        memcpy(tmp, rhs[r], HM10_OTA_FEC_SHARD_SIZE);
+                        memcpy(rhs[r], rhs[c], HM10_OTA_FEC_SHARD_SIZE);
+                        memcpy(rhs[c], tmp, HM10_OTA_FEC_SHARD_SIZE);
+                    }
+                    break;
+                }
+            }
+            factor = gf_inv(a[c][c]);
+            for (uint8_t i=0; i<missing_count; i++)
+            {
+                a[c][i] = gf_mul(a[c][i], factor);
+            }
+            for (uint8_t i=0; i<HM10_OTA_FEC_SHARD_SIZE; i++)
+            {
+                rhs[c][i] = gf_mul(rhs[c][i], factor);
+            }
+            for (uint8_t r=0; r<missing_count; r++)
+            {
+                factor = a[r][c];
+                if ((r==c) || (factor==0))
+                {
+                    continue;
+                }
+                for (uint8_t i=0; i<missing_count; i++)
+                {
+                    a[r][i] ^= gf_mul(a[c][i], factor);
+                }
+                multiply_and_add_shard(rhs[r], rhs[c], factor);
+            }
+        }
+
+        /* Keep the rebuilt data shards whose length is valid. */
+        for (uint8_t c=0; c<missing_count; c++)
+        {
+            if ((rhs[c][0]!=0) && (rhs[c][0]<=HM10_OTA_FEC_MAX_DATA_SIZE))
+            {
+                memcpy(rx_shards[missing[c]], rhs[c], HM10_OTA_FEC_SHARD_SIZE);
+                rx_present |= (uint16_t) (1U << missing[c]);
+                fec_stats.data_packets_recovered++;
+            }
+        }
+    }
+
+    /* Give to the queue the data shards that are now in order. */
+    while ((rx_next_deliver<rx_data_count) && (rx_present & (1U << rx_next_deliver)))
+    {
+        push_into_queue(rx_shards[rx_next_deliver++]);
+    }
+    if (rx_next_deliver == rx_data_count)
+    {
+        rx_is_group_done = 1;
+    }
+}
+
+static void finalize_group()
+{
+    /* Without parity packets, the number of data packets of a group that was flushed early cannot be known, so it is
+       assumed to end at its last received data packet. */
+    if ((rx_present >> k) == 0)
+    {
+        while ((rx_data_count>rx_next_deliver) && (!(rx_present & (1U << (rx_data_count-1)))))
+        {
+            rx_data_count--;
+        }
+    }
+    for (; rx_next_deliver<rx_data_count; rx_next_deliver++)
+    {
+        if (rx_present & (1U << rx_next_deliver))
+        {
+            push_into_queue(rx_shards[rx_next_deliver]);
+        }
+        else
+        {
+            fec_stats.data_packets_lost++;
+        }
+    }
+    rx_is_group_done = 1;
+}
+
+static void push_into_queue(uint8_t *shard)
+{
+    if (queue_count == HM10_OTA_FEC_QUEUE_SIZE)
+    {
+        fec_stats.data_packets_lost++;
+        return;
+    }
+    memcpy(queue[(queue_head + queue_count) % HM10_OTA_FEC_QUEUE_SIZE], shard, HM10_OTA_FEC_SHARD_SIZE);
+    queue_count++;
+}
+
+/** @} */
@@ -0,0 +1,704 @@
+/** @addtogroup hm10_ota_file
+ * @{
+ */
+
+#include "../Inc/hm10_ota_file.h"
+#include "../Inc/hm10_config.h" // This is the Mortrack's HM-10 library configuration file.
+#include "../Inc/hm10_crc32c.h" // Custom Mortrack's Library to calculate the CRC32C of the data sent and received Over the Air.
+#include <stdio.h>	// Library from which "printf", "fopen()", "fwrite()", "fflush()", "snprintf()", "rename()" and "remove()" are located at.
+#include <string.h>	// Library from which "memset()" and "memcpy()" are located at.
+#include <time.h> // Library from which "clock_gettime()" is located at.
+#if defined(__linux__) || defined(__FreeBSD__)   /* Linux & FreeBSD */
+#include <fcntl.h> // Library from which "open()" is located at.
+#include <unistd.h> // Library from which "close()" and "fsync()" are located at.
+#include <sys/mman.h> // Library from which "mmap()" and "munmap()" are located at.
+#include <sys/stat.h> // Library from which "fstat()" is located at.
+#else  /* windows */
+#include <windows.h> // Library from which "CreateFileMapping()", "MapViewOfFile()" and "MoveFileExA()" are located at.
+#include <io.h> // Library from which "_commit()" is located at.
+#endif
+
+#define HM10_OTA_FILE_START_TYPE        (0x01U)     /**< @brief Type of a START frame. */
+#define HM10_OTA_FILE_BLOCK_TYPE        (0x02U)     /**< @brief Type of a BLOCK frame. */
+#define HM10_OTA_FILE_ACK_TYPE          (0x03U)     /**< @brief Type of an ACK frame. */
+#define HM10_OTA_FILE_NAK_TYPE          (0x04U)     /**< @brief Type of a NAK frame. */
+#define HM10_OTA_FILE_START_SIZE        (17)        /**< @brief Length in bytes of a START frame. */
+#define HM10_OTA_FILE_BLOCK_HEADER_SIZE (11)        /**< @brief Length in bytes of a BLOCK frame without the bytes of its block. */
+#define HM10_OTA_FILE_BLOCK_CRC_OFFSET  (7)         /**< @brief Position of the CRC32C within a BLOCK frame, which is also the length in bytes of the header fields that it covers. */
+#define HM10_OTA_FILE_RESPONSE_SIZE     (9)         /**< @brief Length in bytes of an ACK or a NAK frame. */
+#define HM10_OTA_FILE_MAX_PATH_SIZE     (4096)      /**< @brief Length in bytes of the longest path, including its null terminator, of the temporary file into which a Checkpoint File is written before replacing it. */
+#define HM10_OTA_FILE_LATE_POLLS        (2U)        /**< @brief Number of timeouts that the sender keeps waiting for a response after its frame could have gone through the line, which cover the receiver timing out on a lost chunk of a block and then discarding the rest of that frame before it sends its NAK frame. */
+
+#if (HM10_OTA_FILE_BLOCK_SIZE > 65535) || (HM10_OTA_FILE_BLOCK_SIZE == 0)
+#error "HM10_OTA_FILE_BLOCK_SIZE must be within 1 and 65535 bytes so that the length of any block fits into its 2-byte field."
+#endif
+
+#if HM10_OTA_FILE_MIN_RATE == 0
+#error "HM10_OTA_FILE_MIN_RATE must be greater than 0."
+#endif
+
+static uint8_t frame_buffer[HM10_OTA_FILE_START_SIZE];     /**< @brief Buffer that holds the START frame or the header of any other frame that is either being sent or received. */
+static uint8_t rx_block[HM10_OTA_FILE_BLOCK_SIZE];         /**< @brief Buffer into which the receiver receives the bytes of each block before validating them. */
+
+/**@brief	Stores a 32-bit value in little endian.
+ *
+ * @param[out] dst  Pointer to the Memory Address into which the value will be stored.
+ * @param value     Value that is desired to be stored.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+static void write_u32_le(uint8_t *dst, uint32_t value);
+
+/**@brief	Loads a 32-bit value that is stored in little endian.
+ *
+ * @param[in] src   Pointer to the value.
+ *
+ * @return  The loaded value.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+static uint32_t read_u32_le(uint8_t *src);
+
+/**@brief	Gets the confirmed offset from a Checkpoint File, if it belongs to the same file.
+ *
+ * @param[in] checkpoint_path   Path of the Checkpoint File, or \c NULL if there is none.
+ * @param file_size             Size in bytes of the file that is being transferred.
+ * @param file_crc              CRC32C of the whole file that is being transferred.
+ *
+ * @return  The confirmed offset or, if the Checkpoint File does not exist, is not valid or belongs to another file, 0.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+static uint32_t load_checkpoint(const char *checkpoint_path, uint32_t file_size, uint32_t file_crc);
+
+/**@brief	Persists a confirmed offset into a Checkpoint File.
+ *
+ * @details The checkpoint is first written and flushed into the disk on a temporary file (i.e., the path of the
+ *          Checkpoint File followed by ".tmp"), which then replaces the Checkpoint File. Therefore, if the host machine
+ *          crashes or loses its power at any moment, the Checkpoint File still contains either the previous confirmed
+ *          offset or the new one, but never a partially written one.
+ *
+ * @param[in] checkpoint_path   Path of the Checkpoint File, or \c NULL if there is none.
+ * @param file_size             Size in bytes of the file that is being transferred.
+ * @param file_crc              CRC32C of the whole file that is being transferred.
+ * @param confirmed_offset      Offset up to which the receiver has confirmed the file.
+ *
+ * @retval	HM10_EC_OK	if the Checkpoint File was written or if there is none.
+ * @retval  HM10_EC_ERR otherwise.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+static HM10_Status save_checkpoint(const char *checkpoint_path, uint32_t file_size, uint32_t file_crc, uint32_t confirmed_offset);
+
+/**@brief	Memory-maps a whole file in read-only mode.
+ *
+ * @param[in] file_path     Path of the file.
+ * @param[out] p_data       Pointer to the Memory Address into which the pointer to the memory-mapped data of the file
+ *                          will be stored, which will be \c NULL for an empty file.
+ * @param[out] file_size    Pointer to the Memory Address into which the size in bytes of the file will be stored.
+ *
+ * @retval	HM10_EC_OK	if the file was successfully memory-mapped.
+ * @retval  HM10_EC_ERR otherwise.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+static HM10_Status map_file(const char *file_path, uint8_t **p_data, uint32_t *file_size);
+
+/**@brief	Releases the memory-mapped data of a file that was memory-mapped with the @ref map_file function.
+ *
+ * @param[in] p_data    Pointer to the memory-mapped data of the file.
+ * @param file_size     Size in bytes of the file.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+static void unmap_file(uint8_t *p_data, uint32_t file_size);
+
+/**@brief	Sends an ACK or a NAK frame Over the Air (OTA).
+ *
+ * @param type      Type of the frame (i.e., @ref HM10_OTA_FILE_ACK_TYPE or @ref HM10_OTA_FILE_NAK_TYPE ).
+ * @param offset    Offset from which the receiver expects the next block.
+ *
+ * @retval	HM10_EC_OK	if the frame was successfully sent.
+ * @retval  HM10_EC_ERR otherwise.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+static HM10_Status send_response(uint8_t type, uint32_t offset);
+
+/**@brief	Waits for an ACK or a NAK frame Over the Air (OTA).
+ *
+ * @details The response is waited for @ref HM10_OTA_FILE_LATE_POLLS timeouts of the @ref get_hm10_ota_data function
+ *          after the frame that was sent has had the time to go through the line at @ref HM10_OTA_FILE_MIN_RATE , since
+ *          the @ref send_hm10_ota_data function may return long before that (e.g., while the pacer is disabled).
+ *
+ * @param[out] type     Pointer to the Memory Address into which the type of the received frame will be stored.
+ * @param[out] offset   Pointer to the Memory Address into which the offset of the received frame will be stored.
+ * @param sent_size     Length in bytes of the frame that was sent and to which the response is expected.
+ *
+ * @retval	HM10_EC_OK	if an ACK or a NAK frame was received.
+ * @retval  HM10_EC_NA  if an invalid frame was received, in which case any remaining received data is discarded.
+ * @retval  HM10_EC_NR  if nothing was received.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+static HM10_Status receive_response(uint8_t *type, uint32_t *offset, uint32_t sent_size);
+
+/**@brief	Discards all the data that is received Over the Air (OTA) until nothing else is received, so that the next
+ *          frame is received from its first byte.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+static void discard_ota_data();
+
+/**@brief	Receives the bytes of a block Over the Air (OTA) in chunks of up to @ref HM10_MAX_PACKET_SIZE bytes.
+ *
+ * @details Each chunk is waited for with the whole timeout of the @ref get_hm10_ota_data function, so that a block
+ *          whose transmission takes longer than that timeout (e.g., a block of 1024 bytes at 9600 baud) is still
+ *          received as long as its bytes keep arriving.
+ *
+ * @param[out] block    Pointer to the Memory Address into which the bytes of the block will be stored.
+ * @param size          Length in bytes of the block.
+ *
+ * @retval	HM10_EC_OK	if the whole block was received.
+ * @retval  HM10_EC_NR  if any of its chunks was not received.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+static HM10_Status receive_block(uint8_t *block, uint16_t size);
+
+/**@brief	Gets the current time of a monotonic clock of our host machine.
+ *
+ * @return  Current time in microseconds.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+static uint64_t get_monotonic_time_us();
+
+HM10_Status send_hm10_ota_file(const char *file_path, const char *checkpoint_path)
+{
+    /** <b>Local variable p_file:</b> Pointer to the memory-mapped data of the file. */
+    uint8_t *p_file;
+    /** <b>Local variable file_size:</b> Size in bytes of the file. */
+    uint32_t file_size;
+    if (map_file(file_path, &p_file, &file_size) != HM10_EC_OK)
+    {
+        #if ETX_OTA_VERBOSE
+            printf("ERROR: The file \"%s\" could not be memory-mapped.\r\n", file_path);
+        #endif
+        return HM10_EC_ERR;
+    }
+    /** <b>Local variable file_crc:</b> CRC32C of the whole file, with which its Checkpoint File is identified. */
+    uint32_t file_crc = calculate_hm10_crc32c(p_file, file_size);
+    /** <b>Local variable offset:</b> Offset up to which the receiver has confirmed the file. */
+    uint32_t offset = load_checkpoint(checkpoint_path, file_size, file_crc);
+    /** <b>Local variable block_size:</b> Length in bytes of the current block. */
+    uint16_t block_size = 0;
+    /** <b>Local variable type:</b> Type of the last received response. */
+    uint8_t type;
+    /** <b>Local variable response_offset:</b> Offset of the last received response. */
+    uint32_t response_offset;
+    /** <b>Local variable retries:</b> Number of consecutive retries without a valid response from the receiver. */
+    uint8_t retries = 0;
+    /** <b>Local variable naks:</b> Number of consecutive NAK frames received from the receiver. */
+    uint8_t naks = 0;
+    /** <b>Local variable is_started:</b> Flag indicating whether the receiver has responded to the START frame (i.e., 1) or not (i.e., 0). */
+    uint8_t is_started = 0;
+    /** <b>Local variable ret:</b> Return value of a @ref HM10_Status function type. */
+    HM10_Status ret = HM10_EC_OK;
+
+    do
+    {
+        if (!is_started)
+        {
+            /* Propose to the receiver to resume the transfer from the confirmed offset. */
+            frame_buffer[0] = HM10_OTA_FILE_START_TYPE;
+            write_u32_le(&frame_buffer[1], file_size);
+            write_u32_le(&frame_buffer[5], file_crc);
+            write_u32_le(&frame_buffer[9], offset);
+            write_u32_le(&frame_buffer[13], calculate_hm10_crc32c(frame_buffer, 13));
+            if (send_hm10_ota_data(frame_buffer, HM10_OTA_FILE_START_SIZE) != HM10_EC_OK)
+            {
+                ret = HM10_EC_ERR;
+                break;
+            }
+        }
+        else
+        {
+            /* Send the next block straight from the memory-mapped data of the file, with a CRC32C that also covers its header. */
+            block_size = ((file_size-offset) > HM10_OTA_FILE_BLOCK_SIZE) ? HM10_OTA_FILE_BLOCK_SIZE : (uint16_t) (file_size-offset);
+            frame_buffer[0] = HM10_OTA_FILE_BLOCK_TYPE;
+            write_u32_le(&frame_buffer[1], offset);
+            frame_buffer[5] = (uint8_t) block_size;
+            frame_buffer[6] = (uint8_t) (block_size >> 8);
+            write_u32_le(&frame_buffer[HM10_OTA_FILE_BLOCK_CRC_OFFSET], update_hm10_crc32c(calculate_hm10_crc32c(frame_buffer, HM10_OTA_FILE_BLOCK_CRC_OFFSET), &p_file[offset], block_size));
+            if ((send_hm10_ota_data(frame_buffer, HM10_OTA_FILE_BLOCK_HEADER_SIZE) != HM10_EC_OK) || (send_hm10_ota_data(&p_file[offset], block_size) != HM10_EC_OK))
+            {
+                ret = HM10_EC_ERR;
+                break;
+            }
+        }
+
+        /* Continue from whatever offset the receiver expects, or retry the last frame if it did not respond. */
+        if ((receive_response(&type, &response_offset, is_started ? (HM10_OTA_FILE_BLOCK_HEADER_SIZE+block_size) : HM10_OTA_FILE_START_SIZE)!=HM10_EC_OK)
+            || (response_offset>file_size))
+        {
+            if (++retries > HM10_OTA_FILE_MAX_RETRIES)
+            {
+                #if ETX_OTA_VERBOSE
+                    printf("ERROR: The receiver stopped responding at the offset %u of the file \"%s\".\r\n", offset, file_path);
+                #endif
+                ret = HM10_EC_NR;
+                break;
+            }
+            continue;
+        }
+        retries = 0;
+        is_started = 1;
+
+        /* Give up if the receiver keeps rejecting the blocks, since they are then most likely being corrupted. */
+        naks = (type == HM10_OTA_FILE_NAK_TYPE) ? naks+1 : 0;
+        if (naks > HM10_OTA_FILE_MAX_RETRIES)
+        {
+            #if ETX_OTA_VERBOSE
+                printf("ERROR: The receiver rejected the block at the offset %u of the file \"%s\" too many times.\r\n", response_offset, file_path);
+            #endif
+            ret = HM10_EC_NA;
+            break;
+        }
+        if ((type==HM10_OTA_FILE_ACK_TYPE) && (response_offset!=offset))
+        {
+            if (save_checkpoint(checkpoint_path, file_size, file_crc, response_offset) != HM10_EC_OK)
+            {
+                ret = HM10_EC_ERR;
+                break;
+            }
+        }
+        offset = response_offset;
+    }
+    while ((!is_started) || (offset<file_size));
+
+    /* Delete the Checkpoint File once the whole file has been confirmed. */
+    if ((ret==HM10_EC_OK) && (checkpoint_path!=NULL))
+    {
+        remove(checkpoint_path);
+    }
+    #if ETX_OTA_VERBOSE
+        if (ret == HM10_EC_OK)
+        {
+            printf("DONE: The file \"%s\" has been successfully sent.\r\n", file_path);
+        }
+    #endif
+    unmap_file(p_file, file_size);
+
+    return ret;
+}
+
+HM10_Status receive_hm10_ota_file(const char *file_path, const char *checkpoint_path)
+{
+    /* Wait for the sender to propose the offset from which the transfer is to be resumed. */
+    if ((get_hm10_ota_data(frame_buffer, HM10_OTA_FILE_START_SIZE)!=HM10_EC_OK) || (frame_buffer[0]!=HM10_OTA_FILE_START_TYPE)
+        || (calculate_hm10_crc32c(frame_buffer, 13)!=read_u32_le(&frame_buffer[13])))
+    {
+        discard_ota_data();
+        return HM10_EC_NR;
+    }
+    /** <b>Local variable file_size:</b> Size in bytes of the file. */
+    uint32_t file_size = read_u32_le(&frame_buffer[1]);
+    /** <b>Local variable file_crc:</b> CRC32C of the whole file, with which its Checkpoint File is identified. */
+    uint32_t file_crc = read_u32_le(&frame_buffer[5]);
+    /** <b>Local variable proposed_offset:</b> Offset from which the sender proposed to resume the transfer. */
+    uint32_t proposed_offset = read_u32_le(&frame_buffer[9]);
+    /** <b>Local variable offset:</b> Offset up to which the file has been received and written. */
+    uint32_t offset = load_checkpoint(checkpoint_path, file_size, file_crc);
+    if (proposed_offset < offset)
+    {
+        offset = proposed_offset;
+    }
+
+    /* Open the file so that it keeps its confirmed bytes if the transfer is resumed, or so that it is emptied otherwise. */
+    /** <b>Local variable p_output:</b> Stream of the file into which the received file is written. */
+    FILE *p_output = NULL;
+    if (offset > 0)
+    {
+        p_output = fopen(file_path, "r+b");
+        if ((p_output==NULL) || (fseek(p_output, 0, SEEK_END)!=0) || (ftell(p_output)<(long) offset))
+        {
+            if (p_output != NULL)
+            {
+                fclose(p_output);
+                p_output = NULL;
+            }
+            offset = 0;
+        }
+    }
+    if (offset == 0)
+    {
+        p_output = fopen(file_path, "w+b");
+        if (p_output == NULL)
+        {
+            #if ETX_OTA_VERBOSE
+                printf("ERROR: The file \"%s\" could not be opened.\r\n", file_path);
+            #endif
+            return HM10_EC_ERR;
+        }
+    }
+    /** <b>Local variable block_offset:</b> Offset of the last received block. */
+    uint32_t block_offset;
+    /** <b>Local variable block_size:</b> Length in bytes of the last received block. */
+    uint16_t block_size;
+    /** <b>Local variable retries:</b> Number of consecutive timeouts without receiving a block. */
+    uint8_t retries = 0;
+    /** <b>Local variable ret:</b> Return value of a @ref HM10_Status function type. */
+    HM10_Status ret = send_response(HM10_OTA_FILE_ACK_TYPE, offset);
+
+    while ((ret==HM10_EC_OK) && (offset<file_size))
+    {
+        /* Receive the next block. */
+        if (get_hm10_ota_data(frame_buffer, HM10_OTA_FILE_BLOCK_HEADER_SIZE) != HM10_EC_OK)
+        {
+            if (++retries > HM10_OTA_FILE_MAX_RETRIES)
+            {
+                ret = HM10_EC_NR;
+            }
+            discard_ota_data();
+            continue;
+        }
+        retries = 0;
+        block_offset = read_u32_le(&frame_buffer[1]);
+        block_size = (uint16_t) (frame_buffer[5] | (frame_buffer[6] << 8));
+        if ((frame_buffer[0]!=HM10_OTA_FILE_BLOCK_TYPE) || (block_size==0) || (block_size>HM10_OTA_FILE_BLOCK_SIZE) || (block_offset>offset)
+            || (receive_block(rx_block, block_size)!=HM10_EC_OK)
+            || (update_hm10_crc32c(calculate_hm10_crc32c(frame_buffer, HM10_OTA_FILE_BLOCK_CRC_OFFSET), rx_block, block_size)!=read_u32_le(&frame_buffer[HM10_OTA_FILE_BLOCK_CRC_OFFSET])))
+        {
+            #if ETX_OTA_VERBOSE
+                printf("WARNING: An invalid block was received at the offset %u and it will be requested again.\r\n", offset);
+            #endif
+            discard_ota_data();
+            ret = send_response(HM10_OTA_FILE_NAK_TYPE, offset);
+            continue;
+        }
+
+        /* Write the block before confirming it, unless it was already confirmed (i.e., the ACK frame was lost). */
+        if (block_offset == offset)
+        {
+            if ((fseek(p_output, (long) offset, SEEK_SET)!=0) || (fwrite(rx_block, 1, block_size, p_output)!=block_size) || (fflush(p_output)!=0))
+            {
+                ret = HM10_EC_ERR;
+                break;
+            }
+            offset += block_size;
+            if (save_checkpoint(checkpoint_path, file_size, file_crc, offset) != HM10_EC_OK)
+            {
+                ret = HM10_EC_ERR;
+                break;
+            }
+        }
+        ret = send_response(HM10_OTA_FILE_ACK_TYPE, offset);
+    }
+    fclose(p_output);
+
+    // NOTE: The Checkpoint File is kept even after the whole file has been received, so that the last block is
+    //       confirmed again, instead of the whole file being transferred again, if the sender retries because
+    //       the final ACK frame was lost.
+    #if ETX_OTA_VERBOSE
+        if (ret == HM10_EC_OK)
+        {
+            printf("DONE: The file \"%s\" has been successfully received.\r\n", file_path);
+        }
+    #endif
+
+    return ret;
+}
+
+static void write_u32_le(uint8_t *dst, uint32_t value)
+{
+    dst[0] = (uint8_t) value;
+    dst[1] = (uint8_t) (value >> 8);
+    dst[2] = (uint8_t) (value >> 16);
+    dst[3] = (uint8_t) (value >> 24);
+}
+
+static uint32_t read_u32_le(uint8_t *src)
+{
+    return (uint32_t) src[0] | ((uint32_t) src[1] << 8) | ((uint32_t) src[2] << 16) | ((uint32_t) src[3] << 24);
+}
+
+static uint32_t load_checkpoint(const char *checkpoint_path, uint32_t file_size, uint32_t file_crc)
+{
+    if (checkpoint_path == NULL)
+    {
+        return 0;
+    }
+    /** <b>Local variable p_checkpoint_file:</b> Stream of the Checkpoint File. */
+    FILE *p_checkpoint_file = fopen(checkpoint_path, "rb");
+    if (p_checkpoint_file == NULL)
+    {
+        return 0;
+    }
+    /** <b>Local variable checkpoint:</b> Content of the Checkpoint File. */
+    HM10_OTA_File_Checkpoint checkpoint;
+    /** <b>Local variable is_read:</b> Flag indicating whether the whole Checkpoint File was read (i.e., 1) or not (i.e., 0). */
+    uint8_t is_read = (fread(&checkpoint, sizeof(HM10_OTA_File_Checkpoint), 1, p_checkpoint_file) == 1);
+    fclose(p_checkpoint_file);
+
+    if ((!is_read) || (checkpoint.magic!=HM10_OTA_FILE_CHECKPOINT_MAGIC) || (checkpoint.version!=HM10_OTA_FILE_CHECKPOINT_VERSION)
+        || (checkpoint.file_size!=file_size) || (checkpoint.file_crc!=file_crc) || (checkpoint.confirmed_offset>file_size))
+    {
+        #if ETX_OTA_VERBOSE
+            printf("The Checkpoint File \"%s\" does not belong to this transfer and it will be ignored.\r\n", checkpoint_path);
+        #endif
+        return 0;
+    }
+    #if ETX_OTA_VERBOSE
+        printf("The transfer will be resumed from the offset %u.\r\n", checkpoint.confirmed_offset);
+    #endif
+
+    return checkpoint.confirmed_offset;
+}
+
+static HM10_Status save_checkpoint(const char *checkpoint_path, uint32_t file_size, uint32_t file_crc, uint32_t confirmed_offset)
+{
+    if (checkpoint_path == NULL)
+    {
+        return HM10_EC_OK;
+    }
+    /** <b>Local variable checkpoint:</b> Content of the Checkpoint File. */
+    HM10_OTA_File_Checkpoint checkpoint;
+    checkpoint.magic = HM10_OTA_FILE_CHECKPOINT_MAGIC;
+    checkpoint.version = HM10_OTA_FILE_CHECKPOINT_VERSION;
+    checkpoint.reserved = 0;
+    checkpoint.file_size = file_size;
+    checkpoint.file_crc = file_crc;
+    checkpoint.confirmed_offset = confirmed_offset;
+
+    /** <b>Local variable tmp_path:</b> Path of the temporary file into which the Checkpoint File is written. */
+    char tmp_path[HM10_OTA_FILE_MAX_PATH_SIZE];
+    /** <b>Local variable tmp_path_size:</b> Length in bytes of the path of the temporary file, without its null terminator. */
+    int tmp_path_size = snprintf(tmp_path, sizeof(tmp_path), "%s.tmp", checkpoint_path);
+    if ((tmp_path_size<0) || (tmp_path_size>=(int) sizeof(tmp_path)))
+    {
+        #if ETX_OTA_VERBOSE
+            printf("ERROR: The path of the Checkpoint File \"%s\" is too long.\r\n", checkpoint_path);
+        #endif
+        return HM10_EC_ERR;
+    }
+
+    /* Write the checkpoint into the temporary file and flush it into the disk. */
+    /** <b>Local variable p_checkpoint_file:</b> Stream of the temporary file. */
+    FILE *p_checkpoint_file = fopen(tmp_path, "wb");
+    if (p_checkpoint_file == NULL)
+    {
+        #if ETX_OTA_VERBOSE
+            printf("ERROR: The Checkpoint File \"%s\" could not be opened.\r\n", tmp_path);
+        #endif
+        return HM10_EC_ERR;
+    }
+    /** <b>Local variable is_written:</b> Flag indicating whether the whole Checkpoint File was written and flushed into the disk (i.e., 1) or not (i.e., 0). */
+    uint8_t is_written = (fwrite(&checkpoint, sizeof(HM10_OTA_File_Checkpoint), 1, p_checkpoint_file) == 1);
+    if (is_written && (fflush(p_checkpoint_file) != 0))
+    {
+        is_written = 0;
+    }
+#if defined(__linux__) || defined(__FreeBSD__)   /* Linux & FreeBSD */
+    if (is_written && (fsync(fileno(p_checkpoint_file)) != 0))
+#else  /* windows */
+    if (is_written && (_commit(_fileno(p_checkpoint_file)) != 0))
+#endif
+    {
+        is_written = 0;
+    }
+    if (fclose(p_checkpoint_file) != 0)
+    {
+        is_written = 0;
+    }
+
+    /* Replace the Checkpoint File with the temporary file in a single step. */
+#if defined(__linux__) || defined(__FreeBSD__)   /* Linux & FreeBSD */
+    if (is_written && (rename(tmp_path, checkpoint_path) != 0))
+#else  /* windows */
+    if (is_written && (!MoveFileExA(tmp_path, checkpoint_path, MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH)))
+#endif
+    {
+        is_written = 0;
+    }
+    if (!is_written)
+    {
+        #if ETX_OTA_VERBOSE
+            printf("ERROR: The Checkpoint File \"%s\" could not be written.\r\n", checkpoint_path);
+        #endif
+        remove(tmp_path);
+        return HM10_EC_ERR;
+    }
+
+    return HM10_EC_OK;
+}
+
+static HM10_Status map_file(const char *file_path, uint8_t **p_data, uint32_t *file_size)
+{
+    *p_data = NULL;
+#if defined(__linux__) || defined(__FreeBSD__)   /* Linux & FreeBSD */
+    /** <b>Local variable file_descriptor:</b> File Descriptor of the file. */
+    int file_descriptor = open(file_path, O_RDONLY);
+    if (file_descriptor < 0)
+    {
+        return HM10_EC_ERR;
+    }
+    /** <b>Local variable file_stats:</b> Holds the status data of the file (e.g., its size). */
+    struct stat file_stats;
+    if ((fstat(file_descriptor, &file_stats)!=0) || ((uint64_t) file_stats.st_size>UINT32_MAX))
+    {
+        close(file_descriptor);
+        return HM10_EC_ERR;
+    }
+    *file_size = (uint32_t) file_stats.st_size;
+    if (*file_size > 0)
+    {
+        /** <b>Local variable p_mapped:</b> Pointer to the memory-mapped data of the file. */
+        void *p_mapped = mmap(NULL, *file_size, PROT_READ, MAP_PRIVATE, file_descriptor, 0);
+        if (p_mapped == MAP_FAILED)
+        {
+            close(file_descriptor);
+            return HM10_EC_ERR;
+        }
+        madvise(p_mapped, *file_size, MADV_SEQUENTIAL);
+        *p_data = (uint8_t *) p_mapped;
+    }
+    // NOTE: The memory-mapped data remains valid after closing its File Descriptor.
+    close(file_descriptor);
+#else  /* windows */
+    /** <b>Local variable file_handle:</b> File Handle of the file. */
+    HANDLE file_handle = CreateFileA(file_path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+    if (file_handle == INVALID_HANDLE_VALUE)
+    {
+        return HM10_EC_ERR;
+    }
+    /** <b>Local variable file_size_high:</b> Most significant 32 bits of the size of the file. */
+    DWORD file_size_high = 0;
+    *file_size = GetFileSize(file_handle, &file_size_high);
+    if ((*file_size==INVALID_FILE_SIZE) || (file_size_high!=0))
+    {
+        CloseHandle(file_handle);
+        return HM10_EC_ERR;
+    }
+    if (*file_size > 0)
+    {
+        /** <b>Local variable file_mapping:</b> File Mapping Handle of the file. */
+        HANDLE file_mapping = CreateFileMappingA(file_handle, NULL, PAGE_READONLY, 0, 0, NULL);
+        if (file_mapping == NULL)
+        {
+            CloseHandle(file_handle);
+            return HM10_EC_ERR;
+        }
+        *p_data = (uint8_t *) MapViewOfFile(file_mapping, FILE_MAP_READ, 0, 0, 0);
+        // NOTE: The memory-mapped data remains valid after closing its File Mapping Handle and its File Handle.
+        CloseHandle(file_mapping);
+        if (*p_data == NULL)
+        {
+            CloseHandle(file_handle);
+            return HM10_EC_ERR;
+        }
+    }
+    CloseHandle(file_handle);
+#endif
+
+    return HM10_EC_OK;
+}
+
+static void unmap_file(uint8_t *p_data, uint32_t file_size)
+{
+    if (p_data == NULL)
+    {
+        return;
+    }
+#if defined(__linux__) || defined(__FreeBSD__)   /* Linux & FreeBSD */
+    munmap(p_data, file_size);
+#else  /* windows */
+    (void) file_size;
+    UnmapViewOfFile(p_data);
+#endif
+}
+
+static HM10_Status send_response(uint8_t type, uint32_t offset)
+{
+    frame_buffer[0] = type;
+    write_u32_le(&frame_buffer[1], offset);
+    write_u32_le(&frame_buffer[5], calculate_hm10_crc32c(frame_buffer, 5));
+
+    return (send_hm10_ota_data(frame_buffer, HM10_OTA_FILE_RESPONSE_SIZE) == HM10_EC_OK) ? HM10_EC_OK : HM10_EC_ERR;
+}
+
+static HM10_Status receive_response(uint8_t *type, uint32_t *offset, uint32_t sent_size)
+{
+    /** <b>Local variable line_deadline:</b> Time in microseconds up to which the frame that was sent could still be going through the line. */
+    uint64_t line_deadline = get_monotonic_time_us() + ((uint64_t) sent_size*1000000)/HM10_OTA_FILE_MIN_RATE;
+    /** <b>Local variable received:</b> Bytes of data received while waiting for the first byte of the response. */
+    uint16_t received;
+    /** <b>Local variable late_polls:</b> Number of timeouts that have elapsed after the line deadline. */
+    uint8_t late_polls = 0;
+    while (get_hm10_ota_available_data(frame_buffer, 1, &received) != HM10_EC_OK)
+    {
+        if ((get_monotonic_time_us()>=line_deadline) && (++late_polls>HM10_OTA_FILE_LATE_POLLS))
+        {
+            return HM10_EC_NR;
+        }
+    }
+    if (get_hm10_ota_data(&frame_buffer[1], HM10_OTA_FILE_RESPONSE_SIZE-1) != HM10_EC_OK)
+    {
+        discard_ota_data();
+        return HM10_EC_NR;
+    }
+    if (((frame_buffer[0]!=HM10_OTA_FILE_ACK_TYPE) && (frame_buffer[0]!=HM10_OTA_FILE_NAK_TYPE)) || (calculate_hm10_crc32c(frame_buffer, 5)!=read_u32_le(&frame_buffer[5])))
+    {
+        discard_ota_data();
+        return HM10_EC_NA;
+    }
+    *type = frame_buffer[0];
+    *offset = read_u32_le(&frame_buffer[1]);
+
+    return HM10_EC_OK;
+}
+
+static void discard_ota_data()
+{
+    /** <b>Local variable discarded_byte:</b> Holds each of the discarded bytes. */
+    uint8_t discarded_byte;
+    while (get_hm10_ota_data(&discarded_byte, 1) == HM10_EC_OK);
+}
+
+static HM10_Status receive_block(uint8_t *block, uint16_t size)
+{
+    /** <b>Local variable chunk_size:</b> Length in bytes of the current chunk. */
+    uint16_t chunk_size;
+    for (uint16_t received=0; received<size; received+=chunk_size)
+    {
+        chunk_size = ((size-received) > HM10_MAX_PACKET_SIZE) ? HM10_MAX_PACKET_SIZE : (uint16_t) (size-received);
+        if (get_hm10_ota_data(&block[received], chunk_size) != HM10_EC_OK)
+        {
+            return HM10_EC_NR;
+        }
+    }
+
+    return HM10_EC_OK;
+}
+
+static uint64_t get_monotonic_time_us()
+{
+    /** <b>Local variable current_time:</b> Current time of the monotonic clock of our host machine. */
+    struct timespec current_time;
+    clock_gettime(CLOCK_MONOTONIC, &current_time);
+
+    return ((uint64_t) current_time.tv_sec)*1000000U + ((uint64_t) current_time.tv_nsec)/1000U;
+}
+
+/** @} */
@@ -0,0 +1,262 @@
+/** @addtogroup hm10_ota_lz
+ * @{
+ */
+
+#include "../Inc/hm10_ota_lz.h"
+#include <string.h>	// Library from which "memset()" and "memcpy()" are located at.
+
+#if (HM10_OTA_LZ_WINDOW_LOG2 > 8)
+#error "HM10_OTA_LZ_WINDOW_LOG2 must not be greater than 8 since the distance of each match is encoded into a single byte."
+#endif
+
+#define HM10_OTA_LZ_WINDOW_MASK         (HM10_OTA_LZ_WINDOW_SIZE - 1)   /**< @brief Bit mask to get the index in the window of a position in the original data. */
+#define HM10_OTA_LZ_HASH_MULTIPLIER     (2654435761U)                   /**< @brief Multiplier of the multiplicative hash used to find the matches (i.e., the 32-bit golden ratio). */
+#define HM10_OTA_LZ_TOKENS_PER_GROUP    (8)                             /**< @brief Number of tokens whose type is indicated by each Flags byte. */
+
+/**@brief	Adds a byte of original data into the window of an HM-10 OTA LZ Compression Context.
+ *
+ * @param[in,out] ctx   Pointer to the context.
+ * @param data          Byte of original data.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+static void push_into_window(HM10_OTA_LZ_Context *ctx, uint8_t data);
+
+/**@brief	Calculates the hash of the next @ref HM10_OTA_LZ_MIN_MATCH bytes of some data.
+ *
+ * @param[in] data  Pointer to the data.
+ *
+ * @return  The hash, which is within 0 and @ref HM10_OTA_LZ_HASH_SIZE minus 1.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+static uint16_t get_hash(uint8_t *data);
+
+void init_hm10_ota_lz_context(HM10_OTA_LZ_Context *ctx, HM10_OTA_LZ_Mode mode)
+{
+    memset(ctx, 0, sizeof(HM10_OTA_LZ_Context));
+    ctx->mode = mode;
+}
+
+HM10_Status compress_hm10_ota_data(HM10_OTA_LZ_Context *ctx, uint8_t *src, uint16_t src_size, uint8_t *dst, uint16_t dst_capacity, uint16_t *dst_size)
+{
+    if (dst_capacity < HM10_OTA_LZ_MAX_COMPRESSED_SIZE(src_size))
+    {
+        return HM10_EC_ERR;
+    }
+    if (ctx->mode == HM10_OTA_LZ_Per_Message)
+    {
+        ctx->history_size = 0;
+    }
+
+    /** <b>Local variable i:</b> Index of the next byte of the \p src param to be compressed. */
+    uint16_t i = 0;
+    /** <b>Local variable out:</b> Length in bytes of the compressed block that has been populated so far. */
+    uint16_t out = HM10_OTA_LZ_HEADER_SIZE;
+    /** <b>Local variable flags_index:</b> Index in the \p dst param of the Flags byte of the current group. */
+    uint16_t flags_index = 0;
+    /** <b>Local variable token:</b> Index of the next token within the current group. */
+    uint8_t token = HM10_OTA_LZ_TOKENS_PER_GROUP;
+    /** <b>Local variable hash:</b> Hash of the next bytes to be compressed. */
+    uint16_t hash;
+    /** <b>Local variable distance:</b> Distance towards the candidate match. */
+    uint16_t distance;
+    /** <b>Local variable match_size:</b> Length in bytes of the candidate match. */
+    uint16_t match_size;
+    /** <b>Local variable max_match_size:</b> Longest length in bytes that the candidate match can have. */
+    uint16_t max_match_size;
+    while (i < src_size)
+    {
+        /* Find the longest match of the next bytes through the hash table, if there is any. */
+        match_size = 0;
+        distance = 0;
+        if ((src_size-i) >= HM10_OTA_LZ_MIN_MATCH)
+        {
+            hash = get_hash(&src[i]);
+            distance = (uint16_t) (ctx->position - ctx->hash_table[hash]);
+            ctx->hash_table[hash] = ctx->position;
+            if ((distance>=1) && (distance<=ctx->history_size))
+            {
+                max_match_size = ((src_size-i) > HM10_OTA_LZ_MAX_MATCH) ? HM10_OTA_LZ_MAX_MATCH : (src_size-i);
+                while ((match_size < max_match_size)
+                       && (src[i+match_size] == ((match_size<distance) ? ctx->window[(uint16_t) (ctx->position+match_size-distance) & HM10_OTA_LZ_WINDOW_MASK] : src[i+match_size-distance])))
+                {
+                    match_size++;
+                }
+            }
+        }
+
+        /* Give up and populate a stored block instead if the compressed body will not be shorter than the original data. */
+        if ((out + (token==HM10_OTA_LZ_TOKENS_PER_GROUP) + ((match_size>=HM10_OTA_LZ_MIN_MATCH) ? 2 : 1)) > src_size)
+        {
+            while (i < src_size)
+            {
+                push_into_window(ctx, src[i++]);
+            }
+            dst[0] = HM10_OTA_LZ_STORED_BLOCK;
+            memcpy(&dst[HM10_OTA_LZ_HEADER_SIZE], src, src_size);
+            *dst_size = HM10_OTA_LZ_HEADER_SIZE + src_size;
+            return HM10_EC_OK;
+        }
+
+        /* Start a new group if the current one is complete. */
+        if (token == HM10_OTA_LZ_TOKENS_PER_GROUP)
+        {
+            flags_index = out++;
+            dst[flags_index] = 0;
+            token = 0;
+        }
+
+        /* Populate either a match or a literal byte. */
+        if (match_size >= HM10_OTA_LZ_MIN_MATCH)
+        {
+            dst[flags_index] |= (uint8_t) (1U << token);
+            dst[out++] = (uint8_t) (distance - 1);
+            dst[out++] = (uint8_t) (match_size - HM10_OTA_LZ_MIN_MATCH);
+            push_into_window(ctx, src[i++]);
+            while (--match_size)
+            {
+                if ((src_size-i) >= HM10_OTA_LZ_MIN_MATCH)
+                {
+                    ctx->hash_table[get_hash(&src[i])] = ctx->position;
+                }
+                push_into_window(ctx, src[i++]);
+            }
+        }
+        else
+        {
+            dst[out++] = src[i];
+            push_into_window(ctx, src[i++]);
+        }
+        token++;
+    }
+    dst[0] = HM10_OTA_LZ_COMPRESSED_BLOCK;
+    *dst_size = out;
+
+    return HM10_EC_OK;
+}
+
+HM10_Status decompress_hm10_ota_data(HM10_OTA_LZ_Context *ctx, uint8_t *src, uint16_t src_size, uint8_t *dst, uint16_t dst_capacity, uint16_t *dst_size)
+{
+    if (src_size < HM10_OTA_LZ_HEADER_SIZE)
+    {
+        return HM10_EC_ERR;
+    }
+    if (ctx->mode == HM10_OTA_LZ_Per_Message)
+    {
+        ctx->history_size = 0;
+    }
+
+    /** <b>Local variable i:</b> Index of the next byte of the \p src param to be decompressed. */
+    uint16_t i = HM10_OTA_LZ_HEADER_SIZE;
+    /** <b>Local variable out:</b> Length in bytes of the decompressed data that has been populated so far. */
+    uint16_t out = 0;
+    switch (src[0])
+    {
+        case HM10_OTA_LZ_STORED_BLOCK:
+            if ((src_size-HM10_OTA_LZ_HEADER_SIZE) > dst_capacity)
+            {
+                return HM10_EC_ERR;
+            }
+            while (i < src_size)
+            {
+                dst[out] = src[i++];
+                push_into_window(ctx, dst[out++]);
+            }
+            break;
+        case HM10_OTA_LZ_COMPRESSED_BLOCK:
+        {
+            /** <b>Local variable flags:</b> Flags byte of the current group. */
+            uint8_t flags;
+            /** <b>Local variable distance:</b> Distance towards the data of the current match. */
+            uint16_t distance;
+            /** <b>Local variable match_size:</b> Length in bytes of the current match. */
+            uint16_t match_size;
+            while (i < src_size)
+            {
+                flags = src[i++];
+                for (uint8_t token=0; (token<HM10_OTA_LZ_TOKENS_PER_GROUP) && (i<src_size); token++)
+                {
+                    if (flags & (1U << token))
+                    {
+                        if ((src_size-i) < 2)
+                        {
+                            return HM10_EC_ERR;
+                        }
+                        distance = src[i++] + 1;
+                        match_size = src[i++] + HM10_OTA_LZ_MIN_MATCH;
+                        if ((distance>ctx->history_size) || ((dst_capacity-out) < match_size))
+                        {
+                            return HM10_EC_ERR;
+                        }
+                        while (match_size--)
+                        {
+                            dst[out] = ctx->window[(uint16_t) (ctx->position-distance) & HM10_OTA_LZ_WINDOW_MASK];
+                            push_into_window(ctx, dst[out++]);
+                        }
+                    }
+                    else
+                    {
+                        if (out >= dst_capacity)
+                        {
+                            return HM10_EC_ERR;
+                        }
+                        dst[out] = src[i++];
+                        push_into_window(ctx, dst[out++]);
+                    }
+                }
+            }
+            break;
+        }
+        default:
+            return HM10_EC_ERR;
+    }
+    *dst_size = out;
+
+    return HM10_EC_OK;
+}
+
+uint8_t get_hm10_ota_lz_capabilities()
+{
+    return (uint8_t) ((HM10_OTA_LZ_WINDOW_LOG2 << HM10_OTA_LZ_CAPABILITY_WINDOW_POS) | HM10_OTA_LZ_CAPABILITY_PER_MESSAGE | HM10_OTA_LZ_CAPABILITY_PER_STREAM);
+}
+
+HM10_OTA_LZ_Mode negotiate_hm10_ota_lz_mode(uint8_t remote_capabilities, HM10_OTA_LZ_Mode desired_mode)
+{
+    if ((remote_capabilities & HM10_OTA_LZ_CAPABILITY_WINDOW_MASK) != (get_hm10_ota_lz_capabilities() & HM10_OTA_LZ_CAPABILITY_WINDOW_MASK))
+    {
+        return HM10_OTA_LZ_Disabled;
+    }
+    if ((desired_mode == HM10_OTA_LZ_Per_Stream) && (remote_capabilities & HM10_OTA_LZ_CAPABILITY_PER_STREAM))
+    {
+        return HM10_OTA_LZ_Per_Stream;
+    }
+    if ((desired_mode != HM10_OTA_LZ_Disabled) && (remote_capabilities & HM10_OTA_LZ_CAPABILITY_PER_MESSAGE))
+    {
+        return HM10_OTA_LZ_Per_Message;
+    }
+
+    return HM10_OTA_LZ_Disabled;
+}
+
+static void push_into_window(HM10_OTA_LZ_Context *ctx, uint8_t data)
+{
+    ctx->window[ctx->position & HM10_OTA_LZ_WINDOW_MASK] = data;
+    ctx->position++;
+    if (ctx->history_size < HM10_OTA_LZ_WINDOW_SIZE)
+    {
+        ctx->history_size++;
+    }
+}
+
+static uint16_t get_hash(uint8_t *data)
+{
+    /** <b>Local variable sequence:</b> The next @ref HM10_OTA_LZ_MIN_MATCH bytes of the data packed into a single value. */
+    uint32_t sequence = ((uint32_t) data[0] << 16) | ((uint32_t) data[1] << 8) | data[2];
+
+    return (uint16_t) ((sequence * HM10_OTA_LZ_HASH_MULTIPLIER) >> (32 - HM10_OTA_LZ_HASH_BITS));
+}
+
+/** @} */
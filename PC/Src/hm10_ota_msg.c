@@ -0,0 +1,500 @@
+/** @addtogroup hm10_ota_msg
+ * @{
+ */
+
+#include "../Inc/hm10_ota_msg.h"
+#include "../Inc/hm10_config.h" // Custom Library for the HM-10 Driver Library.
+#include "../Inc/hm10_crc32c.h" // Custom Mortrack's Library to calculate the CRC32C of the data sent and received Over the Air by the HM-10 Bluetooth Device.
+#include "../Inc/hm10_ota_ccm.h" // Custom Mortrack's Library to encrypt and authenticate the data sent and received Over the Air by the HM-10 Bluetooth Device.
+#include "../Inc/hm10_trace.h" // Custom Mortrack's Library for the trace points of the HM-10 Driver Library.
+#include <stdio.h>	// Library from which "printf" is located at.
+#include <string.h>	// Library from which "memset()" and "memcpy()" are located at.
+
+#if HM10_OTA_MSG_CRC
+#define HM10_OTA_MSG_CRC_SIZE           (HM10_CRC32C_SIZE)  /**< @brief Length in bytes of the CRC32C that is appended to each message. */
+#else
+#define HM10_OTA_MSG_CRC_SIZE           (0)                 /**< @brief Length in bytes of the CRC32C that is appended to each message. */
+#endif
+#define HM10_OTA_MSG_SEQUENCE_SIZE      (4)                 /**< @brief Length in bytes of the sequence number that prefixes each message whenever the encryption stage is enabled. */
+#define HM10_OTA_MSG_AEAD_SIZE          (HM10_OTA_MSG_SEQUENCE_SIZE + HM10_OTA_CCM_TAG_SIZE)  /**< @brief Length in bytes of the overhead of the encryption stage (i.e., the sequence number and the authentication tag). */
+#define HM10_OTA_MSG_MAX_WIRE_SIZE      (HM10_OTA_LZ_MAX_COMPRESSED_SIZE(HM10_OTA_MSG_MAX_SIZE) + HM10_OTA_MSG_AEAD_SIZE + HM10_OTA_MSG_CRC_SIZE)  /**< @brief Length in bytes of the largest message that can be segmented, which considers the overhead of the compression stage, of the encryption stage and of the CRC32C. */
+
+#if (HM10_OTA_MSG_MAX_WIRE_SIZE > 16383)
+#error "HM10_OTA_MSG_MAX_SIZE must be lower than 16383 bytes so that the length of any (compressed) message fits into a 2-byte varint."
+#endif
+
+/**@brief	Reassembly context of the message that is currently being received.
+ */
+typedef struct {
+    uint8_t *arena;         //!< Pointer to the bounded arena into which the message is being reassembled.
+    uint16_t capacity;      //!< Length in bytes of the arena towards which the @ref arena pointer points to.
+    uint16_t expected;      //!< Total length in bytes of the message, as stated in its first segment.
+    uint16_t received;      //!< Bytes of the message that have been reassembled so far.
+    uint8_t in_progress;    //!< Flag indicating whether a message is being reassembled (i.e., 1) or not (i.e., 0).
+} HM10_OTA_Msg_Reassembly;
+
+static uint8_t reassembly_arena[HM10_OTA_MSG_MAX_WIRE_SIZE];                                /**< @brief Bounded arena into which the received segments are reassembled. */
+static HM10_OTA_Msg_Reassembly reassembly = {reassembly_arena, HM10_OTA_MSG_MAX_WIRE_SIZE, 0, 0, 0}; /**< @brief Reassembly context of the message that is currently being received. */
+static uint8_t segment_buffer[HM10_MAX_PACKET_SIZE];                                         /**< @brief Buffer that holds a whole segment (i.e., one HM-10 packet) that is either being sent or received. */
+static HM10_OTA_Msg_Stats msg_stats;                                                         /**< @brief Statistics of the HM-10 OTA Message Layer. */
+static HM10_OTA_LZ_Mode compression_mode = HM10_OTA_LZ_Disabled;                            /**< @brief Current mode of the compression stage. */
+static HM10_OTA_LZ_Context tx_lz_ctx;                                                        /**< @brief Compression context of the messages that are sent. */
+static HM10_OTA_LZ_Context rx_lz_ctx;                                                        /**< @brief Compression context of the messages that are received. */
+static uint8_t compression_buffer[HM10_OTA_MSG_MAX_WIRE_SIZE];                               /**< @brief Buffer into which each message is compressed, encrypted, and its CRC32C appended, before it is segmented. */
+static HM10_OTA_CCM_Context ccm_ctx;                                                         /**< @brief AES-CCM context of the key of the encryption stage. */
+static uint8_t is_encryption_enabled = 0;                                                    /**< @brief Flag indicating whether the encryption stage is enabled (i.e., 1) or not (i.e., 0). */
+static uint8_t tx_direction = 0;                                                             /**< @brief Direction bit of the nonces of the sent messages, whereas the received ones are expected to have the opposite one. */
+static uint32_t tx_sequence = 0;                                                             /**< @brief Sequence number of the next message that will be sent while the encryption stage is enabled. */
+static uint32_t rx_sequence = 0;                                                             /**< @brief Sequence number of the last message that was received and authenticated while the encryption stage is enabled. */
+static uint8_t is_rx_sequence_valid = 0;                                                     /**< @brief Flag indicating whether a message has been authenticated with the current key (i.e., 1) or not (i.e., 0), and therefore whether @ref rx_sequence holds a valid value. */
+
+/**@brief	Receives a single segment Over the Air (OTA) and adds it into the @ref reassembly context.
+ *
+ * @retval	HM10_EC_OK	if a segment was received and it completed a whole message.
+ * @retval  HM10_EC_NA  if a segment was received, but it did not complete a whole message (or if it was dropped).
+ * @retval  HM10_EC_NR  if no segment was received.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+static HM10_Status receive_segment();
+
+/**@brief	Populates the nonce of a message of the encryption stage.
+ *
+ * @details The nonce consists of the direction bit (1 byte) and the sequence number of the message (4 bytes, in little
+ *          endian), followed by zeros. Since each side sends with a different direction bit, both sides can use the
+ *          same key without ever repeating a nonce.
+ *
+ * @param[out] nonce    Pointer to the Memory Address into which the nonce of @ref HM10_OTA_CCM_NONCE_SIZE bytes will be
+ *                      stored.
+ * @param direction     Direction bit of the message.
+ * @param sequence      Sequence number of the message.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+static void set_nonce(uint8_t *nonce, uint8_t direction, uint32_t sequence);
+
+/**@brief	Authenticates and decrypts in place the message that has been reassembled into the @ref reassembly context,
+ *          which is then left without its sequence number and its authentication tag.
+ *
+ * @retval	HM10_EC_OK	if the message was authenticated and decrypted.
+ * @retval  HM10_EC_NA  if the message was dropped because it is too short, because it was replayed or because its
+ *                      authentication tag did not match.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+static HM10_Status decrypt_reassembled_message();
+
+HM10_Status send_hm10_ota_message(uint8_t *msg, uint16_t size)
+{
+    if (size > HM10_OTA_MSG_MAX_SIZE)
+    {
+        #if ETX_OTA_VERBOSE
+            printf("ERROR: The requested message of %d bytes exceeds the maximum size of %d bytes.\r\n", size, HM10_OTA_MSG_MAX_SIZE);
+        #endif
+        return HM10_EC_ERR;
+    }
+
+    /* Compress the message if the compression stage is enabled, leaving room for the sequence number if the encryption stage is enabled. */
+    /** <b>Local variable payload:</b> Pointer to the location of the compression buffer into which the (compressed) message is placed. */
+    uint8_t *payload = &compression_buffer[is_encryption_enabled ? HM10_OTA_MSG_SEQUENCE_SIZE : 0];
+    if (compression_mode != HM10_OTA_LZ_Disabled)
+    {
+        if (compress_hm10_ota_data(&tx_lz_ctx, msg, size, payload, (uint16_t) (sizeof(compression_buffer) - HM10_OTA_MSG_AEAD_SIZE), &size) != HM10_EC_OK)
+        {
+            return HM10_EC_ERR;
+        }
+        msg = payload;
+    }
+
+    /* Encrypt the message in place, prefixed with its sequence number and followed by its authentication tag, if the encryption stage is enabled. */
+    if (is_encryption_enabled)
+    {
+        if (tx_sequence == UINT32_MAX)
+        {
+            #if ETX_OTA_VERBOSE
+                printf("ERROR: The sequence numbers of the current key have been exhausted and a new key must be set.\r\n");
+            #endif
+            return HM10_EC_ERR;
+        }
+        if (msg != payload)
+        {
+            memcpy(payload, msg, size);
+        }
+        /** <b>Local variable nonce:</b> Nonce of the message. */
+        uint8_t nonce[HM10_OTA_CCM_NONCE_SIZE];
+        set_nonce(nonce, tx_direction, tx_sequence);
+        for (uint8_t i=0; i<HM10_OTA_MSG_SEQUENCE_SIZE; i++)
+        {
+            compression_buffer[i] = (uint8_t) (tx_sequence >> (8*i));
+        }
+        encrypt_hm10_ota_ccm(&ccm_ctx, nonce, NULL, 0, payload, size, &payload[size]);
+        tx_sequence++;
+        size += HM10_OTA_MSG_AEAD_SIZE;
+        msg = compression_buffer;
+    }
+
+#if HM10_OTA_MSG_CRC
+    /* Append the CRC32C of the message, in little-endian, so that the receiver can drop it if it gets corrupted. */
+    if (msg != compression_buffer)
+    {
+        memcpy(compression_buffer, msg, size);
+        msg = compression_buffer;
+    }
+    /** <b>Local variable crc:</b> CRC32C of the message. */
+    uint32_t crc = calculate_hm10_crc32c(msg, size);
+    for (uint8_t i=0; i<HM10_OTA_MSG_CRC_SIZE; i++)
+    {
+        msg[size++] = (uint8_t) (crc >> (8*i));
+    }
+#endif
+
+    /** <b>Local variable bytes_sent:</b> Bytes of the message that have been populated into segments so far. */
+    uint16_t bytes_sent = 0;
+    /** <b>Local variable is_first_segment:</b> Flag indicating whether the segment being populated is the first one of the message (i.e., 1) or not (i.e., 0). */
+    uint8_t is_first_segment = 1;
+    do
+    {
+        /** <b>Local variable segment_size:</b> Length in bytes of the segment that is being populated, including its Segment Header. */
+        uint8_t segment_size = HM10_OTA_MSG_SEGMENT_HEADER_SIZE;
+
+        /* Populate the total length of the message as a varint at the start of its first segment. */
+        if (is_first_segment)
+        {
+            if (size < 0x80U)
+            {
+                segment_buffer[segment_size++] = (uint8_t) size;
+            }
+            else
+            {
+                segment_buffer[segment_size++] = (uint8_t) ((size & 0x7FU) | 0x80U);
+                segment_buffer[segment_size++] = (uint8_t) (size >> 7);
+            }
+        }
+
+        /* Populate as much of the remaining message as it fits into the segment. */
+        /** <b>Local variable chunk_size:</b> Bytes of the message that are populated into the current segment. */
+        uint16_t chunk_size = size - bytes_sent;
+        if (chunk_size > (uint16_t) (HM10_MAX_PACKET_SIZE - segment_size))
+        {
+            chunk_size = HM10_MAX_PACKET_SIZE - segment_size;
+        }
+        memcpy(&segment_buffer[segment_size], &msg[bytes_sent], chunk_size);
+        segment_size += chunk_size;
+        bytes_sent += chunk_size;
+
+        /* Populate the Segment Header and send the segment. */
+        segment_buffer[0] = (uint8_t) ((is_first_segment ? HM10_OTA_MSG_START_FLAG : 0) | ((segment_size - HM10_OTA_MSG_SEGMENT_HEADER_SIZE) & HM10_OTA_MSG_LENGTH_MASK));
+        if (send_hm10_ota_data(segment_buffer, segment_size) != HM10_EC_OK)
+        {
+            #if ETX_OTA_VERBOSE
+                printf("ERROR: A segment of the requested message could not be sent.\r\n");
+            #endif
+            return HM10_EC_ERR;
+        }
+        msg_stats.segments_sent++;
+        is_first_segment = 0;
+    }
+    while (bytes_sent < size);
+    msg_stats.messages_sent++;
+
+    return HM10_EC_OK;
+}
+
+HM10_Status get_hm10_ota_message(uint8_t *msg, uint16_t max_size, uint16_t *size)
+{
+    /** <b>Local variable ret:</b> Return value of a @ref HM10_Status function type. */
+    HM10_Status ret;
+
+    /* Receive segments until a whole message is reassembled or until no more segments arrive. */
+    do
+    {
+        ret = receive_segment();
+    }
+    while (ret == HM10_EC_NA);
+    if (ret != HM10_EC_OK)
+    {
+        return ret;
+    }
+
+    /* Pass the reassembled message into the \p msg param, decompressing it if the compression stage is enabled. */
+    reassembly.in_progress = 0;
+    if (compression_mode != HM10_OTA_LZ_Disabled)
+    {
+        if (decompress_hm10_ota_data(&rx_lz_ctx, reassembly.arena, reassembly.received, msg, max_size, size) != HM10_EC_OK)
+        {
+            #if ETX_OTA_VERBOSE
+                printf("ERROR: A message of %d bytes was received, but it could not be decompressed into the given buffer.\r\n", reassembly.received);
+            #endif
+            msg_stats.messages_dropped++;
+            return HM10_EC_ERR;
+        }
+        HM10_TRACE_POINT(HM10_Trace_Parse_Done, HM10_TRACE_TAG_OTA_MESSAGE);
+        msg_stats.messages_received++;
+        return HM10_EC_OK;
+    }
+    if (reassembly.received > max_size)
+    {
+        #if ETX_OTA_VERBOSE
+            printf("ERROR: A message of %d bytes was received, but the given buffer can only hold %d bytes.\r\n", reassembly.received, max_size);
+        #endif
+        msg_stats.messages_dropped++;
+        return HM10_EC_ERR;
+    }
+    memcpy(msg, reassembly.arena, reassembly.received);
+    *size = reassembly.received;
+    HM10_TRACE_POINT(HM10_Trace_Parse_Done, HM10_TRACE_TAG_OTA_MESSAGE);
+    msg_stats.messages_received++;
+
+    return HM10_EC_OK;
+}
+
+void reset_hm10_ota_message_layer()
+{
+    reassembly.in_progress = 0;
+    reassembly.expected = 0;
+    reassembly.received = 0;
+    init_hm10_ota_lz_context(&tx_lz_ctx, compression_mode);
+    init_hm10_ota_lz_context(&rx_lz_ctx, compression_mode);
+}
+
+HM10_Status set_hm10_ota_message_encryption(uint8_t *key, uint8_t direction)
+{
+    if (direction > 1)
+    {
+        return HM10_EC_ERR;
+    }
+
+    /* Replace the key and restart the sequence numbers, which is safe only because the key is a new one. */
+    if (key == NULL)
+    {
+        clear_hm10_ota_ccm_context(&ccm_ctx);
+        is_encryption_enabled = 0;
+    }
+    else
+    {
+        init_hm10_ota_ccm_context(&ccm_ctx, key);
+        is_encryption_enabled = 1;
+    }
+    tx_direction = direction;
+    tx_sequence = 0;
+    rx_sequence = 0;
+    is_rx_sequence_valid = 0;
+
+    return HM10_EC_OK;
+}
+
+HM10_Status set_hm10_ota_message_compression(HM10_OTA_LZ_Mode mode)
+{
+    /* Refuse the modes whose window is kept between messages, since any dropped message would desynchronize both sides. */
+    if ((mode!=HM10_OTA_LZ_Disabled) && (mode!=HM10_OTA_LZ_Per_Message))
+    {
+        #if ETX_OTA_VERBOSE
+            printf("ERROR: The compression mode %d is not supported by the Message Layer.\r\n", mode);
+        #endif
+        return HM10_EC_ERR;
+    }
+
+    compression_mode = mode;
+    init_hm10_ota_lz_context(&tx_lz_ctx, compression_mode);
+    init_hm10_ota_lz_context(&rx_lz_ctx, compression_mode);
+
+    return HM10_EC_OK;
+}
+
+void get_hm10_ota_message_stats(HM10_OTA_Msg_Stats *stats)
+{
+    memcpy(stats, &msg_stats, sizeof(HM10_OTA_Msg_Stats));
+}
+
+static HM10_Status receive_segment()
+{
+    /* Receive the Segment Header and then the exact length of payload that it states. */
+    if (get_hm10_ota_data(segment_buffer, HM10_OTA_MSG_SEGMENT_HEADER_SIZE) != HM10_EC_OK)
+    {
+        return HM10_EC_NR;
+    }
+    /** <b>Local variable payload_size:</b> Length in bytes of the payload of the received segment. */
+    uint8_t payload_size = segment_buffer[0] & HM10_OTA_MSG_LENGTH_MASK;
+    if ((payload_size==0) || (payload_size>HM10_OTA_MSG_MAX_SEGMENT_PAYLOAD_SIZE) || ((segment_buffer[0]&HM10_OTA_MSG_RESERVED_MASK)!=0))
+    {
+        #if ETX_OTA_VERBOSE
+            printf("WARNING: An invalid Segment Header (0x%02X) was received and it will be dropped.\r\n", segment_buffer[0]);
+        #endif
+        msg_stats.segments_dropped++;
+        return HM10_EC_NA;
+    }
+    /** <b>Local variable payload:</b> Pointer to the payload of the received segment. */
+    uint8_t *payload = &segment_buffer[HM10_OTA_MSG_SEGMENT_HEADER_SIZE];
+    if (get_hm10_ota_data(payload, payload_size) != HM10_EC_OK)
+    {
+        msg_stats.segments_dropped++;
+        return HM10_EC_NR;
+    }
+    msg_stats.segments_received++;
+
+    /* Start a new reassembly if this is the first segment of a message. */
+    if (segment_buffer[0] & HM10_OTA_MSG_START_FLAG)
+    {
+        if (reassembly.in_progress)
+        {
+            #if ETX_OTA_VERBOSE
+                printf("WARNING: A new message started before the previous one was completed, which will be dropped.\r\n");
+            #endif
+            msg_stats.messages_dropped++;
+        }
+
+        /* Decode the total length of the message from its varint. */
+        /** <b>Local variable prefix_size:</b> Length in bytes of the varint that prefixes the message. */
+        uint8_t prefix_size = 1;
+        reassembly.expected = payload[0] & 0x7FU;
+        if (payload[0] & 0x80U)
+        {
+            if (payload_size < HM10_OTA_MSG_MAX_LENGTH_PREFIX_SIZE)
+            {
+                msg_stats.segments_dropped++;
+                reassembly.in_progress = 0;
+                return HM10_EC_NA;
+            }
+            reassembly.expected |= (uint16_t) payload[1] << 7;
+            prefix_size = HM10_OTA_MSG_MAX_LENGTH_PREFIX_SIZE;
+        }
+        if (reassembly.expected > reassembly.capacity)
+        {
+            #if ETX_OTA_VERBOSE
+                printf("WARNING: A message of %d bytes was announced, but it exceeds the arena of %d bytes and it will be dropped.\r\n", reassembly.expected, reassembly.capacity);
+            #endif
+            msg_stats.messages_dropped++;
+            reassembly.in_progress = 0;
+            return HM10_EC_NA;
+        }
+        reassembly.received = 0;
+        reassembly.in_progress = 1;
+        payload += prefix_size;
+        payload_size -= prefix_size;
+    }
+    else if (!reassembly.in_progress)
+    {
+        #if ETX_OTA_VERBOSE
+            printf("WARNING: A continuation segment was received without a previous Start segment and it will be dropped.\r\n");
+        #endif
+        msg_stats.segments_dropped++;
+        return HM10_EC_NA;
+    }
+
+    /* Append the payload into the arena. */
+    if ((uint16_t) (reassembly.received + payload_size) > reassembly.expected)
+    {
+        #if ETX_OTA_VERBOSE
+            printf("WARNING: A segment exceeded the announced length of its message, which will be dropped.\r\n");
+        #endif
+        msg_stats.messages_dropped++;
+        reassembly.in_progress = 0;
+        return HM10_EC_NA;
+    }
+    memcpy(&reassembly.arena[reassembly.received], payload, payload_size);
+    reassembly.received += payload_size;
+    if (reassembly.received != reassembly.expected)
+    {
+        return HM10_EC_NA;
+    }
+
+#if HM10_OTA_MSG_CRC
+    /* Drop the whole message if its CRC32C does not match, before it reaches the application. */
+    /** <b>Local variable crc:</b> CRC32C that was received at the end of the message. */
+    uint32_t crc = 0;
+    if (reassembly.received >= HM10_OTA_MSG_CRC_SIZE)
+    {
+        reassembly.received -= HM10_OTA_MSG_CRC_SIZE;
+        for (uint8_t i=0; i<HM10_OTA_MSG_CRC_SIZE; i++)
+        {
+            crc |= (uint32_t) reassembly.arena[reassembly.received + i] << (8*i);
+        }
+    }
+    if ((reassembly.expected < HM10_OTA_MSG_CRC_SIZE) || (crc != calculate_hm10_crc32c(reassembly.arena, reassembly.received)))
+    {
+        #if ETX_OTA_VERBOSE
+            printf("WARNING: A message with an invalid CRC32C was received and it will be dropped.\r\n");
+        #endif
+        msg_stats.crc_errors++;
+        msg_stats.messages_dropped++;
+        reassembly.in_progress = 0;
+        return HM10_EC_NA;
+    }
+#endif
+
+    if (is_encryption_enabled)
+    {
+        return decrypt_reassembled_message();
+    }
+
+    return HM10_EC_OK;
+}
+
+static void set_nonce(uint8_t *nonce, uint8_t direction, uint32_t sequence)
+{
+    memset(nonce, 0, HM10_OTA_CCM_NONCE_SIZE);
+    nonce[0] = direction;
+    for (uint8_t i=0; i<HM10_OTA_MSG_SEQUENCE_SIZE; i++)
+    {
+        nonce[1 + i] = (uint8_t) (sequence >> (8*i));
+    }
+}
+
+static HM10_Status decrypt_reassembled_message()
+{
+    /** <b>Local variable sequence:</b> Sequence number that was received at the start of the message. */
+    uint32_t sequence = 0;
+    /** <b>Local variable nonce:</b> Nonce of the message. */
+    uint8_t nonce[HM10_OTA_CCM_NONCE_SIZE];
+    /** <b>Local variable size:</b> Length in bytes of the ciphertext of the message. */
+    uint16_t size;
+
+    /* Drop the message if it is too short or if its sequence number is not newer than the last authenticated one (i.e., a replayed message). */
+    reassembly.in_progress = 0;
+    if (reassembly.received < HM10_OTA_MSG_AEAD_SIZE)
+    {
+        #if ETX_OTA_VERBOSE
+            printf("WARNING: A message that is too short to be authenticated was received and it will be dropped.\r\n");
+        #endif
+        msg_stats.auth_errors++;
+        msg_stats.messages_dropped++;
+        return HM10_EC_NA;
+    }
+    for (uint8_t i=0; i<HM10_OTA_MSG_SEQUENCE_SIZE; i++)
+    {
+        sequence |= (uint32_t) reassembly.arena[i] << (8*i);
+    }
+    if (is_rx_sequence_valid && (sequence <= rx_sequence))
+    {
+        #if ETX_OTA_VERBOSE
+            printf("WARNING: A message with the already used sequence number %u was received and it will be dropped.\r\n", (unsigned int) sequence);
+        #endif
+        msg_stats.auth_errors++;
+        msg_stats.messages_dropped++;
+        return HM10_EC_NA;
+    }
+
+    /* Authenticate and decrypt the message in place, and then move it to the start of the arena. */
+    size = reassembly.received - HM10_OTA_MSG_AEAD_SIZE;
+    set_nonce(nonce, !tx_direction, sequence);
+    if (decrypt_hm10_ota_ccm(&ccm_ctx, nonce, NULL, 0, &reassembly.arena[HM10_OTA_MSG_SEQUENCE_SIZE], size, &reassembly.arena[HM10_OTA_MSG_SEQUENCE_SIZE + size]) != HM10_EC_OK)
+    {
+        #if ETX_OTA_VERBOSE
+            printf("WARNING: A message whose authentication tag does not match was received and it will be dropped.\r\n");
+        #endif
+        msg_stats.auth_errors++;
+        msg_stats.messages_dropped++;
+        return HM10_EC_NA;
+    }
+    rx_sequence = sequence;
+    is_rx_sequence_valid = 1;
+    memmove(reassembly.arena, &reassembly.arena[HM10_OTA_MSG_SEQUENCE_SIZE], size);
+    reassembly.received = size;
+
+    return HM10_EC_OK;
+}
+
+/** @} */
@@ -0,0 +1,565 @@
+/** @addtogroup hm10_ota_mux
+ * @{
+ */
+
+#include "../Inc/hm10_ota_mux.h"
+#include "../Inc/hm10_config.h" // This is the Mortrack's HM-10 library configuration file.
+#include "../Inc/hm10_crc32c.h" // Custom Mortrack's Library to calculate the CRC32C of the data sent and received Over the Air by the HM-10 Bluetooth Device.
+#include <stdio.h>	// Library from which "printf" is located at.
+#include <string.h>	// Library from which "memset()" and "memcpy()" are located at.
+
+#define HM10_OTA_MUX_QUEUE_MASK         (HM10_OTA_MUX_QUEUE_SIZE - 1U)     /**< @brief Bit mask with which a position of a queue is wrapped into an index. */
+#define HM10_OTA_MUX_ENTRY_HEADER_SIZE  (2U)                               /**< @brief Length in bytes of the length that precedes each message in a queue. */
+#if HM10_OTA_MSG_CRC
+#define HM10_OTA_MUX_CRC_SIZE           (HM10_CRC32C_SIZE)                 /**< @brief Length in bytes of the CRC32C that is appended to each message. */
+#else
+#define HM10_OTA_MUX_CRC_SIZE           (0)                                /**< @brief Length in bytes of the CRC32C that is appended to each message. */
+#endif
+#define HM10_OTA_MUX_MAX_MESSAGE_SIZE   (((HM10_OTA_MUX_QUEUE_SIZE - HM10_OTA_MUX_ENTRY_HEADER_SIZE) < 16383U ? (HM10_OTA_MUX_QUEUE_SIZE - HM10_OTA_MUX_ENTRY_HEADER_SIZE) : 16383U) - HM10_OTA_MUX_CRC_SIZE) /**< @brief Length in bytes of the largest message, which must fit into a queue along with its CRC32C and whose length, including its CRC32C, must fit into a 2-byte varint. */
+
+#if (HM10_OTA_MUX_QUEUE_SIZE & HM10_OTA_MUX_QUEUE_MASK) != 0
+#error "HM10_OTA_MUX_QUEUE_SIZE must be a power of 2."
+#endif
+
+/**@brief	Queue of messages, where each message is stored as its length, in 2 bytes and in little endian, followed
+ *          by its data. In the TX queues, the stored length and data of each message include its CRC32C whenever @ref
+ *          HM10_OTA_MSG_CRC is enabled.
+ */
+typedef struct {
+    uint8_t data[HM10_OTA_MUX_QUEUE_SIZE];  //!< Ring buffer that holds the queued messages.
+    uint32_t head;                          //!< Position at which the next message will be stored.
+    uint32_t tail;                          //!< Position at which the oldest message is stored.
+} HM10_OTA_Mux_Queue;
+
+/**@brief	Reassembly context of the message that is currently being received on a channel.
+ */
+typedef struct {
+    uint16_t expected;      //!< Total length in bytes of the message, including its CRC32C, as stated in its first segment.
+    uint16_t received;      //!< Bytes of the message that have been reassembled so far.
+    uint8_t in_progress;    //!< Flag indicating whether a message is being reassembled (i.e., 1) or not (i.e., 0).
+} HM10_OTA_Mux_Reassembly;
+
+static HM10_OTA_Mux_Queue tx_queues[HM10_OTA_MUX_CHANNELS];             /**< @brief TX queue of each channel. */
+static HM10_OTA_Mux_Queue rx_queues[HM10_OTA_MUX_CHANNELS];             /**< @brief RX queue of each channel, into which the received segments are directly reassembled. */
+static HM10_OTA_Mux_Reassembly reassembly[HM10_OTA_MUX_CHANNELS];       /**< @brief Reassembly context of each channel. */
+static uint16_t tx_offsets[HM10_OTA_MUX_CHANNELS];                      /**< @brief Bytes of the oldest message of each TX queue that have already been sent. */
+static uint8_t weights[HM10_OTA_MUX_CHANNELS];                          /**< @brief Number of segments that each channel can send per turn with the @ref HM10_OTA_Mux_Weighted_Fair scheduling policy. */
+static uint16_t deficits[HM10_OTA_MUX_CHANNELS];                        /**< @brief Number of segments that each channel can still send in its current turn with the @ref HM10_OTA_Mux_Weighted_Fair scheduling policy. */
+static uint8_t current_channel = 0;                                     /**< @brief Channel whose turn it is with the @ref HM10_OTA_Mux_Weighted_Fair scheduling policy. */
+static HM10_OTA_Mux_Scheduling scheduling_policy = HM10_OTA_Mux_Strict_Priority; /**< @brief Scheduling policy with which the channel of each sent segment is chosen. */
+static uint8_t segment_buffer[HM10_MAX_PACKET_SIZE];                    /**< @brief Buffer that holds a whole segment (i.e., one HM-10 packet) that is either being sent or received. */
+static HM10_OTA_Mux_Stats mux_stats;                                    /**< @brief Statistics of the HM-10 OTA Channel Multiplexer. */
+
+/**@brief	Copies some data into a queue, at a certain position and wrapping around its ring buffer if needed.
+ *
+ * @param[in,out] queue Pointer to the queue.
+ * @param position      Position of the queue at which the data is desired to be stored.
+ * @param[in] src       Pointer to the data.
+ * @param size          Length in bytes of the data towards which the \p src param points to.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+static void write_into_queue(HM10_OTA_Mux_Queue *queue, uint32_t position, uint8_t *src, uint16_t size);
+
+/**@brief	Copies some data out of a queue, from a certain position and wrapping around its ring buffer if needed.
+ *
+ * @param[in] queue     Pointer to the queue.
+ * @param position      Position of the queue from which the data is desired to be copied.
+ * @param[out] dst      Pointer to the Memory Address into which the data will be stored.
+ * @param size          Length in bytes of the data that is desired to be copied.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+static void read_from_queue(HM10_OTA_Mux_Queue *queue, uint32_t position, uint8_t *dst, uint16_t size);
+
+#if HM10_OTA_MSG_CRC
+/**@brief	Calculates the CRC32C of some data of a queue, from a certain position and wrapping around its ring buffer
+ *          if needed.
+ *
+ * @param[in] queue     Pointer to the queue.
+ * @param position      Position of the queue at which the data starts.
+ * @param size          Length in bytes of the data.
+ *
+ * @return  The CRC32C of the data.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+static uint32_t calculate_queue_crc32c(HM10_OTA_Mux_Queue *queue, uint32_t position, uint16_t size);
+#endif
+
+/**@brief	Gets the length of the oldest message of a queue.
+ *
+ * @param[in] queue     Pointer to the queue, which must not be empty.
+ *
+ * @return  Length in bytes of the oldest message.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+static uint16_t get_oldest_message_size(HM10_OTA_Mux_Queue *queue);
+
+/**@brief	Chooses the channel of the next segment to be sent according to the scheduling policy.
+ *
+ * @return  The Channel ID of the chosen channel or, if there are no queued messages, @ref HM10_OTA_MUX_CHANNELS .
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+static uint8_t choose_channel();
+
+/**@brief	Sends the next segment of the oldest message of the TX queue of a channel.
+ *
+ * @param channel   Channel ID of the channel.
+ *
+ * @retval	HM10_EC_OK	if the segment was successfully sent.
+ * @retval  HM10_EC_ERR otherwise.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+static HM10_Status send_segment(uint8_t channel);
+
+/**@brief	Receives a single segment Over the Air (OTA) and reassembles it into the RX queue of its channel.
+ *
+ * @details A message that is not received completely is dropped, and the reassembly of its channel resumes at the
+ *          next Start segment of that channel. Whenever @ref HM10_OTA_MSG_CRC is enabled, the messages whose CRC32C
+ *          does not match are also dropped before they are committed into their RX queue, which catches both the
+ *          corrupted segments and the segments that were dispatched into the wrong channel by a corrupted Channel ID.
+ *
+ * @retval	HM10_EC_OK	if a segment was received (even if it was dropped).
+ * @retval  HM10_EC_NR  if no segment was received.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+static HM10_Status receive_segment();
+
+void init_hm10_ota_mux(HM10_OTA_Mux_Scheduling scheduling)
+{
+    for (uint8_t channel=0; channel<HM10_OTA_MUX_CHANNELS; channel++)
+    {
+        tx_queues[channel].head = 0;
+        tx_queues[channel].tail = 0;
+        rx_queues[channel].head = 0;
+        rx_queues[channel].tail = 0;
+        reassembly[channel].in_progress = 0;
+        tx_offsets[channel] = 0;
+        weights[channel] = 1;
+        deficits[channel] = 0;
+    }
+    current_channel = 0;
+    scheduling_policy = scheduling;
+    memset(&mux_stats, 0, sizeof(HM10_OTA_Mux_Stats));
+}
+
+HM10_Status set_hm10_ota_mux_weight(uint8_t channel, uint8_t weight)
+{
+    if ((channel>=HM10_OTA_MUX_CHANNELS) || (weight==0))
+    {
+        return HM10_EC_ERR;
+    }
+    weights[channel] = weight;
+
+    return HM10_EC_OK;
+}
+
+HM10_Status enqueue_hm10_ota_mux_message(uint8_t channel, uint8_t *msg, uint16_t size)
+{
+    if ((channel>=HM10_OTA_MUX_CHANNELS) || (size>HM10_OTA_MUX_MAX_MESSAGE_SIZE))
+    {
+        return HM10_EC_ERR;
+    }
+    /** <b>Local variable queue:</b> Pointer to the TX queue of the requested channel. */
+    HM10_OTA_Mux_Queue *queue = &tx_queues[channel];
+    /** <b>Local variable wire_size:</b> Length in bytes of the message along with its CRC32C. */
+    uint16_t wire_size = size + HM10_OTA_MUX_CRC_SIZE;
+    if ((HM10_OTA_MUX_QUEUE_SIZE - (queue->head-queue->tail)) < (uint32_t) (HM10_OTA_MUX_ENTRY_HEADER_SIZE+wire_size))
+    {
+        return HM10_EC_NA;
+    }
+
+    /** <b>Local variable entry_header:</b> Length of the message, including its CRC32C, in little endian. */
+    uint8_t entry_header[HM10_OTA_MUX_ENTRY_HEADER_SIZE] = {(uint8_t) wire_size, (uint8_t) (wire_size >> 8)};
+    write_into_queue(queue, queue->head, entry_header, HM10_OTA_MUX_ENTRY_HEADER_SIZE);
+    write_into_queue(queue, queue->head+HM10_OTA_MUX_ENTRY_HEADER_SIZE, msg, size);
+#if HM10_OTA_MSG_CRC
+    /* Append the CRC32C of the message, in little-endian, as the @ref hm10_ota_msg does. */
+    /** <b>Local variable crc:</b> CRC32C of the message. */
+    uint32_t crc = calculate_hm10_crc32c(msg, size);
+    /** <b>Local variable crc_bytes:</b> CRC32C of the message in little endian. */
+    uint8_t crc_bytes[HM10_OTA_MUX_CRC_SIZE];
+    for (uint8_t i=0; i<HM10_OTA_MUX_CRC_SIZE; i++)
+    {
+        crc_bytes[i] = (uint8_t) (crc >> (8*i));
+    }
+    write_into_queue(queue, queue->head+HM10_OTA_MUX_ENTRY_HEADER_SIZE+size, crc_bytes, HM10_OTA_MUX_CRC_SIZE);
+#endif
+    queue->head += HM10_OTA_MUX_ENTRY_HEADER_SIZE + wire_size;
+
+    return HM10_EC_OK;
+}
+
+HM10_Status send_hm10_ota_mux_segments(uint16_t max_segments)
+{
+    /** <b>Local variable channel:</b> Channel ID of the channel whose segment is sent next. */
+    uint8_t channel;
+    /** <b>Local variable segments_sent:</b> Number of segments that have been sent in this call. */
+    uint16_t segments_sent = 0;
+
+    while (segments_sent < max_segments)
+    {
+        channel = choose_channel();
+        if (channel == HM10_OTA_MUX_CHANNELS)
+        {
+            break;
+        }
+        if (send_segment(channel) != HM10_EC_OK)
+        {
+            return HM10_EC_ERR;
+        }
+        segments_sent++;
+    }
+
+    return (segments_sent > 0) ? HM10_EC_OK : HM10_EC_NA;
+}
+
+HM10_Status get_hm10_ota_mux_message(uint8_t channel, uint8_t *msg, uint16_t max_size, uint16_t *size)
+{
+    if (channel >= HM10_OTA_MUX_CHANNELS)
+    {
+        return HM10_EC_ERR;
+    }
+    /** <b>Local variable queue:</b> Pointer to the RX queue of the requested channel. */
+    HM10_OTA_Mux_Queue *queue = &rx_queues[channel];
+
+    /* Receive and dispatch segments until the RX queue of the requested channel has a whole message. */
+    while (queue->head == queue->tail)
+    {
+        if (receive_segment() == HM10_EC_NR)
+        {
+            return HM10_EC_NR;
+        }
+    }
+
+    /** <b>Local variable msg_size:</b> Length in bytes of the oldest message of the RX queue. */
+    uint16_t msg_size = get_oldest_message_size(queue);
+    if (msg_size > max_size)
+    {
+        #if ETX_OTA_VERBOSE
+            printf("WARNING: A message of %d bytes was received, but it exceeds the given buffer of %d bytes and it will be dropped.\r\n", msg_size, max_size);
+        #endif
+        queue->tail += HM10_OTA_MUX_ENTRY_HEADER_SIZE + msg_size;
+        mux_stats.messages_dropped++;
+        return HM10_EC_ERR;
+    }
+    read_from_queue(queue, queue->tail+HM10_OTA_MUX_ENTRY_HEADER_SIZE, msg, msg_size);
+    queue->tail += HM10_OTA_MUX_ENTRY_HEADER_SIZE + msg_size;
+    *size = msg_size;
+
+    return HM10_EC_OK;
+}
+
+void get_hm10_ota_mux_stats(HM10_OTA_Mux_Stats *stats)
+{
+    memcpy(stats, &mux_stats, sizeof(HM10_OTA_Mux_Stats));
+}
+
+static void write_into_queue(HM10_OTA_Mux_Queue *queue, uint32_t position, uint8_t *src, uint16_t size)
+{
+    /** <b>Local variable index:</b> Index of the ring buffer at which the data starts. */
+    uint32_t index = position & HM10_OTA_MUX_QUEUE_MASK;
+    /** <b>Local variable contiguous_size:</b> Bytes of the data that fit before wrapping around the ring buffer. */
+    uint32_t contiguous_size = HM10_OTA_MUX_QUEUE_SIZE - index;
+
+    if (contiguous_size >= size)
+    {
+        memcpy(&queue->data[index], src, size);
+    }
+    else
+    {
+        memcpy(&queue->data[index], src, contiguous_size);
+        memcpy(queue->data, &src[contiguous_size], size-contiguous_size);
+    }
+}
+
+static void read_from_queue(HM10_OTA_Mux_Queue *queue, uint32_t position, uint8_t *dst, uint16_t size)
+{
+    /** <b>Local variable index:</b> Index of the ring buffer at which the data starts. */
+    uint32_t index = position & HM10_OTA_MUX_QUEUE_MASK;
+    /** <b>Local variable contiguous_size:</b> Bytes of the data that are stored before wrapping around the ring buffer. */
+    uint32_t contiguous_size = HM10_OTA_MUX_QUEUE_SIZE - index;
+
+    if (contiguous_size >= size)
+    {
+        memcpy(dst, &queue->data[index], size);
+    }
+    else
+    {
+        memcpy(dst, &queue->data[index], contiguous_size);
+        memcpy(&dst[contiguous_size], queue->data, size-contiguous_size);
+    }
+}
+
+#if HM10_OTA_MSG_CRC
+static uint32_t calculate_queue_crc32c(HM10_OTA_Mux_Queue *queue, uint32_t position, uint16_t size)
+{
+    /** <b>Local variable index:</b> Index of the ring buffer at which the data starts. */
+    uint32_t index = position & HM10_OTA_MUX_QUEUE_MASK;
+    /** <b>Local variable contiguous_size:</b> Bytes of the data that are stored before wrapping around the ring buffer. */
+    uint32_t contiguous_size = HM10_OTA_MUX_QUEUE_SIZE - index;
+
+    if (contiguous_size >= size)
+    {
+        return calculate_hm10_crc32c(&queue->data[index], size);
+    }
+
+    return update_hm10_crc32c(calculate_hm10_crc32c(&queue->data[index], contiguous_size), queue->data, size-contiguous_size);
+}
+#endif
+
+static uint16_t get_oldest_message_size(HM10_OTA_Mux_Queue *queue)
+{
+    /** <b>Local variable entry_header:</b> Length of the message in little endian. */
+    uint8_t entry_header[HM10_OTA_MUX_ENTRY_HEADER_SIZE];
+    read_from_queue(queue, queue->tail, entry_header, HM10_OTA_MUX_ENTRY_HEADER_SIZE);
+
+    return (uint16_t) (entry_header[0] | (entry_header[1] << 8));
+}
+
+static uint8_t choose_channel()
+{
+    /** <b>Local variable channel:</b> Channel ID of the channel that is being considered. */
+    uint8_t channel;
+
+    if (scheduling_policy == HM10_OTA_Mux_Strict_Priority)
+    {
+        for (channel=0; channel<HM10_OTA_MUX_CHANNELS; channel++)
+        {
+            if (tx_queues[channel].head != tx_queues[channel].tail)
+            {
+                break;
+            }
+        }
+        return channel;
+    }
+
+    /* Apply a Deficit Round Robin, where each channel gets as many segments as its weight on each of its turns. */
+    for (channel=0; channel<HM10_OTA_MUX_CHANNELS; channel++)
+    {
+        if (tx_queues[channel].head != tx_queues[channel].tail)
+        {
+            break;
+        }
+    }
+    if (channel == HM10_OTA_MUX_CHANNELS)
+    {
+        return HM10_OTA_MUX_CHANNELS;
+    }
+    while ((tx_queues[current_channel].head==tx_queues[current_channel].tail) || (deficits[current_channel]==0))
+    {
+        if (tx_queues[current_channel].head == tx_queues[current_channel].tail)
+        {
+            deficits[current_channel] = 0;
+        }
+        current_channel = (current_channel + 1) % HM10_OTA_MUX_CHANNELS;
+        if (tx_queues[current_channel].head != tx_queues[current_channel].tail)
+        {
+            deficits[current_channel] += weights[current_channel];
+        }
+    }
+    deficits[current_channel]--;
+
+    return current_channel;
+}
+
+static HM10_Status send_segment(uint8_t channel)
+{
+    /** <b>Local variable queue:</b> Pointer to the TX queue of the channel. */
+    HM10_OTA_Mux_Queue *queue = &tx_queues[channel];
+    /** <b>Local variable msg_size:</b> Length in bytes of the oldest message of the TX queue. */
+    uint16_t msg_size = get_oldest_message_size(queue);
+    /** <b>Local variable is_first_segment:</b> Flag indicating whether the segment is the first one of its message (i.e., 1) or not (i.e., 0). */
+    uint8_t is_first_segment = (tx_offsets[channel] == 0);
+    /** <b>Local variable segment_size:</b> Length in bytes of the segment, including its Segment Header. */
+    uint8_t segment_size = HM10_OTA_MSG_SEGMENT_HEADER_SIZE;
+
+    /* Populate the total length of the message as a varint at the start of its first segment. */
+    if (is_first_segment)
+    {
+        if (msg_size < 0x80U)
+        {
+            segment_buffer[segment_size++] = (uint8_t) msg_size;
+        }
+        else
+        {
+            segment_buffer[segment_size++] = (uint8_t) ((msg_size & 0x7FU) | 0x80U);
+            segment_buffer[segment_size++] = (uint8_t) (msg_size >> 7);
+        }
+    }
+
+    /* Populate as much of the remaining message as it fits into the segment. */
+    /** <b>Local variable chunk_size:</b> Bytes of the message that are populated into the segment. */
+    uint16_t chunk_size = msg_size - tx_offsets[channel];
+    if (chunk_size > (uint16_t) (HM10_MAX_PACKET_SIZE - segment_size))
+    {
+        chunk_size = HM10_MAX_PACKET_SIZE - segment_size;
+    }
+    read_from_queue(queue, queue->tail+HM10_OTA_MUX_ENTRY_HEADER_SIZE+tx_offsets[channel], &segment_buffer[segment_size], chunk_size);
+    segment_size += chunk_size;
+
+    /* Populate the Segment Header, with the Channel ID, and send the segment. */
+    segment_buffer[0] = (uint8_t) ((is_first_segment ? HM10_OTA_MSG_START_FLAG : 0) | (channel << HM10_OTA_MUX_CHANNEL_POS) | ((segment_size - HM10_OTA_MSG_SEGMENT_HEADER_SIZE) & HM10_OTA_MSG_LENGTH_MASK));
+    if (send_hm10_ota_data(segment_buffer, segment_size) != HM10_EC_OK)
+    {
+        #if ETX_OTA_VERBOSE
+            printf("ERROR: A segment of the channel %d could not be sent.\r\n", channel);
+        #endif
+        return HM10_EC_ERR;
+    }
+    mux_stats.segments_sent[channel]++;
+
+    /* Release the message from the TX queue once all of its segments have been sent. */
+    tx_offsets[channel] += chunk_size;
+    if (tx_offsets[channel] == msg_size)
+    {
+        queue->tail += HM10_OTA_MUX_ENTRY_HEADER_SIZE + msg_size;
+        tx_offsets[channel] = 0;
+        mux_stats.messages_sent[channel]++;
+    }
+
+    return HM10_EC_OK;
+}
+
+static HM10_Status receive_segment()
+{
+    /* Receive the Segment Header and then the exact length of payload that it states. */
+    if (get_hm10_ota_data(segment_buffer, HM10_OTA_MSG_SEGMENT_HEADER_SIZE) != HM10_EC_OK)
+    {
+        return HM10_EC_NR;
+    }
+    /** <b>Local variable payload_size:</b> Length in bytes of the payload of the received segment. */
+    uint8_t payload_size = segment_buffer[0] & HM10_OTA_MSG_LENGTH_MASK;
+    if ((payload_size==0) || (payload_size>HM10_OTA_MSG_MAX_SEGMENT_PAYLOAD_SIZE))
+    {
+        #if ETX_OTA_VERBOSE
+            printf("WARNING: An invalid Segment Header (0x%02X) was received and it will be dropped.\r\n", segment_buffer[0]);
+        #endif
+        mux_stats.segments_dropped++;
+        return HM10_EC_OK;
+    }
+    /** <b>Local variable payload:</b> Pointer to the payload of the received segment. */
+    uint8_t *payload = &segment_buffer[HM10_OTA_MSG_SEGMENT_HEADER_SIZE];
+    /** <b>Local variable channel:</b> Channel ID of the received segment. */
+    uint8_t channel = (segment_buffer[0] & HM10_OTA_MUX_CHANNEL_MASK) >> HM10_OTA_MUX_CHANNEL_POS;
+    if (get_hm10_ota_data(payload, payload_size) != HM10_EC_OK)
+    {
+        mux_stats.segments_dropped++;
+        reassembly[channel].in_progress = 0;
+        return HM10_EC_NR;
+    }
+    /** <b>Local variable queue:</b> Pointer to the RX queue of the channel. */
+    HM10_OTA_Mux_Queue *queue = &rx_queues[channel];
+    /** <b>Local variable p_reassembly:</b> Pointer to the reassembly context of the channel. */
+    HM10_OTA_Mux_Reassembly *p_reassembly = &reassembly[channel];
+
+    /* Start a new reassembly if this is the first segment of a message. */
+    if (segment_buffer[0] & HM10_OTA_MSG_START_FLAG)
+    {
+        if (p_reassembly->in_progress)
+        {
+            mux_stats.messages_dropped++;
+        }
+
+        /* Decode the total length of the message from its varint. */
+        /** <b>Local variable prefix_size:</b> Length in bytes of the varint that prefixes the message. */
+        uint8_t prefix_size = 1;
+        p_reassembly->in_progress = 0;
+        p_reassembly->expected = payload[0] & 0x7FU;
+        if (payload[0] & 0x80U)
+        {
+            if (payload_size < HM10_OTA_MSG_MAX_LENGTH_PREFIX_SIZE)
+            {
+                mux_stats.segments_dropped++;
+                return HM10_EC_OK;
+            }
+            p_reassembly->expected |= (uint16_t) payload[1] << 7;
+            prefix_size = HM10_OTA_MSG_MAX_LENGTH_PREFIX_SIZE;
+        }
+
+        /* Reserve the space of the whole message in the RX queue, so that it is reassembled in place. */
+        if ((HM10_OTA_MUX_QUEUE_SIZE - (queue->head-queue->tail)) < (uint32_t) (HM10_OTA_MUX_ENTRY_HEADER_SIZE+p_reassembly->expected))
+        {
+            #if ETX_OTA_VERBOSE
+                printf("WARNING: A message of %d bytes does not fit into the RX queue of the channel %d and it will be dropped.\r\n", p_reassembly->expected, channel);
+            #endif
+            mux_stats.messages_dropped++;
+            return HM10_EC_OK;
+        }
+        p_reassembly->received = 0;
+        p_reassembly->in_progress = 1;
+        payload += prefix_size;
+        payload_size -= prefix_size;
+    }
+    else if (!p_reassembly->in_progress)
+    {
+        mux_stats.segments_dropped++;
+        return HM10_EC_OK;
+    }
+
+    /* Append the payload into the reserved space of the RX queue. */
+    if ((uint16_t) (p_reassembly->received + payload_size) > p_reassembly->expected)
+    {
+        mux_stats.messages_dropped++;
+        p_reassembly->in_progress = 0;
+        return HM10_EC_OK;
+    }
+    write_into_queue(queue, queue->head+HM10_OTA_MUX_ENTRY_HEADER_SIZE+p_reassembly->received, payload, payload_size);
+    p_reassembly->received += payload_size;
+
+    if (p_reassembly->received != p_reassembly->expected)
+    {
+        return HM10_EC_OK;
+    }
+    p_reassembly->in_progress = 0;
+    /** <b>Local variable msg_size:</b> Length in bytes of the reassembled message without its CRC32C. */
+    uint16_t msg_size = p_reassembly->expected - HM10_OTA_MUX_CRC_SIZE;
+
+#if HM10_OTA_MSG_CRC
+    /* Drop the whole message if its CRC32C does not match, before it is committed into the RX queue. */
+    /** <b>Local variable crc_bytes:</b> CRC32C that was received at the end of the message, in little endian. */
+    uint8_t crc_bytes[HM10_OTA_MUX_CRC_SIZE];
+    /** <b>Local variable crc:</b> CRC32C that was received at the end of the message. */
+    uint32_t crc = 0;
+    if (p_reassembly->expected >= HM10_OTA_MUX_CRC_SIZE)
+    {
+        read_from_queue(queue, queue->head+HM10_OTA_MUX_ENTRY_HEADER_SIZE+msg_size, crc_bytes, HM10_OTA_MUX_CRC_SIZE);
+        for (uint8_t i=0; i<HM10_OTA_MUX_CRC_SIZE; i++)
+        {
+            crc |= (uint32_t) crc_bytes[i] << (8*i);
+        }
+    }
+    if ((p_reassembly->expected < HM10_OTA_MUX_CRC_SIZE) || (crc != calculate_queue_crc32c(queue, queue->head+HM10_OTA_MUX_ENTRY_HEADER_SIZE, msg_size)))
+    {
+        #if ETX_OTA_VERBOSE
+            printf("WARNING: A message with an invalid CRC32C was received on the channel %d and it will be dropped.\r\n", channel);
+        #endif
+        mux_stats.crc_errors++;
+        mux_stats.messages_dropped++;
+        return HM10_EC_OK;
+    }
+#endif
+
+    /* Commit the message, without its CRC32C, into the RX queue. */
+    /** <b>Local variable entry_header:</b> Length of the message in little endian. */
+    uint8_t entry_header[HM10_OTA_MUX_ENTRY_HEADER_SIZE] = {(uint8_t) msg_size, (uint8_t) (msg_size >> 8)};
+    write_into_queue(queue, queue->head, entry_header, HM10_OTA_MUX_ENTRY_HEADER_SIZE);
+    queue->head += HM10_OTA_MUX_ENTRY_HEADER_SIZE + msg_size;
+    mux_stats.messages_received[channel]++;
+
+    return HM10_EC_OK;
+}
+
+/** @} */
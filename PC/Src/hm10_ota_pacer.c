@@ -0,0 +1,174 @@
+/** @addtogroup hm10_ota_pacer
+ * @{
+ */
+
+#include "../Inc/hm10_ota_pacer.h"
+#include "../Inc/hm10_config.h" // Custom Library for the HM-10 Driver Library.
+#include <unistd.h> // Library for using the "usleep()" function.
+#include <string.h>	// Library from which "memset()" and "memcpy()" are located at.
+#include <time.h> // Library from which "clock_gettime()" is located at.
+
+#define HM10_OTA_PACER_BITS_PER_BYTE    (10U)          /**< @brief Bits that the RS-232 Port uses to carry one byte of data (i.e., 1 start bit, 8 data bits and 1 stop bit). */
+#define HM10_OTA_PACER_TOKEN_SCALE      (1000000ULL)   /**< @brief Tokens that represent one byte in the bucket of the pacer. @details This scale is used so that refilling the bucket with \f$elapsed\_time_{\mu s} \times rate_{bytes/s}\f$ tokens can be made with integer arithmetic only. */
+#define HM10_OTA_PACER_CAPACITY         ((uint64_t) HM10_OTA_PACER_BURST_PACKETS * HM10_MAX_PACKET_SIZE * HM10_OTA_PACER_TOKEN_SCALE) /**< @brief Highest number of tokens that the bucket of the pacer can hold. */
+
+#if HM10_OTA_PACER_BURST_PACKETS == 0
+#error "HM10_OTA_PACER_BURST_PACKETS must be greater than 0."
+#endif
+
+static uint8_t is_pacer_enabled = 0;        /**< @brief Flag indicating whether the pacer is enabled (i.e., 1) or not (i.e., 0). */
+static uint32_t pacer_rate;                 /**< @brief Current rate of the pacer in bytes per second. */
+static uint32_t pacer_max_rate;             /**< @brief Highest rate of the pacer in bytes per second. */
+static uint64_t pacer_tokens;               /**< @brief Tokens currently available in the bucket of the pacer (see @ref HM10_OTA_PACER_TOKEN_SCALE ). */
+static uint64_t pacer_last_refill_time;     /**< @brief Time in microseconds at which the bucket of the pacer was last refilled. */
+static uint64_t pacer_start_time;           /**< @brief Time in microseconds at which the first byte was sent through the pacer, or 0 if none has been sent yet. */
+static uint64_t pacer_last_send_time;       /**< @brief Time in microseconds at which the last byte was sent through the pacer. */
+static uint64_t pacer_bytes_sent;           /**< @brief Total bytes that have been sent through the pacer. */
+static uint32_t pacer_drops;                /**< @brief Number of drops that have been reported to the pacer. */
+static uint32_t pacer_echoes;               /**< @brief Number of echoes that have been reported to the pacer. */
+
+/**@brief	Refills the bucket of the pacer with the tokens accumulated since the last time that it was refilled.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+static void refill_pacer_bucket();
+
+/**@brief	Gets the current time of a monotonic clock of our host machine.
+ *
+ * @return  Current time in microseconds.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+static uint64_t get_monotonic_time_us();
+
+HM10_Status init_hm10_ota_pacer(uint32_t baudrate, uint32_t connection_interval)
+{
+    if ((baudrate==0) || (connection_interval==0))
+    {
+        return HM10_EC_ERR;
+    }
+
+    /* Derive the highest rate of the pacer from the baud rate and from the Bluetooth Connection Interval. */
+    /** <b>Local variable uart_rate:</b> Rate in bytes per second that the RS-232 Port can carry. */
+    uint64_t uart_rate = baudrate / HM10_OTA_PACER_BITS_PER_BYTE;
+    /** <b>Local variable ble_rate:</b> Rate in bytes per second that the HM-10 BT Device can forward OTA. */
+    uint64_t ble_rate = ((uint64_t) HM10_OTA_PACER_PACKETS_PER_INTERVAL * HM10_MAX_PACKET_SIZE * 1000000ULL) / connection_interval;
+    pacer_max_rate = (uint32_t) ((uart_rate < ble_rate) ? uart_rate : ble_rate);
+    if (pacer_max_rate < HM10_OTA_PACER_MIN_RATE)
+    {
+        pacer_max_rate = HM10_OTA_PACER_MIN_RATE;
+    }
+
+    /* Start with a full bucket at the highest rate. */
+    pacer_rate = pacer_max_rate;
+    pacer_tokens = HM10_OTA_PACER_CAPACITY;
+    pacer_last_refill_time = get_monotonic_time_us();
+    pacer_start_time = 0;
+    pacer_last_send_time = 0;
+    pacer_bytes_sent = 0;
+    pacer_drops = 0;
+    pacer_echoes = 0;
+    is_pacer_enabled = 1;
+
+    return HM10_EC_OK;
+}
+
+void deinit_hm10_ota_pacer()
+{
+    is_pacer_enabled = 0;
+}
+
+uint8_t is_hm10_ota_pacer_enabled()
+{
+    return is_pacer_enabled;
+}
+
+void wait_for_hm10_ota_pacer(uint16_t size)
+{
+    /** <b>Local variable required_tokens:</b> Tokens required to send the requested number of bytes. */
+    uint64_t required_tokens = (uint64_t) size * HM10_OTA_PACER_TOKEN_SCALE;
+    if (required_tokens > HM10_OTA_PACER_CAPACITY)
+    {
+        /* A burst larger than the bucket could never be waited for, so it only waits for a full bucket instead. */
+        required_tokens = HM10_OTA_PACER_CAPACITY;
+    }
+
+    /* Wait until the bucket holds enough tokens. */
+    refill_pacer_bucket();
+    while (pacer_tokens < required_tokens)
+    {
+        usleep((useconds_t) ((required_tokens - pacer_tokens + pacer_rate - 1) / pacer_rate));
+        refill_pacer_bucket();
+    }
+    pacer_tokens -= required_tokens;
+
+    /* Account for the bytes that are about to be sent. */
+    pacer_last_send_time = pacer_last_refill_time;
+    if (pacer_start_time == 0)
+    {
+        pacer_start_time = pacer_last_send_time;
+    }
+    pacer_bytes_sent += size;
+}
+
+void report_hm10_ota_pacer_drop()
+{
+    pacer_drops++;
+    pacer_rate /= 2;
+    if (pacer_rate < HM10_OTA_PACER_MIN_RATE)
+    {
+        pacer_rate = HM10_OTA_PACER_MIN_RATE;
+    }
+}
+
+void report_hm10_ota_pacer_echo(uint16_t size)
+{
+    pacer_echoes++;
+
+    /* Increase the rate by @ref HM10_OTA_PACER_ADDITIVE_INCREASE bytes per second for each confirmed packet. */
+    /** <b>Local variable new_rate:</b> Rate of the pacer after accounting for the confirmed bytes. */
+    uint64_t new_rate = (uint64_t) pacer_rate + ((uint64_t) HM10_OTA_PACER_ADDITIVE_INCREASE * size) / HM10_MAX_PACKET_SIZE;
+    pacer_rate = (uint32_t) ((new_rate > pacer_max_rate) ? pacer_max_rate : new_rate);
+}
+
+void get_hm10_ota_pacer_stats(HM10_OTA_Pacer_Stats *stats)
+{
+    memset(stats, 0, sizeof(HM10_OTA_Pacer_Stats));
+    stats->rate = pacer_rate;
+    stats->max_rate = pacer_max_rate;
+    stats->bytes_sent = pacer_bytes_sent;
+    stats->drops = pacer_drops;
+    stats->echoes = pacer_echoes;
+
+    /* The achieved rate considers the time elapsed from the first burst until the last one. */
+    if (pacer_last_send_time > pacer_start_time)
+    {
+        stats->achieved_rate = (uint32_t) ((pacer_bytes_sent * 1000000ULL) / (pacer_last_send_time - pacer_start_time));
+    }
+}
+
+static void refill_pacer_bucket()
+{
+    /** <b>Local variable current_time:</b> Current time in microseconds. */
+    uint64_t current_time = get_monotonic_time_us();
+
+    pacer_tokens += (current_time - pacer_last_refill_time) * pacer_rate;
+    if (pacer_tokens > HM10_OTA_PACER_CAPACITY)
+    {
+        pacer_tokens = HM10_OTA_PACER_CAPACITY;
+    }
+    pacer_last_refill_time = current_time;
+}
+
+static uint64_t get_monotonic_time_us()
+{
+    /** <b>Local variable current_time:</b> Current time of the monotonic clock of our host machine. */
+    struct timespec current_time;
+    clock_gettime(CLOCK_MONOTONIC, &current_time);
+
+    return ((uint64_t) current_time.tv_sec)*1000000U + ((uint64_t) current_time.tv_nsec)/1000U;
+}
+
+/** @} */
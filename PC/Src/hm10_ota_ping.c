@@ -0,0 +1,430 @@
+/** @addtogroup hm10_ota_ping
+ * @{
+ */
+
+#include "../Inc/hm10_ota_ping.h"
+#include "../Inc/hm10_config.h" // Custom Library for the HM-10 Driver Library.
+#include <stdio.h>	// Library from which "printf" is located at.
+#include <string.h>	// Library from which "memset()" and "memcpy()" are located at.
+#include <time.h> // Library from which "clock_gettime()" is located at.
+
+/**@brief	Sample of a single exchange of the HM-10 OTA Ping Service.
+ */
+typedef struct {
+    uint64_t local_time;    //!< Time in microseconds of our host machine at the middle of the exchange (i.e., (T1 + T4) / 2).
+    int64_t offset;         //!< Clock offset in microseconds measured by the exchange.
+    uint32_t rtt;           //!< RTT in microseconds measured by the exchange.
+    int64_t outbound;       //!< Difference in microseconds between the time at which the PING frame was received and the one at which it was sent (i.e., T2 - T1), which still includes the clock offset.
+    int64_t inbound;        //!< Difference in microseconds between the time at which the PONG frame was received and the one at which it was sent (i.e., T4 - T3), which still includes the clock offset.
+} HM10_OTA_Ping_Sample;
+
+static HM10_OTA_Ping_Sample ping_samples[HM10_OTA_PING_MAX_SAMPLES];    /**< @brief Ring of the samples of the most recent exchanges. */
+static uint16_t ping_sample_count = 0;                                  /**< @brief Number of valid samples in the @ref ping_samples ring. */
+static uint16_t ping_next_sample = 0;                                   /**< @brief Index of the @ref ping_samples ring into which the next sample will be stored. */
+static uint8_t ping_sequence = 0;                                       /**< @brief Sequence Number of the last PING frame that was sent. */
+static uint32_t pings_sent = 0;                                         /**< @brief Number of PING frames that have been sent. */
+static uint32_t pings_lost = 0;                                         /**< @brief Number of PING frames whose PONG frame was not received. */
+static uint64_t clock_reference_time = 0;                               /**< @brief Time in microseconds of our host machine at which the @ref clock_reference_offset was measured. */
+static int64_t clock_reference_offset = 0;                              /**< @brief Current estimation of the clock offset in microseconds. */
+static double clock_drift = 0;                                          /**< @brief Current estimation of the drift between both clocks, as a fraction (e.g., 1e-6 for 1 ppm). */
+static uint8_t ping_frame[HM10_OTA_PING_PONG_SIZE];                     /**< @brief Buffer that holds the frame that is either being sent or received. */
+
+/**@brief	Adds the sample of an exchange into the @ref ping_samples ring and updates the estimations of the clock
+ *          offset and of the drift.
+ *
+ * @param t1    Time at which the PING frame was sent, in microseconds of our host machine.
+ * @param t2    Time at which the PING frame was received, in microseconds of the Remote BT Device.
+ * @param t3    Time at which the PONG frame was sent, in microseconds of the Remote BT Device.
+ * @param t4    Time at which the PONG frame was received, in microseconds of our host machine.
+ *
+ * @return  The RTT in microseconds of the exchange.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+static uint32_t add_ping_sample(uint64_t t1, uint64_t t2, uint64_t t3, uint64_t t4);
+
+/**@brief	Sorts the RTTs of all the samples of the @ref ping_samples ring into a certain buffer.
+ *
+ * @param[out] rtts Pointer to the Memory Address into which the @ref ping_sample_count RTTs will be stored in
+ *                  ascending order.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+static void sort_ping_rtts(uint32_t *rtts);
+
+/**@brief	Gets a percentile from some sorted RTTs with the nearest-rank method.
+ *
+ * @param[in] rtts      Pointer to the RTTs in ascending order.
+ * @param count         Number of RTTs towards which the \p rtts param points to.
+ * @param percentile    Desired percentile, from 1 to 100.
+ *
+ * @return  The RTT at the requested percentile.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+static uint32_t get_rtt_percentile(uint32_t *rtts, uint16_t count, uint8_t percentile);
+
+/**@brief	Sorts the estimated one-way delays of one direction of all the samples of the @ref ping_samples ring into a
+ *          certain buffer, by correcting them with the estimated clock offset at the time of each sample.
+ *
+ * @param[out] delays   Pointer to the Memory Address into which the @ref ping_sample_count one-way delays in
+ *                      microseconds will be stored in ascending order.
+ * @param is_inbound    1 to sort the delays from the Remote BT Device to our host machine, or 0 to sort the ones from
+ *                      our host machine to the Remote BT Device.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+static void sort_ping_one_way_delays(int32_t *delays, uint8_t is_inbound);
+
+/**@brief	Gets a percentile from some sorted one-way delays with the nearest-rank method.
+ *
+ * @param[in] delays    Pointer to the one-way delays in ascending order.
+ * @param count         Number of one-way delays towards which the \p delays param points to.
+ * @param percentile    Desired percentile, from 1 to 100.
+ *
+ * @return  The one-way delay at the requested percentile.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+static int32_t get_one_way_delay_percentile(int32_t *delays, uint16_t count, uint8_t percentile);
+
+/**@brief	Encodes a 64-bit time in little endian.
+ *
+ * @param[out] data Pointer to the Memory Address into which the 8 bytes of the time will be stored.
+ * @param time      Time that is desired to be encoded.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+static void put_time(uint8_t *data, uint64_t time);
+
+/**@brief	Decodes a 64-bit time from little endian.
+ *
+ * @param[in] data  Pointer to the 8 bytes of the time.
+ *
+ * @return  The decoded time.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+static uint64_t get_time(uint8_t *data);
+
+void init_hm10_ota_ping()
+{
+    ping_sample_count = 0;
+    ping_next_sample = 0;
+    pings_sent = 0;
+    pings_lost = 0;
+    clock_reference_time = 0;
+    clock_reference_offset = 0;
+    clock_drift = 0;
+}
+
+HM10_Status send_hm10_ota_ping(uint32_t *rtt)
+{
+    /** <b>Local variable t1:</b> Time at which the PING frame was sent. */
+    uint64_t t1;
+    /** <b>Local variable t4:</b> Time at which the PONG frame was received. */
+    uint64_t t4;
+    /** <b>Local variable measured_rtt:</b> RTT measured by the exchange. */
+    uint32_t measured_rtt;
+
+    /* Send the PING frame, padded to the length of the PONG frame. */
+    memset(ping_frame, 0, HM10_OTA_PING_PING_SIZE);
+    ping_frame[0] = HM10_OTA_PING_TYPE_PING;
+    ping_frame[1] = ++ping_sequence;
+    t1 = get_hm10_ota_ping_time();
+    if (send_hm10_ota_data(ping_frame, HM10_OTA_PING_PING_SIZE) != HM10_EC_OK)
+    {
+        #if ETX_OTA_VERBOSE
+            printf("ERROR: The PING frame could not be sent.\r\n");
+        #endif
+        return HM10_EC_ERR;
+    }
+    pings_sent++;
+
+    /* Wait for the PONG frame of this PING frame, discarding anything else. */
+    while (1)
+    {
+        if (get_hm10_ota_data(ping_frame, 1) != HM10_EC_OK)
+        {
+            pings_lost++;
+            return HM10_EC_NR;
+        }
+        if (ping_frame[0] != HM10_OTA_PING_TYPE_PONG)
+        {
+            continue;
+        }
+        if (get_hm10_ota_data(&ping_frame[1], HM10_OTA_PING_PONG_SIZE - 1) != HM10_EC_OK)
+        {
+            pings_lost++;
+            return HM10_EC_NR;
+        }
+        t4 = get_hm10_ota_ping_time();
+        if (ping_frame[1] == ping_sequence)
+        {
+            break;
+        }
+        #if ETX_OTA_VERBOSE
+            printf("WARNING: The late PONG frame of the PING frame %d was received and it will be discarded.\r\n", ping_frame[1]);
+        #endif
+    }
+
+    /* Take the sample of the exchange. */
+    measured_rtt = add_ping_sample(t1, get_time(&ping_frame[2]), get_time(&ping_frame[10]), t4);
+    if (rtt != NULL)
+    {
+        *rtt = measured_rtt;
+    }
+
+    return HM10_EC_OK;
+}
+
+HM10_Status respond_hm10_ota_ping()
+{
+    /** <b>Local variable t2:</b> Time at which the PING frame was received. */
+    uint64_t t2;
+
+    /* Receive the PING frame. */
+    if (get_hm10_ota_data(ping_frame, 1) != HM10_EC_OK)
+    {
+        return HM10_EC_NR;
+    }
+    t2 = get_hm10_ota_ping_time();
+    if (ping_frame[0] != HM10_OTA_PING_TYPE_PING)
+    {
+        return HM10_EC_NA;
+    }
+    if (get_hm10_ota_data(&ping_frame[1], HM10_OTA_PING_PING_SIZE - 1) != HM10_EC_OK)
+    {
+        return HM10_EC_NR;
+    }
+
+    /* Send the PONG frame, with the Sequence Number of the PING frame, as late as possible after taking its T3. */
+    ping_frame[0] = HM10_OTA_PING_TYPE_PONG;
+    put_time(&ping_frame[2], t2);
+    put_time(&ping_frame[10], get_hm10_ota_ping_time());
+    if (send_hm10_ota_data(ping_frame, HM10_OTA_PING_PONG_SIZE) != HM10_EC_OK)
+    {
+        #if ETX_OTA_VERBOSE
+            printf("ERROR: The PONG frame could not be sent.\r\n");
+        #endif
+        return HM10_EC_ERR;
+    }
+
+    return HM10_EC_OK;
+}
+
+HM10_Status get_hm10_ota_ping_stats(HM10_OTA_Ping_Stats *stats)
+{
+    /** <b>Local variable rtts:</b> RTTs of all the samples in ascending order. */
+    uint32_t rtts[HM10_OTA_PING_MAX_SAMPLES];
+    /** <b>Local variable delays:</b> Estimated one-way delays of one direction of all the samples in ascending order. */
+    int32_t delays[HM10_OTA_PING_MAX_SAMPLES];
+
+    memset(stats, 0, sizeof(HM10_OTA_Ping_Stats));
+    stats->pings_sent = pings_sent;
+    stats->pings_lost = pings_lost;
+    if (ping_sample_count == 0)
+    {
+        return HM10_EC_NA;
+    }
+
+    sort_ping_rtts(rtts);
+    stats->samples = ping_sample_count;
+    stats->rtt_min = rtts[0];
+    stats->rtt_p50 = get_rtt_percentile(rtts, ping_sample_count, 50);
+    stats->rtt_p90 = get_rtt_percentile(rtts, ping_sample_count, 90);
+    stats->rtt_p99 = get_rtt_percentile(rtts, ping_sample_count, 99);
+    stats->rtt_max = rtts[ping_sample_count - 1];
+    stats->offset = clock_reference_offset;
+    stats->drift = (int32_t) (clock_drift*1e9);
+    sort_ping_one_way_delays(delays, 0);
+    stats->owd_out_min = delays[0];
+    stats->owd_out_p50 = get_one_way_delay_percentile(delays, ping_sample_count, 50);
+    stats->owd_out_p90 = get_one_way_delay_percentile(delays, ping_sample_count, 90);
+    sort_ping_one_way_delays(delays, 1);
+    stats->owd_in_min = delays[0];
+    stats->owd_in_p50 = get_one_way_delay_percentile(delays, ping_sample_count, 50);
+    stats->owd_in_p90 = get_one_way_delay_percentile(delays, ping_sample_count, 90);
+
+    return HM10_EC_OK;
+}
+
+uint64_t convert_hm10_ota_ping_remote_time(uint64_t remote_time)
+{
+    /** <b>Local variable elapsed:</b> Approximate time in microseconds of our host machine elapsed since the @ref clock_reference_time . */
+    int64_t elapsed = (int64_t) (remote_time - (uint64_t) clock_reference_offset - clock_reference_time);
+
+    return remote_time - (uint64_t) (clock_reference_offset + (int64_t) (clock_drift*(double) elapsed));
+}
+
+uint64_t get_hm10_ota_ping_time()
+{
+    /** <b>Local variable current_time:</b> Current time of the monotonic clock of our host machine. */
+    struct timespec current_time;
+    clock_gettime(CLOCK_MONOTONIC, &current_time);
+
+    return ((uint64_t) current_time.tv_sec)*1000000U + ((uint64_t) current_time.tv_nsec)/1000U;
+}
+
+static uint32_t add_ping_sample(uint64_t t1, uint64_t t2, uint64_t t3, uint64_t t4)
+{
+    /** <b>Local variable rtt:</b> RTT of the exchange, without the processing time of the responder. */
+    int64_t rtt = (int64_t) (t4 - t1) - (int64_t) (t3 - t2);
+    /** <b>Local variable sample:</b> Pointer to the sample of the exchange in the @ref ping_samples ring. */
+    HM10_OTA_Ping_Sample *sample = &ping_samples[ping_next_sample];
+    /** <b>Local variable best:</b> Pointer to the sample with the lowest RTT among the most recent ones. */
+    HM10_OTA_Ping_Sample *best = sample;
+    /** <b>Local variable median:</b> Median of the RTTs of all the samples. */
+    uint32_t median;
+    /** <b>Local variable rtts:</b> RTTs of all the samples in ascending order. */
+    uint32_t rtts[HM10_OTA_PING_MAX_SAMPLES];
+    /** <b>Local variable n:</b> Number of samples used for the least-squares fit of the drift. */
+    uint16_t n = 0;
+    /** <b>Local variable mean_x:</b> Mean of the local times, relative to the newest sample, of the samples used for the fit. */
+    double mean_x = 0;
+    /** <b>Local variable mean_y:</b> Mean of the offsets of the samples used for the fit. */
+    double mean_y = 0;
+    /** <b>Local variable sxx:</b> Sum of the squared deviations of the local times of the samples used for the fit. */
+    double sxx = 0;
+    /** <b>Local variable sxy:</b> Sum of the products of the deviations of the samples used for the fit. */
+    double sxy = 0;
+
+    /* Store the sample into the ring. */
+    sample->local_time = t1 + (t4 - t1)/2;
+    sample->offset = ((int64_t) (t2 - t1) + (int64_t) (t3 - t4))/2;
+    sample->rtt = (rtt < 0) ? 0 : (uint32_t) rtt;
+    sample->outbound = (int64_t) (t2 - t1);
+    sample->inbound = (int64_t) (t4 - t3);
+    ping_next_sample = (uint16_t) ((ping_next_sample + 1) % HM10_OTA_PING_MAX_SAMPLES);
+    if (ping_sample_count < HM10_OTA_PING_MAX_SAMPLES)
+    {
+        ping_sample_count++;
+    }
+
+    /* Take the clock offset from the sample with the lowest RTT among the most recent ones. */
+    for (uint16_t i=1; (i<HM10_OTA_PING_FILTER_SIZE) && (i<ping_sample_count); i++)
+    {
+        /** <b>Local variable candidate:</b> Pointer to the i-th most recent sample before the newest one. */
+        HM10_OTA_Ping_Sample *candidate = &ping_samples[(ping_next_sample + HM10_OTA_PING_MAX_SAMPLES - 1 - i) % HM10_OTA_PING_MAX_SAMPLES];
+        if (candidate->rtt < best->rtt)
+        {
+            best = candidate;
+        }
+    }
+    clock_reference_time = best->local_time;
+    clock_reference_offset = best->offset;
+
+    /* Estimate the drift as the least-squares slope of the offsets of the samples whose RTT is not above the median. */
+    sort_ping_rtts(rtts);
+    median = get_rtt_percentile(rtts, ping_sample_count, 50);
+    for (uint16_t i=0; i<ping_sample_count; i++)
+    {
+        if (ping_samples[i].rtt <= median)
+        {
+            n++;
+            mean_x += ((double) (int64_t) (ping_samples[i].local_time - sample->local_time) - mean_x)/n;
+            mean_y += ((double) ping_samples[i].offset - mean_y)/n;
+        }
+    }
+    for (uint16_t i=0; i<ping_sample_count; i++)
+    {
+        if (ping_samples[i].rtt <= median)
+        {
+            /** <b>Local variable dx:</b> Deviation of the local time of the sample from the mean. */
+            double dx = (double) (int64_t) (ping_samples[i].local_time - sample->local_time) - mean_x;
+            sxx += dx*dx;
+            sxy += dx*((double) ping_samples[i].offset - mean_y);
+        }
+    }
+    if ((n >= 2) && (sxx > 0))
+    {
+        clock_drift = sxy/sxx;
+    }
+
+    return sample->rtt;
+}
+
+static void sort_ping_rtts(uint32_t *rtts)
+{
+    /** <b>Local variable rtt:</b> RTT that is being inserted into its sorted position. */
+    uint32_t rtt;
+    /** <b>Local variable j:</b> Position into which the RTT that is being inserted is moved. */
+    uint16_t j;
+
+    for (uint16_t i=0; i<ping_sample_count; i++)
+    {
+        rtt = ping_samples[i].rtt;
+        for (j=i; (j>0) && (rtts[j-1]>rtt); j--)
+        {
+            rtts[j] = rtts[j-1];
+        }
+        rtts[j] = rtt;
+    }
+}
+
+static uint32_t get_rtt_percentile(uint32_t *rtts, uint16_t count, uint8_t percentile)
+{
+    /** <b>Local variable rank:</b> Nearest rank of the percentile (i.e., the ceiling of percentile * count / 100). */
+    uint32_t rank = ((uint32_t) percentile*count + 99U)/100U;
+
+    return rtts[(rank == 0) ? 0 : (rank - 1)];
+}
+
+static void sort_ping_one_way_delays(int32_t *delays, uint8_t is_inbound)
+{
+    /** <b>Local variable delay:</b> One-way delay that is being inserted into its sorted position. */
+    int32_t delay;
+    /** <b>Local variable offset:</b> Estimated clock offset at the time of the sample whose one-way delay is being inserted. */
+    int64_t offset;
+    /** <b>Local variable j:</b> Position into which the one-way delay that is being inserted is moved. */
+    uint16_t j;
+
+    for (uint16_t i=0; i<ping_sample_count; i++)
+    {
+        offset = clock_reference_offset + (int64_t) (clock_drift*(double) (int64_t) (ping_samples[i].local_time - clock_reference_time));
+        delay = (int32_t) ((is_inbound) ? (ping_samples[i].inbound + offset) : (ping_samples[i].outbound - offset));
+        for (j=i; (j>0) && (delays[j-1]>delay); j--)
+        {
+            delays[j] = delays[j-1];
+        }
+        delays[j] = delay;
+    }
+}
+
+static int32_t get_one_way_delay_percentile(int32_t *delays, uint16_t count, uint8_t percentile)
+{
+    /** <b>Local variable rank:</b> Nearest rank of the percentile (i.e., the ceiling of percentile * count / 100). */
+    uint32_t rank = ((uint32_t) percentile*count + 99U)/100U;
+
+    return delays[(rank == 0) ? 0 : (rank - 1)];
+}
+
+static void put_time(uint8_t *data, uint64_t time)
+{
+    for (uint8_t i=0; i<8; i++)
+    {
+        data[i] = (uint8_t) (time >> (8*i));
+    }
+}
+
+static uint64_t get_time(uint8_t *data)
+{
+    /** <b>Local variable time:</b> Decoded time. */
+    uint64_t time = 0;
+
+    for (uint8_t i=0; i<8; i++)
+    {
+        time |= (uint64_t) data[i] << (8*i);
+    }
+
+    return time;
+}
+
+/** @} */
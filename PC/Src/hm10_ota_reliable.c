@@ -0,0 +1,596 @@
+/** @addtogroup hm10_ota_reliable
+ * @{
+ */
+
+#include "../Inc/hm10_ota_reliable.h"
+#include "../Inc/hm10_ota_pacer.h" // Custom Mortrack's Library to pace the data sent Over the Air by the HM-10 Bluetooth Device.
+#include "../Inc/hm10_config.h" // Custom Library for the HM-10 Driver Library.
+#include <stdio.h>	// Library from which "printf" is located at.
+#include <string.h>	// Library from which "memset()", "memcpy()" and "memmove()" are located at.
+#include <time.h> // Library from which "clock_gettime()" is located at.
+
+#define HM10_OTA_RELIABLE_SLOT_MASK     (HM10_OTA_RELIABLE_MAX_WINDOW_SIZE - 1)  /**< @brief Bit mask to get the index of the slot of a Sequence Number. @details Since 256 is a multiple of @ref HM10_OTA_RELIABLE_MAX_WINDOW_SIZE , the slot of each Sequence Number remains the same after its wrap-around. */
+
+/**@brief	Slot of a DATA frame that has been sent, but that may not have been acknowledged yet.
+ */
+typedef struct {
+    uint8_t data[HM10_OTA_RELIABLE_MAX_PAYLOAD_SIZE];   //!< Payload of the DATA frame.
+    uint8_t size;                                       //!< Length in bytes of the payload of the DATA frame.
+    uint8_t is_acked;                                   //!< Flag indicating whether the DATA frame has been acknowledged (i.e., 1) or not (i.e., 0).
+    uint8_t retransmissions;                            //!< Number of times that the DATA frame has been retransmitted.
+    uint8_t dupacks;                                    //!< Number of ACK frames that selectively acknowledged later DATA frames while this one was missing.
+    uint64_t sent_time;                                 //!< Time in microseconds at which the DATA frame was last sent.
+} HM10_OTA_Reliable_Tx_Slot;
+
+/**@brief	Slot of a DATA frame that has been received, but that has not been delivered to the application yet.
+ */
+typedef struct {
+    uint8_t data[HM10_OTA_RELIABLE_MAX_PAYLOAD_SIZE];   //!< Payload of the DATA frame.
+    uint8_t size;                                       //!< Length in bytes of the payload of the DATA frame.
+    uint8_t is_received;                                //!< Flag indicating whether the DATA frame has been received (i.e., 1) or not (i.e., 0).
+} HM10_OTA_Reliable_Rx_Slot;
+
+static uint8_t is_reliable_initialized = 0;                                             /**< @brief Flag indicating whether the reliable transport has been initialized (i.e., 1) or not (i.e., 0). */
+static uint8_t window;                                                                  /**< @brief Maximum number of DATA frames that can be in flight without being acknowledged. */
+static HM10_OTA_Reliable_Tx_Slot tx_slots[HM10_OTA_RELIABLE_MAX_WINDOW_SIZE];           /**< @brief Slots of the DATA frames that are in flight. */
+static uint8_t tx_base;                                                                 /**< @brief Sequence Number of the oldest DATA frame that has not been acknowledged. */
+static uint8_t tx_next;                                                                 /**< @brief Sequence Number that will be given to the next DATA frame to be sent. */
+static HM10_OTA_Reliable_Rx_Slot rx_slots[HM10_OTA_RELIABLE_MAX_WINDOW_SIZE];           /**< @brief Slots of the DATA frames that have been received, but not delivered. */
+static uint8_t rx_deliver;                                                              /**< @brief Sequence Number of the next DATA frame to be delivered to the application. */
+static uint8_t rx_next;                                                                 /**< @brief Sequence Number of the next DATA frame that is expected in order (i.e., the cumulative ACK). */
+static uint32_t srtt;                                                                   /**< @brief Smoothed RTT in microseconds, or 0 if it has not been measured yet. */
+static uint32_t rttvar;                                                                 /**< @brief Variation of the RTT in microseconds. */
+static uint32_t rto;                                                                    /**< @brief Current RTO in microseconds. */
+static uint8_t frame_buffer[HM10_MAX_PACKET_SIZE];                                      /**< @brief Buffer that holds a whole frame (i.e., one HM-10 packet) that is being sent. */
+static uint8_t rx_frame_buffer[HM10_MAX_PACKET_SIZE];                                   /**< @brief Buffer that holds the bytes of the frame that is being received, which are kept between calls while the frame is incomplete. */
+static uint8_t rx_frame_size;                                                           /**< @brief Number of bytes in @ref rx_frame_buffer . */
+static HM10_OTA_Reliable_Stats reliable_stats;                                          /**< @brief Statistics of the HM-10 OTA Reliable Transport. */
+
+/**@brief	Sends, or resends, the DATA frame of a certain Sequence Number.
+ *
+ * @param seq   Sequence Number of the DATA frame that is desired to be sent.
+ *
+ * @retval	HM10_EC_OK	if the DATA frame was successfully sent.
+ * @retval  HM10_EC_ERR otherwise.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+static HM10_Status send_data_frame(uint8_t seq);
+
+/**@brief	Sends an ACK frame with the current cumulative ACK and SACK bitmap of the received DATA frames.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+static void send_ack_frame();
+
+/**@brief	Sends a frame Over the Air (OTA), after appending to it the CRC32C of its Frame Header and of its payload.
+ *
+ * @param size  Length in bytes of the Frame Header and of the payload of the frame in @ref frame_buffer .
+ *
+ * @retval	HM10_EC_OK	if the frame was successfully sent.
+ * @retval  HM10_EC_ERR otherwise.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+static HM10_Status send_frame(uint8_t size);
+
+/**@brief	Receives bytes Over the Air (OTA) into @ref rx_frame_buffer until it holds a certain number of them.
+ *
+ * @param size  Number of bytes that @ref rx_frame_buffer is desired to hold.
+ *
+ * @retval	HM10_EC_OK	if @ref rx_frame_buffer holds the desired number of bytes.
+ * @retval  HM10_EC_NR  if nothing else was received before that.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+static HM10_Status receive_frame_bytes(uint8_t size);
+
+/**@brief	Discards the first byte of @ref rx_frame_buffer , so that the next frame is searched from the byte that
+ *          follows it.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+static void resync_frame();
+
+/**@brief	Receives a single frame Over the Air (OTA) and processes it.
+ *
+ * @retval	HM10_EC_OK	if a frame was received and processed.
+ * @retval  HM10_EC_NA  if a frame was received, but it was discarded because of an invalid Frame Header, of a CRC32C
+ *                      that did not match or of some of its bytes not being received.
+ * @retval  HM10_EC_NR  if no frame was received.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+static HM10_Status process_incoming_frame();
+
+/**@brief	Processes a received ACK frame by marking the acknowledged DATA frames, by fast retransmitting the missing
+ *          ones and by sliding the send window.
+ *
+ * @param cumulative_ack    Sequence Number of the next DATA frame that the Remote BT Device expects.
+ * @param sack_bitmap       SACK bitmap of the ACK frame.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+static void process_ack_frame(uint8_t cumulative_ack, uint16_t sack_bitmap);
+
+/**@brief	Processes a received DATA frame by storing it into its slot, if it is new and within the receive window, and
+ *          by acknowledging it.
+ *
+ * @param seq           Sequence Number of the DATA frame.
+ * @param[in] payload   Pointer to the payload of the DATA frame.
+ * @param size          Length in bytes of the payload of the DATA frame.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+static void process_data_frame(uint8_t seq, uint8_t *payload, uint8_t size);
+
+/**@brief	Marks the DATA frame of a certain Sequence Number as acknowledged and, if it was never retransmitted, updates
+ *          the RTT estimation with it.
+ *
+ * @param seq   Sequence Number of the DATA frame that was acknowledged.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+static void acknowledge_data_frame(uint8_t seq);
+
+/**@brief	Updates the smoothed RTT, its variation and the RTO with a new RTT sample.
+ *
+ * @param sample    Measured RTT in microseconds.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+static void update_rtt_estimation(uint32_t sample);
+
+/**@brief	Gets the current time of a monotonic clock of our host machine.
+ *
+ * @return  Current time in microseconds.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+static uint64_t get_monotonic_time_us();
+
+HM10_Status init_hm10_ota_reliable(uint8_t window_size)
+{
+    if ((window_size==0) || (window_size>HM10_OTA_RELIABLE_MAX_WINDOW_SIZE))
+    {
+        return HM10_EC_ERR;
+    }
+
+    window = window_size;
+    memset(tx_slots, 0, sizeof(tx_slots));
+    memset(rx_slots, 0, sizeof(rx_slots));
+    tx_base = 0;
+    tx_next = 0;
+    rx_deliver = 0;
+    rx_next = 0;
+    rx_frame_size = 0;
+    srtt = 0;
+    rttvar = 0;
+    rto = HM10_OTA_RELIABLE_INITIAL_RTO;
+    memset(&reliable_stats, 0, sizeof(HM10_OTA_Reliable_Stats));
+    is_reliable_initialized = 1;
+
+    return HM10_EC_OK;
+}
+
+HM10_Status send_hm10_ota_reliable_data(uint8_t *data, uint32_t size)
+{
+    if (!is_reliable_initialized)
+    {
+        return HM10_EC_ERR;
+    }
+
+    /** <b>Local variable bytes_queued:</b> Bytes of the data that have been populated into DATA frames so far. */
+    uint32_t bytes_queued = 0;
+    /** <b>Local variable slot:</b> Pointer to the slot of the DATA frame that is being processed. */
+    HM10_OTA_Reliable_Tx_Slot *slot;
+    /** <b>Local variable current_time:</b> Current time in microseconds. */
+    uint64_t current_time;
+    /** <b>Local variable is_rto_expired:</b> Flag indicating whether the RTO of any DATA frame expired (i.e., 1) or not (i.e., 0). */
+    uint8_t is_rto_expired;
+    while ((bytes_queued<size) || (tx_base!=tx_next))
+    {
+        /* Send new DATA frames while there is room for them in the send window. */
+        while ((bytes_queued<size) && ((uint8_t) (tx_next-tx_base) < window))
+        {
+            slot = &tx_slots[tx_next & HM10_OTA_RELIABLE_SLOT_MASK];
+            slot->size = ((size-bytes_queued) > HM10_OTA_RELIABLE_MAX_PAYLOAD_SIZE) ? HM10_OTA_RELIABLE_MAX_PAYLOAD_SIZE : (uint8_t) (size-bytes_queued);
+            memcpy(slot->data, &data[bytes_queued], slot->size);
+            slot->is_acked = 0;
+            slot->retransmissions = 0;
+            slot->dupacks = 0;
+            if (send_data_frame(tx_next) != HM10_EC_OK)
+            {
+                return HM10_EC_ERR;
+            }
+            reliable_stats.frames_sent++;
+            bytes_queued += slot->size;
+            tx_next++;
+        }
+
+        /* Retransmit the DATA frames whose RTO expired. */
+        current_time = get_monotonic_time_us();
+        is_rto_expired = 0;
+        for (uint8_t seq=tx_base; seq!=tx_next; seq++)
+        {
+            slot = &tx_slots[seq & HM10_OTA_RELIABLE_SLOT_MASK];
+            if ((slot->is_acked) || ((current_time-slot->sent_time) < rto))
+            {
+                continue;
+            }
+            if (slot->retransmissions >= HM10_OTA_RELIABLE_MAX_RETRANSMISSIONS)
+            {
+                #if ETX_OTA_VERBOSE
+                    printf("ERROR: The DATA frame with Sequence Number %d was not acknowledged after %d retransmissions.\r\n", seq, slot->retransmissions);
+                #endif
+                is_reliable_initialized = 0;
+                return HM10_EC_ERR;
+            }
+            slot->retransmissions++;
+            slot->dupacks = 0;
+            if (send_data_frame(seq) != HM10_EC_OK)
+            {
+                return HM10_EC_ERR;
+            }
+            reliable_stats.retransmissions++;
+            is_rto_expired = 1;
+        }
+
+        /* Back off the RTO and slow down the pacer once per timeout event. */
+        if (is_rto_expired)
+        {
+            rto = ((rto*2) > HM10_OTA_RELIABLE_MAX_RTO) ? HM10_OTA_RELIABLE_MAX_RTO : (rto*2);
+            report_hm10_ota_pacer_drop();
+        }
+
+        /* Receive and process any incoming ACK (or DATA) frame. */
+        process_incoming_frame();
+    }
+
+    return HM10_EC_OK;
+}
+
+HM10_Status get_hm10_ota_reliable_data(uint8_t *data, uint16_t max_size, uint16_t *size)
+{
+    if ((!is_reliable_initialized) || (max_size<HM10_OTA_RELIABLE_MAX_PAYLOAD_SIZE))
+    {
+        return HM10_EC_ERR;
+    }
+
+    /* Receive frames until at least one DATA frame can be delivered in order. */
+    while (rx_deliver == rx_next)
+    {
+        if (process_incoming_frame() == HM10_EC_NR)
+        {
+            return HM10_EC_NR;
+        }
+    }
+
+    /* Deliver as many in-order DATA frames as they fit into the \p data param. */
+    /** <b>Local variable slot:</b> Pointer to the slot of the next DATA frame to be delivered. */
+    HM10_OTA_Reliable_Rx_Slot *slot = &rx_slots[rx_deliver & HM10_OTA_RELIABLE_SLOT_MASK];
+    *size = 0;
+    while ((rx_deliver!=rx_next) && ((*size + slot->size) <= max_size))
+    {
+        memcpy(&data[*size], slot->data, slot->size);
+        *size += slot->size;
+        slot->is_received = 0;
+        rx_deliver++;
+        slot = &rx_slots[rx_deliver & HM10_OTA_RELIABLE_SLOT_MASK];
+    }
+
+    return HM10_EC_OK;
+}
+
+void get_hm10_ota_reliable_stats(HM10_OTA_Reliable_Stats *stats)
+{
+    reliable_stats.srtt = srtt;
+    reliable_stats.rto = rto;
+    memcpy(stats, &reliable_stats, sizeof(HM10_OTA_Reliable_Stats));
+}
+
+static HM10_Status send_data_frame(uint8_t seq)
+{
+    /** <b>Local variable slot:</b> Pointer to the slot of the DATA frame that is desired to be sent. */
+    HM10_OTA_Reliable_Tx_Slot *slot = &tx_slots[seq & HM10_OTA_RELIABLE_SLOT_MASK];
+
+    frame_buffer[0] = slot->size & HM10_OTA_RELIABLE_LENGTH_MASK;
+    frame_buffer[1] = seq;
+    memcpy(&frame_buffer[HM10_OTA_RELIABLE_HEADER_SIZE], slot->data, slot->size);
+    if (send_frame(HM10_OTA_RELIABLE_HEADER_SIZE + slot->size) != HM10_EC_OK)
+    {
+        #if ETX_OTA_VERBOSE
+            printf("ERROR: The DATA frame with Sequence Number %d could not be sent.\r\n", seq);
+        #endif
+        return HM10_EC_ERR;
+    }
+    slot->sent_time = get_monotonic_time_us();
+
+    return HM10_EC_OK;
+}
+
+static void send_ack_frame()
+{
+    /* Populate the SACK bitmap with the DATA frames that were received after the missing one. */
+    /** <b>Local variable sack_bitmap:</b> SACK bitmap of the ACK frame. */
+    uint16_t sack_bitmap = 0;
+    /** <b>Local variable seq:</b> Sequence Number of the DATA frame that is being checked. */
+    uint8_t seq;
+    for (uint8_t n=0; n<(HM10_OTA_RELIABLE_ACK_PAYLOAD_SIZE*8); n++)
+    {
+        seq = rx_next + 1 + n;
+        if (((uint8_t) (seq-rx_deliver) < window) && (rx_slots[seq & HM10_OTA_RELIABLE_SLOT_MASK].is_received))
+        {
+            sack_bitmap |= (uint16_t) (1U << n);
+        }
+    }
+
+    frame_buffer[0] = HM10_OTA_RELIABLE_ACK_FLAG | HM10_OTA_RELIABLE_ACK_PAYLOAD_SIZE;
+    frame_buffer[1] = rx_next;
+    frame_buffer[2] = (uint8_t) sack_bitmap;
+    frame_buffer[3] = (uint8_t) (sack_bitmap >> 8);
+    if (send_frame(HM10_OTA_RELIABLE_HEADER_SIZE + HM10_OTA_RELIABLE_ACK_PAYLOAD_SIZE) == HM10_EC_OK)
+    {
+        reliable_stats.acks_sent++;
+    }
+}
+
+static HM10_Status send_frame(uint8_t size)
+{
+    /** <b>Local variable crc:</b> CRC32C of the Frame Header and of the payload of the frame. */
+    uint32_t crc = calculate_hm10_crc32c(frame_buffer, size);
+    for (uint8_t i=0; i<HM10_OTA_RELIABLE_CRC_SIZE; i++)
+    {
+        frame_buffer[size++] = (uint8_t) (crc >> (8*i));
+    }
+
+    return send_hm10_ota_data(frame_buffer, size);
+}
+
+static HM10_Status receive_frame_bytes(uint8_t size)
+{
+    /** <b>Local variable received:</b> Number of bytes that were received by each call. */
+    uint16_t received;
+    while (rx_frame_size < size)
+    {
+        if (get_hm10_ota_available_data(&rx_frame_buffer[rx_frame_size], size-rx_frame_size, &received) != HM10_EC_OK)
+        {
+            return HM10_EC_NR;
+        }
+        rx_frame_size += (uint8_t) received;
+    }
+
+    return HM10_EC_OK;
+}
+
+static void resync_frame()
+{
+    rx_frame_size--;
+    memmove(rx_frame_buffer, &rx_frame_buffer[1], rx_frame_size);
+}
+
+static HM10_Status process_incoming_frame()
+{
+    /* Receive the Frame Header, which may have already been received while resynchronizing. */
+    if (receive_frame_bytes(HM10_OTA_RELIABLE_HEADER_SIZE) != HM10_EC_OK)
+    {
+        if (rx_frame_size == 0)
+        {
+            return HM10_EC_NR;
+        }
+        reliable_stats.invalid_frames++;
+        resync_frame();
+        return HM10_EC_NA;
+    }
+    /** <b>Local variable is_ack:</b> Flag indicating whether the received frame is an ACK frame (i.e., 1) or a DATA frame (i.e., 0). */
+    uint8_t is_ack = (rx_frame_buffer[0] & HM10_OTA_RELIABLE_ACK_FLAG) ? 1 : 0;
+    /** <b>Local variable payload_size:</b> Length in bytes of the payload of the received frame. */
+    uint8_t payload_size = rx_frame_buffer[0] & HM10_OTA_RELIABLE_LENGTH_MASK;
+    if (((rx_frame_buffer[0]&HM10_OTA_RELIABLE_RESERVED_MASK) != 0)
+        || (is_ack && (payload_size!=HM10_OTA_RELIABLE_ACK_PAYLOAD_SIZE))
+        || (!is_ack && ((payload_size==0) || (payload_size>HM10_OTA_RELIABLE_MAX_PAYLOAD_SIZE))))
+    {
+        #if ETX_OTA_VERBOSE
+            printf("WARNING: An invalid Frame Header (0x%02X) was received and it will be discarded.\r\n", rx_frame_buffer[0]);
+        #endif
+        reliable_stats.invalid_frames++;
+        resync_frame();
+        return HM10_EC_NA;
+    }
+
+    /* Receive the exact length of payload that the Frame Header states, followed by the CRC32C of the frame. */
+    /** <b>Local variable frame_size:</b> Length in bytes of the Frame Header and of the payload of the received frame. */
+    uint8_t frame_size = HM10_OTA_RELIABLE_HEADER_SIZE + payload_size;
+    if (receive_frame_bytes(frame_size + HM10_OTA_RELIABLE_CRC_SIZE) != HM10_EC_OK)
+    {
+        reliable_stats.invalid_frames++;
+        resync_frame();
+        return HM10_EC_NA;
+    }
+    /** <b>Local variable crc:</b> CRC32C that was received at the end of the frame. */
+    uint32_t crc = 0;
+    for (uint8_t i=0; i<HM10_OTA_RELIABLE_CRC_SIZE; i++)
+    {
+        crc |= (uint32_t) rx_frame_buffer[frame_size + i] << (8*i);
+    }
+    if (crc != calculate_hm10_crc32c(rx_frame_buffer, frame_size))
+    {
+        #if ETX_OTA_VERBOSE
+            printf("WARNING: A frame with an invalid CRC32C was received and it will be discarded.\r\n");
+        #endif
+        reliable_stats.crc_errors++;
+        resync_frame();
+        return HM10_EC_NA;
+    }
+
+    /* Consume the frame before processing it, since processing it may send other frames. */
+    rx_frame_size = 0;
+    if (is_ack)
+    {
+        process_ack_frame(rx_frame_buffer[1], (uint16_t) (rx_frame_buffer[2] | (rx_frame_buffer[3] << 8)));
+    }
+    else
+    {
+        process_data_frame(rx_frame_buffer[1], &rx_frame_buffer[HM10_OTA_RELIABLE_HEADER_SIZE], payload_size);
+    }
+
+    return HM10_EC_OK;
+}
+
+static void process_ack_frame(uint8_t cumulative_ack, uint16_t sack_bitmap)
+{
+    reliable_stats.acks_received++;
+
+    /* Ignore the ACK frames that are older than the send window. */
+    /** <b>Local variable in_flight:</b> Number of DATA frames in the send window. */
+    uint8_t in_flight = tx_next - tx_base;
+    if ((uint8_t) (cumulative_ack-tx_base) > in_flight)
+    {
+        return;
+    }
+
+    /* Mark the cumulatively acknowledged DATA frames. */
+    /** <b>Local variable seq:</b> Sequence Number of the DATA frame that is being processed. */
+    uint8_t seq;
+    for (seq=tx_base; seq!=cumulative_ack; seq++)
+    {
+        acknowledge_data_frame(seq);
+    }
+
+    /* Mark the selectively acknowledged DATA frames. */
+    /** <b>Local variable highest_sacked:</b> Sequence Number after the highest selectively acknowledged DATA frame. */
+    uint8_t highest_sacked = cumulative_ack;
+    for (uint8_t n=0; n<(HM10_OTA_RELIABLE_ACK_PAYLOAD_SIZE*8); n++)
+    {
+        seq = cumulative_ack + 1 + n;
+        if ((sack_bitmap & (1U << n)) && ((uint8_t) (seq-tx_base) < in_flight))
+        {
+            acknowledge_data_frame(seq);
+            highest_sacked = seq + 1;
+        }
+    }
+
+    /* Fast retransmit the DATA frames that are still missing behind the selectively acknowledged ones. */
+    /** <b>Local variable slot:</b> Pointer to the slot of the DATA frame that is being processed. */
+    HM10_OTA_Reliable_Tx_Slot *slot;
+    for (seq=cumulative_ack; seq!=highest_sacked; seq++)
+    {
+        slot = &tx_slots[seq & HM10_OTA_RELIABLE_SLOT_MASK];
+        if ((slot->is_acked) || (++slot->dupacks != HM10_OTA_RELIABLE_DUPACK_THRESHOLD))
+        {
+            continue;
+        }
+        slot->retransmissions++;
+        if (send_data_frame(seq) == HM10_EC_OK)
+        {
+            reliable_stats.fast_retransmissions++;
+            report_hm10_ota_pacer_drop();
+        }
+    }
+
+    /* Slide the send window. */
+    while ((tx_base!=tx_next) && (tx_slots[tx_base & HM10_OTA_RELIABLE_SLOT_MASK].is_acked))
+    {
+        tx_base++;
+    }
+}
+
+static void process_data_frame(uint8_t seq, uint8_t *payload, uint8_t size)
+{
+    /* Store the DATA frame if it is new and within the receive window. */
+    /** <b>Local variable slot:</b> Pointer to the slot of the received DATA frame. */
+    HM10_OTA_Reliable_Rx_Slot *slot = &rx_slots[seq & HM10_OTA_RELIABLE_SLOT_MASK];
+    if (((uint8_t) (seq-rx_deliver) < window) && (!slot->is_received))
+    {
+        memcpy(slot->data, payload, size);
+        slot->size = size;
+        slot->is_received = 1;
+        reliable_stats.frames_received++;
+
+        /* Advance the cumulative ACK over the DATA frames that are now in order. */
+        while (((uint8_t) (rx_next-rx_deliver) < window) && (rx_slots[rx_next & HM10_OTA_RELIABLE_SLOT_MASK].is_received))
+        {
+            rx_next++;
+        }
+    }
+    else
+    {
+        reliable_stats.duplicates_received++;
+    }
+
+    /* Acknowledge every DATA frame, including the duplicated ones, in case that a previous ACK frame was lost. */
+    send_ack_frame();
+}
+
+static void acknowledge_data_frame(uint8_t seq)
+{
+    /** <b>Local variable slot:</b> Pointer to the slot of the acknowledged DATA frame. */
+    HM10_OTA_Reliable_Tx_Slot *slot = &tx_slots[seq & HM10_OTA_RELIABLE_SLOT_MASK];
+    if (slot->is_acked)
+    {
+        return;
+    }
+
+    slot->is_acked = 1;
+    if (slot->retransmissions == 0)
+    {
+        update_rtt_estimation((uint32_t) (get_monotonic_time_us() - slot->sent_time));
+    }
+    report_hm10_ota_pacer_echo(slot->size);
+}
+
+static void update_rtt_estimation(uint32_t sample)
+{
+    /** <b>Local variable delta:</b> Absolute difference between the new RTT sample and the smoothed RTT. */
+    uint32_t delta;
+
+    /* Apply the same estimation as TCP (i.e., with gains of 1/8 for the smoothed RTT and of 1/4 for its variation). */
+    if (sample == 0)
+    {
+        sample = 1;
+    }
+    if (srtt == 0)
+    {
+        srtt = sample;
+        rttvar = sample / 2;
+    }
+    else
+    {
+        delta = (sample > srtt) ? (sample - srtt) : (srtt - sample);
+        rttvar = (3*rttvar + delta) / 4;
+        srtt = (7*srtt + sample) / 8;
+    }
+
+    /* Derive the RTO from the new estimation. */
+    rto = srtt + 4*rttvar;
+    if (rto < HM10_OTA_RELIABLE_MIN_RTO)
+    {
+        rto = HM10_OTA_RELIABLE_MIN_RTO;
+    }
+    else if (rto > HM10_OTA_RELIABLE_MAX_RTO)
+    {
+        rto = HM10_OTA_RELIABLE_MAX_RTO;
+    }
+}
+
+static uint64_t get_monotonic_time_us()
+{
+    /** <b>Local variable current_time:</b> Current time of the monotonic clock of our host machine. */
+    struct timespec current_time;
+    clock_gettime(CLOCK_MONOTONIC, &current_time);
+
+    return ((uint64_t) current_time.tv_sec)*1000000U + ((uint64_t) current_time.tv_nsec)/1000U;
+}
+
+/** @} */
@@ -0,0 +1,202 @@
+/** @addtogroup hm10_trace
+ * @{
+ */
+
+#include "../Inc/hm10_trace.h"
+
+#if HM10_TRACE
+#include <time.h> // Library from which "clock_gettime()" is located at.
+#if HM10_TRACE_RDTSC
+#include <unistd.h> // Library for using the "usleep()" function.
+#include <x86intrin.h> // Library from which "__rdtsc()" is located at.
+#endif
+
+#if (HM10_TRACE_RING_SIZE & (HM10_TRACE_RING_SIZE - 1)) != 0
+#error "HM10_TRACE_RING_SIZE must be a power of 2."
+#endif
+#if HM10_TRACE_RDTSC && !(defined(__x86_64__) || defined(__i386__))
+#error "HM10_TRACE_RDTSC requires an x86 processor."
+#endif
+
+#define HM10_TRACE_PRINT_CHUNK_SIZE         (32)        /**< @brief Number of records that the @ref print_hm10_trace function reads from the trace ring at once. */
+#define HM10_TRACE_RDTSC_CALIBRATION_TIME   (10000U)    /**< @brief Time in microseconds during which the Time Stamp Counter is calibrated against the monotonic clock. */
+
+/**@brief	Slot of the trace ring.
+ */
+typedef struct
+{
+    volatile uint32_t sequence;         //!< One plus the number of records that had been claimed before the record of this slot, once that record has been published, or the number of those records while it is being written.
+    volatile HM10_Trace_Record record;  //!< Record of this slot.
+} HM10_Trace_Slot;
+
+static HM10_Trace_Slot trace_ring[HM10_TRACE_RING_SIZE];   /**< @brief Ring of trace records. */
+static volatile uint32_t trace_claimed = 0;                 /**< @brief Total number of records that have been claimed by the trace points. */
+static uint32_t trace_read = 0;                             /**< @brief Total number of records that have been read or lost. */
+static uint32_t trace_ticks_per_us = 1000;                  /**< @brief Number of ticks per microsecond of the clock with which the records are timestamped. */
+static const char *trace_point_names[HM10_Trace_Points_Count] = {"SEND_START", "SEND_DONE", "FIRST_RX_BYTE", "LAST_RX_BYTE", "PARSE_DONE", "CALLBACK_DISPATCH"}; /**< @brief Names with which each trace point is printed by the @ref print_hm10_trace function. */
+
+/**@brief	Gets the current time of the clock with which the records are timestamped.
+ *
+ * @return  The current value of the Time Stamp Counter if @ref HM10_TRACE_RDTSC is enabled or, otherwise, the current
+ *          time in nanoseconds of the monotonic clock of our host machine.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+static inline uint64_t get_trace_timestamp();
+
+void init_hm10_trace()
+{
+    /* Discard all the records. */
+    for (uint32_t slot=0; slot<HM10_TRACE_RING_SIZE; slot++)
+    {
+        trace_ring[slot].sequence = 0;
+    }
+    trace_claimed = 0;
+    trace_read = 0;
+
+#if HM10_TRACE_RDTSC
+    /* Calibrate the Time Stamp Counter by counting its ticks during a known interval of the monotonic clock. */
+    /** <b>Local variable start_time:</b> Time of the monotonic clock at the start of the calibration. */
+    struct timespec start_time;
+    /** <b>Local variable end_time:</b> Time of the monotonic clock at the end of the calibration. */
+    struct timespec end_time;
+    clock_gettime(CLOCK_MONOTONIC, &start_time);
+    /** <b>Local variable start_ticks:</b> Value of the Time Stamp Counter at the start of the calibration. */
+    uint64_t start_ticks = __rdtsc();
+    usleep(HM10_TRACE_RDTSC_CALIBRATION_TIME);
+    clock_gettime(CLOCK_MONOTONIC, &end_time);
+    /** <b>Local variable end_ticks:</b> Value of the Time Stamp Counter at the end of the calibration. */
+    uint64_t end_ticks = __rdtsc();
+    /** <b>Local variable elapsed_time:</b> Time in nanoseconds that the calibration took. */
+    uint64_t elapsed_time = ((uint64_t) (end_time.tv_sec - start_time.tv_sec))*1000000000U + (uint64_t) end_time.tv_nsec - (uint64_t) start_time.tv_nsec;
+    trace_ticks_per_us = (uint32_t) ((end_ticks - start_ticks)*1000U/elapsed_time);
+#endif
+}
+
+void record_hm10_trace(HM10_Trace_Point point, uint16_t arg)
+{
+    /** <b>Local variable timestamp:</b> Time at which the trace point was reached. */
+    uint64_t timestamp = get_trace_timestamp();
+
+    /* Claim the next record, which is not shared with any other trace point that is reached at the same time. */
+    /** <b>Local variable index:</b> Number of records that had been claimed before the one of this trace point. */
+    uint32_t index = __atomic_fetch_add(&trace_claimed, 1, __ATOMIC_RELAXED);
+    /** <b>Local variable p_slot:</b> Pointer to the slot of the trace ring into which the record is written. */
+    HM10_Trace_Slot *p_slot = &trace_ring[index & (HM10_TRACE_RING_SIZE - 1)];
+
+    /* Write the record while its slot is marked as being written, and then publish it. */
+    __atomic_store_n(&p_slot->sequence, index, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    p_slot->record.timestamp = timestamp;
+    p_slot->record.arg = arg;
+    p_slot->record.point = (uint8_t) point;
+    __atomic_store_n(&p_slot->sequence, index + 1, __ATOMIC_RELEASE);
+}
+
+uint16_t read_hm10_trace(HM10_Trace_Record *records, uint16_t max_records, uint32_t *lost)
+{
+    /** <b>Local variable count:</b> Number of records that have been read. */
+    uint16_t count = 0;
+    /** <b>Local variable lost_records:</b> Number of records that were overwritten before they could be read. */
+    uint32_t lost_records = 0;
+    /** <b>Local variable claimed:</b> Total number of records that had been claimed when the reading started. */
+    uint32_t claimed = __atomic_load_n(&trace_claimed, __ATOMIC_ACQUIRE);
+    /** <b>Local variable p_slot:</b> Pointer to the slot of the trace ring of the record that is being read. */
+    HM10_Trace_Slot *p_slot;
+    /** <b>Local variable sequence:</b> Sequence value that the slot of the record that is being read had before copying it. */
+    uint32_t sequence;
+
+    /* Skip the records that have already been overwritten by newer ones. */
+    if ((claimed - trace_read) > HM10_TRACE_RING_SIZE)
+    {
+        lost_records = claimed - trace_read - HM10_TRACE_RING_SIZE;
+        trace_read = claimed - HM10_TRACE_RING_SIZE;
+    }
+
+    while ((count < max_records) && (trace_read != claimed))
+    {
+        /* Stop at a record that has not been published yet, and skip the ones that were overwritten in the meantime. */
+        p_slot = &trace_ring[trace_read & (HM10_TRACE_RING_SIZE - 1)];
+        sequence = __atomic_load_n(&p_slot->sequence, __ATOMIC_ACQUIRE);
+        if ((int32_t) (sequence - (trace_read + 1)) < 0)
+        {
+            break;
+        }
+        if (sequence != (trace_read + 1))
+        {
+            lost_records++;
+            trace_read++;
+            continue;
+        }
+
+        /* Copy the record and keep it only if it was not overwritten while it was being copied. */
+        records[count].timestamp = p_slot->record.timestamp;
+        records[count].arg = p_slot->record.arg;
+        records[count].point = p_slot->record.point;
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        if (__atomic_load_n(&p_slot->sequence, __ATOMIC_RELAXED) == sequence)
+        {
+            count++;
+        }
+        else
+        {
+            lost_records++;
+        }
+        trace_read++;
+    }
+
+    if (lost != NULL)
+    {
+        *lost = lost_records;
+    }
+
+    return count;
+}
+
+uint32_t get_hm10_trace_ticks_per_us()
+{
+    return trace_ticks_per_us;
+}
+
+void print_hm10_trace(FILE *file)
+{
+    /** <b>Local variable records:</b> Records that have been read from the trace ring and that are pending to be printed. */
+    HM10_Trace_Record records[HM10_TRACE_PRINT_CHUNK_SIZE];
+    /** <b>Local variable count:</b> Number of records in the @ref records Local Variable. */
+    uint16_t count;
+    /** <b>Local variable lost:</b> Number of records that were lost in the last read of the trace ring. */
+    uint32_t lost;
+    /** <b>Local variable total_lost:</b> Number of records that were lost in all the reads of the trace ring. */
+    uint32_t total_lost = 0;
+
+    fprintf(file, "HM10_TRACE BEGIN ticks_per_us=%u timestamp_bits=64\n", trace_ticks_per_us);
+    do
+    {
+        count = read_hm10_trace(records, HM10_TRACE_PRINT_CHUNK_SIZE, &lost);
+        total_lost += lost;
+        for (uint16_t i=0; i<count; i++)
+        {
+            fprintf(file, "%s %llu %u\n", trace_point_names[records[i].point], (unsigned long long) records[i].timestamp, records[i].arg);
+        }
+    }
+    while (count == HM10_TRACE_PRINT_CHUNK_SIZE);
+    fprintf(file, "HM10_TRACE END lost=%u\n", total_lost);
+}
+
+static inline uint64_t get_trace_timestamp()
+{
+#if HM10_TRACE_RDTSC
+    return __rdtsc();
+#else
+    /** <b>Local variable current_time:</b> Current time of the monotonic clock of our host machine. */
+    struct timespec current_time;
+    clock_gettime(CLOCK_MONOTONIC, &current_time);
+
+    return ((uint64_t) current_time.tv_sec)*1000000000U + (uint64_t) current_time.tv_nsec;
+#endif
+}
+
+#endif /* HM10_TRACE */
+
+/** @} */
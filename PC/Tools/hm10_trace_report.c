@@ -0,0 +1,393 @@
+/** @addtogroup hm10_trace
+ * @{
+ */
+
+/**@file
+ * @brief	HM-10 Trace Report tool.
+ *
+ * @details Reads the dumps that the print_hm10_trace() function of the @ref hm10_trace prints, either from the PC
+ *          library or from the STMicroelectronics library, and reports the per-phase latency breakdown of the Commands
+ *          and of the exchanges of data Over the Air (OTA) that they recorded. Any other line of its input is ignored,
+ *          so that the dumps can be mixed with the rest of the output of the application. It is built and used as
+ *          follows:
+ *
+ * @code
+  gcc -O2 -o hm10_trace_report hm10_trace_report.c
+  ./hm10_trace_report trace.log      # Or pipe the output of the application into "./hm10_trace_report".
+ * @endcode
+ *
+ * @details The records are grouped into transactions, each of which starts at a SEND_START record, or at a FIRST_RX_BYTE
+ *          or PARSE_DONE record when the current transaction has already gone past that point. The receptions that
+ *          follow a SEND_START record are merged into its transaction (e.g., the two parts of the Connect-To-Address
+ *          Response). Each transaction is then split into the following phases, where a phase whose records are
+ *          missing is left out:<br><br>
+ *          - send: SEND_START to SEND_DONE (i.e., the write into the RS-232 Port or the UART transmission).<br>
+ *          - wait: SEND_DONE to FIRST_RX_BYTE (i.e., the wire time of the Command, the time that the HM-10 BT Device
+ *            takes to think its Response, the wire time of its first byte and the granularity of the poll sleeps).<br>
+ *          - receive: FIRST_RX_BYTE to LAST_RX_BYTE (i.e., the wire time of the rest of the data).<br>
+ *          - parse: LAST_RX_BYTE to PARSE_DONE.<br>
+ *          - dispatch: PARSE_DONE to CALLBACK_DISPATCH.<br>
+ *          - total: from the first to the last record of the transaction.<br><br>
+ *          The transactions are reported by the tag of their PARSE_DONE record (i.e., their Command) or, if they do not
+ *          have one, by the kind of exchange of data OTA that they are.
+ *
+ * @author 	Cesar Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026.
+ */
+
+#include <stdio.h>	// Library from which "printf()" and "fgets()" are located at.
+#include <stdint.h> // This library contains the aliases: uint8_t, uint16_t, uint32_t, etc.
+#include <stdlib.h> // Library from which "realloc()" and "qsort()" are located at.
+#include <string.h>	// Library from which "strcmp()" and "strncmp()" are located at.
+#include <ctype.h> // Library from which "isprint()" is located at.
+
+#define TRACE_POINTS                (6)         /**< @brief Number of trace points of the @ref hm10_trace . */
+#define TRACE_PHASES                (6)         /**< @brief Number of phases into which each transaction is split, including its total. */
+#define TRACE_MAX_GROUPS            (64)        /**< @brief Maximum number of different groups of transactions that are reported. */
+#define TRACE_LINE_SIZE             (256)       /**< @brief Maximum length in bytes of each line of the input. */
+#define TRACE_SEND_START            (0)         /**< @brief Index of the SEND_START trace point. */
+#define TRACE_FIRST_RX_BYTE         (2)         /**< @brief Index of the FIRST_RX_BYTE trace point. */
+#define TRACE_LAST_RX_BYTE          (3)         /**< @brief Index of the LAST_RX_BYTE trace point. */
+#define TRACE_PARSE_DONE            (4)         /**< @brief Index of the PARSE_DONE trace point. */
+#define TRACE_OTA_MESSAGE_TAG       (0x4D53U)   /**< @brief Tag of the PARSE_DONE records of the messages of the HM-10 OTA Message Layer of the PC library. */
+
+/**@brief	Transaction that is being assembled from the records.
+ */
+typedef struct
+{
+    uint64_t time[TRACE_POINTS];    //!< Time in ticks at which each trace point was reached.
+    uint8_t reached[TRACE_POINTS];  //!< Whether each trace point was reached.
+    uint16_t tag;                   //!< Argument of the PARSE_DONE record.
+    int last_point;                 //!< Latest trace point that was reached, or -1 if none.
+    uint8_t started_by_send;        //!< Whether the transaction started at a SEND_START record.
+} Trace_Transaction;
+
+/**@brief	Latency samples of a group of transactions.
+ */
+typedef struct
+{
+    char name[40];                  //!< Name of the group.
+    uint32_t transactions;          //!< Number of transactions in the group.
+    double *samples[TRACE_PHASES];  //!< Samples in microseconds of each phase.
+    uint32_t count[TRACE_PHASES];   //!< Number of samples of each phase.
+    uint32_t capacity[TRACE_PHASES];//!< Number of samples that fit into the buffer of each phase.
+} Trace_Group;
+
+static const char *point_names[TRACE_POINTS] = {"SEND_START", "SEND_DONE", "FIRST_RX_BYTE", "LAST_RX_BYTE", "PARSE_DONE", "CALLBACK_DISPATCH"}; /**< @brief Names of the trace points in the dumps. */
+static const char *phase_names[TRACE_PHASES] = {"send", "wait", "receive", "parse", "dispatch", "total"}; /**< @brief Names of the phases. */
+static const char *command_names[] = {"Test", "Reset", "Renew", "Set Name", "Get Name", "Set Role", "Get Role", "Set Pin",
+                                      "Get Pin", "Set Type", "Get Type", "Set Mode", "Get Mode", "Set IMME", "Get IMME",
+                                      "Set NOTI", "Get NOTI", "Get Address", "Connect-To-Address", "Disconnect"}; /**< @brief Names of the Command Types of the PC library, which are the tags of its PARSE_DONE records. */
+static Trace_Group groups[TRACE_MAX_GROUPS];   /**< @brief Groups of transactions. */
+static int group_count = 0;                     /**< @brief Number of groups in the @ref groups buffer. */
+static Trace_Transaction transaction;           /**< @brief Transaction that is being assembled. */
+static double ticks_per_us = 1;                 /**< @brief Ticks per microsecond of the timestamps of the current dump. */
+static uint32_t timestamp_bits = 64;            /**< @brief Width in bits of the timestamps of the current dump. */
+static uint64_t last_raw_timestamp = 0;         /**< @brief Last timestamp read from the current dump, as it was printed. */
+static uint64_t extended_time = 0;              /**< @brief Last timestamp read, extended to 64 bits across the wraps of the timestamps. */
+static uint8_t has_time = 0;                    /**< @brief Whether a timestamp has been read from the current dump. */
+static uint32_t records = 0;                    /**< @brief Number of records that have been read. */
+static uint32_t lost_records = 0;               /**< @brief Number of records that the dumps reported as lost. */
+static uint32_t orphan_records = 0;             /**< @brief Number of transactions with a single record, which have no phases. */
+
+/**@brief	Reads a record and adds it into the current transaction.
+ *
+ * @param point     Trace point of the record.
+ * @param timestamp Timestamp of the record, as it was printed.
+ * @param arg       Argument of the record.
+ */
+static void add_record(int point, uint64_t timestamp, uint16_t arg);
+
+/**@brief	Adds the phases of the current transaction into its group and clears it.
+ */
+static void finish_transaction(void);
+
+/**@brief	Adds a sample into a phase of a group.
+ *
+ * @param p_group   Pointer to the group.
+ * @param phase     Index of the phase.
+ * @param sample    Sample in microseconds.
+ */
+static void add_sample(Trace_Group *p_group, int phase, double sample);
+
+/**@brief	Gets the group of a transaction, creating it if it does not exist yet.
+ *
+ * @param p_transaction Pointer to the transaction.
+ *
+ * @return  Pointer to the group.
+ */
+static Trace_Group *get_group(const Trace_Transaction *p_transaction);
+
+/**@brief	Compares two samples for the qsort() function.
+ */
+static int compare_samples(const void *a, const void *b);
+
+/**@brief	Prints the per-phase latency breakdown of all the groups.
+ */
+static void print_report(void);
+
+int main(int argc, char **argv)
+{
+    /** <b>Local variable line:</b> Line that is being read. */
+    char line[TRACE_LINE_SIZE];
+    /** <b>Local variable name:</b> Name of the trace point of the line that is being read. */
+    char name[TRACE_LINE_SIZE];
+    /** <b>Local variable in_dump:</b> Whether the lines that are being read are inside of a dump. */
+    uint8_t in_dump = 0;
+
+    transaction.last_point = -1;
+    for (int file_index=1; (file_index<argc) || (file_index==1); file_index++)
+    {
+        /** <b>Local variable file:</b> File that is being read. */
+        FILE *file = (argc > 1) ? fopen(argv[file_index], "r") : stdin;
+        if (file == NULL)
+        {
+            fprintf(stderr, "ERROR: The file %s could not be opened.\n", argv[file_index]);
+            return 1;
+        }
+        while (fgets(line, sizeof(line), file) != NULL)
+        {
+            /** <b>Local variable value1:</b> First number of the line. */
+            unsigned long long value1;
+            /** <b>Local variable value2:</b> Second number of the line. */
+            unsigned int value2;
+            if (sscanf(line, "HM10_TRACE BEGIN ticks_per_us=%llu timestamp_bits=%u", &value1, &value2) == 2)
+            {
+                ticks_per_us = (value1 == 0) ? 1 : (double) value1;
+                timestamp_bits = value2;
+                has_time = 0;
+                in_dump = 1;
+                continue;
+            }
+            if (sscanf(line, "HM10_TRACE END lost=%u", &value2) == 1)
+            {
+                lost_records += value2;
+                in_dump = 0;
+                continue;
+            }
+            if (!in_dump || (sscanf(line, "%255s %llu %u", name, &value1, &value2) != 3))
+            {
+                continue;
+            }
+            for (int point=0; point<TRACE_POINTS; point++)
+            {
+                if (strcmp(name, point_names[point]) == 0)
+                {
+                    add_record(point, value1, (uint16_t) value2);
+                    break;
+                }
+            }
+        }
+        if (file != stdin)
+        {
+            fclose(file);
+        }
+    }
+    finish_transaction();
+    print_report();
+
+    return 0;
+}
+
+static void add_record(int point, uint64_t timestamp, uint16_t arg)
+{
+    /* Extend the timestamp to 64 bits, since the ones of the DWT Cycle Counter wrap around every 2^32 cycles. */
+    if (has_time && (timestamp_bits < 64))
+    {
+        extended_time += (timestamp - last_raw_timestamp) & ((1ULL << timestamp_bits) - 1);
+    }
+    else
+    {
+        extended_time = timestamp;
+    }
+    last_raw_timestamp = timestamp;
+    has_time = 1;
+    records++;
+
+    /* Start a new transaction if this record cannot belong to the current one. */
+    /** <b>Local variable merge:</b> Whether this record is another reception of the Response of a Command. */
+    uint8_t merge = transaction.started_by_send && !transaction.reached[TRACE_PARSE_DONE] && ((point == TRACE_FIRST_RX_BYTE) || (point == TRACE_LAST_RX_BYTE));
+    if ((transaction.last_point >= 0) && ((point == TRACE_SEND_START) || ((point <= transaction.last_point) && !merge)))
+    {
+        finish_transaction();
+    }
+    if (transaction.last_point < 0)
+    {
+        transaction.started_by_send = (point == TRACE_SEND_START);
+    }
+
+    /* Keep the first byte of the first reception and the last byte of the last one. */
+    if (!((point == TRACE_FIRST_RX_BYTE) && transaction.reached[TRACE_FIRST_RX_BYTE]))
+    {
+        transaction.time[point] = extended_time;
+        transaction.reached[point] = 1;
+    }
+    if (point == TRACE_PARSE_DONE)
+    {
+        transaction.tag = arg;
+    }
+    if (point > transaction.last_point)
+    {
+        transaction.last_point = point;
+    }
+}
+
+static void finish_transaction(void)
+{
+    /** <b>Local variable first:</b> Earliest trace point of the transaction. */
+    int first = -1;
+    /** <b>Local variable previous:</b> Latest trace point of the transaction before the one that is being processed. */
+    int previous = -1;
+    /** <b>Local variable reached:</b> Number of trace points of the transaction. */
+    int reached = 0;
+
+    for (int point=0; point<TRACE_POINTS; point++)
+    {
+        reached += transaction.reached[point];
+    }
+    if (reached == 1)
+    {
+        orphan_records++;
+    }
+    if (reached > 1)
+    {
+        /** <b>Local variable p_group:</b> Pointer to the group of the transaction. */
+        Trace_Group *p_group = get_group(&transaction);
+        p_group->transactions++;
+        for (int point=0; point<TRACE_POINTS; point++)
+        {
+            if (!transaction.reached[point])
+            {
+                continue;
+            }
+            if (first < 0)
+            {
+                first = point;
+            }
+            else if (previous == (point - 1))
+            {
+                add_sample(p_group, point - 1, (double) (transaction.time[point] - transaction.time[previous])/ticks_per_us);
+            }
+            previous = point;
+        }
+        add_sample(p_group, TRACE_PHASES - 1, (double) (transaction.time[previous] - transaction.time[first])/ticks_per_us);
+    }
+    memset(&transaction, 0, sizeof(transaction));
+    transaction.last_point = -1;
+}
+
+static void add_sample(Trace_Group *p_group, int phase, double sample)
+{
+    if (p_group->count[phase] == p_group->capacity[phase])
+    {
+        p_group->capacity[phase] = (p_group->capacity[phase] == 0) ? 64 : 2*p_group->capacity[phase];
+        p_group->samples[phase] = realloc(p_group->samples[phase], p_group->capacity[phase]*sizeof(double));
+        if (p_group->samples[phase] == NULL)
+        {
+            fprintf(stderr, "ERROR: Out of memory.\n");
+            exit(1);
+        }
+    }
+    p_group->samples[phase][p_group->count[phase]++] = sample;
+}
+
+static Trace_Group *get_group(const Trace_Transaction *p_transaction)
+{
+    /** <b>Local variable name:</b> Name of the group of the transaction. */
+    char name[sizeof(groups[0].name)];
+    /** <b>Local variable tag_high:</b> Most significant byte of the tag of the transaction. */
+    int tag_high = p_transaction->tag >> 8;
+    /** <b>Local variable tag_low:</b> Least significant byte of the tag of the transaction. */
+    int tag_low = p_transaction->tag & 0xFF;
+
+    if (p_transaction->reached[TRACE_PARSE_DONE])
+    {
+        if (p_transaction->tag == TRACE_OTA_MESSAGE_TAG)
+        {
+            snprintf(name, sizeof(name), "OTA message");
+        }
+        else if (p_transaction->tag < (sizeof(command_names)/sizeof(command_names[0])))
+        {
+            snprintf(name, sizeof(name), "%s", command_names[p_transaction->tag]);
+        }
+        else if (isprint(tag_high) && isprint(tag_low))
+        {
+            snprintf(name, sizeof(name), "Command \"%c%c\"", tag_high, tag_low);
+        }
+        else
+        {
+            snprintf(name, sizeof(name), "Tag 0x%04X", p_transaction->tag);
+        }
+    }
+    else if (p_transaction->reached[TRACE_SEND_START] && p_transaction->reached[TRACE_LAST_RX_BYTE])
+    {
+        snprintf(name, sizeof(name), "OTA round trip");
+    }
+    else if (p_transaction->reached[TRACE_SEND_START])
+    {
+        snprintf(name, sizeof(name), "OTA send");
+    }
+    else
+    {
+        snprintf(name, sizeof(name), "OTA receive");
+    }
+
+    for (int group=0; group<group_count; group++)
+    {
+        if (strcmp(groups[group].name, name) == 0)
+        {
+            return &groups[group];
+        }
+    }
+    if (group_count == TRACE_MAX_GROUPS)
+    {
+        return &groups[TRACE_MAX_GROUPS - 1];
+    }
+    snprintf(groups[group_count].name, sizeof(groups[group_count].name), "%s", name);
+
+    return &groups[group_count++];
+}
+
+static int compare_samples(const void *a, const void *b)
+{
+    /** <b>Local variable sample_a:</b> First sample. */
+    double sample_a = *(const double *) a;
+    /** <b>Local variable sample_b:</b> Second sample. */
+    double sample_b = *(const double *) b;
+
+    return (sample_a > sample_b) - (sample_a < sample_b);
+}
+
+static void print_report(void)
+{
+    printf("%u record(s) read, %u lost, %u without a phase.\n", records, lost_records, orphan_records);
+    printf("%-24s %-9s %7s %12s %12s %12s %12s %12s\n", "Transaction", "Phase", "Samples", "Min [us]", "Mean [us]", "P50 [us]", "P99 [us]", "Max [us]");
+    for (int group=0; group<group_count; group++)
+    {
+        /** <b>Local variable name:</b> Name of the group, which is printed only in its first row. */
+        const char *name = groups[group].name;
+        for (int phase=0; phase<TRACE_PHASES; phase++)
+        {
+            /** <b>Local variable count:</b> Number of samples of the phase. */
+            uint32_t count = groups[group].count[phase];
+            /** <b>Local variable samples:</b> Samples of the phase. */
+            double *samples = groups[group].samples[phase];
+            if (count == 0)
+            {
+                continue;
+            }
+            qsort(samples, count, sizeof(double), compare_samples);
+            /** <b>Local variable sum:</b> Sum of the samples of the phase. */
+            double sum = 0;
+            for (uint32_t i=0; i<count; i++)
+            {
+                sum += samples[i];
+            }
+            printf("%-24s %-9s %7u %12.1f %12.1f %12.1f %12.1f %12.1f\n", name,
+                   phase_names[phase], count, samples[0], sum/count, samples[(count - 1)*50/100], samples[(count - 1)*99/100], samples[count - 1]);
+            name = "";
+        }
+    }
+}
+
+/** @} */
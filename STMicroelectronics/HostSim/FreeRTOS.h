@@ -0,0 +1,76 @@
+/** @addtogroup hm10_sim
+ * @{
+ */
+
+/**@file
+ * @brief	FreeRTOS Stub Header file.
+ *
+ * @details This header file replaces the "FreeRTOS.h" header file of the FreeRTOS Kernel whenever the @ref hm10_rtos is
+ *          compiled on a host machine, so that its code can be compiled without any change. It only declares the
+ *          subset of the types, of the configuration and of the API of the FreeRTOS Kernel that the @ref hm10_rtos
+ *          uses, with their actual signatures, but none of them is implemented since the @ref hm10_rtos is only
+ *          compiled and not run (see the "rtos" target of the Makefile of this folder). The "task.h", "semphr.h" and
+ *          "stream_buffer.h" header files of this folder simply include this one.
+ *
+ * @author 	Cesar Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026.
+ */
+
+#ifndef INC_FREERTOS_H
+#define INC_FREERTOS_H
+
+#include <stddef.h> // Library from which "size_t" is located at.
+#include <stdint.h> // This library contains the aliases: uint8_t, uint16_t, uint32_t, etc.
+
+typedef long BaseType_t;
+typedef unsigned long UBaseType_t;
+typedef uint32_t TickType_t;
+typedef void *TaskHandle_t;
+typedef void *SemaphoreHandle_t;
+typedef void *StreamBufferHandle_t;
+typedef void (*TaskFunction_t)(void *);
+
+/**@brief	Actions that can be performed when notifying a task.
+ */
+typedef enum
+{
+	eNoAction = 0,
+	eSetBits,
+	eIncrement,
+	eSetValueWithOverwrite,
+	eSetValueWithoutOverwrite
+} eNotifyAction;
+
+#define configTICK_RATE_HZ                  ((TickType_t) 1000U)
+
+#define pdFALSE                             ((BaseType_t) 0)
+#define pdTRUE                              ((BaseType_t) 1)
+#define pdPASS                              (pdTRUE)
+#define pdFAIL                              (pdFALSE)
+#define portMAX_DELAY                       ((TickType_t) 0xFFFFFFFFUL)
+#define portTICK_PERIOD_MS                  ((TickType_t) 1000U/configTICK_RATE_HZ)
+#define pdMS_TO_TICKS(xTimeInMs)            ((TickType_t) (((uint64_t) (xTimeInMs)*(uint64_t) configTICK_RATE_HZ)/(uint64_t) 1000U))
+#define pdTICKS_TO_MS(xTimeInTicks)         ((TickType_t) (((uint64_t) (xTimeInTicks)*(uint64_t) 1000U)/(uint64_t) configTICK_RATE_HZ))
+#define portYIELD_FROM_ISR(x)               ((void) (x))
+
+BaseType_t xTaskCreate(TaskFunction_t pxTaskCode, const char *pcName, uint16_t usStackDepth, void *pvParameters, UBaseType_t uxPriority, TaskHandle_t *pxCreatedTask);
+TickType_t xTaskGetTickCount(void);
+TaskHandle_t xTaskGetCurrentTaskHandle(void);
+BaseType_t xTaskNotify(TaskHandle_t xTaskToNotify, uint32_t ulValue, eNotifyAction eAction);
+BaseType_t xTaskNotifyWait(uint32_t ulBitsToClearOnEntry, uint32_t ulBitsToClearOnExit, uint32_t *pulNotificationValue, TickType_t xTicksToWait);
+void vTaskNotifyGiveFromISR(TaskHandle_t xTaskToNotify, BaseType_t *pxHigherPriorityTaskWoken);
+uint32_t ulTaskNotifyTake(BaseType_t xClearCountOnExit, TickType_t xTicksToWait);
+
+SemaphoreHandle_t xSemaphoreCreateBinary(void);
+SemaphoreHandle_t xSemaphoreCreateMutex(void);
+BaseType_t xSemaphoreTake(SemaphoreHandle_t xSemaphore, TickType_t xBlockTime);
+BaseType_t xSemaphoreGive(SemaphoreHandle_t xSemaphore);
+BaseType_t xSemaphoreGiveFromISR(SemaphoreHandle_t xSemaphore, BaseType_t *pxHigherPriorityTaskWoken);
+
+StreamBufferHandle_t xStreamBufferCreate(size_t xBufferSizeBytes, size_t xTriggerLevelBytes);
+size_t xStreamBufferSend(StreamBufferHandle_t xStreamBuffer, const void *pvTxData, size_t xDataLengthBytes, TickType_t xTicksToWait);
+size_t xStreamBufferReceive(StreamBufferHandle_t xStreamBuffer, void *pvRxData, size_t xBufferLengthBytes, TickType_t xTicksToWait);
+
+#endif /* INC_FREERTOS_H */
+
+/** @} */
@@ -0,0 +1,23 @@
+/** @addtogroup hm10_sim
+ * @{
+ */
+
+/**@file
+ * @brief	ETX OTA Protocol configuration file of the @ref hm10_sim .
+ *
+ * @details On the MCU/MPU, this file belongs to the ETX OTA Protocol project in which the @ref hm10_ble is integrated.
+ *          On the host machine, it only pulls in the configurations of the @ref hm10_ble , which can be overridden
+ *          from the command line of the compiler (see the Makefile of the @ref hm10_sim ).
+ *
+ * @author 	Cesar Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026.
+ */
+
+#ifndef ETX_OTA_CONFIG_H_
+#define ETX_OTA_CONFIG_H_
+
+#include "hm10_config.h" // Default HM-10 Bluetooth Driver configurations.
+
+#endif /* ETX_OTA_CONFIG_H_ */
+
+/** @} */
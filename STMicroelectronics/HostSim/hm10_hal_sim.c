@@ -0,0 +1,546 @@
+/** @addtogroup hm10_sim
+ * @{
+ */
+
+#include "hm10_sim.h"
+#include <stdio.h>	// Library from which "sprintf()" is located at.
+#include <string.h>	// Library from which "memset()" and "memcpy()" are located at.
+
+#define SIM_NO_EVENT                    (UINT64_MAX)    /**< @brief Time of an event that is not scheduled. */
+#define SIM_LINE_SIZE                   (4096U)         /**< @brief Maximum number of bytes that can be in flight from the simulated HM-10 BT Device to the simulated MCU/MPU. */
+#define SIM_DEVICE_BUFFER_SIZE          (256U)          /**< @brief Maximum number of bytes that the simulated HM-10 BT Device accumulates before processing them. */
+#define SIM_DEVICE_SETTINGS             (6U)            /**< @brief Number of single-valued settings of the simulated HM-10 BT Device (i.e., ROLE, PASS, TYPE, MODE, IMME and NOTI). */
+
+DWT_Type sim_dwt;
+CoreDebug_Type sim_core_debug;
+uint32_t SystemCoreClock = HM10_SIM_CPU_MHZ*1000000U;
+
+static USART_TypeDef sim_usart;                         /**< @brief Registers of the simulated UART. */
+static uint32_t sim_usart_sr_read;                      /**< @brief Error flags of the simulated UART that were set at the last read of its Status Register, which are cleared by the next read of its Data Register. */
+static DMA_Channel_TypeDef sim_dma_rx_channel;          /**< @brief Registers of the RX DMA Channel of the simulated UART. */
+static DMA_Channel_TypeDef sim_dma_tx_channel;          /**< @brief Registers of the TX DMA Channel of the simulated UART. */
+static DMA_HandleTypeDef sim_hdma_rx = {&sim_dma_rx_channel};  /**< @brief RX DMA Handle of the simulated UART. */
+static DMA_HandleTypeDef sim_hdma_tx = {&sim_dma_tx_channel};  /**< @brief TX DMA Handle of the simulated UART. */
+static UART_HandleTypeDef *sim_huart;                   /**< @brief UART Handle Structure that is attached to the simulated UART. */
+
+static uint64_t now_ns;                                 /**< @brief Current time of the virtual clock in nanoseconds. */
+static uint64_t byte_ns;                                /**< @brief Time in nanoseconds that a byte (i.e., 10 bits) takes on the line. */
+static uint32_t primask;                                /**< @brief Simulated PRIMASK register. */
+static HM10_Sim_Stats stats;                            /**< @brief Statistics of the @ref hm10_sim . */
+
+static uint8_t line_data[SIM_LINE_SIZE];                /**< @brief Bytes in flight from the simulated HM-10 BT Device to the simulated MCU/MPU. */
+static uint64_t line_time[SIM_LINE_SIZE];               /**< @brief Arrival time of each of the bytes of the @ref line_data buffer. */
+static uint32_t line_head;                              /**< @brief Number of bytes that have been put into the @ref line_data buffer. */
+static uint32_t line_tail;                              /**< @brief Number of bytes that have arrived from the @ref line_data buffer. */
+static uint64_t line_last_time;                         /**< @brief Arrival time of the last byte put into the @ref line_data buffer. */
+
+static uint8_t *rx_dma_data;                            /**< @brief Circular buffer of the Receive-To-Idle DMA reception, or \c NULL if there is none. */
+static uint16_t rx_dma_size;                            /**< @brief Length in bytes of the @ref rx_dma_data buffer. */
+static uint16_t rx_dma_position;                        /**< @brief Position in the @ref rx_dma_data buffer at which the next byte will be written. */
+static uint64_t rx_idle_time;                           /**< @brief Time at which the Idle Event will be generated, or @ref SIM_NO_EVENT . */
+static uint32_t noise_period;                           /**< @brief Number of bytes between two Noise Errors, or \c 0 if there are none. */
+static uint32_t noise_countdown;                        /**< @brief Number of bytes that are left to be received before the next Noise Error. */
+static uint32_t tx_dma_failures;                        /**< @brief Number of the next calls to HAL_UART_Transmit_DMA() that will fail. */
+
+static const uint8_t *tx_data;                          /**< @brief Data of the interrupt or DMA transmission that is in progress, or \c NULL if there is none. */
+static uint16_t tx_size;                                /**< @brief Length in bytes of the @ref tx_data data. */
+static uint16_t tx_index;                               /**< @brief Number of bytes of the @ref tx_data data that have been sent. */
+static uint64_t tx_next_time;                           /**< @brief Time at which the next byte of the @ref tx_data data finishes being sent. */
+
+static uint8_t device_buffer[SIM_DEVICE_BUFFER_SIZE];   /**< @brief Bytes received by the simulated HM-10 BT Device that are pending to be processed. */
+static uint16_t device_size;                            /**< @brief Number of bytes in the @ref device_buffer buffer. */
+static uint64_t device_process_time;                    /**< @brief Time at which the @ref device_buffer buffer will be processed, or @ref SIM_NO_EVENT . */
+static uint64_t device_connect_time;                    /**< @brief Time at which the pending Bluetooth Connection will be established, or @ref SIM_NO_EVENT . */
+static uint8_t device_connected;                        /**< @brief Whether the simulated HM-10 BT Device is in a Bluetooth Connection. */
+static uint8_t device_name[13];                         /**< @brief BT Name of the simulated HM-10 BT Device. */
+static uint8_t device_name_size;                        /**< @brief Length in bytes of the @ref device_name BT Name. */
+static const char *device_setting_names[SIM_DEVICE_SETTINGS] = {"ROLE", "PASS", "TYPE", "MODE", "IMME", "NOTI"};  /**< @brief Names of the single-valued settings of the simulated HM-10 BT Device. */
+static const char *device_setting_defaults[SIM_DEVICE_SETTINGS] = {"0", "000000", "0", "0", "0", "0"};            /**< @brief Factory values of the single-valued settings of the simulated HM-10 BT Device. */
+static char device_settings[SIM_DEVICE_SETTINGS][7];    /**< @brief Current values of the single-valued settings of the simulated HM-10 BT Device. */
+
+/**@brief	Advances the virtual clock up to a certain time, processing in order all the events that are due by then.
+ *
+ * @param time  Time in nanoseconds up to which the virtual clock is advanced.
+ */
+static void advance_to(uint64_t time);
+
+/**@brief	Gets the time of the next event that is scheduled, or @ref SIM_NO_EVENT if there is none.
+ */
+static uint64_t get_next_event_time(void);
+
+/**@brief	Delivers a byte from the line to the simulated UART, either into its Data Register or into the circular
+ *          buffer of the Receive-To-Idle DMA reception.
+ */
+static void uart_receive_byte(uint8_t byte);
+
+/**@brief	Delivers a byte sent by the simulated UART to the simulated HM-10 BT Device.
+ */
+static void device_receive_byte(uint8_t byte);
+
+/**@brief	Processes the bytes that the simulated HM-10 BT Device has received, either as an AT Command or, during a
+ *          Bluetooth Connection, as data for the remote BT Device.
+ */
+static void device_process(void);
+
+/**@brief	Makes the simulated HM-10 BT Device send some bytes, starting no earlier than a certain time.
+ */
+static void device_send(const void *data, uint16_t size, uint64_t start_time);
+
+/**@brief	Restores the settings of the simulated HM-10 BT Device to its factory values.
+ */
+static void device_renew(void);
+
+void init_hm10_sim(UART_HandleTypeDef *huart, uint32_t baud_rate)
+{
+	memset(&stats, 0, sizeof(stats));
+	memset(&sim_usart, 0, sizeof(sim_usart));
+	sim_usart_sr_read = 0;
+	now_ns = 0;
+	byte_ns = (10ULL*1000000000ULL + baud_rate/2) / baud_rate;
+	primask = 0;
+	line_head = 0;
+	line_tail = 0;
+	line_last_time = 0;
+	rx_dma_data = NULL;
+	rx_idle_time = SIM_NO_EVENT;
+	noise_period = 0;
+	tx_dma_failures = 0;
+	tx_data = NULL;
+	device_size = 0;
+	device_process_time = SIM_NO_EVENT;
+	device_connect_time = SIM_NO_EVENT;
+	device_connected = 0;
+	device_renew();
+
+	memset(huart, 0, sizeof(*huart));
+	huart->Instance = &sim_usart;
+	huart->hdmarx = &sim_hdma_rx;
+	huart->hdmatx = &sim_hdma_tx;
+	huart->RxState = HAL_UART_STATE_READY;
+	sim_huart = huart;
+}
+
+void set_hm10_sim_noise(uint32_t period)
+{
+	noise_period = period;
+	noise_countdown = period;
+}
+
+void set_hm10_sim_tx_dma_failures(uint32_t count)
+{
+	tx_dma_failures = count;
+}
+
+void get_hm10_sim_stats(HM10_Sim_Stats *s)
+{
+	stats.time_ns = now_ns;
+	*s = stats;
+}
+
+uint32_t read_hm10_sim_uart_sr(UART_HandleTypeDef *huart)
+{
+	sim_usart_sr_read = huart->Instance->SR & (UART_FLAG_ORE | UART_FLAG_NE | UART_FLAG_FE | UART_FLAG_PE);
+	return huart->Instance->SR;
+}
+
+uint32_t read_hm10_sim_uart_dr(UART_HandleTypeDef *huart)
+{
+	huart->Instance->SR &= ~(UART_FLAG_RXNE | UART_FLAG_ORE | UART_FLAG_NE | UART_FLAG_FE | UART_FLAG_PE);
+	return huart->Instance->DR;
+}
+
+uint32_t HAL_GetTick(void)
+{
+	advance_to(now_ns + HM10_SIM_POLL_COST_NS);
+	return (uint32_t) (now_ns / 1000000U);
+}
+
+void HAL_Delay(uint32_t Delay)
+{
+	advance_to(now_ns + Delay*1000000ULL);
+}
+
+HAL_StatusTypeDef HAL_UART_Transmit(UART_HandleTypeDef *huart, const uint8_t *pData, uint16_t Size, uint32_t Timeout)
+{
+	(void) huart;
+	(void) Timeout;
+	if (tx_data != NULL)
+	{
+		return HAL_BUSY;
+	}
+	for (uint16_t i=0; i<Size; i++)
+	{
+		advance_to(now_ns + byte_ns);
+		device_receive_byte(pData[i]);
+	}
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_UART_Receive(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size, uint32_t Timeout)
+{
+	if (rx_dma_data != NULL)
+	{
+		return HAL_BUSY;
+	}
+
+	/** <b>Local variable deadline:</b> Time at which the timeout expires. */
+	uint64_t deadline = now_ns + Timeout*1000000ULL;
+	for (uint16_t i=0; i<Size; i++)
+	{
+		while (!(huart->Instance->SR & UART_FLAG_RXNE))
+		{
+			/** <b>Local variable next:</b> Time of the next event. */
+			uint64_t next = get_next_event_time();
+			if (next > deadline)
+			{
+				advance_to(deadline);
+				return HAL_TIMEOUT;
+			}
+			advance_to(next);
+		}
+		pData[i] = (uint8_t) read_hm10_sim_uart_dr(huart);
+	}
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_UART_Transmit_IT(UART_HandleTypeDef *huart, const uint8_t *pData, uint16_t Size)
+{
+	(void) huart;
+	if (tx_data != NULL)
+	{
+		return HAL_BUSY;
+	}
+	tx_data = pData;
+	tx_size = Size;
+	tx_index = 0;
+	tx_next_time = now_ns + byte_ns;
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_UART_Transmit_DMA(UART_HandleTypeDef *huart, const uint8_t *pData, uint16_t Size)
+{
+	if (tx_dma_failures > 0)
+	{
+		tx_dma_failures--;
+		stats.tx_dma_failures++;
+		return HAL_ERROR;
+	}
+	return HAL_UART_Transmit_IT(huart, pData, Size);
+}
+
+HAL_StatusTypeDef HAL_UARTEx_ReceiveToIdle_DMA(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size)
+{
+	if (rx_dma_data != NULL)
+	{
+		return HAL_BUSY;
+	}
+	rx_dma_data = pData;
+	rx_dma_size = Size;
+	rx_dma_position = 0;
+	huart->hdmarx->Instance->CNDTR = Size;
+	huart->Instance->CR3 |= USART_CR3_EIE;
+	huart->RxState = HAL_UART_STATE_BUSY_RX;
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_UART_AbortReceive(UART_HandleTypeDef *huart)
+{
+	rx_dma_data = NULL;
+	rx_idle_time = SIM_NO_EVENT;
+	huart->RxState = HAL_UART_STATE_READY;
+	return HAL_OK;
+}
+
+uint32_t __get_PRIMASK(void)
+{
+	return primask;
+}
+
+void __set_PRIMASK(uint32_t priMask)
+{
+	primask = priMask;
+}
+
+void __disable_irq(void)
+{
+	primask = 1;
+}
+
+void __enable_irq(void)
+{
+	primask = 0;
+}
+
+void __WFI(void)
+{
+	/* Sleep until either the next event or the next SysTick interrupt. */
+	/** <b>Local variable wake:</b> Time at which the simulated MCU/MPU wakes up. */
+	uint64_t wake = (now_ns/1000000U + 1U)*1000000U;
+	/** <b>Local variable next:</b> Time of the next event. */
+	uint64_t next = get_next_event_time();
+	if (next < wake)
+	{
+		wake = (next > now_ns) ? next : now_ns;
+	}
+	stats.sleep_ns += wake - now_ns;
+	advance_to(wake);
+}
+
+static void advance_to(uint64_t time)
+{
+	/** <b>Local variable next:</b> Time of the next event. */
+	uint64_t next;
+	while ((next = get_next_event_time()) <= time)
+	{
+		if (next > now_ns)
+		{
+			now_ns = next;
+		}
+
+		if ((line_tail != line_head) && (line_time[line_tail % SIM_LINE_SIZE] == next))
+		{
+			uart_receive_byte(line_data[line_tail++ % SIM_LINE_SIZE]);
+		}
+		else if (tx_next_time == next && tx_data != NULL)
+		{
+			device_receive_byte(tx_data[tx_index++]);
+			if (tx_index == tx_size)
+			{
+				tx_data = NULL;
+				HAL_UART_TxCpltCallback(sim_huart);
+			}
+			else
+			{
+				tx_next_time += byte_ns;
+			}
+		}
+		else if (rx_idle_time == next)
+		{
+			rx_idle_time = SIM_NO_EVENT;
+			if ((rx_dma_data != NULL) && (rx_dma_position != 0))
+			{
+				HAL_UARTEx_RxEventCallback(sim_huart, rx_dma_position);
+			}
+		}
+		else if (device_process_time == next)
+		{
+			device_process_time = SIM_NO_EVENT;
+			device_process();
+		}
+		else if (device_connect_time == next)
+		{
+			device_connect_time = SIM_NO_EVENT;
+			device_connected = 1;
+			device_send("OK+CONN", 7, now_ns);
+		}
+	}
+	if (time > now_ns)
+	{
+		now_ns = time;
+	}
+	sim_dwt.CYCCNT = (uint32_t) (now_ns*HM10_SIM_CPU_MHZ/1000U);
+}
+
+static uint64_t get_next_event_time(void)
+{
+	/** <b>Local variable next:</b> Time of the earliest event found so far. */
+	uint64_t next = SIM_NO_EVENT;
+	if ((line_tail != line_head) && (line_time[line_tail % SIM_LINE_SIZE] < next))
+	{
+		next = line_time[line_tail % SIM_LINE_SIZE];
+	}
+	if ((tx_data != NULL) && (tx_next_time < next))
+	{
+		next = tx_next_time;
+	}
+	if (rx_idle_time < next)
+	{
+		next = rx_idle_time;
+	}
+	if (device_process_time < next)
+	{
+		next = device_process_time;
+	}
+	if (device_connect_time < next)
+	{
+		next = device_connect_time;
+	}
+	return next;
+}
+
+static void uart_receive_byte(uint8_t byte)
+{
+	stats.bytes_received++;
+
+	/* Corrupt the byte if a Noise Error is due. */
+	/** <b>Local variable noise:</b> Whether this byte is received with a Noise Error. */
+	uint8_t noise = 0;
+	if ((noise_period != 0) && (--noise_countdown == 0))
+	{
+		noise_countdown = noise_period;
+		noise = 1;
+		byte ^= 0x10;
+		stats.noise_errors++;
+	}
+
+	if (rx_dma_data == NULL)
+	{
+		/* Without a reception in progress, the byte is held by the Data Register unless it was not read yet. */
+		if (sim_usart.SR & UART_FLAG_RXNE)
+		{
+			sim_usart.SR |= UART_FLAG_ORE;
+			stats.overruns++;
+			return;
+		}
+		sim_usart.DR = byte;
+		sim_usart.SR |= noise ? (UART_FLAG_RXNE | UART_FLAG_NE) : UART_FLAG_RXNE;
+		return;
+	}
+
+	/* Write the byte into the circular buffer, whose read of the Data Register clears the error flags that were read from the Status Register, and generate the Half and Full Events. */
+	sim_usart.SR &= ~sim_usart_sr_read;
+	sim_usart_sr_read = 0;
+	if (noise)
+	{
+		sim_usart.SR |= UART_FLAG_NE;
+	}
+	rx_dma_data[rx_dma_position++] = byte;
+	sim_dma_rx_channel.CNDTR = rx_dma_size - rx_dma_position;
+	rx_idle_time = now_ns + byte_ns;
+	if (rx_dma_position == rx_dma_size/2)
+	{
+		HAL_UARTEx_RxEventCallback(sim_huart, rx_dma_position);
+	}
+	else if (rx_dma_position == rx_dma_size)
+	{
+		rx_dma_position = 0;
+		sim_dma_rx_channel.CNDTR = rx_dma_size;
+		HAL_UARTEx_RxEventCallback(sim_huart, rx_dma_size);
+	}
+
+	/* If the Error Interrupt is enabled, then a Noise Error during a DMA reception makes the HAL abort that reception and call its Error Callback. */
+	if (noise && (sim_usart.CR3 & USART_CR3_EIE))
+	{
+		HAL_UART_AbortReceive(sim_huart);
+		sim_huart->ErrorCode |= HAL_UART_ERROR_NE;
+		HAL_UART_ErrorCallback(sim_huart);
+	}
+}
+
+static void device_receive_byte(uint8_t byte)
+{
+	stats.bytes_sent++;
+	if (device_size < SIM_DEVICE_BUFFER_SIZE)
+	{
+		device_buffer[device_size++] = byte;
+	}
+	device_process_time = now_ns + HM10_SIM_COMMAND_GAP_BYTES*byte_ns;
+}
+
+static void device_process(void)
+{
+	/** <b>Local variable response:</b> Response to the AT Command being processed. */
+	char response[SIM_DEVICE_BUFFER_SIZE + 16];
+	/** <b>Local variable size:</b> Length in bytes of the @ref response . */
+	uint16_t size = 0;
+	/** <b>Local variable cmd:</b> The received bytes as a string. */
+	char cmd[SIM_DEVICE_BUFFER_SIZE + 1];
+	/** <b>Local variable answer_time:</b> Time at which the simulated HM-10 BT Device starts answering. */
+	uint64_t answer_time = now_ns + HM10_SIM_RESPONSE_LATENCY_US*1000ULL;
+
+	memcpy(cmd, device_buffer, device_size);
+	cmd[device_size] = '\0';
+	/** <b>Local variable cmd_size:</b> Length in bytes of the received bytes. */
+	uint16_t cmd_size = device_size;
+	device_size = 0;
+
+	/* During a Bluetooth Connection, everything but the Test Command goes to the remote BT Device, which echoes it. */
+	if (device_connected && strcmp(cmd, "AT") != 0)
+	{
+		device_send(device_buffer, cmd_size, now_ns + HM10_SIM_LINK_LATENCY_US*1000ULL);
+		return;
+	}
+
+	if (strcmp(cmd, "AT") == 0)
+	{
+		size = (uint16_t) sprintf(response, device_connected ? "OK+LOST" : "OK");
+		device_connected = 0;
+	}
+	else if (strcmp(cmd, "AT+RESET") == 0)
+	{
+		size = (uint16_t) sprintf(response, "OK+RESET");
+	}
+	else if (strcmp(cmd, "AT+RENEW") == 0)
+	{
+		device_renew();
+		size = (uint16_t) sprintf(response, "OK+RENEW");
+	}
+	else if (strcmp(cmd, "AT+NAME?") == 0)
+	{
+		size = (uint16_t) sprintf(response, "OK+NAME:%.*s", device_name_size, device_name);
+		response[size++] = '\0';
+	}
+	else if ((strncmp(cmd, "AT+NAME", 7) == 0) && (cmd_size > 7) && (cmd_size <= 7 + 12))
+	{
+		device_name_size = (uint8_t) (cmd_size - 7);
+		memcpy(device_name, &cmd[7], device_name_size);
+		size = (uint16_t) sprintf(response, "OK+Set:%s", &cmd[7]);
+	}
+	else if ((strncmp(cmd, "AT+CO", 5) == 0) && (cmd_size == 18))
+	{
+		size = (uint16_t) sprintf(response, "OK+CO%c%cA", cmd[5], cmd[5]);
+		device_connect_time = answer_time + HM10_SIM_CONNECT_LATENCY_US*1000ULL;
+	}
+	else if (strncmp(cmd, "AT+", 3) == 0)
+	{
+		for (uint8_t i=0; i<SIM_DEVICE_SETTINGS; i++)
+		{
+			if (strncmp(&cmd[3], device_setting_names[i], 4) != 0)
+			{
+				continue;
+			}
+			if (strcmp(&cmd[7], "?") == 0)
+			{
+				size = (uint16_t) sprintf(response, "OK+Get:%.6s", device_settings[i]);
+			}
+			else if (strlen(&cmd[7]) == strlen(device_setting_defaults[i]))
+			{
+				strcpy(device_settings[i], &cmd[7]);
+				size = (uint16_t) sprintf(response, "OK+Set:%.6s", device_settings[i]);
+			}
+			break;
+		}
+	}
+
+	/* The unknown AT Commands are ignored, as the HM-10 BT Device does. */
+	if (size > 0)
+	{
+		device_send(response, size, answer_time);
+	}
+}
+
+static void device_send(const void *data, uint16_t size, uint64_t start_time)
+{
+	/** <b>Local variable time:</b> Arrival time of the last byte scheduled so far. */
+	uint64_t time = (start_time > line_last_time) ? start_time : line_last_time;
+	for (uint16_t i=0; (i<size) && (line_head - line_tail < SIM_LINE_SIZE); i++)
+	{
+		time += byte_ns;
+		line_data[line_head % SIM_LINE_SIZE] = ((const uint8_t *) data)[i];
+		line_time[line_head % SIM_LINE_SIZE] = time;
+		line_head++;
+	}
+	line_last_time = time;
+}
+
+static void device_renew(void)
+{
+	memcpy(device_name, "HMSoft", 6);
+	device_name_size = 6;
+	for (uint8_t i=0; i<SIM_DEVICE_SETTINGS; i++)
+	{
+		strcpy(device_settings[i], device_setting_defaults[i]);
+	}
+}
+
+/** @} */
@@ -0,0 +1,130 @@
+/** @addtogroup hm10_ble
+ * @{
+ */
+
+/**@file
+ * @brief	HM-10 Host Simulation Header file.
+ *
+ * @defgroup hm10_sim HM-10 Host Simulation
+ * @{
+ *
+ * @brief   This module allows to compile and to run the unchanged code of the @ref hm10_ble on a Linux host machine,
+ *          by implementing the subset of the STM32 HAL that it uses (see stm32f1xx_hal.h) over a simulated HM-10 BT
+ *          Device and a virtual clock.
+ *
+ * @details The virtual clock only advances whenever the code of the @ref hm10_ble calls a function of the simulated
+ *          HAL, as follows:<br><br>
+ *          - HAL_UART_Transmit() advances it by the time that each byte takes on the line.<br>
+ *          - HAL_UART_Receive() advances it up to the arrival of each requested byte or up to its timeout.<br>
+ *          - HAL_Delay() advances it by the requested delay.<br>
+ *          - HAL_GetTick() advances it by @ref HM10_SIM_POLL_COST_NS , which is the cost of each iteration of a
+ *            busy-wait loop.<br>
+ *          - __WFI() advances it up to the next event or up to the next SysTick interrupt, and that time is accounted
+ *            as time asleep.<br><br>
+ * @details While the virtual clock advances, the events that are due are processed in order: the bytes sent to the
+ *          simulated HM-10 BT Device, the bytes that it sends back (which are either written into the Data Register of
+ *          the UART or, during a Receive-To-Idle DMA reception, into its circular buffer along with the Half, Full and
+ *          Idle Events), and the completion of the interrupt and DMA transmissions. The simulated HM-10 BT Device
+ *          processes each AT Command once the line has been idle for @ref HM10_SIM_COMMAND_GAP_BYTES byte times, and
+ *          it answers after @ref HM10_SIM_RESPONSE_LATENCY_US microseconds. Once connected, it echoes back all the data
+ *          that it receives, as if the remote BT Device was a loopback, after @ref HM10_SIM_LINK_LATENCY_US
+ *          microseconds.
+ *
+ * @author 	Cesar Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026.
+ */
+
+#ifndef HM10_SIM_H_
+#define HM10_SIM_H_
+
+#include <stdint.h> // This library contains the aliases: uint8_t, uint16_t, uint32_t, etc.
+#include "stm32f1xx_hal.h" // Simulated STM32F1 HAL.
+
+#ifndef HM10_SIM_CPU_MHZ
+#define HM10_SIM_CPU_MHZ                (72U)       /**< @brief Frequency in MHz of the simulated MCU/MPU, with which its DWT Cycle Counter advances. */
+#endif
+
+#ifndef HM10_SIM_POLL_COST_NS
+#define HM10_SIM_POLL_COST_NS           (1000U)     /**< @brief Time in nanoseconds that each call to HAL_GetTick() takes, which models the cost of each iteration of a busy-wait loop. */
+#endif
+
+#ifndef HM10_SIM_COMMAND_GAP_BYTES
+#define HM10_SIM_COMMAND_GAP_BYTES      (3U)        /**< @brief Number of byte times of idle line after which the simulated HM-10 BT Device processes the bytes that it has received. */
+#endif
+
+#ifndef HM10_SIM_RESPONSE_LATENCY_US
+#define HM10_SIM_RESPONSE_LATENCY_US    (10000U)    /**< @brief Time in microseconds that the simulated HM-10 BT Device takes to start answering an AT Command. */
+#endif
+
+#ifndef HM10_SIM_CONNECT_LATENCY_US
+#define HM10_SIM_CONNECT_LATENCY_US     (800000U)   /**< @brief Time in microseconds that the simulated HM-10 BT Device takes to establish a Bluetooth Connection. */
+#endif
+
+#ifndef HM10_SIM_LINK_LATENCY_US
+#define HM10_SIM_LINK_LATENCY_US        (30000U)    /**< @brief Time in microseconds that the data takes to go to the remote BT Device and back. */
+#endif
+
+/**@brief	HM-10 Host Simulation Statistics.
+ */
+typedef struct {
+	uint64_t time_ns;           //!< Current time of the virtual clock in nanoseconds.
+	uint64_t sleep_ns;          //!< Time in nanoseconds that the simulated MCU/MPU has spent in __WFI().
+	uint32_t bytes_sent;        //!< Number of bytes that the simulated MCU/MPU has sent to the simulated HM-10 BT Device.
+	uint32_t bytes_received;    //!< Number of bytes that the simulated HM-10 BT Device has sent to the simulated MCU/MPU.
+	uint32_t overruns;          //!< Number of bytes that were lost because the Data Register of the UART had not been read yet.
+	uint32_t noise_errors;      //!< Number of bytes that were received with a Noise Error (see @ref set_hm10_sim_noise ).
+	uint32_t tx_dma_failures;   //!< Number of calls to HAL_UART_Transmit_DMA() that were made to fail (see @ref set_hm10_sim_tx_dma_failures ).
+} HM10_Sim_Stats;
+
+/**@brief	Resets the virtual clock and the simulated HM-10 BT Device, and attaches the simulated UART and DMA
+ *          registers to a UART Handle Structure.
+ *
+ * @param[out] huart    Pointer to the UART Handle Structure that is then given to the @ref init_hm10_module function.
+ * @param baud_rate     Baud rate of the simulated UART.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+void init_hm10_sim(UART_HandleTypeDef *huart, uint32_t baud_rate);
+
+/**@brief	Makes the simulated UART receive some of the bytes with a Noise Error.
+ *
+ * @details Every \p period bytes received by the simulated UART, one of them is corrupted and received with its Noise
+ *          Error Flag set. If that happens during a Receive-To-Idle DMA reception while the Error Interrupt of the UART
+ *          is enabled, then the simulated HAL also aborts that reception and calls the HAL_UART_ErrorCallback()
+ *          function, as the real HAL does.
+ *
+ * @param period    Number of bytes between two Noise Errors, or \c 0 to receive all the bytes without errors.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+void set_hm10_sim_noise(uint32_t period);
+
+/**@brief	Makes the simulated UART fail to start some of its DMA transmissions.
+ *
+ * @details The next \p count calls to the HAL_UART_Transmit_DMA() function return \c HAL_ERROR without sending anything,
+ *          as the real HAL does whenever the DMA channel cannot be started, regardless of whether they are made from
+ *          the UART's interrupts or not.
+ *
+ * @param count Number of the next calls to the HAL_UART_Transmit_DMA() function that will fail.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+void set_hm10_sim_tx_dma_failures(uint32_t count);
+
+/**@brief	Gets the statistics of the @ref hm10_sim .
+ *
+ * @param[out] stats    Pointer to the Memory Address into which the statistics will be stored.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+void get_hm10_sim_stats(HM10_Sim_Stats *stats);
+
+#endif /* HM10_SIM_H_ */
+
+/** @} */ // hm10_sim
+
+/** @} */ // hm10_ble
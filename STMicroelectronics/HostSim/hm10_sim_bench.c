@@ -0,0 +1,358 @@
+/** @addtogroup hm10_sim
+ * @{
+ */
+
+/**@file
+ * @brief	HM-10 Host Simulation Benchmark.
+ *
+ * @details Runs each of the operations of the @ref hm10_ble against the simulated HM-10 BT Device of the @ref hm10_sim
+ *          and reports, for each of them, its result, the simulated time that it took and how much of that time the
+ *          simulated MCU/MPU was active (i.e., not in __WFI()). If @ref HM10_UART_TX_STREAM is
+ *          enabled, it also streams packets through the transmit stream and checks that they are sent at the rate of
+ *          the UART, and that the stream does not stall whenever the UART fails to start its DMA from its interrupt.
+ *          If the transmit queue is enabled with its DMA, it also checks that the queue does not stall whenever the
+ *          UART fails to restart it from its interrupt. If @ref HM10_TRACE is enabled, the records of the
+ *          trace points that each operation reached are printed after it.
+ *
+ * @author 	Cesar Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026.
+ */
+
+#include <stdio.h>	// Library from which "printf()" is located at.
+#include <string.h>	// Library from which "memcmp()" and "memset()" are located at.
+#include "hm10_sim.h" // HM-10 Host Simulation.
+#include "hm10_ble_driver.h" // Custom Mortrack's Library to be able to initialize, send configuration commands and send and/or receive data to/from an HM-10 Bluetooth Device.
+#include "hm10_trace.h" // Custom Mortrack's Library for the trace points of the HM-10 Driver Library.
+
+#define SIM_BAUD_RATE               (9600U)     /**< @brief Baud rate of the simulated UART, which is the default one of the HM-10 BT Device. */
+#define SIM_OTA_ROUND_TRIPS         (10U)       /**< @brief Number of packets that are sent Over the Air and received back from the simulated remote BT Device. */
+#define SIM_OTA_TIMEOUT             (1000U)     /**< @brief Timeout in milliseconds of each OTA transaction. */
+#define SIM_OTA_PACKET_SIZE         (128U)      /**< @brief Length in bytes of each packet that is sent Over the Air. */
+#define SIM_NOISE_PERIOD            (300U)      /**< @brief Number of bytes between two Noise Errors of the simulated UART during the OTA round trips with noise. */
+#define SIM_STREAM_PACKETS          (40U)       /**< @brief Number of packets that are streamed Over the Air through the transmit stream, whenever @ref HM10_UART_TX_STREAM is enabled. */
+
+static UART_HandleTypeDef hm10_huart;              /**< @brief UART Handle Structure of the simulated UART. */
+static HM10_Sim_Stats start_stats;              /**< @brief Statistics of the @ref hm10_sim at the start of the operation being measured. */
+static int failures;                            /**< @brief Number of operations that did not succeed. */
+#if HM10_UART_TX_STREAM
+static volatile uint16_t stream_swaps;          /**< @brief Number of times that the transmit stream has freed one of its buffers. */
+#endif
+
+/**@brief	Starts measuring an operation.
+ */
+static void begin_operation(void);
+
+/**@brief	Finishes measuring an operation and reports it.
+ *
+ * @param name  Name of the operation.
+ * @param ret   Value returned by the operation.
+ * @param ok    Whether the operation succeeded.
+ */
+static void end_operation(const char *name, int ret, int ok);
+
+#if HM10_UART_TX_STREAM
+/**@brief	Counts each buffer that the transmit stream frees (see @ref HM10_TX_Stream_Callback ).
+ */
+static void count_stream_swap(void);
+#endif
+
+void HAL_UARTEx_RxEventCallback(UART_HandleTypeDef *huart, uint16_t Size)
+{
+	handle_hm10_uart_rx_event(huart, Size);
+}
+
+void HAL_UART_TxCpltCallback(UART_HandleTypeDef *huart)
+{
+	handle_hm10_uart_tx_complete(huart);
+}
+
+void HAL_UART_ErrorCallback(UART_HandleTypeDef *huart)
+{
+	handle_hm10_uart_error(huart);
+}
+
+int main(void)
+{
+	/** <b>Local variable ret:</b> Return value of the operation being measured. */
+	int ret;
+	/** <b>Local variable name:</b> BT Name that is set and then read back. */
+	uint8_t name[] = {'C', 'e', 's', 'a', 'r', 'B', 'L', 'E'};
+	/** <b>Local variable buffer:</b> Buffer for the values that are read back. */
+	uint8_t buffer[HM10_MAX_BLE_NAME_SIZE];
+	/** <b>Local variable size:</b> Length in bytes of the value that is read back. */
+	uint8_t size;
+	/** <b>Local variable pin:</b> Pin that is set and then read back. */
+	uint8_t pin[] = {'1', '2', '3', '4', '5', '6'};
+	/** <b>Local variable role:</b> Role that is read back. */
+	HM10_Role role;
+	/** <b>Local variable pin_code_mode:</b> Pin Code Mode that is read back. */
+	HM10_Pin_Code_Mode pin_code_mode;
+	/** <b>Local variable work_mode:</b> Module Work Mode that is read back. */
+	HM10_Module_Work_Mode work_mode;
+	/** <b>Local variable work_type:</b> Module Work Type that is read back. */
+	HM10_Module_Work_Type work_type;
+	/** <b>Local variable notify_mode:</b> Notify Information Mode that is read back. */
+	HM10_Notify_Information_Mode notify_mode;
+	/** <b>Local variable packet:</b> Packet that is sent Over the Air. */
+	uint8_t packet[SIM_OTA_PACKET_SIZE];
+	/** <b>Local variable echo:</b> Packet that is received back Over the Air. */
+	uint8_t echo[SIM_OTA_PACKET_SIZE];
+
+	init_hm10_sim(&hm10_huart, SIM_BAUD_RATE);
+	#if HM10_TRACE
+		init_hm10_trace();
+	#endif
+	init_hm10_module(&hm10_huart);
+	printf("HM-10 Host Simulation at %u baud (RX DMA = %u, TX Queue = %u, TX Stream = %u, Low-Power Wait = %u, Error Recovery = %u).\r\n",
+	       SIM_BAUD_RATE, HM10_UART_RX_DMA, HM10_UART_TX_QUEUE, HM10_UART_TX_STREAM, HM10_LOW_POWER_WAIT, HM10_UART_ERROR_RECOVERY);
+	printf("%-28s %8s %12s %12s\r\n", "Operation", "Result", "Time [ms]", "Active [ms]");
+
+	begin_operation();
+	ret = disconnect_hm10_from_bt_address();
+	end_operation("Disconnect (not connected)", ret, ret == HM10_BT_No_Connection);
+
+	begin_operation();
+	ret = send_hm10_test_cmd();
+	end_operation("Test", ret, ret == HM10_EC_OK);
+
+	begin_operation();
+	ret = send_hm10_renew_cmd();
+	end_operation("Renew", ret, ret == HM10_EC_OK);
+
+	begin_operation();
+	ret = set_hm10_name(name, sizeof(name));
+	end_operation("Set name", ret, ret == HM10_EC_OK);
+
+	begin_operation();
+	ret = get_hm10_name(buffer, &size);
+	end_operation("Get name", ret, (ret == HM10_EC_OK) && (size == sizeof(name)) && (memcmp(buffer, name, size) == 0));
+
+	begin_operation();
+	ret = set_hm10_role(HM10_Role_Central);
+	end_operation("Set role", ret, ret == HM10_EC_OK);
+
+	begin_operation();
+	ret = get_hm10_role(&role);
+	end_operation("Get role", ret, (ret == HM10_EC_OK) && (role == HM10_Role_Central));
+
+	begin_operation();
+	ret = set_hm10_pin(pin);
+	end_operation("Set pin", ret, ret == HM10_EC_OK);
+
+	begin_operation();
+	ret = get_hm10_pin(buffer);
+	end_operation("Get pin", ret, (ret == HM10_EC_OK) && (memcmp(buffer, pin, sizeof(pin)) == 0));
+
+	begin_operation();
+	ret = set_hm10_pin_code_mode(HM10_Pin_Code_DISABLED);
+	end_operation("Set pin code mode", ret, ret == HM10_EC_OK);
+
+	begin_operation();
+	ret = get_hm10_pin_code_mode(&pin_code_mode);
+	end_operation("Get pin code mode", ret, (ret == HM10_EC_OK) && (pin_code_mode == HM10_Pin_Code_DISABLED));
+
+	begin_operation();
+	ret = set_hm10_module_work_mode(HM10_Transmission_Mode);
+	end_operation("Set module work mode", ret, ret == HM10_EC_OK);
+
+	begin_operation();
+	ret = get_hm10_module_work_mode(&work_mode);
+	end_operation("Get module work mode", ret, (ret == HM10_EC_OK) && (work_mode == HM10_Transmission_Mode));
+
+	begin_operation();
+	ret = set_hm10_module_work_type(HM10_Module_Work_Type_1);
+	end_operation("Set module work type", ret, ret == HM10_EC_OK);
+
+	begin_operation();
+	ret = get_hm10_module_work_type(&work_type);
+	end_operation("Get module work type", ret, (ret == HM10_EC_OK) && (work_type == HM10_Module_Work_Type_1));
+
+	begin_operation();
+	ret = set_hm10_notify_information_mode(HM10_Notify_ENABLED);
+	end_operation("Set notify mode", ret, ret == HM10_EC_OK);
+
+	begin_operation();
+	ret = get_hm10_notify_information_mode(&notify_mode);
+	end_operation("Get notify mode", ret, (ret == HM10_EC_OK) && (notify_mode == HM10_Notify_ENABLED));
+
+	begin_operation();
+	ret = send_hm10_reset_cmd();
+	end_operation("Reset", ret, ret == HM10_EC_OK);
+
+	begin_operation();
+	ret = connect_hm10_to_bt_address(HM10_BT_Static_MAC, "0017EA090909");
+	end_operation("Connect", ret, ret == HM10_EC_OK);
+
+	for (uint16_t i=0; i<sizeof(packet); i++)
+	{
+		packet[i] = (uint8_t) (i*7U + 1U);
+	}
+	for (uint8_t i=0; i<SIM_OTA_ROUND_TRIPS; i++)
+	{
+		packet[0] = i;
+		begin_operation();
+		ret = send_hm10_ota_data(packet, sizeof(packet), SIM_OTA_TIMEOUT);
+		if (ret == HM10_EC_OK)
+		{
+			ret = get_hm10_ota_data(echo, sizeof(echo), SIM_OTA_TIMEOUT);
+		}
+		end_operation("OTA round trip", ret, (ret == HM10_EC_OK) && (memcmp(packet, echo, sizeof(packet)) == 0));
+	}
+
+	#if HM10_UART_RX_DMA && HM10_UART_ERROR_RECOVERY
+		/* Repeat the round trips with Noise Errors, where only the packets that hold a corrupted byte must be flagged. */
+		/** <b>Local variable uart_errors:</b> Errors that the UART reported to the @ref hm10_ble during the round trips with noise. */
+		HM10_UART_Error_Stats uart_errors;
+		/** <b>Local variable flagged:</b> Number of the packets received back that were flagged as affected by an error of the UART. */
+		uint8_t flagged = 0;
+		reset_hm10_uart_error_stats();
+		(void) get_hm10_rx_error_flag();
+		set_hm10_sim_noise(SIM_NOISE_PERIOD);
+		for (uint8_t i=0; i<SIM_OTA_ROUND_TRIPS; i++)
+		{
+			packet[0] = i;
+			begin_operation();
+			ret = send_hm10_ota_data(packet, sizeof(packet), SIM_OTA_TIMEOUT);
+			if (ret == HM10_EC_OK)
+			{
+				ret = get_hm10_ota_data(echo, sizeof(echo), SIM_OTA_TIMEOUT);
+			}
+			/** <b>Local variable error_flag:</b> Whether the packet received back was flagged as affected by an error of the UART. */
+			uint8_t error_flag = get_hm10_rx_error_flag();
+			flagged += error_flag;
+			end_operation(error_flag ? "OTA round trip (noise, flag)" : "OTA round trip (noise)", ret,
+			              (ret == HM10_EC_OK) && ((memcmp(packet, echo, sizeof(packet)) != 0) == error_flag));
+		}
+		set_hm10_sim_noise(0);
+		get_hm10_uart_error_stats(&uart_errors);
+		printf("UART errors: %u noise, %u recoveries, %u packet(s) flagged.\r\n", (unsigned) uart_errors.noise, (unsigned) uart_errors.recoveries, flagged);
+	#endif
+
+	#if HM10_UART_TX_QUEUE && HM10_UART_TX_QUEUE_DMA
+		/* Fill the transmit queue and make the UART fail to restart it from its interrupt, which a send that needs the whole queue has to retry instead of stalling. */
+		/** <b>Local variable burst:</b> Data that needs the whole transmit queue to be free. */
+		uint8_t burst[HM10_UART_TX_QUEUE_SIZE];
+		/** <b>Local variable queue_stats:</b> Statistics of the @ref hm10_sim once the transmit queue has been restarted. */
+		HM10_Sim_Stats queue_stats;
+		memset(burst, 0x5A, sizeof(burst));
+		begin_operation();
+		ret = send_hm10_ota_data(packet, sizeof(packet), SIM_OTA_TIMEOUT);
+		if (ret == HM10_EC_OK)
+		{
+			ret = send_hm10_ota_data(packet, HM10_UART_TX_QUEUE_SIZE - sizeof(packet), SIM_OTA_TIMEOUT);
+		}
+		set_hm10_sim_tx_dma_failures(1);
+		if (ret == HM10_EC_OK)
+		{
+			ret = send_hm10_ota_data(burst, sizeof(burst), SIM_OTA_TIMEOUT);
+		}
+		get_hm10_sim_stats(&queue_stats);
+		end_operation("OTA send (DMA failure)", ret, (ret == HM10_EC_OK) && (queue_stats.tx_dma_failures == 1));
+
+		/* Leave the line idle so that the sent data and its echo are gone before the next Command. */
+		HAL_Delay(SIM_OTA_TIMEOUT);
+	#endif
+
+	#if HM10_UART_TX_STREAM
+		/* Stream telemetry packets written straight into the buffers of the transmit stream, which must keep the UART sending without any gap. */
+		/** <b>Local variable stream_stats:</b> Statistics of the @ref hm10_sim once the transmit stream has been sent. */
+		HM10_Sim_Stats stream_stats;
+		/** <b>Local variable stream_buffer:</b> Buffer of the transmit stream into which each packet is written. */
+		uint8_t *stream_buffer;
+		stream_swaps = 0;
+		set_hm10_tx_stream_callback(count_stream_swap);
+		begin_operation();
+		ret = HM10_EC_OK;
+		for (uint16_t i=0; (i<SIM_STREAM_PACKETS) && (ret == HM10_EC_OK); i++)
+		{
+			ret = get_hm10_tx_stream_buffer(&stream_buffer, SIM_OTA_TIMEOUT);
+			if (ret == HM10_EC_OK)
+			{
+				for (uint16_t j=0; j<HM10_UART_TX_STREAM_BUFFER_SIZE; j++)
+				{
+					stream_buffer[j] = (uint8_t) (i + j);
+				}
+				ret = send_hm10_tx_stream_buffer(HM10_UART_TX_STREAM_BUFFER_SIZE);
+			}
+		}
+		if (ret == HM10_EC_OK)
+		{
+			ret = flush_hm10_tx_stream(SIM_OTA_TIMEOUT);
+		}
+		get_hm10_sim_stats(&stream_stats);
+		set_hm10_tx_stream_callback(NULL);
+
+		/* Compare the time that the stream took with the one that its bytes take on the wire at the baud rate of the UART. */
+		/** <b>Local variable wire_ns:</b> Time in nanoseconds that the streamed bytes take on the wire. */
+		uint64_t wire_ns = (uint64_t) SIM_STREAM_PACKETS*HM10_UART_TX_STREAM_BUFFER_SIZE*10U*1000000000ULL/SIM_BAUD_RATE;
+		/** <b>Local variable rate:</b> Fraction of the rate of the UART at which the stream was sent. */
+		double rate = (double) wire_ns/(double) (stream_stats.time_ns - start_stats.time_ns);
+		end_operation("OTA stream", ret, (ret == HM10_EC_OK) && (stream_swaps == SIM_STREAM_PACKETS) && (rate > 0.99));
+		printf("Stream: %u bytes at %.1f%% of the UART rate, %u buffer swap(s).\r\n", SIM_STREAM_PACKETS*HM10_UART_TX_STREAM_BUFFER_SIZE, rate*100, stream_swaps);
+
+		/* Make the UART fail to start the second buffer from its interrupt, which the flush has to retry instead of stalling. */
+		begin_operation();
+		ret = HM10_EC_OK;
+		for (uint8_t i=0; (i<2) && (ret == HM10_EC_OK); i++)
+		{
+			ret = get_hm10_tx_stream_buffer(&stream_buffer, SIM_OTA_TIMEOUT);
+			if (ret == HM10_EC_OK)
+			{
+				memset(stream_buffer, i, HM10_UART_TX_STREAM_BUFFER_SIZE);
+				ret = send_hm10_tx_stream_buffer(HM10_UART_TX_STREAM_BUFFER_SIZE);
+			}
+		}
+		set_hm10_sim_tx_dma_failures(1);
+		if (ret == HM10_EC_OK)
+		{
+			ret = flush_hm10_tx_stream(SIM_OTA_TIMEOUT);
+		}
+		get_hm10_sim_stats(&stream_stats);
+		end_operation("OTA stream (DMA failure)", ret, (ret == HM10_EC_OK) && (stream_stats.tx_dma_failures == 1)
+		              && ((stream_stats.bytes_sent - start_stats.bytes_sent) == 2*HM10_UART_TX_STREAM_BUFFER_SIZE));
+
+		/* Leave the line idle so that the simulated HM-10 BT Device forwards the streamed data before the next Command, whose echo is then discarded. */
+		HAL_Delay(SIM_OTA_TIMEOUT);
+	#endif
+
+	begin_operation();
+	ret = disconnect_hm10_from_bt_address();
+	end_operation("Disconnect", ret, ret == HM10_BT_Connection_Lost);
+
+	printf("%d operation(s) failed.\r\n", failures);
+	return (failures == 0) ? 0 : 1;
+}
+
+static void begin_operation(void)
+{
+	get_hm10_sim_stats(&start_stats);
+}
+
+static void end_operation(const char *name, int ret, int ok)
+{
+	/** <b>Local variable end_stats:</b> Statistics of the @ref hm10_sim at the end of the operation. */
+	HM10_Sim_Stats end_stats;
+	get_hm10_sim_stats(&end_stats);
+
+	/** <b>Local variable time_ns:</b> Simulated time in nanoseconds that the operation took. */
+	uint64_t time_ns = end_stats.time_ns - start_stats.time_ns;
+	/** <b>Local variable active_ns:</b> Simulated time in nanoseconds that the MCU/MPU was active during the operation. */
+	uint64_t active_ns = time_ns - (end_stats.sleep_ns - start_stats.sleep_ns);
+	printf("%-28s %4d %-3s %12.3f %12.3f\r\n", name, ret, ok ? "" : "(!)", time_ns/1e6, active_ns/1e6);
+	#if HM10_TRACE
+		print_hm10_trace();
+	#endif
+	if (!ok)
+	{
+		failures++;
+	}
+}
+
+#if HM10_UART_TX_STREAM
+static void count_stream_swap(void)
+{
+	stream_swaps++;
+}
+#endif
+
+/** @} */
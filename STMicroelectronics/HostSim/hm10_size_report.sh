@@ -0,0 +1,44 @@
+#!/bin/sh
+#
+#
+# Author: Cesar Miranda Meza
+#
+# email: cmirandameza3@hotmail.com
+#
+# Prints the Flash (text + data) and RAM (data + bss) footprint of the STM32 HM-10 driver library for several
+# configurations of its HM10_CMD_* and UART feature flags, so that its footprint can be tracked over releases. It builds
+# against the simulated HAL of this folder, which only declares the HAL, so that no HAL code is counted. To measure it
+# for the actual MCU, give it the cross compiler, e.g.:
+#
+#   CC=arm-none-eabi-gcc SIZE=arm-none-eabi-size TARGET_FLAGS="-mcpu=cortex-m3 -mthumb" ./hm10_size_report.sh
+#
+
+CC=${CC:-gcc}
+SIZE=${SIZE:-size}
+TARGET_FLAGS=${TARGET_FLAGS:-}
+CFLAGS="-Os -ffunction-sections -fdata-sections -std=gnu11 -w -I. -I../Inc $TARGET_FLAGS"
+OBJECT=${TMPDIR:-/tmp}/hm10_size_report.$$.o
+
+NO_CMDS="-DHM10_CMD_RESET=0U -DHM10_CMD_RENEW=0U -DHM10_CMD_NAME=0U -DHM10_CMD_ROLE=0U -DHM10_CMD_PIN=0U -DHM10_CMD_PIN_CODE_MODE=0U -DHM10_CMD_MODULE_WORK_MODE=0U -DHM10_CMD_MODULE_WORK_TYPE=0U -DHM10_CMD_NOTIFY_INFORMATION_MODE=0U -DHM10_CMD_CONNECTION=0U"
+UART_FEATURES="-DHM10_UART_RX_DMA=1U -DHM10_UART_TX_QUEUE=1U -DHM10_LOW_POWER_WAIT=1U"
+
+report()
+{
+	if ! $CC $CFLAGS $2 -c ../Src/hm10_ble_driver.c -o "$OBJECT"; then
+		echo "$1: build failed" >&2
+		exit 1
+	fi
+	$SIZE "$OBJECT" | awk -v name="$1" 'NR == 2 { printf "%-36s %8d %8d %8d %8d %8d\n", name, $1, $2, $3, $1 + $2, $2 + $3 }'
+}
+
+printf "%-36s %8s %8s %8s %8s %8s\n" "Configuration" "text" "data" "bss" "Flash" "RAM"
+report "All commands (default)" ""
+report "All commands, verbose" "-DETX_OTA_VERBOSE=1U"
+report "All commands, DMA/IT UART" "$UART_FEATURES"
+report "All commands, DMA TX stream" "-DHM10_UART_RX_DMA=1U -DHM10_UART_TX_STREAM=1U -DHM10_LOW_POWER_WAIT=1U"
+report "Central (role, connection, reset)" "$NO_CMDS -DHM10_CMD_ROLE=1U -DHM10_CMD_CONNECTION=1U -DHM10_CMD_RESET=1U"
+report "Peripheral (name, pin, type, reset)" "$NO_CMDS -DHM10_CMD_NAME=1U -DHM10_CMD_PIN=1U -DHM10_CMD_PIN_CODE_MODE=1U -DHM10_CMD_RESET=1U"
+report "Test command and OTA data only" "$NO_CMDS"
+report "Test command and OTA data, DMA/IT" "$NO_CMDS $UART_FEATURES"
+
+rm -f "$OBJECT"
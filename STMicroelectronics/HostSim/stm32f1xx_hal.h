@@ -0,0 +1,172 @@
+/** @addtogroup hm10_sim
+ * @{
+ */
+
+/**@file
+ * @brief	Simulated STM32F1 HAL Header file.
+ *
+ * @details This header file replaces the "stm32f1xx_hal.h" header file of the STM32CubeF1 package whenever the @ref
+ *          hm10_ble is compiled on a host machine, so that its code can be compiled without any change. It only
+ *          declares the subset of the HAL, of the CMSIS and of the registers that the @ref hm10_ble uses, all of which
+ *          are implemented over the simulated HM-10 BT Device and the virtual clock of the @ref hm10_sim .
+ *
+ * @author 	Cesar Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026.
+ */
+
+#ifndef STM32F1XX_HAL_H
+#define STM32F1XX_HAL_H
+
+#include <stdint.h> // This library contains the aliases: uint8_t, uint16_t, uint32_t, etc.
+
+/**@brief	HAL Status structures definition.
+ */
+typedef enum
+{
+	HAL_OK       = 0x00U,
+	HAL_ERROR    = 0x01U,
+	HAL_BUSY     = 0x02U,
+	HAL_TIMEOUT  = 0x03U
+} HAL_StatusTypeDef;
+
+/**@brief	HAL UART State structures definition.
+ */
+typedef enum
+{
+	HAL_UART_STATE_RESET    = 0x00U,
+	HAL_UART_STATE_READY    = 0x20U,
+	HAL_UART_STATE_BUSY_RX  = 0x22U
+} HAL_UART_StateTypeDef;
+
+/**@brief	General Purpose I/O registers, which are not simulated.
+ */
+typedef struct
+{
+	volatile uint32_t IDR;
+	volatile uint32_t ODR;
+} GPIO_TypeDef;
+
+/**@brief	DMA Channel registers.
+ */
+typedef struct
+{
+	volatile uint32_t CNDTR;    //!< Number of data items that are pending to be transferred.
+} DMA_Channel_TypeDef;
+
+/**@brief	DMA Handle Structure definition.
+ */
+typedef struct
+{
+	DMA_Channel_TypeDef *Instance;
+} DMA_HandleTypeDef;
+
+/**@brief	Universal Synchronous Asynchronous Receiver Transmitter registers.
+ */
+typedef struct
+{
+	volatile uint32_t SR;       //!< Status Register.
+	volatile uint32_t DR;       //!< Data Register.
+	volatile uint32_t CR1;      //!< Control Register 1.
+	volatile uint32_t CR3;      //!< Control Register 3.
+} USART_TypeDef;
+
+/**@brief	UART Handle Structure definition.
+ */
+typedef struct
+{
+	USART_TypeDef *Instance;
+	DMA_HandleTypeDef *hdmatx;
+	DMA_HandleTypeDef *hdmarx;
+	volatile HAL_UART_StateTypeDef RxState;
+	volatile uint32_t ErrorCode;
+} UART_HandleTypeDef;
+
+/**@brief	Data Watchpoint and Trace registers.
+ */
+typedef struct
+{
+	volatile uint32_t CTRL;
+	volatile uint32_t CYCCNT;
+} DWT_Type;
+
+/**@brief	Core Debug registers.
+ */
+typedef struct
+{
+	volatile uint32_t DEMCR;
+} CoreDebug_Type;
+
+extern DWT_Type sim_dwt;                    /**< @brief Simulated DWT, whose Cycle Counter follows the virtual clock. */
+extern CoreDebug_Type sim_core_debug;       /**< @brief Simulated Core Debug registers. */
+extern uint32_t SystemCoreClock;            /**< @brief Frequency in Hz of the simulated MCU/MPU. */
+
+#ifndef __CORTEX_M
+#define __CORTEX_M                          (3U)    /**< @brief Cortex-M3 core of the STM32F1 series, as the "core_cm3.h" header file of the CMSIS defines it. */
+#endif
+#define DWT                                 (&sim_dwt)
+#define CoreDebug                           (&sim_core_debug)
+#define CoreDebug_DEMCR_TRCENA_Msk          (1UL << 24U)
+#define DWT_CTRL_CYCCNTENA_Msk              (1UL << 0U)
+
+#define UART_FLAG_PE                        (0x00000001U)
+#define UART_FLAG_FE                        (0x00000002U)
+#define UART_FLAG_NE                        (0x00000004U)
+#define UART_FLAG_ORE                       (0x00000008U)
+#define UART_FLAG_IDLE                      (0x00000010U)
+#define UART_FLAG_RXNE                      (0x00000020U)
+
+#define USART_CR1_PEIE                      (0x00000100U)
+#define USART_CR3_EIE                       (0x00000001U)
+#define UART_IT_PE                          ((1U << 28U) | USART_CR1_PEIE)
+#define UART_IT_ERR                         ((3U << 28U) | USART_CR3_EIE)
+
+#define HAL_UART_ERROR_NONE                 (0x00000000U)
+#define HAL_UART_ERROR_PE                   (0x00000001U)
+#define HAL_UART_ERROR_NE                   (0x00000002U)
+#define HAL_UART_ERROR_FE                   (0x00000004U)
+#define HAL_UART_ERROR_ORE                  (0x00000008U)
+#define HAL_UART_ERROR_DMA                  (0x00000010U)
+
+#define __HAL_UART_GET_FLAG(__HANDLE__, __FLAG__)   ((read_hm10_sim_uart_sr(__HANDLE__) & (__FLAG__)) == (__FLAG__))
+#define __HAL_UART_FLUSH_DRREGISTER(__HANDLE__)     (read_hm10_sim_uart_dr(__HANDLE__))
+#define __HAL_UART_CLEAR_OREFLAG(__HANDLE__)        ((void) read_hm10_sim_uart_dr(__HANDLE__))
+#define __HAL_UART_CLEAR_PEFLAG(__HANDLE__)         ((void) read_hm10_sim_uart_dr(__HANDLE__))
+#define __HAL_UART_DISABLE_IT(__HANDLE__, __INTERRUPT__)   ((((__INTERRUPT__) >> 28U) == 1U) ? ((__HANDLE__)->Instance->CR1 &= ~((__INTERRUPT__) & 0xFFFFU)) : ((__HANDLE__)->Instance->CR3 &= ~((__INTERRUPT__) & 0xFFFFU)))
+#define __HAL_DMA_GET_COUNTER(__HANDLE__)           ((__HANDLE__)->Instance->CNDTR)
+
+/**@brief	Reads the Status Register of the simulated UART, after which the next read of its Data Register (either by
+ *          the software or by the DMA) clears the error flags that were read, as on the real one.
+ */
+uint32_t read_hm10_sim_uart_sr(UART_HandleTypeDef *huart);
+
+/**@brief	Reads the Data Register of the simulated UART, which clears its RXNE, ORE, NE, FE and PE Flags as on the real
+ *          one.
+ */
+uint32_t read_hm10_sim_uart_dr(UART_HandleTypeDef *huart);
+
+uint32_t HAL_GetTick(void);
+void HAL_Delay(uint32_t Delay);
+HAL_StatusTypeDef HAL_UART_Transmit(UART_HandleTypeDef *huart, const uint8_t *pData, uint16_t Size, uint32_t Timeout);
+HAL_StatusTypeDef HAL_UART_Receive(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size, uint32_t Timeout);
+HAL_StatusTypeDef HAL_UART_Transmit_IT(UART_HandleTypeDef *huart, const uint8_t *pData, uint16_t Size);
+HAL_StatusTypeDef HAL_UART_Transmit_DMA(UART_HandleTypeDef *huart, const uint8_t *pData, uint16_t Size);
+HAL_StatusTypeDef HAL_UARTEx_ReceiveToIdle_DMA(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size);
+HAL_StatusTypeDef HAL_UART_AbortReceive(UART_HandleTypeDef *huart);
+
+/**@brief	Callbacks that the simulated HAL calls, which must be defined by the application as on the real HAL.
+ * @{
+ */
+void HAL_UARTEx_RxEventCallback(UART_HandleTypeDef *huart, uint16_t Size);
+void HAL_UART_TxCpltCallback(UART_HandleTypeDef *huart);
+void HAL_UART_ErrorCallback(UART_HandleTypeDef *huart);
+/** @} */
+
+uint32_t __get_PRIMASK(void);
+void __set_PRIMASK(uint32_t priMask);
+void __disable_irq(void);
+void __enable_irq(void);
+void __WFI(void);
+
+#endif /* STM32F1XX_HAL_H */
+
+/** @} */
@@ -0,0 +1,17 @@
+/** @addtogroup hm10_sim
+ * @{
+ */
+
+/**@file
+ * @brief	FreeRTOS Stub Header file of the stream buffers.
+ *
+ * @details This header file replaces the "stream_buffer.h" header file of the FreeRTOS Kernel whenever the @ref hm10_rtos is
+ *          compiled on a host machine. All of its declarations are in the "FreeRTOS.h" header file of this folder.
+ *
+ * @author 	Cesar Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026.
+ */
+
+#include "FreeRTOS.h" // FreeRTOS Stub, which declares the whole subset of the FreeRTOS Kernel used by the HM-10 FreeRTOS Binding.
+
+/** @} */
@@ -459,6 +459,12 @@
 
 #define HM10_MAX_BLE_NAME_SIZE          (12)		/**< @brief Total maximum bytes that the BT Name of the HM-10 BT Device can have. */
 #define HM10_PIN_VALUE_SIZE             (6)			/**< @brief Length in bytes of the Pin value in a HM-10 BT device. */
+#define HM10_MAX_PACKET_SIZE            (19)        /**< @brief Total maximum bytes in a Tx/Rx package/Payload to/from the HM-10 BT Device. @note The documentation of the HM-10 BT Device states that there is a restriction of sending data from one HM-10 BT Device to another, whenever they establish a connection, of 19 bytes per request. Therefore, to manage things homogeneously, both the transmit and receive requests will be handled by this @ref hm10_ble with the same size limit of 19 bytes. */
+#if defined(__CORTEX_M) && (__CORTEX_M >= 3U)
+#define HM10_DWT_CYCCNT                 (1)         /**< @brief Flag that indicates with a 1 that the Cortex-M core has the DWT Cycle Counter (i.e., Cortex-M3 and above) or, otherwise, with a 0 that the cycle counts of the default port are derived from its tick (i.e., Cortex-M0 and Cortex-M0+). */
+#else
+#define HM10_DWT_CYCCNT                 (0)         /**< @brief Flag that indicates with a 1 that the Cortex-M core has the DWT Cycle Counter (i.e., Cortex-M3 and above) or, otherwise, with a 0 that the cycle counts of the default port are derived from its tick (i.e., Cortex-M0 and Cortex-M0+). */
+#endif
 
 /**@brief	HM-10 Exception codes.
  *
@@ -596,6 +602,64 @@ typedef struct __attribute__ ((__packed__)) {
 	uint16_t GPIO_Pin;			//!< Pin number of the GPIO peripheral from to this @ref HM10_GPIO_def_t structure will be associated with.
 } HM10_GPIO_def_t;
 
+/**@brief	Watermark callback of the transmit queue of the @ref hm10_ble .
+ *
+ * @details Whenever @ref HM10_UART_TX_QUEUE is enabled, this callback is called from the UART's interrupt each time
+ *          that the number of bytes pending to be sent in the transmit queue drops from above to at or below @ref
+ *          HM10_UART_TX_LOW_WATERMARK , which is the moment at which the application should produce more data.
+ *
+ * @param free_space    Number of bytes that can be queued at that moment without having to wait.
+ */
+typedef void (*HM10_TX_Watermark_Callback)(uint16_t free_space);
+
+/**@brief	Buffer-free callback of the transmit stream of the @ref hm10_ble .
+ *
+ * @details Whenever @ref HM10_UART_TX_STREAM is enabled, this callback is called from the UART's interrupt each time
+ *          that the DMA has finished sending one of the buffers of the transmit stream, right after the other one (if
+ *          it was already filled) has been started, which is the moment at which the application can get the freed
+ *          buffer with the @ref get_hm10_tx_stream_buffer function without having to wait.
+ */
+typedef void (*HM10_TX_Stream_Callback)(void);
+
+/**@brief	HM-10 Port Definition structure.
+ *
+ * @details This contains the functions through which the @ref hm10_ble measures time and waits for events, so that
+ *          they can be replaced either by the ones of a low-power scheme of your application (e.g., entering the STOP
+ *          Mode on devices whose UART can wake up the MCU/MPU from it) or by simulated ones that allow to test the
+ *          logic of this module on a host machine (see @ref set_hm10_port ).
+ */
+typedef struct {
+	uint32_t (*get_tick)(void);       //!< Function that returns the current time in milliseconds (i.e., \c HAL_GetTick() by default).
+	void (*wait_for_event)(void);     //!< Function that makes our MCU/MPU sleep until the next interrupt (i.e., \c __WFI() by default), which must return at least once per millisecond of the \c get_tick function so that the timeouts are respected.
+	uint32_t (*get_cycles)(void);     //!< Function that returns a free-running count of CPU cycles (i.e., the \c DWT->CYCCNT register by default, or the \c HAL_GetTick() milliseconds converted into cycles on the cores without it, see @ref HM10_DWT_CYCCNT ).
+} HM10_Port_def_t;
+
+/**@brief	HM-10 Activity Statistics structure.
+ *
+ * @details This contains the time that our MCU/MPU has spent inside the @ref hm10_ble since the last call to the @ref
+ *          reset_hm10_activity_stats function, in the units of the get_cycles() function of the @ref HM10_Port_def_t
+ *          port, so that the active time of a command can be measured by calling that function right before it.
+ */
+typedef struct {
+	uint32_t active_cycles;           //!< Number of cycles during which our MCU/MPU was awake.
+	uint32_t sleep_cycles;            //!< Number of cycles during which our MCU/MPU was asleep in the wait_for_event() function of the @ref HM10_Port_def_t port.
+	uint32_t sleeps;                  //!< Number of times that the wait_for_event() function of the @ref HM10_Port_def_t port was called.
+} HM10_Activity_Stats;
+
+/**@brief	HM-10 UART Error Statistics structure.
+ *
+ * @details This contains the number of errors that the UART has reported since the last call to the @ref
+ *          reset_hm10_uart_error_stats function, whenever @ref HM10_UART_ERROR_RECOVERY is enabled.
+ */
+typedef struct {
+	uint32_t overrun;                 //!< Number of Overrun Errors (i.e., bytes lost because the previous one had not been read yet).
+	uint32_t noise;                   //!< Number of Noise Errors (i.e., bytes received with noise on the line).
+	uint32_t framing;                 //!< Number of Framing Errors (i.e., bytes received without a valid Stop Bit).
+	uint32_t parity;                  //!< Number of Parity Errors.
+	uint32_t dma;                     //!< Number of DMA Transfer Errors.
+	uint32_t recoveries;              //!< Number of times that the circular DMA reception was restarted after the HAL aborted it (see @ref handle_hm10_uart_error ).
+} HM10_UART_Error_Stats;
+
 /**@brief	Sends a Test Command to the HM-10 BT Device.
  *
  * @details The primary use of this function is to identify if the HM-10 BT Device is active and/or operational
@@ -616,6 +680,7 @@ typedef struct __attribute__ ((__packed__)) {
  */
 HM10_Status send_hm10_test_cmd();
 
+#if HM10_CMD_RESET
 /**@brief	Sends a Reset Command to the HM-10 BT Device.
  *
  * @retval	HM10_EC_OK	if the Reset Command was successfully sent to the HM-10 BT Device and if an OK Response was
@@ -628,7 +693,9 @@ HM10_Status send_hm10_test_cmd();
  * @date	December 08, 2023
  */
 HM10_Status send_hm10_reset_cmd();
+#endif
 
+#if HM10_CMD_RENEW
 /**@brief	Sends a Renew Command to the HM-10 BT Device.
  *
  * @retval	HM10_EC_OK	if the Renew Command was successfully sent to the HM-10 BT Device and if a Renew Response was
@@ -641,7 +708,9 @@ HM10_Status send_hm10_reset_cmd();
  * @date	December 09, 2023
  */
 HM10_Status send_hm10_renew_cmd();
+#endif
 
+#if HM10_CMD_NAME
 /**@brief	Sends a Set Name Command to the HM-10 BT Device and sets a desired BT Name to that Device.
  *
  * @param[in] hm10_name Pointer to the ASCII Code data representing the desired BT Name that wants to be given to the
@@ -697,7 +766,9 @@ HM10_Status set_hm10_name(uint8_t *hm10_name, uint8_t size);
  * @date	December 11, 2023
  */
 HM10_Status get_hm10_name(uint8_t *hm10_name, uint8_t *size);
+#endif
 
+#if HM10_CMD_ROLE
 /**@brief	Sends a Set Role Command to the HM-10 BT Device and sets a desired BT Role to that Device.
  *
  * @param	ble_role	BT Role that wants to be set in the HM-10 BT Device.
@@ -745,7 +816,9 @@ HM10_Status set_hm10_role(HM10_Role ble_role);
  * @date	December 08, 2023
  */
 HM10_Status get_hm10_role(HM10_Role *ble_role);
+#endif
 
+#if HM10_CMD_PIN
 /**@brief	Sends a Set Pass Command to the HM-10 BT Device and sets a desired BT Pin to that Device.
  *
  * @param[in] pin	Pointer to the ASCII Code data representing the desired BT Pin that wants to be given to the HM-10
@@ -797,7 +870,9 @@ HM10_Status set_hm10_pin(uint8_t *pin);
  * @date	December 08, 2023
  */
 HM10_Status get_hm10_pin(uint8_t *pin);
+#endif
 
+#if HM10_CMD_PIN_CODE_MODE
 /**@brief	Sends a Set Type Command to the HM-10 BT Device and sets a desired Pin Code Mode to that Device.
  *
  * @param pin_code_mode Pin Code Mode that is desired to set in the HM-10 BT Device.
@@ -847,7 +922,9 @@ HM10_Status set_hm10_pin_code_mode(HM10_Pin_Code_Mode pin_code_mode);
  * @date	December 11, 2023
  */
 HM10_Status get_hm10_pin_code_mode(HM10_Pin_Code_Mode *pin_code_mode);
+#endif
 
+#if HM10_CMD_MODULE_WORK_MODE
 /**@brief	Sends a Set Mode Command to the HM-10 BT Device and sets a desired Module Work Mode to that Device.
  *
  * @param module_work_mode Module Work Mode that is desired to set in the HM-10 BT Device.
@@ -897,7 +974,9 @@ HM10_Status set_hm10_module_work_mode(HM10_Module_Work_Mode module_work_mode);
  * @date	December 11, 2023
  */
 HM10_Status get_hm10_module_work_mode(HM10_Module_Work_Mode *module_work_mode);
+#endif
 
+#if HM10_CMD_MODULE_WORK_TYPE
 /**@brief	Sends a Set IMME Command to the HM-10 BT Device and sets a desired Module Work Type to that Device.
  *
  * @param module_work_type Module Work Type that is desired to set in the HM-10 BT Device.
@@ -947,7 +1026,9 @@ HM10_Status set_hm10_module_work_type(HM10_Module_Work_Type module_work_type);
  * @date	December 11, 2023
  */
 HM10_Status get_hm10_module_work_type(HM10_Module_Work_Type *module_work_type);
+#endif
 
+#if HM10_CMD_NOTIFY_INFORMATION_MODE
 /**@brief	Sends a Set NOTI Command to the HM-10 BT Device and sets a desired Notify Information Mode to that Device.
  *
  * @param notify_mode   Notify Information Mode that is desired to set in the HM-10 BT Device.
@@ -997,7 +1078,9 @@ HM10_Status set_hm10_notify_information_mode(HM10_Notify_Information_Mode notify
  * @date	December 11, 2023
  */
 HM10_Status get_hm10_notify_information_mode(HM10_Notify_Information_Mode *notify_mode);
+#endif
 
+#if HM10_CMD_CONNECTION
 /**@brief	Sends a Connect-To-Address Command to the HM-10 BT Device (must be configured in Central Mode) and connects
  *          that Device with a desired Remote Bluetooth Device that should have already been configured in Peripheral
  *          Mode.
@@ -1072,10 +1155,15 @@ HM10_Status connect_hm10_to_bt_address(HM10_BT_Address_Type bt_addr_t, char bt_a
  * @date	December 12, 2023
  */
 HM10_BT_Connection_Status disconnect_hm10_from_bt_address();
+#endif
 
 /**@brief   Sends some desired data Over the Air (OTA) via the HM-10 BT Device to whatever other BT Device it is
  *          connected to Point-to-Point, if there is such a connection.
  *
+ * @details If @ref HM10_UART_TX_QUEUE is enabled, the requested data is copied into the transmit queue, from which the
+ *          UART sends it in the background, and this function returns as soon as it is queued. In that case, the \p
+ *          timeout param is the time to wait for enough free space in that queue.
+ *
  * @note    If there is no BT connection between the HM-10 BT Device and any other BT Device, the HM-10 BT Device
  *          will do nothing.
  *
@@ -1120,6 +1208,9 @@ HM10_Status get_hm10_ota_data(uint8_t *ble_ota_data, uint16_t size, uint32_t tim
  *
  * @details This function stores in the @ref p_huart Global Static Pointer the address of the UART Handle Structure of
  *          the UART that is desired to be used by the @ref hm10_ble to send/receive data to/from the HM-10 BT Device.
+ *          If @ref HM10_UART_RX_DMA is enabled, this function also starts the circular DMA reception described in the
+ *          @ref handle_hm10_uart_rx_event function and, if @ref HM10_UART_ERROR_RECOVERY is also enabled, it disables
+ *          the Error Interrupts of the UART so that its errors do not make the HAL abort that reception.
  *
  * @param[in] huart	Pointer to the UART Handle Structure of the UART that it is desired to use in the @ref hm10_ble to
  *                  send/receive data to/from the HM-10 BT Device.
@@ -1129,6 +1220,281 @@ HM10_Status get_hm10_ota_data(uint8_t *ble_ota_data, uint16_t size, uint32_t tim
  */
 void init_hm10_module(UART_HandleTypeDef *huart);
 
+/**@brief	Accounts for the data that the DMA has written into the circular RX buffer of the @ref hm10_ble whenever
+ *          @ref HM10_UART_RX_DMA is enabled.
+ *
+ * @details The @ref init_hm10_module function starts a Receive-To-Idle DMA reception on the UART into a circular
+ *          buffer of @ref HM10_UART_RX_RING_SIZE bytes, so that all the AT Command responses and all the BT data
+ *          received Over the Air (OTA) are served from that buffer without our MCU/MPU having to poll the UART. The
+ *          HAL reports the progress of that reception on the Half-Transfer, on the Transfer-Complete and on the
+ *          Idle-Line Events through its HAL_UARTEx_RxEventCallback() function, from which this function must be
+ *          called as shown in the following code example:
+ *
+ * @code
+  void HAL_UARTEx_RxEventCallback(UART_HandleTypeDef *huart, uint16_t Size)
+  {
+      handle_hm10_uart_rx_event(huart, Size);
+  }
+ * @endcode
+ *
+ * @details If @ref HM10_UART_ERROR_RECOVERY is enabled, this function also checks the error flags of the UART, which
+ *          any of the bytes written since the previous event may have raised, and remembers those bytes so that the
+ *          read that returns them raises the flag of the @ref get_hm10_rx_error_flag function.
+ *
+ * @note    The RX DMA Channel of the UART must be configured in Circular Mode. If @ref HM10_UART_RX_DMA is disabled,
+ *          then this function does nothing.
+ *
+ * @param[in] huart	Pointer to the UART Handle Structure of the UART that generated the event, which is ignored if it is
+ *                  not the one given to the @ref init_hm10_module function.
+ * @param size      Position in the circular buffer up to which the DMA has written, as given by the HAL.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+void handle_hm10_uart_rx_event(UART_HandleTypeDef *huart, uint16_t size);
+
+/**@brief	Recovers the circular DMA reception of the @ref hm10_ble after the HAL has aborted it because of an error,
+ *          whenever both @ref HM10_UART_RX_DMA and @ref HM10_UART_ERROR_RECOVERY are enabled.
+ *
+ * @details Since the @ref init_hm10_module function disables the Error Interrupts of the UART, its Overrun, Noise,
+ *          Framing and Parity Errors do not stop the circular DMA reception, and they are instead detected and counted
+ *          by the @ref handle_hm10_uart_rx_event function while every byte that was received is kept. However, the HAL
+ *          still aborts that reception whenever the DMA itself fails and then calls its HAL_UART_ErrorCallback()
+ *          function, from which this function must be called as shown in the following code example:
+ *
+ * @code
+  void HAL_UART_ErrorCallback(UART_HandleTypeDef *huart)
+  {
+      handle_hm10_uart_error(huart);
+  }
+ * @endcode
+ *
+ * @details This function counts the error (see @ref get_hm10_uart_error_stats ), clears the error flags of the UART
+ *          and restarts the circular DMA reception right away instead of leaving it stopped until the next call to
+ *          the @ref init_hm10_module function. Since the restarted reception writes again from the beginning of the
+ *          circular buffer, the bytes that were pending to be read at that moment are discarded and the next read
+ *          raises the flag of the @ref get_hm10_rx_error_flag function.
+ *
+ * @note    If either @ref HM10_UART_RX_DMA or @ref HM10_UART_ERROR_RECOVERY is disabled, then this function does
+ *          nothing.
+ *
+ * @param[in] huart	Pointer to the UART Handle Structure of the UART that reported the error, which is ignored if it is
+ *                  not the one given to the @ref init_hm10_module function.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+void handle_hm10_uart_error(UART_HandleTypeDef *huart);
+
+/**@brief	Gets and clears the flag that indicates whether the data received from the HM-10 BT Device was affected by
+ *          an error of the UART.
+ *
+ * @details If @ref HM10_UART_RX_DMA is enabled, the flag is raised by the read (e.g., by the @ref get_hm10_ota_data
+ *          function) that returns any of the bytes that were received between the two events of the @ref
+ *          handle_hm10_uart_rx_event function at which the error was detected, so that the layer that validates the
+ *          frames (e.g., with the @ref hm10_crc32c ) can tell which frame is damaged and keep all the other ones.
+ *          Otherwise, the flag is raised by the read that failed while the UART had an error flag set.
+ *
+ * @return  \c 1 if any of the data that was read since the last call to this function was affected by an error of
+ *          the UART, or \c 0 otherwise or if @ref HM10_UART_ERROR_RECOVERY is disabled.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+uint8_t get_hm10_rx_error_flag();
+
+/**@brief	Restarts the count of the errors that the UART has reported to the @ref hm10_ble .
+ *
+ * @note    This function does nothing if @ref HM10_UART_ERROR_RECOVERY is disabled.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+void reset_hm10_uart_error_stats();
+
+/**@brief	Gets the number of errors that the UART has reported to the @ref hm10_ble since the last call to the @ref
+ *          reset_hm10_uart_error_stats function.
+ *
+ * @param[out] stats    Pointer to the Memory Address into which the statistics will be stored.
+ *
+ * @retval	HM10_EC_OK	if the statistics were stored.
+ * @retval  HM10_EC_NA  if @ref HM10_UART_ERROR_RECOVERY is disabled.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+HM10_Status get_hm10_uart_error_stats(HM10_UART_Error_Stats *stats);
+
+/**@brief	Starts sending the next part of the transmit queue, or the next buffer of the transmit stream, of the @ref
+ *          hm10_ble once the UART has finished sending the previous one.
+ *
+ * @details This function must be called from the HAL_UART_TxCpltCallback() function of your application, as shown in
+ *          the following code example:
+ *
+ * @code
+  void HAL_UART_TxCpltCallback(UART_HandleTypeDef *huart)
+  {
+      handle_hm10_uart_tx_complete(huart);
+  }
+ * @endcode
+ *
+ * @details If @ref HM10_UART_TX_STREAM is enabled instead, this function frees the buffer of the transmit stream that
+ *          has just been sent and starts sending the other one if the application has already filled it.
+ *
+ * @note    If both @ref HM10_UART_TX_QUEUE and @ref HM10_UART_TX_STREAM are disabled, then this function does
+ *          nothing.
+ *
+ * @param[in] huart	Pointer to the UART Handle Structure of the UART that has finished sending, which is ignored if it
+ *                  is not the one given to the @ref init_hm10_module function.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+void handle_hm10_uart_tx_complete(UART_HandleTypeDef *huart);
+
+/**@brief	Sets the callback that is called whenever the transmit queue of the @ref hm10_ble drains down to @ref
+ *          HM10_UART_TX_LOW_WATERMARK bytes.
+ *
+ * @param callback  Pointer to the callback (see @ref HM10_TX_Watermark_Callback ), or \c NULL to not be notified.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+void set_hm10_tx_watermark_callback(HM10_TX_Watermark_Callback callback);
+
+/**@brief	Gets the number of bytes that can be queued into the transmit queue of the @ref hm10_ble without having to
+ *          wait.
+ *
+ * @return  The free space in bytes of the transmit queue if @ref HM10_UART_TX_QUEUE is enabled, or \c 0 otherwise.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+uint16_t get_hm10_tx_queue_free_space();
+
+#if HM10_UART_TX_STREAM
+/**@brief	Gets the buffer of the transmit stream of the @ref hm10_ble into which the application has to write the next
+ *          packet that it wants to send Over the Air (OTA), waiting until the DMA has finished sending it if needed.
+ *
+ * @details The transmit stream owns two buffers of @ref HM10_UART_TX_STREAM_BUFFER_SIZE bytes, so that the application
+ *          can fill one of them (e.g., directly from its ADC) while the DMA of the UART sends the other one, without
+ *          any copy being made by our MCU/MPU. Each buffer that is obtained with this function must be handed to the
+ *          DMA with the @ref send_hm10_tx_stream_buffer function, as shown in the following code example:
+ *
+ * @code
+  uint8_t *buffer;
+  while (get_hm10_tx_stream_buffer(&buffer, HM10_CUSTOM_HAL_TIMEOUT) == HM10_EC_OK)
+  {
+      uint16_t size = read_adc_samples(buffer, HM10_UART_TX_STREAM_BUFFER_SIZE);
+      send_hm10_tx_stream_buffer(size);
+  }
+ * @endcode
+ *
+ * @note    Calling this function again before calling the @ref send_hm10_tx_stream_buffer function gives the same
+ *          buffer back.
+ * @note    If the UART failed to start sending the next buffer from its interrupt, then this function retries to start
+ *          it while waiting, so that the transmit stream does not stall.
+ *
+ * @param[out] buffer   Pointer to the Memory Address into which the pointer to the buffer will be stored.
+ * @param timeout       Time in milliseconds to wait for the buffer to be free.
+ *
+ * @retval	HM10_EC_OK	if the pointer to the buffer was stored.
+ * @retval  HM10_EC_NR  if the buffer was not freed within the \p timeout param.
+ * @retval  HM10_EC_ERR if the UART kept failing to start sending the buffers of the transmit stream until the \p
+ *                      timeout param expired.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+HM10_Status get_hm10_tx_stream_buffer(uint8_t **buffer, uint32_t timeout);
+
+/**@brief	Hands the buffer that was obtained with the @ref get_hm10_tx_stream_buffer function to the DMA of the UART,
+ *          which starts sending it right away if it is idle or, otherwise, as soon as it finishes sending the other
+ *          buffer of the transmit stream (see @ref handle_hm10_uart_tx_complete ).
+ *
+ * @param size  Number of bytes that the application wrote at the beginning of the buffer.
+ *
+ * @retval	HM10_EC_OK	if the buffer was handed to the DMA.
+ * @retval  HM10_EC_ERR if the \p size param is \c 0 or larger than @ref HM10_UART_TX_STREAM_BUFFER_SIZE , if the buffer
+ *                      is still being sent or if the UART failed to start sending it.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+HM10_Status send_hm10_tx_stream_buffer(uint16_t size);
+
+/**@brief	Waits until the DMA of the UART has finished sending both buffers of the transmit stream of the @ref hm10_ble .
+ *
+ * @note    The functions that send Commands or data Over the Air (OTA) through the HAL_UART_Transmit() function already
+ *          wait for this, for up to their own timeout, before sending anything.
+ * @note    If the UART failed to start sending the next buffer from its interrupt, then this function retries to start
+ *          it while waiting, so that the transmit stream does not stall.
+ *
+ * @param timeout   Time in milliseconds to wait for both buffers to be sent.
+ *
+ * @retval	HM10_EC_OK	if both buffers were sent.
+ * @retval  HM10_EC_NR  if they were not sent within the \p timeout param.
+ * @retval  HM10_EC_ERR if the UART kept failing to start sending the buffers of the transmit stream until the \p
+ *                      timeout param expired.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+HM10_Status flush_hm10_tx_stream(uint32_t timeout);
+
+/**@brief	Sets the callback that is called whenever the DMA of the UART has finished sending a buffer of the transmit
+ *          stream of the @ref hm10_ble .
+ *
+ * @param callback  Pointer to the callback (see @ref HM10_TX_Stream_Callback ), or \c NULL to not be notified.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+void set_hm10_tx_stream_callback(HM10_TX_Stream_Callback callback);
+#endif
+
+/**@brief	Sets the port through which the @ref hm10_ble measures time and waits for events.
+ *
+ * @param[in] port  Pointer to the port (see @ref HM10_Port_def_t ), which must remain valid while this module is used,
+ *                  or \c NULL to use the default one that is based on the HAL and on the Cortex-M core.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+void set_hm10_port(const HM10_Port_def_t *port);
+
+/**@brief	Restarts the measurement of the time that our MCU/MPU spends active and asleep inside the @ref hm10_ble .
+ *
+ * @note    This function does nothing if @ref HM10_ACTIVE_TIME_STATS is disabled.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+void reset_hm10_activity_stats();
+
+/**@brief	Gets the time that our MCU/MPU has spent active and asleep inside the @ref hm10_ble since the last call to
+ *          the @ref reset_hm10_activity_stats function.
+ *
+ * @details The following code example shows how to measure the active time of a command:
+ *
+ * @code
+  HM10_Activity_Stats stats;
+  reset_hm10_activity_stats();
+  send_hm10_reset_cmd();
+  get_hm10_activity_stats(&stats);
+  printf("Active for %lu cycles, asleep for %lu cycles.\r\n", stats.active_cycles, stats.sleep_cycles);
+ * @endcode
+ *
+ * @param[out] stats    Pointer to the Memory Address into which the statistics will be stored.
+ *
+ * @retval	HM10_EC_OK	if the statistics were stored.
+ * @retval  HM10_EC_NA  if @ref HM10_ACTIVE_TIME_STATS is disabled.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+HM10_Status get_hm10_activity_stats(HM10_Activity_Stats *stats);
+
 #endif /* HM10_BLE_DRIVER_H_ */
 
 /** @} */
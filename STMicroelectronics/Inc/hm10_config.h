@@ -51,6 +51,122 @@
 #define HM10_RESET_AND_RENEW_CMDS_DELAY     (1000U)        /**< @brief Designated time in milliseconds for the Delay to be requested each time after either the Reset or the Renew Command is solicited to the HM-10 BT Device. @details In order to guarantee that any other AT Command will work as expected after Resetting the HM-10 BT Device, a Delay is needed in order to wait for the Device to complete the Reset Process. This is particularly necessary if a Bluetooth Connection is requested to the HM-10 BT Device after applying a Reset to itself. @note On a validation test made with only one HM-10 BT Device, a Delay of 500 milliseconds worked fine, but repeating that test with more units in the future would help to learn the right value for this Definition. Therefore, a higher value than the one mentioned is suggested in order to guarantee that the HM-10 BT Device will work properly. */
 #endif
 
+#ifndef HM10_UART_RX_DMA
+#define HM10_UART_RX_DMA                    (0U)           /**< @brief Flag used to make the @ref hm10_ble receive all the data from the HM-10 BT Device through a circular DMA buffer fed by the Receive-To-Idle Event of the UART with a 1 or, otherwise, to poll-receive it with the HAL_UART_Receive() function with a 0. @note When enabling this, the RX DMA Channel of the UART must be configured in Circular Mode and the @ref handle_hm10_uart_rx_event function must be called from the HAL_UARTEx_RxEventCallback() function of your application. */
+#endif
+
+#ifndef HM10_UART_RX_RING_SIZE
+#define HM10_UART_RX_RING_SIZE              (256U)         /**< @brief Length in bytes of the circular DMA buffer into which the data from the HM-10 BT Device is received whenever @ref HM10_UART_RX_DMA is enabled. @note This value must be a power of 2, and it must be large enough to hold all the data that may arrive while our MCU/MPU is not reading it. */
+#endif
+
+#ifndef HM10_UART_ERROR_RECOVERY
+#define HM10_UART_ERROR_RECOVERY            (0U)           /**< @brief Flag used to make the @ref hm10_ble keep receiving through the Overrun, Noise, Framing and Parity Errors of the UART, while flagging the data that those errors affected (see @ref get_hm10_rx_error_flag ) and counting them (see @ref get_hm10_uart_error_stats ), with a 1 or, otherwise, to let those errors make the reception fail with a 0. @note When enabling this together with @ref HM10_UART_RX_DMA , the Error Interrupts of the UART are disabled so that the HAL does not abort the circular DMA reception on those errors, and the @ref handle_hm10_uart_error function must be called from the HAL_UART_ErrorCallback() function of your application to recover from the ones that still make the HAL abort it (e.g., the DMA Transfer Errors). */
+#endif
+
+#ifndef HM10_UART_RX_ERROR_RECORDS
+#define HM10_UART_RX_ERROR_RECORDS          (4U)           /**< @brief Number of UART errors whose position in the circular DMA buffer is remembered until the data around them is read, whenever both @ref HM10_UART_RX_DMA and @ref HM10_UART_ERROR_RECOVERY are enabled. @note This value must be a power of 2. If more errors than this happen before their data is read, then the next read is flagged (see @ref get_hm10_rx_error_flag ) instead. */
+#endif
+
+#ifndef HM10_UART_TX_QUEUE
+#define HM10_UART_TX_QUEUE                  (0U)           /**< @brief Flag used to make the @ref hm10_ble send all the data to the HM-10 BT Device through a transmit queue that is drained in the background by the UART with a 1 or, otherwise, to send it with the blocking HAL_UART_Transmit() function with a 0. @note When enabling this, the @ref handle_hm10_uart_tx_complete function must be called from the HAL_UART_TxCpltCallback() function of your application. */
+#endif
+
+#ifndef HM10_UART_TX_QUEUE_DMA
+#define HM10_UART_TX_QUEUE_DMA              (1U)           /**< @brief Flag used to make the transmit queue, whenever @ref HM10_UART_TX_QUEUE is enabled, be drained with the HAL_UART_Transmit_DMA() function with a 1 or, otherwise, with the HAL_UART_Transmit_IT() function with a 0. @note When using a 1, the TX DMA Channel of the UART must be configured in Normal Mode. */
+#endif
+
+#ifndef HM10_UART_TX_QUEUE_SIZE
+#define HM10_UART_TX_QUEUE_SIZE             (256U)         /**< @brief Length in bytes of the transmit queue whenever @ref HM10_UART_TX_QUEUE is enabled. @note This value must be a power of 2. */
+#endif
+
+#ifndef HM10_UART_TX_LOW_WATERMARK
+#define HM10_UART_TX_LOW_WATERMARK          (64U)          /**< @brief Number of bytes pending to be sent in the transmit queue at or below which the watermark callback (see @ref set_hm10_tx_watermark_callback ) is called, whenever @ref HM10_UART_TX_QUEUE is enabled. */
+#endif
+
+#ifndef HM10_UART_TX_STREAM
+#define HM10_UART_TX_STREAM                 (0U)           /**< @brief Flag used to enable the double-buffered transmit stream of the @ref hm10_ble , in which the application fills one of two packet buffers owned by the @ref hm10_ble while the DMA of the UART sends the other one (see @ref get_hm10_tx_stream_buffer ), with a 1 or, otherwise, to leave it out of the compilation with a 0. @note When enabling this, the TX DMA Channel of the UART must be configured in Normal Mode and the @ref handle_hm10_uart_tx_complete function must be called from the HAL_UART_TxCpltCallback() function of your application. This cannot be enabled together with @ref HM10_UART_TX_QUEUE . */
+#endif
+
+#ifndef HM10_UART_TX_STREAM_BUFFER_SIZE
+#define HM10_UART_TX_STREAM_BUFFER_SIZE     (128U)         /**< @brief Length in bytes of each of the two packet buffers of the transmit stream whenever @ref HM10_UART_TX_STREAM is enabled. */
+#endif
+
+#ifndef HM10_LOW_POWER_WAIT
+#define HM10_LOW_POWER_WAIT                 (0U)           /**< @brief Flag used to make our MCU/MPU sleep, through the wait_for_event() function of the @ref HM10_Port_def_t port (i.e., \c __WFI() by default), whenever the @ref hm10_ble is waiting for the HM-10 BT Device with a 1 or, otherwise, to busy-wait with a 0. @note Only the waits that are not made inside the blocking HAL functions can sleep, which are the Reset and Renew Commands' delays, the waits for data in the circular DMA buffer (see @ref HM10_UART_RX_DMA ) the waits for free space in the transmit queue (see @ref HM10_UART_TX_QUEUE ) and the waits for a free buffer of the transmit stream (see @ref HM10_UART_TX_STREAM ). */
+#endif
+
+#ifndef HM10_ACTIVE_TIME_STATS
+#define HM10_ACTIVE_TIME_STATS              (0U)           /**< @brief Flag used to enable the measurement, through the get_cycles() function of the @ref HM10_Port_def_t port (i.e., the DWT Cycle Counter by default), of the time that our MCU/MPU spends active and asleep inside the @ref hm10_ble with a 1 or, otherwise, to disable it with a 0 (see @ref get_hm10_activity_stats ). */
+#endif
+
+#ifndef HM10_RTOS
+#define HM10_RTOS                           (0U)           /**< @brief Flag used to enable the FreeRTOS binding of the @ref hm10_rtos with a 1 or, otherwise, to leave it out of the compilation with a 0. @note The @ref hm10_rtos requires both @ref HM10_UART_RX_DMA and @ref HM10_LOW_POWER_WAIT to be enabled. */
+#endif
+
+#ifndef HM10_RTOS_DRIVER_TASK
+#define HM10_RTOS_DRIVER_TASK               (1U)           /**< @brief Flag used to make the @ref hm10_rtos create a dedicated driver task that forwards the data received from the HM-10 BT Device into a stream buffer and signals its link events with a 1 or, otherwise, to let the application tasks call the functions of the @ref hm10_ble directly with a 0. */
+#endif
+
+#ifndef HM10_RTOS_TASK_STACK_SIZE
+#define HM10_RTOS_TASK_STACK_SIZE           (192U)         /**< @brief Stack size in words of the driver task of the @ref hm10_rtos . */
+#endif
+
+#ifndef HM10_RTOS_TASK_PRIORITY
+#define HM10_RTOS_TASK_PRIORITY             (2U)           /**< @brief FreeRTOS priority of the driver task of the @ref hm10_rtos . */
+#endif
+
+#ifndef HM10_RTOS_STREAM_SIZE
+#define HM10_RTOS_STREAM_SIZE               (256U)         /**< @brief Length in bytes of the stream buffer into which the driver task of the @ref hm10_rtos forwards the data received from the HM-10 BT Device. */
+#endif
+
+#ifndef HM10_TRACE
+#define HM10_TRACE                          (0U)           /**< @brief Flag used to compile the trace points of the @ref hm10_trace , which timestamp each phase of the Commands and of the exchanges of data OTA with the DWT Cycle Counter, with a 1 or, otherwise, to leave them out of the compilation with a 0. */
+#endif
+
+#ifndef HM10_TRACE_RING_SIZE
+#define HM10_TRACE_RING_SIZE                (64U)          /**< @brief Number of records that the trace ring of the @ref hm10_trace can hold before the newest ones overwrite the oldest ones. This must be a power of 2. */
+#endif
+
+#ifndef HM10_CMD_RESET
+#define HM10_CMD_RESET                      (1U)           /**< @brief Flag used to compile the @ref send_hm10_reset_cmd function of the @ref hm10_ble with a 1 or, otherwise, to leave them out with a 0. @note The Test Command and the functions that send and receive data Over the Air are always compiled. Disabling the commands that your application does not use reduces the Flash footprint of the @ref hm10_ble (see the size report of the HostSim folder). */
+#endif
+
+#ifndef HM10_CMD_RENEW
+#define HM10_CMD_RENEW                      (1U)           /**< @brief Flag used to compile the @ref send_hm10_renew_cmd function of the @ref hm10_ble with a 1 or, otherwise, to leave them out with a 0. */
+#endif
+
+#ifndef HM10_CMD_NAME
+#define HM10_CMD_NAME                       (1U)           /**< @brief Flag used to compile the @ref set_hm10_name and @ref get_hm10_name functions of the @ref hm10_ble with a 1 or, otherwise, to leave them out with a 0. */
+#endif
+
+#ifndef HM10_CMD_ROLE
+#define HM10_CMD_ROLE                       (1U)           /**< @brief Flag used to compile the @ref set_hm10_role and @ref get_hm10_role functions of the @ref hm10_ble with a 1 or, otherwise, to leave them out with a 0. */
+#endif
+
+#ifndef HM10_CMD_PIN
+#define HM10_CMD_PIN                        (1U)           /**< @brief Flag used to compile the @ref set_hm10_pin and @ref get_hm10_pin functions of the @ref hm10_ble with a 1 or, otherwise, to leave them out with a 0. */
+#endif
+
+#ifndef HM10_CMD_PIN_CODE_MODE
+#define HM10_CMD_PIN_CODE_MODE              (1U)           /**< @brief Flag used to compile the @ref set_hm10_pin_code_mode and @ref get_hm10_pin_code_mode functions of the @ref hm10_ble with a 1 or, otherwise, to leave them out with a 0. */
+#endif
+
+#ifndef HM10_CMD_MODULE_WORK_MODE
+#define HM10_CMD_MODULE_WORK_MODE           (1U)           /**< @brief Flag used to compile the @ref set_hm10_module_work_mode and @ref get_hm10_module_work_mode functions of the @ref hm10_ble with a 1 or, otherwise, to leave them out with a 0. */
+#endif
+
+#ifndef HM10_CMD_MODULE_WORK_TYPE
+#define HM10_CMD_MODULE_WORK_TYPE           (1U)           /**< @brief Flag used to compile the @ref set_hm10_module_work_type and @ref get_hm10_module_work_type functions of the @ref hm10_ble with a 1 or, otherwise, to leave them out with a 0. */
+#endif
+
+#ifndef HM10_CMD_NOTIFY_INFORMATION_MODE
+#define HM10_CMD_NOTIFY_INFORMATION_MODE    (1U)           /**< @brief Flag used to compile the @ref set_hm10_notify_information_mode and @ref get_hm10_notify_information_mode functions of the @ref hm10_ble with a 1 or, otherwise, to leave them out with a 0. */
+#endif
+
+#ifndef HM10_CMD_CONNECTION
+#define HM10_CMD_CONNECTION                 (1U)           /**< @brief Flag used to compile the @ref connect_hm10_to_bt_address and @ref disconnect_hm10_from_bt_address functions of the @ref hm10_ble with a 1 or, otherwise, to leave them out with a 0. */
+#endif
+
 #endif /* HM10_CONFIG_H_ */
 
 /** @} */ // HM10_config
@@ -0,0 +1,105 @@
+/** @addtogroup hm10_ble
+ * @{
+ */
+
+/**@file
+ * @brief	HM-10 CRC32C Header file.
+ *
+ * @defgroup hm10_crc32c HM-10 CRC32C
+ * @{
+ *
+ * @brief   This module provides the CRC32C (i.e., the Castagnoli CRC, with the reflected polynomial 0x82F63B78) with
+ *          which the integrity of the data sent and received Over the Air (OTA) can be validated.
+ *
+ * @details By default, the CRC32C is calculated with a table-driven implementation. However, the application can
+ *          provide a hook (see @ref set_hm10_crc32c_hook ) so that it is calculated with the CRC peripheral of the
+ *          MCU/MPU instead.
+ *
+ * @note    The CRC peripheral of the STM32F1 series can only calculate the CRC-32 of the Ethernet standard over 32-bit
+ *          words, which is not the CRC32C. Therefore, a hook should only be provided on devices whose CRC peripheral
+ *          has a programmable polynomial and input/output bit reversal (e.g., the STM32F0, STM32F3, STM32F7 or STM32L4
+ *          series).
+ *
+ * @author 	Cesar Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026.
+ */
+
+#ifndef HM10_CRC32C_H_
+#define HM10_CRC32C_H_
+
+#include <stdint.h> // This library contains the aliases: uint8_t, uint16_t, uint32_t, etc.
+
+#define HM10_CRC32C_SIZE        (4)     /**< @brief Length in bytes of a CRC32C. */
+
+/**@brief	Hook that calculates the CRC32C of some data with the CRC peripheral of the MCU/MPU.
+ *
+ * @details The hook has to return the final CRC32C of the data (i.e., with an initial value of 0xFFFFFFFF, with both
+ *          its input and output reflected and with its output inverted), which is what the peripheral gives if it is
+ *          configured with the 0x1EDC6F41 polynomial, an initial value of 0xFFFFFFFF, byte input bit reversal and
+ *          output bit reversal, and if its result is then inverted by software.
+ *
+ * @param[in] data  Pointer to the data whose CRC32C is desired to be calculated.
+ * @param size      Length in bytes of the data towards which the \p data param points to.
+ *
+ * @return  The CRC32C of the data.
+ */
+typedef uint32_t (*HM10_CRC32C_Hook)(uint8_t *data, uint32_t size);
+
+/**@brief	Calculates the CRC32C of some data.
+ *
+ * @param[in] data  Pointer to the data whose CRC32C is desired to be calculated.
+ * @param size      Length in bytes of the data towards which the \p data param points to.
+ *
+ * @return  The CRC32C of the data.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+uint32_t calculate_hm10_crc32c(uint8_t *data, uint32_t size);
+
+/**@brief	Continues the CRC32C of some data with more data, so that the CRC32C of data that is split into several
+ *          buffers can be calculated without having to copy it into a single one.
+ *
+ * @details Calling this function with the CRC32C of some data A and with some data B gives the same result as calling
+ *          the @ref calculate_hm10_crc32c function with the data A followed by the data B. Calling it with a \p crc
+ *          param of 0 gives the same result as calling the @ref calculate_hm10_crc32c function.
+ *
+ * @note    Since a hook (see @ref set_hm10_crc32c_hook ) can only calculate the CRC32C of some data from its start, it
+ *          is only used whenever the \p crc param is 0, and the table-driven implementation is used otherwise.
+ *
+ * @param crc       CRC32C of the data that precedes the \p data param.
+ * @param[in] data  Pointer to the data with which the CRC32C is desired to be continued.
+ * @param size      Length in bytes of the data towards which the \p data param points to.
+ *
+ * @return  The CRC32C of the preceding data followed by the \p data param.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+uint32_t update_hm10_crc32c(uint32_t crc, uint8_t *data, uint32_t size);
+
+/**@brief	Sets the hook with which the CRC32C will be calculated.
+ *
+ * @param hook  Pointer to the hook that calculates the CRC32C with the CRC peripheral of the MCU/MPU, or \c NULL to use
+ *              the table-driven implementation again.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+void set_hm10_crc32c_hook(HM10_CRC32C_Hook hook);
+
+/**@brief	Indicates whether the CRC32C is being calculated with a hook or with the table-driven implementation.
+ *
+ * @retval  1 if a hook is used.
+ * @retval  0 otherwise.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+uint8_t is_hm10_crc32c_hw_accelerated();
+
+#endif /* HM10_CRC32C_H_ */
+
+/** @} */ // hm10_crc32c
+
+/** @} */ // hm10_ble
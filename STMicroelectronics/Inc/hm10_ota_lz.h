@@ -0,0 +1,167 @@
+/** @addtogroup hm10_ble
+ * @{
+ */
+
+/**@file
+ * @brief	HM-10 OTA LZ Compression Header file.
+ *
+ * @defgroup hm10_ota_lz HM-10 OTA LZ Compression
+ * @{
+ *
+ * @brief   This module provides an LZ-family compression codec with a small fixed window, which is meant to compress
+ *          the data before it is sent Over the Air (OTA) with the @ref send_hm10_ota_data function and to decompress it
+ *          after it is received with the @ref get_hm10_ota_data function.
+ *
+ * @details The codec only uses a statically allocated context of about @ref HM10_OTA_LZ_WINDOW_SIZE plus 2 times @ref
+ *          HM10_OTA_LZ_HASH_SIZE bytes per direction, so it can also be used from an MCU/MPU. Each compressed block
+ *          consists of a single Block Header byte followed by its body, where the Block Header is either @ref
+ *          HM10_OTA_LZ_STORED_BLOCK (i.e., the body holds the original data because it could not be compressed) or
+ *          @ref HM10_OTA_LZ_COMPRESSED_BLOCK. The body of a compressed block is a sequence of groups, each of which
+ *          starts with a Flags byte whose bits, from the least significant one, indicate whether each of the next 8
+ *          tokens is a literal byte (i.e., 0) or a match (i.e., 1). A match consists of 2 bytes: the distance minus 1
+ *          towards the previous occurrence of the data and the length of the match minus @ref HM10_OTA_LZ_MIN_MATCH.
+ * @details The codec can be used with either of the following modes:<br><br>
+ *          - @ref HM10_OTA_LZ_Per_Message : Each block is compressed independently, so each one can be decompressed
+ *            even if the previous ones were lost.<br>
+ *          - @ref HM10_OTA_LZ_Per_Stream : The window is kept from one block to the next, which compresses better, but
+ *            requires all the blocks to be decompressed in the same order in which they were compressed and without
+ *            losing any of them.<br><br>
+ * @details The mode to be used can be negotiated with the Remote BT Device by exchanging the byte returned by the @ref
+ *          get_hm10_ota_lz_capabilities function and by passing the received one into the @ref negotiate_hm10_ota_lz_mode
+ *          function.
+ *
+ * @author 	Cesar Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026.
+ */
+
+#ifndef HM10_OTA_LZ_H_
+#define HM10_OTA_LZ_H_
+
+#include <stdint.h> // This library contains the aliases: uint8_t, uint16_t, uint32_t, etc.
+#include "hm10_ble_driver.h" // Custom Mortrack's Library to be able to initialize, send configuration commands and send and/or receive data to/from an HM-10 Bluetooth Device.
+
+#define HM10_OTA_LZ_WINDOW_LOG2         (8U)                    /**< @brief Base 2 logarithm of @ref HM10_OTA_LZ_WINDOW_SIZE . @note This value must not be greater than 8 since the distance of each match is encoded into a single byte. */
+#define HM10_OTA_LZ_WINDOW_SIZE         (1 << HM10_OTA_LZ_WINDOW_LOG2)  /**< @brief Length in bytes of the window of the codec (i.e., the farthest distance at which a match can be found). */
+#define HM10_OTA_LZ_HASH_BITS           (8)                     /**< @brief Number of bits of the hash used to find the matches. */
+#define HM10_OTA_LZ_HASH_SIZE           (1 << HM10_OTA_LZ_HASH_BITS)  /**< @brief Number of entries of the hash table used to find the matches. */
+#define HM10_OTA_LZ_MIN_MATCH           (3)                     /**< @brief Shortest length in bytes of a match. */
+#define HM10_OTA_LZ_MAX_MATCH           (HM10_OTA_LZ_MIN_MATCH + 255)  /**< @brief Longest length in bytes of a match. */
+#define HM10_OTA_LZ_STORED_BLOCK        (0x00U)                 /**< @brief Block Header of a block whose body holds the original data. */
+#define HM10_OTA_LZ_COMPRESSED_BLOCK    (0x01U)                 /**< @brief Block Header of a block whose body holds compressed data. */
+#define HM10_OTA_LZ_HEADER_SIZE         (1)                     /**< @brief Length in bytes of the Block Header. */
+#define HM10_OTA_LZ_MAX_COMPRESSED_SIZE(size)   ((size) + HM10_OTA_LZ_HEADER_SIZE)  /**< @brief Largest length in bytes that a block can have after compressing \p size bytes with this codec. */
+
+#define HM10_OTA_LZ_CAPABILITY_PER_MESSAGE  (0x01U)             /**< @brief Bit of the Capabilities byte indicating that the @ref HM10_OTA_LZ_Per_Message mode is supported. */
+#define HM10_OTA_LZ_CAPABILITY_PER_STREAM   (0x02U)             /**< @brief Bit of the Capabilities byte indicating that the @ref HM10_OTA_LZ_Per_Stream mode is supported. */
+#define HM10_OTA_LZ_CAPABILITY_WINDOW_MASK  (0xF0U)             /**< @brief Bit mask of the base 2 logarithm of @ref HM10_OTA_LZ_WINDOW_SIZE in the Capabilities byte. */
+#define HM10_OTA_LZ_CAPABILITY_WINDOW_POS   (4U)                /**< @brief Bit position of the base 2 logarithm of @ref HM10_OTA_LZ_WINDOW_SIZE in the Capabilities byte. */
+
+/**@brief	HM-10 OTA LZ Compression Modes.
+ */
+typedef enum
+{
+    HM10_OTA_LZ_Disabled        = 0U,    //!< Data is not compressed.
+    HM10_OTA_LZ_Per_Message     = 1U,    //!< Each block is compressed independently from the others.
+    HM10_OTA_LZ_Per_Stream      = 2U     //!< The window of the codec is kept from one block to the next.
+} HM10_OTA_LZ_Mode;
+
+/**@brief	HM-10 OTA LZ Compression Context.
+ *
+ * @details A different context must be used for each direction (i.e., one to compress and one to decompress).
+ */
+typedef struct {
+    HM10_OTA_LZ_Mode mode;                          //!< Mode with which the context was initialized.
+    uint8_t window[HM10_OTA_LZ_WINDOW_SIZE];        //!< Last @ref HM10_OTA_LZ_WINDOW_SIZE bytes of original data that went through the context.
+    uint16_t hash_table[HM10_OTA_LZ_HASH_SIZE];     //!< Last position in the original data at which each hash was found (only used to compress).
+    uint16_t position;                              //!< Position in the original data (modulo 65536) of the next byte to go through the context.
+    uint16_t history_size;                          //!< Bytes of valid data in the window, up to @ref HM10_OTA_LZ_WINDOW_SIZE .
+} HM10_OTA_LZ_Context;
+
+/**@brief	Initializes an HM-10 OTA LZ Compression Context with a desired mode.
+ *
+ * @param[out] ctx  Pointer to the context that is desired to be initialized.
+ * @param mode      Mode with which the context will compress or decompress the data.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+void init_hm10_ota_lz_context(HM10_OTA_LZ_Context *ctx, HM10_OTA_LZ_Mode mode);
+
+/**@brief	Compresses a block of data.
+ *
+ * @details If the compressed body turns out to be at least as long as the original data, then a stored block is
+ *          populated instead. Therefore, the compressed block will never be longer than @ref
+ *          HM10_OTA_LZ_MAX_COMPRESSED_SIZE of \p src_size bytes.
+ *
+ * @param[in,out] ctx   Pointer to the context with which the data will be compressed.
+ * @param[in] src       Pointer to the data that is desired to be compressed.
+ * @param src_size      Length in bytes of the data towards which the \p src param points to.
+ * @param[out] dst      Pointer to the Memory Address into which the compressed block will be stored.
+ * @param dst_capacity  Length in bytes of the buffer towards which the \p dst param points to.
+ * @param[out] dst_size Pointer to the Memory Address into which the length in bytes of the compressed block will be
+ *                      stored.
+ *
+ * @retval	HM10_EC_OK	if the data was successfully compressed.
+ * @retval  HM10_EC_ERR if \p dst_capacity is lower than @ref HM10_OTA_LZ_MAX_COMPRESSED_SIZE of \p src_size bytes.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+HM10_Status compress_hm10_ota_data(HM10_OTA_LZ_Context *ctx, uint8_t *src, uint16_t src_size, uint8_t *dst, uint16_t dst_capacity, uint16_t *dst_size);
+
+/**@brief	Decompresses a block of data that was compressed with the @ref compress_hm10_ota_data function.
+ *
+ * @param[in,out] ctx   Pointer to the context with which the data will be decompressed.
+ * @param[in] src       Pointer to the compressed block.
+ * @param src_size      Length in bytes of the compressed block towards which the \p src param points to.
+ * @param[out] dst      Pointer to the Memory Address into which the decompressed data will be stored.
+ * @param dst_capacity  Length in bytes of the buffer towards which the \p dst param points to.
+ * @param[out] dst_size Pointer to the Memory Address into which the length in bytes of the decompressed data will be
+ *                      stored.
+ *
+ * @retval	HM10_EC_OK	if the block was successfully decompressed.
+ * @retval  HM10_EC_ERR if the block is malformed or if the decompressed data does not fit into the \p dst param. In
+ *                      this case and if the @ref HM10_OTA_LZ_Per_Stream mode is used, the context has to be initialized
+ *                      again on both sides.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+HM10_Status decompress_hm10_ota_data(HM10_OTA_LZ_Context *ctx, uint8_t *src, uint16_t src_size, uint8_t *dst, uint16_t dst_capacity, uint16_t *dst_size);
+
+/**@brief	Gets the Capabilities byte of this codec, which is meant to be sent to the Remote BT Device so that it can
+ *          negotiate the mode to be used with the @ref negotiate_hm10_ota_lz_mode function.
+ *
+ * @details The Capabilities byte has the following format:<br><br>
+ *          - Bit 0: @ref HM10_OTA_LZ_CAPABILITY_PER_MESSAGE .<br>
+ *          - Bit 1: @ref HM10_OTA_LZ_CAPABILITY_PER_STREAM .<br>
+ *          - Bits 2 and 3: Reserved. These are always set to 0.<br>
+ *          - Bits 4 to 7: Base 2 logarithm of @ref HM10_OTA_LZ_WINDOW_SIZE .<br>
+ *
+ * @return  The Capabilities byte of this codec.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+uint8_t get_hm10_ota_lz_capabilities();
+
+/**@brief	Negotiates the mode to be used with the Remote BT Device from the Capabilities byte that it sent.
+ *
+ * @details The @ref HM10_OTA_LZ_Per_Stream mode is preferred over the @ref HM10_OTA_LZ_Per_Message one whenever both
+ *          sides support it. However, the compression is disabled if both sides do not use the same window size.
+ *
+ * @param remote_capabilities   Capabilities byte received from the Remote BT Device.
+ * @param desired_mode          Highest mode that the application is willing to use.
+ *
+ * @return  The mode that both sides will use.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+HM10_OTA_LZ_Mode negotiate_hm10_ota_lz_mode(uint8_t remote_capabilities, HM10_OTA_LZ_Mode desired_mode);
+
+#endif /* HM10_OTA_LZ_H_ */
+
+/** @} */ // hm10_ota_lz
+
+/** @} */ // hm10_ble
@@ -0,0 +1,87 @@
+/** @addtogroup hm10_ble
+ * @{
+ */
+
+/**@file
+ * @brief	HM-10 OTA Ping Service Header file.
+ *
+ * @defgroup hm10_ota_ping HM-10 OTA Ping Service
+ * @{
+ *
+ * @brief   This module provides the responder of the ping/echo service with which the PC (i.e., the gateway) measures
+ *          the Round Trip Time (RTT) of the Bluetooth Connection and synchronizes the clock of this MCU/MPU against its
+ *          own clock, so that the timestamps taken with @ref get_hm10_ota_ping_time (e.g., of the samples of a sensor)
+ *          can be converted into the clock of the gateway.
+ *
+ * @details The responder answers each PING frame with a PONG frame that carries the times at which the PING frame was
+ *          received and at which the PONG frame was sent, in microseconds of the clock of this module. Both frames
+ *          are received and sent with the @ref get_hm10_ota_data and @ref send_hm10_ota_data functions, so that the
+ *          measurements include the same path that the application experiences. The frames have the following
+ *          formats, where all the multi-byte fields are in little endian:<br><br>
+ *          - PING frame: Type (1 byte), Sequence Number (1 byte) and zero padding (16 bytes), so that it has the same
+ *            length as the PONG frame and both directions therefore take the same time through the line.<br>
+ *          - PONG frame: Type (1 byte), the Sequence Number of the PING frame (1 byte), the time at which the PING
+ *            frame was received (8 bytes) and the time at which the PONG frame was sent (8 bytes).<br><br>
+ * @details By default, the clock of this module is the SysTick of the HAL (i.e., \c HAL_GetTick() ), which only has a
+ *          resolution of 1 millisecond. For a finer synchronization, the application can provide a clock with a
+ *          resolution of 1 microsecond (e.g., from the DWT cycle counter or from a free-running timer) through the @ref
+ *          set_hm10_ota_ping_clock function.
+ *
+ * @author 	Cesar Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026.
+ */
+
+#ifndef HM10_OTA_PING_H_
+#define HM10_OTA_PING_H_
+
+#include <stdint.h> // This library contains the aliases: uint8_t, uint16_t, uint32_t, etc.
+#include "hm10_ble_driver.h" // This custom Mortrack's library contains the HM-10 BT Driver Library.
+
+#define HM10_OTA_PING_TYPE_PING         (0xE1U)     /**< @brief Type of the PING frames. */
+#define HM10_OTA_PING_TYPE_PONG         (0xE2U)     /**< @brief Type of the PONG frames. */
+#define HM10_OTA_PING_PING_SIZE         (18)        /**< @brief Length in bytes of a PING frame, which is padded to the length of the PONG frame. */
+#define HM10_OTA_PING_PONG_SIZE         (18)        /**< @brief Length in bytes of a PONG frame. */
+
+/**@brief	Clock with which the times of the PONG frames are taken.
+ *
+ * @return  The current time in microseconds of a monotonic clock.
+ */
+typedef uint64_t (*HM10_OTA_Ping_Clock)(void);
+
+/**@brief	Sets the clock with which the times of the PONG frames are taken.
+ *
+ * @param clock Pointer to the clock, or \c NULL to use the SysTick of the HAL again.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+void set_hm10_ota_ping_clock(HM10_OTA_Ping_Clock clock);
+
+/**@brief	Gets the current time of the clock of the HM-10 OTA Ping Service.
+ *
+ * @return  The current time in microseconds.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+uint64_t get_hm10_ota_ping_time();
+
+/**@brief	Waits for a PING frame Over the Air (OTA) and responds to it with its PONG frame.
+ *
+ * @param timeout   Timeout duration for waiting to receive the PING frame and to send the PONG frame.
+ *
+ * @retval	HM10_EC_OK	if a PING frame was received and responded.
+ * @retval  HM10_EC_NA  if something other than a PING frame was received, which is discarded.
+ * @retval  HM10_EC_NR  if nothing was received within the \p timeout param.
+ * @retval  HM10_EC_ERR if the PONG frame could not be sent.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+HM10_Status respond_hm10_ota_ping(uint32_t timeout);
+
+#endif /* HM10_OTA_PING_H_ */
+
+/** @} */ // hm10_ota_ping
+
+/** @} */ // hm10_ble
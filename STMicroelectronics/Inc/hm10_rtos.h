@@ -0,0 +1,184 @@
+/** @addtogroup hm10_ble
+ * @{
+ */
+
+/**@file
+ * @brief	HM-10 FreeRTOS Binding Header file.
+ *
+ * @defgroup hm10_rtos HM-10 FreeRTOS Binding
+ * @{
+ *
+ * @brief   This module binds the @ref hm10_ble to FreeRTOS, so that the tasks that wait for the HM-10 BT Device block
+ *          on FreeRTOS primitives instead of spinning, and so that the rest of the tasks run at full speed while the
+ *          Bluetooth link is busy.
+ *
+ * @details The binding is built on top of the circular DMA reception (see @ref HM10_UART_RX_DMA ) and of the port of
+ *          the @ref hm10_ble (see @ref set_hm10_port ). The @ref init_hm10_rtos function installs a port whose clock is
+ *          the FreeRTOS tick count and whose wait blocks the calling task on a binary semaphore, which is given from
+ *          the @ref handle_hm10_rtos_uart_rx_event and @ref handle_hm10_rtos_uart_tx_complete functions. Those two
+ *          functions must be called from the HAL_UARTEx_RxEventCallback() and HAL_UART_TxCpltCallback() functions of
+ *          your application instead of the ones of the @ref hm10_ble , as well as the @ref handle_hm10_rtos_uart_error
+ *          function from its HAL_UART_ErrorCallback() function if @ref HM10_UART_ERROR_RECOVERY is enabled.
+ * @details If @ref HM10_RTOS_DRIVER_TASK is enabled, a dedicated driver task owns the reception: it forwards all the
+ *          data received from the HM-10 BT Device into a stream buffer of @ref HM10_RTOS_STREAM_SIZE bytes, from which
+ *          the application tasks read it with the @ref get_hm10_rtos_ota_data function, and it notifies the task given
+ *          to the @ref set_hm10_rtos_event_task function whenever the HM-10 BT Device reports a link event (i.e., the
+ *          OK+CONN and OK+LOST notifications that it sends when its Notify Information Mode is enabled). While that
+ *          task is running, the AT Commands must be sent between the @ref take_hm10_rtos and @ref give_hm10_rtos
+ *          functions so that their responses are not forwarded into the stream buffer.
+ *
+ * @code
+  #include "hm10_rtos.h"
+
+  void HAL_UARTEx_RxEventCallback(UART_HandleTypeDef *huart, uint16_t Size) { handle_hm10_rtos_uart_rx_event(huart, Size); }
+  void HAL_UART_TxCpltCallback(UART_HandleTypeDef *huart) { handle_hm10_rtos_uart_tx_complete(huart); }
+  void HAL_UART_ErrorCallback(UART_HandleTypeDef *huart) { handle_hm10_rtos_uart_error(huart); }
+
+  void app_task(void *argument)
+  {
+      init_hm10_rtos(&huart3);
+      set_hm10_rtos_event_task(xTaskGetCurrentTaskHandle());
+      for (;;)
+      {
+          uint8_t packet[HM10_MAX_PACKET_SIZE];
+          if (get_hm10_rtos_ota_data(packet, sizeof(packet), 1000) == HM10_EC_OK) { ... }
+          uint32_t events;
+          if (xTaskNotifyWait(0, HM10_RTOS_EVENT_LOST, &events, 0) == pdTRUE) { ... }
+      }
+  }
+ * @endcode
+ *
+ * @note    This module uses the native FreeRTOS API, which is also available in the projects that are generated with
+ *          the CMSIS-RTOS2 interface since that interface is implemented on top of FreeRTOS.
+ *
+ * @author 	Cesar Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026.
+ */
+
+#ifndef HM10_RTOS_H_
+#define HM10_RTOS_H_
+
+#include <stdint.h> // This library contains the aliases: uint8_t, uint16_t, uint32_t, etc.
+#include "hm10_ble_driver.h" // This custom Mortrack's library contains the HM-10 BT Driver Library.
+
+#if HM10_RTOS
+#include "FreeRTOS.h" // FreeRTOS Kernel configuration and types.
+#include "task.h" // FreeRTOS Library from which the tasks and the task notifications are located at.
+
+#define HM10_RTOS_EVENT_CONN            (1UL << 0)  /**< @brief Task notification bit that signals that the HM-10 BT Device has established a Bluetooth Connection (i.e., OK+CONN). */
+#define HM10_RTOS_EVENT_LOST            (1UL << 1)  /**< @brief Task notification bit that signals that the HM-10 BT Device has lost its Bluetooth Connection (i.e., OK+LOST). */
+
+/**@brief	Initializes the @ref hm10_ble with the UART of the HM-10 BT Device and binds it to FreeRTOS.
+ *
+ * @details This function calls the @ref init_hm10_module function, installs the FreeRTOS port of this module through
+ *          the @ref set_hm10_port function and, if @ref HM10_RTOS_DRIVER_TASK is enabled, creates the stream buffer
+ *          and the driver task.
+ *
+ * @param[in] huart	Pointer to the UART Handle Structure of the UART that it is desired to use to send/receive data
+ *                  to/from the HM-10 BT Device.
+ *
+ * @retval	HM10_EC_OK	if the binding was initialized.
+ * @retval  HM10_EC_ERR if FreeRTOS could not allocate any of the objects of this module.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+HM10_Status init_hm10_rtos(UART_HandleTypeDef *huart);
+
+/**@brief	Accounts for the data received by the DMA and wakes up the task that is waiting for it.
+ *
+ * @note    This function must be called from the HAL_UARTEx_RxEventCallback() function of your application.
+ *
+ * @param[in] huart	Pointer to the UART Handle Structure of the UART that generated the event.
+ * @param size      Position in the circular buffer up to which the DMA has written, as given by the HAL.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+void handle_hm10_rtos_uart_rx_event(UART_HandleTypeDef *huart, uint16_t size);
+
+/**@brief	Releases the data sent by the UART and wakes up the task that is waiting for free space to send more.
+ *
+ * @note    This function must be called from the HAL_UART_TxCpltCallback() function of your application.
+ *
+ * @param[in] huart	Pointer to the UART Handle Structure of the UART that has finished sending.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+void handle_hm10_rtos_uart_tx_complete(UART_HandleTypeDef *huart);
+
+/**@brief	Recovers the circular DMA reception after the HAL has aborted it and wakes up the task that is waiting for
+ *          it, whenever @ref HM10_UART_ERROR_RECOVERY is enabled (see @ref handle_hm10_uart_error ).
+ *
+ * @note    This function must be called from the HAL_UART_ErrorCallback() function of your application.
+ *
+ * @param[in] huart	Pointer to the UART Handle Structure of the UART that reported the error.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+void handle_hm10_rtos_uart_error(UART_HandleTypeDef *huart);
+
+/**@brief	Takes the exclusive use of the @ref hm10_ble , which pauses the forwarding of the received data by the driver
+ *          task so that an AT Command can be sent and its response received.
+ *
+ * @param timeout   Time in milliseconds to wait for the @ref hm10_ble to become available.
+ *
+ * @retval	HM10_EC_OK	if the exclusive use was taken.
+ * @retval  HM10_EC_NR  if the @ref hm10_ble did not become available within the \p timeout param.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+HM10_Status take_hm10_rtos(uint32_t timeout);
+
+/**@brief	Gives back the exclusive use of the @ref hm10_ble that was taken with the @ref take_hm10_rtos function.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+void give_hm10_rtos();
+
+#if HM10_RTOS_DRIVER_TASK
+/**@brief	Receives the BT data that the driver task has forwarded into the stream buffer, blocking the calling task
+ *          until all of it has arrived.
+ *
+ * @param[out] ble_ota_data Pointer to the Memory Address into which the received BT data will be stored.
+ * @param size              Length in bytes of the BT data that is expected to be received.
+ * @param timeout           Time in milliseconds to wait for all the expected BT data.
+ *
+ * @retval	HM10_EC_OK	if all the expected BT data was received.
+ * @retval  HM10_EC_NR  if not all the expected BT data was received within the \p timeout param, in which case the
+ *                      part that did arrive is discarded.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+HM10_Status get_hm10_rtos_ota_data(uint8_t *ble_ota_data, uint16_t size, uint32_t timeout);
+
+/**@brief	Sets the task that the driver task notifies, with the @ref HM10_RTOS_EVENT_CONN and @ref
+ *          HM10_RTOS_EVENT_LOST bits, whenever the HM-10 BT Device reports a link event.
+ *
+ * @param task  Handle of the task to be notified, or \c NULL to not notify any.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+void set_hm10_rtos_event_task(TaskHandle_t task);
+
+/**@brief	Gets the number of received bytes that the driver task had to discard because the stream buffer was full.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+uint32_t get_hm10_rtos_dropped_bytes();
+#endif
+
+#endif /* HM10_RTOS */
+
+#endif /* HM10_RTOS_H_ */
+
+/** @} */ // hm10_rtos
+
+/** @} */ // hm10_ble
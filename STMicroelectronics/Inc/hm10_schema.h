@@ -0,0 +1,163 @@
+/** @addtogroup hm10_ble
+ * @{
+ */
+
+/**@file
+ * @brief	HM-10 Schema Codec Header file.
+ *
+ * @defgroup hm10_schema HM-10 Schema Codec
+ * @{
+ *
+ * @brief   This module generates, at compile time, the encode and decode functions of a message from a single
+ *          description of its fields (i.e., its schema), so that the same message can be packed and unpacked by both
+ *          the PC and the MCU/MPU without writing the packing code by hand on each side.
+ *
+ * @details A schema is an X-macro that lists the fields of the message in the order in which they are sent, where each
+ *          field is either a scalar (i.e., @c FIELD(tag, name) ) or an array with a fixed number of elements (i.e., @c
+ *          ARRAY(tag, name, count) ), and where the tag is one of @c u8 , @c i8 , @c u16 , @c i16 , @c u32 , @c i32 or
+ *          @c f32 . The @ref HM10_SCHEMA_DEFINE macro then generates from that schema the struct of the message, an
+ *          @c encode_ function and a @c decode_ function, all of which are inlined and use neither the heap nor any
+ *          function pointers.
+ * @details Each field is encoded in little endian and without any padding between the fields, so the length in bytes
+ *          of any encoded message is always the constant @ref HM10_SCHEMA_WIRE_SIZE , regardless of the alignment
+ *          rules or of the endianness of the compiler. This allows to validate at compile time, with the @ref
+ *          HM10_SCHEMA_ASSERT_FITS macro, that a message fits exactly into a single packet of @ref HM10_MAX_PACKET_SIZE
+ *          bytes. The same wire format is generated by the C++ front-end of this module (see hm10_schema.hpp).
+ *
+ * @code
+  #include "hm10_schema.h"
+
+  #define TELEMETRY_SCHEMA(FIELD, ARRAY) \
+      FIELD(u32, timestamp_ms)           \
+      FIELD(i16, temperature_cdeg)       \
+      ARRAY(u16, adc, 4)                 \
+      FIELD(f32, battery_v)              \
+      FIELD(u8, flags)
+
+  HM10_SCHEMA_DEFINE(Telemetry_Msg, telemetry_msg, TELEMETRY_SCHEMA)
+  HM10_SCHEMA_ASSERT_FITS(Telemetry_Msg, TELEMETRY_SCHEMA, HM10_MAX_PACKET_SIZE); // 4 + 2 + 8 + 4 + 1 = 19 bytes.
+
+  Telemetry_Msg msg = {...};
+  uint8_t packet[HM10_SCHEMA_WIRE_SIZE(TELEMETRY_SCHEMA)];
+  send_hm10_ota_data(packet, encode_telemetry_msg(&msg, packet));
+ * @endcode
+ *
+ * @author 	Cesar Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026.
+ */
+
+#ifndef HM10_SCHEMA_H_
+#define HM10_SCHEMA_H_
+
+#include <stdint.h> // This library contains the aliases: uint8_t, uint16_t, uint32_t, etc.
+#include <string.h>	// Library from which "memset()" and "memcpy()" are located at.
+#include "hm10_ble_driver.h" // Custom Mortrack's Library to be able to initialize, send configuration commands and send and/or receive data to/from an HM-10 Bluetooth Device.
+
+#define HM10_SCHEMA_TYPE_u8     uint8_t     /**< @brief C type of the fields with the @c u8 tag. */
+#define HM10_SCHEMA_TYPE_i8     int8_t      /**< @brief C type of the fields with the @c i8 tag. */
+#define HM10_SCHEMA_TYPE_u16    uint16_t    /**< @brief C type of the fields with the @c u16 tag. */
+#define HM10_SCHEMA_TYPE_i16    int16_t     /**< @brief C type of the fields with the @c i16 tag. */
+#define HM10_SCHEMA_TYPE_u32    uint32_t    /**< @brief C type of the fields with the @c u32 tag. */
+#define HM10_SCHEMA_TYPE_i32    int32_t     /**< @brief C type of the fields with the @c i32 tag. */
+#define HM10_SCHEMA_TYPE_f32    float       /**< @brief C type of the fields with the @c f32 tag. */
+
+#define HM10_SCHEMA_SIZE_u8     (1)         /**< @brief Length in bytes of an encoded field with the @c u8 tag. */
+#define HM10_SCHEMA_SIZE_i8     (1)         /**< @brief Length in bytes of an encoded field with the @c i8 tag. */
+#define HM10_SCHEMA_SIZE_u16    (2)         /**< @brief Length in bytes of an encoded field with the @c u16 tag. */
+#define HM10_SCHEMA_SIZE_i16    (2)         /**< @brief Length in bytes of an encoded field with the @c i16 tag. */
+#define HM10_SCHEMA_SIZE_u32    (4)         /**< @brief Length in bytes of an encoded field with the @c u32 tag. */
+#define HM10_SCHEMA_SIZE_i32    (4)         /**< @brief Length in bytes of an encoded field with the @c i32 tag. */
+#define HM10_SCHEMA_SIZE_f32    (4)         /**< @brief Length in bytes of an encoded field with the @c f32 tag. */
+
+/**@name	Encoders of each tag, which write a value in little endian and return the position that follows it.
+ * @{
+ */
+static inline uint8_t *put_hm10_schema_u8(uint8_t *p, uint8_t v) { p[0] = v; return p + 1; }
+static inline uint8_t *put_hm10_schema_i8(uint8_t *p, int8_t v) { p[0] = (uint8_t) v; return p + 1; }
+static inline uint8_t *put_hm10_schema_u16(uint8_t *p, uint16_t v) { p[0] = (uint8_t) v; p[1] = (uint8_t) (v >> 8); return p + 2; }
+static inline uint8_t *put_hm10_schema_i16(uint8_t *p, int16_t v) { return put_hm10_schema_u16(p, (uint16_t) v); }
+static inline uint8_t *put_hm10_schema_u32(uint8_t *p, uint32_t v) { p[0] = (uint8_t) v; p[1] = (uint8_t) (v >> 8); p[2] = (uint8_t) (v >> 16); p[3] = (uint8_t) (v >> 24); return p + 4; }
+static inline uint8_t *put_hm10_schema_i32(uint8_t *p, int32_t v) { return put_hm10_schema_u32(p, (uint32_t) v); }
+static inline uint8_t *put_hm10_schema_f32(uint8_t *p, float v) { uint32_t u; memcpy(&u, &v, sizeof(u)); return put_hm10_schema_u32(p, u); }
+/** @} */
+
+/**@name	Decoders of each tag, which read a value in little endian and return the position that follows it.
+ * @{
+ */
+static inline uint8_t *get_hm10_schema_u8(uint8_t *p, uint8_t *v) { *v = p[0]; return p + 1; }
+static inline uint8_t *get_hm10_schema_i8(uint8_t *p, int8_t *v) { *v = (int8_t) p[0]; return p + 1; }
+static inline uint8_t *get_hm10_schema_u16(uint8_t *p, uint16_t *v) { *v = (uint16_t) (p[0] | ((uint16_t) p[1] << 8)); return p + 2; }
+static inline uint8_t *get_hm10_schema_i16(uint8_t *p, int16_t *v) { uint16_t u; p = get_hm10_schema_u16(p, &u); *v = (int16_t) u; return p; }
+static inline uint8_t *get_hm10_schema_u32(uint8_t *p, uint32_t *v) { *v = p[0] | ((uint32_t) p[1] << 8) | ((uint32_t) p[2] << 16) | ((uint32_t) p[3] << 24); return p + 4; }
+static inline uint8_t *get_hm10_schema_i32(uint8_t *p, int32_t *v) { uint32_t u; p = get_hm10_schema_u32(p, &u); *v = (int32_t) u; return p; }
+static inline uint8_t *get_hm10_schema_f32(uint8_t *p, float *v) { uint32_t u; p = get_hm10_schema_u32(p, &u); memcpy(v, &u, sizeof(u)); return p; }
+/** @} */
+
+/**@name	Expansions of the fields of a schema into each of the parts of the code that are generated from it.
+ * @{
+ */
+#define HM10_SCHEMA_MEMBER(tag, name)                   HM10_SCHEMA_TYPE_##tag name;
+#define HM10_SCHEMA_ARRAY_MEMBER(tag, name, count)      HM10_SCHEMA_TYPE_##tag name[count];
+#define HM10_SCHEMA_FIELD_SIZE(tag, name)               + HM10_SCHEMA_SIZE_##tag
+#define HM10_SCHEMA_ARRAY_SIZE(tag, name, count)        + HM10_SCHEMA_SIZE_##tag*(count)
+#define HM10_SCHEMA_ENCODE(tag, name)                   p = put_hm10_schema_##tag(p, msg->name);
+#define HM10_SCHEMA_ARRAY_ENCODE(tag, name, count)      for (uint16_t i=0; i<(count); i++) { p = put_hm10_schema_##tag(p, msg->name[i]); }
+#define HM10_SCHEMA_DECODE(tag, name)                   p = get_hm10_schema_##tag(p, &msg->name);
+#define HM10_SCHEMA_ARRAY_DECODE(tag, name, count)      for (uint16_t i=0; i<(count); i++) { p = get_hm10_schema_##tag(p, &msg->name[i]); }
+/** @} */
+
+/**@brief	Length in bytes of any encoded message of a schema, as a constant expression.
+ *
+ * @param SCHEMA    X-macro of the schema.
+ */
+#define HM10_SCHEMA_WIRE_SIZE(SCHEMA)       (0 SCHEMA(HM10_SCHEMA_FIELD_SIZE, HM10_SCHEMA_ARRAY_SIZE))
+
+/**@brief	Fails the compilation if the encoded messages of a schema are longer than a certain length in bytes.
+ *
+ * @param type      Name of the struct of the message.
+ * @param SCHEMA    X-macro of the schema.
+ * @param max_size  Largest length in bytes that the encoded messages can have (e.g., @ref HM10_MAX_PACKET_SIZE ).
+ */
+#define HM10_SCHEMA_ASSERT_FITS(type, SCHEMA, max_size) \
+    typedef char type##_fits_check[(HM10_SCHEMA_WIRE_SIZE(SCHEMA) <= (max_size)) ? 1 : -1]
+
+/**@brief	Generates the struct of the messages of a schema along with their encode and decode functions.
+ *
+ * @details The generated functions have the following prototypes:<br><br>
+ *          - <tt>uint16_t encode_<suffix>(type *msg, uint8_t *data)</tt>, which encodes the \p msg param into the
+ *            buffer of the \p data param, which must hold at least @ref HM10_SCHEMA_WIRE_SIZE bytes, and returns the
+ *            length in bytes of the encoded message.<br>
+ *          - <tt>HM10_Status decode_<suffix>(type *msg, uint8_t *data, uint16_t size)</tt>, which decodes the \p msg
+ *            param from the \p size bytes of the \p data param and returns @ref HM10_EC_OK or, if \p size is lower than
+ *            @ref HM10_SCHEMA_WIRE_SIZE bytes, @ref HM10_EC_ERR .<br><br>
+ *
+ * @param type      Name of the struct of the message that is desired to be generated.
+ * @param suffix    Suffix of the names of the encode and decode functions that are desired to be generated.
+ * @param SCHEMA    X-macro of the schema.
+ */
+#define HM10_SCHEMA_DEFINE(type, suffix, SCHEMA)                                        \
+    typedef struct {                                                                    \
+        SCHEMA(HM10_SCHEMA_MEMBER, HM10_SCHEMA_ARRAY_MEMBER)                            \
+    } type;                                                                             \
+    static inline uint16_t encode_##suffix(type *msg, uint8_t *data)                    \
+    {                                                                                   \
+        uint8_t *p = data;                                                              \
+        SCHEMA(HM10_SCHEMA_ENCODE, HM10_SCHEMA_ARRAY_ENCODE)                            \
+        return (uint16_t) (p - data);                                                   \
+    }                                                                                   \
+    static inline HM10_Status decode_##suffix(type *msg, uint8_t *data, uint16_t size)  \
+    {                                                                                   \
+        uint8_t *p = data;                                                              \
+        if (size < HM10_SCHEMA_WIRE_SIZE(SCHEMA))                                       \
+        {                                                                               \
+            return HM10_EC_ERR;                                                         \
+        }                                                                               \
+        SCHEMA(HM10_SCHEMA_DECODE, HM10_SCHEMA_ARRAY_DECODE)                            \
+        return HM10_EC_OK;                                                              \
+    }
+
+#endif /* HM10_SCHEMA_H_ */
+
+/** @} */ // hm10_schema
+
+/** @} */ // hm10_ble
@@ -0,0 +1,208 @@
+/** @addtogroup hm10_schema
+ * @{
+ */
+
+/**@file
+ * @brief	HM-10 Schema Codec C++ Header file.
+ *
+ * @details This is the C++17 front-end of the @ref hm10_schema , in which the schema of a message is the list of
+ *          pointers to the members of an existing struct, so that the encode and decode functions are generated by the
+ *          compiler from templates instead of from X-macros. Each member can be of any integral or enumeration type,
+ *          a \c float or a fixed-size array of those, and it is encoded in little endian and without any padding, which
+ *          is the same wire format as the one of the C macros of the @ref hm10_schema . The generated functions are
+ *          static and inlined, and they use neither the heap nor any virtual dispatch.
+ *
+ * @code
+  #include "hm10_schema.hpp"
+
+  struct Telemetry {
+      uint32_t timestamp_ms;
+      int16_t temperature_cdeg;
+      uint16_t adc[4];
+      float battery_v;
+      uint8_t flags;
+  };
+  using Telemetry_Schema = hm10::Schema<&Telemetry::timestamp_ms, &Telemetry::temperature_cdeg, &Telemetry::adc,
+                                        &Telemetry::battery_v, &Telemetry::flags>;
+  static_assert(Telemetry_Schema::fits_in_packet, "The telemetry does not fit into a single HM-10 packet.");
+
+  uint8_t packet[Telemetry_Schema::wire_size];
+  send_hm10_ota_data(packet, Telemetry_Schema::encode(telemetry, packet));
+ * @endcode
+ *
+ * @author 	Cesar Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026.
+ */
+
+#ifndef HM10_SCHEMA_HPP_
+#define HM10_SCHEMA_HPP_
+
+#include <cstddef> // This library contains the std::size_t alias.
+#include <cstdint> // This library contains the aliases: uint8_t, uint16_t, uint32_t, etc.
+#include <cstring> // Library from which "std::memcpy()" is located at.
+#include <type_traits> // Library from which the type traits used to select the encoding of each member are located at.
+#include <utility> // Library from which "std::index_sequence" is located at.
+extern "C" {
+#include "hm10_ble_driver.h" // Custom Mortrack's Library to be able to initialize, send configuration commands and send and/or receive data to/from an HM-10 Bluetooth Device.
+}
+
+namespace hm10 {
+
+/**@brief	Unsigned integer type with which an integral or enumeration type is encoded.
+ */
+template <typename T, bool = std::is_enum_v<T>>
+struct Unsigned {
+    using type = std::make_unsigned_t<T>;
+};
+
+template <typename T>
+struct Unsigned<T, true> {
+    using type = std::make_unsigned_t<std::underlying_type_t<T>>;
+};
+
+template <>
+struct Unsigned<bool, false> {
+    using type = uint8_t;
+};
+
+/**@brief	Wire encoding of a type, which is specialized for the integral and enumeration types, for \c float and for
+ *          fixed-size arrays.
+ *
+ * @details Each specialization provides the length in bytes of an encoded value (i.e., \c size ), a \c put function
+ *          that encodes a value and returns the position that follows it, and a \c get function that decodes a value
+ *          and returns the position that follows it.
+ */
+template <typename T, typename Enable = void>
+struct Wire;
+
+template <typename T>
+struct Wire<T, std::enable_if_t<std::is_integral_v<T> || std::is_enum_v<T>>> {
+    using U = typename Unsigned<T>::type;
+    static constexpr std::size_t size = sizeof(T);
+
+    static uint8_t *put(uint8_t *p, T v)
+    {
+        put_bytes(p, static_cast<U>(v), std::make_index_sequence<size>{});
+        return p + size;
+    }
+
+    static uint8_t *get(uint8_t *p, T &v)
+    {
+        v = static_cast<T>(get_bytes(p, std::make_index_sequence<size>{}));
+        return p + size;
+    }
+
+    /* The bytes are unrolled at compile time, since the compilers do not always unroll a loop with a variable shift
+       and the loop then dominates the time of the whole message. */
+    template <std::size_t... I>
+    static void put_bytes(uint8_t *p, U u, std::index_sequence<I...>)
+    {
+        ((p[I] = static_cast<uint8_t>(u >> (8*I))), ...);
+    }
+
+    template <std::size_t... I>
+    static U get_bytes(uint8_t *p, std::index_sequence<I...>)
+    {
+        return static_cast<U>((static_cast<U>(static_cast<U>(p[I]) << (8*I)) | ...));
+    }
+};
+
+template <>
+struct Wire<float> {
+    static_assert(sizeof(float) == sizeof(uint32_t), "The float type is expected to have 32 bits.");
+    static constexpr std::size_t size = sizeof(uint32_t);
+
+    static uint8_t *put(uint8_t *p, float v)
+    {
+        uint32_t u;
+        std::memcpy(&u, &v, sizeof(u));
+        return Wire<uint32_t>::put(p, u);
+    }
+
+    static uint8_t *get(uint8_t *p, float &v)
+    {
+        uint32_t u;
+        p = Wire<uint32_t>::get(p, u);
+        std::memcpy(&v, &u, sizeof(u));
+        return p;
+    }
+};
+
+template <typename T, std::size_t N>
+struct Wire<T[N]> {
+    static constexpr std::size_t size = N*Wire<T>::size;
+
+    static uint8_t *put(uint8_t *p, const T (&v)[N])
+    {
+        for (std::size_t i=0; i<N; i++)
+        {
+            p = Wire<T>::put(p, v[i]);
+        }
+        return p;
+    }
+
+    static uint8_t *get(uint8_t *p, T (&v)[N])
+    {
+        for (std::size_t i=0; i<N; i++)
+        {
+            p = Wire<T>::get(p, v[i]);
+        }
+        return p;
+    }
+};
+
+/**@brief	Splits a pointer to a member into the type of its struct and the type of the member.
+ */
+template <typename T>
+struct Member;
+
+template <typename C, typename F>
+struct Member<F C::*> {
+    using Message = C;
+    using Field = F;
+};
+
+/**@brief	Schema of a message, whose fields are the members of a struct that are pointed to by the \p Members
+ *          params, in the order in which they are sent.
+ */
+template <auto First, auto... Members>
+struct Schema {
+    using Message = typename Member<decltype(First)>::Message;   //!< Type of the struct of the message.
+    static_assert((std::is_same_v<Message, typename Member<decltype(Members)>::Message> && ...), "All the members of a schema must belong to the same struct.");
+
+    static constexpr std::size_t wire_size = (Wire<typename Member<decltype(First)>::Field>::size + ... + Wire<typename Member<decltype(Members)>::Field>::size);  //!< Length in bytes of any encoded message.
+    static constexpr bool fits_in_packet = (wire_size <= HM10_MAX_PACKET_SIZE);  //!< Whether an encoded message fits into a single HM-10 packet.
+
+    /**@brief	Encodes a message into a buffer of at least @ref wire_size bytes.
+     *
+     * @return  The length in bytes of the encoded message.
+     */
+    static uint16_t encode(const Message &msg, uint8_t *data)
+    {
+        uint8_t *p = Wire<typename Member<decltype(First)>::Field>::put(data, msg.*First);
+        ((p = Wire<typename Member<decltype(Members)>::Field>::put(p, msg.*Members)), ...);
+        return static_cast<uint16_t>(p - data);
+    }
+
+    /**@brief	Decodes a message from a buffer.
+     *
+     * @retval	HM10_EC_OK	if the message was decoded.
+     * @retval  HM10_EC_ERR if the \p size param is lower than @ref wire_size bytes.
+     */
+    static HM10_Status decode(Message &msg, uint8_t *data, std::size_t size)
+    {
+        if (size < wire_size)
+        {
+            return HM10_EC_ERR;
+        }
+        uint8_t *p = Wire<typename Member<decltype(First)>::Field>::get(data, msg.*First);
+        ((p = Wire<typename Member<decltype(Members)>::Field>::get(p, msg.*Members)), ...);
+        return HM10_EC_OK;
+    }
+};
+
+} // namespace hm10
+
+#endif /* HM10_SCHEMA_HPP_ */
+
+/** @} */ // hm10_schema
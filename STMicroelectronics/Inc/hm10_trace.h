@@ -0,0 +1,136 @@
+/** @addtogroup hm10_ble
+ * @{
+ */
+
+/**@file
+ * @brief	HM-10 Trace Points Header file.
+ *
+ * @defgroup hm10_trace HM-10 Trace Points
+ * @{
+ *
+ * @brief   This module records, with the resolution of the DWT Cycle Counter of the Cortex-M core, the moments at
+ *          which the @ref hm10_ble goes through each phase of a Command or of an exchange of data Over the Air (OTA),
+ *          so that the time that each of those phases takes can be told apart (e.g., the UART transmission, the wait
+ *          for the HM-10 BT Device to respond, the reception of its Response and the parsing of it).
+ *
+ * @details The trace points are placed in the hot path of the @ref hm10_ble with the @ref HM10_TRACE_POINT macro,
+ *          which compiles into nothing unless @ref HM10_TRACE is enabled. Each trace point writes a record into a
+ *          fixed-size ring of @ref HM10_TRACE_RING_SIZE records that is lock-free (i.e., it never disables the
+ *          interrupts), so that trace points can also be placed in the UART callbacks. Once the ring is full, the
+ *          newest records overwrite the oldest ones that have not been read yet.
+ * @details The records are read with the @ref read_hm10_trace function, or they are printed with the @ref
+ *          print_hm10_trace function in the text format that is turned into a per-phase latency breakdown by the
+ *          <a href=https://github.com/Mortrack/hm10_ble_driver/blob/main/PC/Tools/hm10_trace_report.c>hm10_trace_report</a>
+ *          tool of the PC library.
+ *
+ * @note    The ring is claimed with the atomic read-modify-write instructions of the Cortex-M3 and higher cores (i.e.,
+ *          \c LDREX and \c STREX ), which the Cortex-M0 and Cortex-M0+ cores do not have.
+ *
+ * @author 	Cesar Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026.
+ */
+
+#ifndef HM10_TRACE_H_
+#define HM10_TRACE_H_
+
+#include <stdint.h> // This library contains the aliases: uint8_t, uint16_t, uint32_t, etc.
+#include "hm10_ble_driver.h" // This custom Mortrack's library contains the HM-10 BT Driver Library.
+
+/**@brief	Trace point definitions.
+ *
+ * @details The trace points are listed in the order in which they happen during a Command, where the time between
+ *          two consecutive ones is the duration of a phase of that Command.
+ */
+typedef enum
+{
+    HM10_Trace_Send_Start           = 0U,   //!< The @ref hm10_ble starts to send some data to the HM-10 BT Device. Its argument is the length in bytes of that data.
+    HM10_Trace_Send_Done            = 1U,   //!< The data has been sent by the UART, or it has been queued if @ref HM10_UART_TX_QUEUE is enabled. Its argument is the length in bytes of that data.
+    HM10_Trace_First_RX_Byte        = 2U,   //!< The first byte of the expected data has been received from the HM-10 BT Device. Its argument is the number of bytes that had been received at that moment.
+    HM10_Trace_Last_RX_Byte         = 3U,   //!< The last byte of the expected data has been received from the HM-10 BT Device. Its argument is the length in bytes of that data.
+    HM10_Trace_Parse_Done           = 4U,   //!< The Response of a Command has been validated. Its argument is the tag of that Command (see @ref HM10_TRACE_TAG ).
+    HM10_Trace_Callback_Dispatch    = 5U,   //!< A callback of the application is about to be called. Its argument is the value that will be passed to that callback.
+    HM10_Trace_Points_Count         = 6U    //!< Total number of trace points. @note This is not a valid trace point.
+} HM10_Trace_Point;
+
+/**@brief	Trace record definition.
+ */
+typedef struct
+{
+    uint32_t timestamp;     //!< Value of the DWT Cycle Counter at which the trace point was reached.
+    uint16_t arg;           //!< Argument of the trace point (see @ref HM10_Trace_Point ).
+    uint8_t point;          //!< Trace point that was reached (see @ref HM10_Trace_Point ).
+} HM10_Trace_Record;
+
+/**@brief	Calculates the tag with which the @ref HM10_Trace_Parse_Done trace point identifies a Command, which is made
+ *          of the first letter of the name of that Command and the last letter of the whole Command (e.g., "RT" for the
+ *          Reset Command "AT+RESET" and "AT" for the Test Command).
+ *
+ * @param cmd       Pointer to the Memory Address of the Command without its value (e.g., "AT+ROLE").
+ * @param cmd_size  Length in bytes of the \p cmd param.
+ */
+#define HM10_TRACE_TAG(cmd, cmd_size)   ((uint16_t) ((((cmd_size) > 3) ? (cmd)[3] : (cmd)[0]) << 8) | (uint8_t) (cmd)[(cmd_size) - 1])
+
+#if HM10_TRACE
+#define HM10_TRACE_POINT(point, arg)    record_hm10_trace((point), (uint16_t) (arg))    /**< @brief Records a trace point (see @ref record_hm10_trace ), or compiles into nothing if @ref HM10_TRACE is disabled. */
+#else
+#define HM10_TRACE_POINT(point, arg)    ((void) 0)                                      /**< @brief Records a trace point (see @ref record_hm10_trace ), or compiles into nothing if @ref HM10_TRACE is disabled. */
+#endif
+
+/**@brief	Enables the DWT Cycle Counter of the Cortex-M core and discards all the records of the trace ring.
+ *
+ * @note    This function should be called once before the trace points are reached, and while none of them can be
+ *          reached (e.g., before the UART callbacks are enabled).
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+void init_hm10_trace();
+
+/**@brief	Records that a trace point has been reached, with the current value of the DWT Cycle Counter.
+ *
+ * @details This function can be called both from the application and from interrupts, since each call claims a
+ *          different record of the trace ring atomically and then publishes it once it has been written.
+ *
+ * @param point Trace point that has been reached.
+ * @param arg   Argument of the trace point (see @ref HM10_Trace_Point ).
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+void record_hm10_trace(HM10_Trace_Point point, uint16_t arg);
+
+/**@brief	Reads, from the oldest to the newest one, the records of the trace ring that have not been read yet.
+ *
+ * @param[out] records      Pointer to the Memory Address into which the read records will be stored.
+ * @param max_records       Maximum number of records that can be stored into the \p records param.
+ * @param[out] lost         Pointer to the Memory Address into which the number of records that were overwritten
+ *                          before they could be read will be stored. If this is not required, then pass a \c NULL
+ *                          value to this param.
+ *
+ * @return  The number of records that were read.
+ *
+ * @note    This function must not be called from more than one place at the same time. A record that is still being
+ *          written is left to be read by the next call.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+uint16_t read_hm10_trace(HM10_Trace_Record *records, uint16_t max_records, uint32_t *lost);
+
+/**@brief	Prints, with \c printf() , all the records of the trace ring that have not been read yet.
+ *
+ * @details The records are printed between a "HM10_TRACE BEGIN" line, which gives the number of DWT cycles per
+ *          microsecond and the width in bits of the timestamps, and a "HM10_TRACE END" line, which gives the number of
+ *          records that were lost. Each record is printed in its own line as the name of its trace point, its timestamp
+ *          and its argument.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+void print_hm10_trace();
+
+#endif /* HM10_TRACE_H_ */
+
+/** @} */ // hm10_trace
+
+/** @} */ // hm10_ble
@@ -3,66 +3,131 @@
  */
 
 #include "hm10_ble_driver.h"
+#include "hm10_trace.h" // Custom Mortrack's Library for the trace points of the HM-10 Driver Library.
 #include <string.h>	// Library from which "memset()" and "memcpy()" are located at.
 
 #define HM10_MAX_AT_COMMAND_SIZE							(19)       /**< @brief Total maximum bytes in a Tx/Rx AT Command of the HM-10 BT Device. */
-#define HM10_MAX_PACKET_SIZE								(19)       /**< @brief Total maximum bytes in a Tx/Rx package/Payload to/from the HM-10 BT Device. @note The documentation of the HM-10 BT Device states that there is a restriction of sending data from one HM-10 BT Device to another, whenever they establish a connection, of 19 bytes per request. Therefore, to manage things homogeneously, both the transmit and receive requests will be handled by this @ref hm10_ble with the same size limit of 19 bytes. */
 #define HM10_TEST_CMD_SIZE								    (2)        /**< @brief	Length in bytes of a Test Command in the HM-10 BT device. */
 #define HM10_RESET_CMD_SIZE								    (8)        /**< @brief	Length in bytes of a Reset Command in the HM-10 BT device. */
 #define HM10_RENEW_CMD_SIZE								    (8)        /**< @brief	Length in bytes of a Renew Command in the HM-10 BT device. */
-#define HM10_SET_NAME_RESPONSE_SIZE_WITHOUT_REQUESTED_NAME  (7)        /**< @brief	Length in bytes of a Set Name Response from the HM-10 BT device but without considering the length of the requested name. */
+#define HM10_NAME_CMD_SIZE_WITHOUT_VALUE                    (7)        /**< @brief	Length in bytes of either a Set or a Get Name Command in the HM-10 BT device but without considering the length of its value (i.e., the requested name or the '?' character). */
+#define HM10_PIN_CMD_SIZE_WITHOUT_VALUE                     (7)        /**< @brief	Length in bytes of either a Set or a Get Pin Command in the HM-10 BT device but without considering the length of its value (i.e., the requested pin or the '?' character). */
+#define HM10_SINGLE_VALUE_CMD_SIZE_WITHOUT_VALUE            (7)        /**< @brief	Length in bytes of either a Set or a Get Command in the HM-10 BT device whose value is a single byte (i.e., the Role, Type, Mode, IMME and NOTI Commands) but without considering the length of its value. */
+#define HM10_QUERY_VALUE_SIZE                               (1)        /**< @brief	Length in bytes of the value of a Get Command in the HM-10 BT device (i.e., the '?' character). */
+#define HM10_SET_GET_RESPONSE_SIZE_WITHOUT_VALUE            (7)        /**< @brief	Length in bytes of either a Set or a Get Response from the HM-10 BT device (i.e., "OK+Set:" or "OK+Get:") but without considering the length of its value. */
 #define HM10_GET_NAME_RESPONSE_SIZE_WITHOUT_REQUESTED_NAME	(8)        /**< @brief	Length in bytes of a Get Name Response from the HM-10 BT device but without considering the length of the requested name. */
-#define HM10_GET_NAME_CMD_SIZE							    (8)        /**< @brief	Length in bytes of a Get Name Command in the HM-10 BT device. */
-#define HM10_SET_ROLE_CMD_SIZE							    (8)        /**< @brief	Length in bytes of a Set Role Command in the HM-10 BT device. */
-#define HM10_GET_ROLE_CMD_SIZE							    (8)        /**< @brief	Length in bytes of a Get Role Command in the HM-10 BT device. */
-#define HM10_ROLE_RESPONSE_SIZE							    (8)        /**< @brief	Length in bytes of either a Get or a Set Role Command's Response in the HM-10 BT device. */
-#define HM10_SET_PIN_CMD_SIZE								(13)       /**< @brief	Length in bytes of the Set Pin Command of a HM-10 BT device. */
-#define HM10_GET_PIN_CMD_SIZE								(8)        /**< @brief	Length in bytes of the Get Pin Command of a HM-10 BT device. */
-#define HM10_PIN_RESPONSE_SIZE							    (13)       /**< @brief	Length in bytes of either a Get or a Set Pin Command's Response in the HM-10 BT device. */
-#define HM10_SET_TYPE_CMD_SIZE							    (8)        /**< @brief	Length in bytes of the Set Type Command of a HM-10 BT device. */
-#define HM10_GET_TYPE_CMD_SIZE							    (8)        /**< @brief	Length in bytes of the Get Type Command of a HM-10 BT device. */
-#define HM10_TYPE_RESPONSE_SIZE							    (8)        /**< @brief	Length in bytes of either a Get or a Set Type Command's Response in the HM-10 BT device. */
-#define HM10_SET_MODE_CMD_SIZE							    (8)        /**< @brief	Length in bytes of the Set Mode Command of a HM-10 BT device. */
-#define HM10_GET_MODE_CMD_SIZE							    (8)        /**< @brief	Length in bytes of the Get Mode Command of a HM-10 BT device. */
-#define HM10_MODE_RESPONSE_SIZE							    (8)        /**< @brief	Length in bytes of either a Get or a Set Mode Command's Response in the HM-10 BT device. */
-#define HM10_SET_IMME_CMD_SIZE							    (8)        /**< @brief	Length in bytes of the Set IMME Command of a HM-10 BT device. */
-#define HM10_GET_IMME_CMD_SIZE							    (8)        /**< @brief	Length in bytes of the Get IMME Command of a HM-10 BT device. */
-#define HM10_IMME_RESPONSE_SIZE							    (8)        /**< @brief	Length in bytes of either a Get or a Set IMME Command's Response in the HM-10 BT device. */
-#define HM10_SET_NOTI_CMD_SIZE							    (8)        /**< @brief	Length in bytes of the Set NOTI Command of a HM-10 BT device. */
-#define HM10_GET_NOTI_CMD_SIZE							    (8)        /**< @brief	Length in bytes of the Get NOTI Command of a HM-10 BT device. */
-#define HM10_NOTI_RESPONSE_SIZE							    (8)        /**< @brief	Length in bytes of either a Get or a Set NOTI Command's Response in the HM-10 BT device. */
 #define HM10_CONNECT_TO_ADDRESS_CMD_SIZE				    (18)       /**< @brief	Length in bytes of the Connect-To-Address Command of a HM-10 BT device. */
+#define HM10_CONNECT_TO_ADDRESS_CMD_SIZE_WITHOUT_VALUE	    (5)        /**< @brief	Length in bytes of the Connect-To-Address Command of a HM-10 BT device but without considering the length of the Bluetooth Address Type and of the Bluetooth Address. */
 #define HM10_CONNECT_TO_ADDRESS_RESPONSE1_SIZE				(8)        /**< @brief	Length in bytes of the first part of the Connect-To-Address Command's Response in the HM-10 BT device. */
+#define HM10_CONNECT_TO_ADDRESS_RESPONSE1_SIZE_WITHOUT_VALUE (5)       /**< @brief	Length in bytes of the first part of the Connect-To-Address Command's Response in the HM-10 BT device but without considering the length of the Bluetooth Address Type bytes and of the 'A' character that follow it. */
 #define HM10_CONNECT_TO_ADDRESS_RESPONSE2_SIZE				(7)        /**< @brief	Length in bytes of the second part of the Connect-To-Address Command's Response in the HM-10 BT device. */
 #define HM10_RESET_RESPONSE_SIZE							(8)        /**< @brief	Length in bytes of a Reset Response from the HM-10 BT device. */
 #define HM10_RENEW_RESPONSE_SIZE							(8)        /**< @brief	Length in bytes of a Renew Response from the HM-10 BT device. */
 #define HM10_OK_RESPONSE_SIZE								(2)        /**< @brief	Length in bytes of a OK Response from the HM-10 BT device. */
-#define HM10_OK_LOST_RESPONSE_SIZE                          (7)        /**< @brief	Length in bytes of a whole OK+LOST Response from the HM-10 BT device. */
 #define HM10_OK_LOST_RESPONSE_SIZE_WITHOUT_THE_OK_PART      (5)        /**< @brief	Length in bytes of a OK+LOST Response from the HM-10 BT device, but without the OK part. */
 #define HM10_CONNECT_TO_ADDRESS_TIMEOUT				        (11000U)   /**< @brief	Time in milliseconds that out MCU/MPU will wait for the HM-10 BT device's Connect-To-Address Response after sending a Connect-To-Address Command to it. */
+#define HM10_CMD_SINGLE_VALUE                               (HM10_CMD_ROLE || HM10_CMD_PIN_CODE_MODE || HM10_CMD_MODULE_WORK_MODE || HM10_CMD_MODULE_WORK_TYPE || HM10_CMD_NOTIFY_INFORMATION_MODE)    /**< @brief	Flag that indicates whether any of the Commands whose value is a single byte is enabled, which require the @ref set_hm10_single_value and @ref get_hm10_single_value functions. */
 
 static UART_HandleTypeDef *p_huart;												                                                  /**< @brief Pointer to the UART Handle Structure of the UART that will be used in this @ref hm10_ble to communicate with the HM-10 BT device. @details This pointer's value is defined in the @ref init_hm10_module function. */
 static uint8_t TxRx_Buffer[HM10_MAX_AT_COMMAND_SIZE];					                                                          /**< @brief Global buffer that will be used by our MCU/MPU to hold the whole data of a received response or a request to be send from/to the HM-10 BT Device. */
-static char HM10_Set_Name_resp_without_name_value[] = {'O', 'K', '+', 'S', 'e', 't', ':'};	          /**< @brief Pointer to the equivalent data of the BT Name Response that the HM-10 BT device sends back to our MCU/MPU whenever a Set Name request to the HM-10 BT device is processed successfully, but without the name value. */
-static char HM10_Get_Name_resp_without_name_value[] = {'O', 'K', '+', 'N', 'A', 'M', 'E', ':'};    /**< @brief Pointer to the equivalent data of a BT Name Response that the HM-10 BT device sends back to our MCU/MPU whenever a Get Name request to the HM-10 BT device is processed successfully, but without the name value. */
-static char *HM10_Set_Role_resp_without_role_value = HM10_Set_Name_resp_without_name_value;	                                      /**< @brief Pointer to the equivalent data of a BT Role Response that the HM-10 BT device sends back to our MCU/MPU whenever a Set Role request to the HM-10 BT device is processed successfully, but without the role value. */
-static char HM10_Get_Role_resp_without_role_value[] = {'O', 'K', '+', 'G', 'e', 't', ':'};	          /**< @brief Pointer to the equivalent data of a BT Role Response that the HM-10 BT device sends back to our MCU/MPU whenever a Get Role request to the HM-10 BT device is processed successfully, but without the role value. */
-static char *HM10_Set_Pin_resp_without_pin_value = HM10_Set_Name_resp_without_name_value;			                              /**< @brief Pointer to the equivalent data of a BT Pin Response that the HM-10 BT device sends back to our MCU/MPU whenever a Set Pin request to the HM-10 BT device is processed successfully, but without the pin value. */
-static char *HM10_Get_Pin_resp_without_pin_value = HM10_Get_Role_resp_without_role_value;			                              /**< @brief Pointer to the equivalent data of a BT Pin Response that the HM-10 BT device sends back to our MCU/MPU whenever a Get Pin request to the HM-10 BT device is processed successfully, but without the pin value. */
-static char *HM10_Set_Type_resp_without_type_value = HM10_Set_Name_resp_without_name_value;	                                      /**< @brief Pointer to the equivalent data of a BT Type Response that the HM-10 BT device sends back to our MCU/MPU whenever a Set Type request to the HM-10 BT device is processed successfully, but without the type value. */
-static char *HM10_Get_Type_resp_without_type_value = HM10_Get_Role_resp_without_role_value;	                                      /**< @brief Pointer to the equivalent data of a BT Type Response that the HM-10 BT device sends back to our MCU/MPU whenever a Get Type request to the HM-10 BT device is processed successfully, but without the type value. */
-static char *HM10_Set_Mode_resp_without_module_work_mode_value = HM10_Set_Name_resp_without_name_value;	                          /**< @brief Pointer to the equivalent data of a BT Mode Response that the HM-10 BT device sends back to our MCU/MPU whenever a Set Mode request to the HM-10 BT device is processed successfully, but without the Module Work Mode value. */
-static char *HM10_Get_Mode_resp_without_module_work_mode_value = HM10_Get_Role_resp_without_role_value;	                          /**< @brief Pointer to the equivalent data of a BT Mode Response that the HM-10 BT device sends back to our MCU/MPU whenever a Get Mode request to the HM-10 BT device is processed successfully, but without the Module Work Mode value. */
-static char *HM10_Set_IMME_resp_without_module_work_type_value = HM10_Set_Name_resp_without_name_value;	                          /**< @brief Pointer to the equivalent data of a BT IMME Response that the HM-10 BT device sends back to our MCU/MPU whenever a Set IMME request to the HM-10 BT device is processed successfully, but without the Module Work Type value. */
-static char *HM10_Get_IMME_resp_without_module_work_type_value = HM10_Get_Role_resp_without_role_value;	                          /**< @brief Pointer to the equivalent data of a BT IMME Response that the HM-10 BT device sends back to our MCU/MPU whenever a Get IMME request to the HM-10 BT device is processed successfully, but without the Module Work Type value. */
-static char *HM10_Set_NOTI_resp_without_notify_mode_value = HM10_Set_Name_resp_without_name_value;	                              /**< @brief Pointer to the equivalent data of a BT NOTI Response that the HM-10 BT device sends back to our MCU/MPU whenever a Set NOTI request to the HM-10 BT device is processed successfully, but without the Notify Information Mode value. */
-static char *HM10_Get_NOTI_resp_without_notify_mode_value = HM10_Get_Role_resp_without_role_value;	                              /**< @brief Pointer to the equivalent data of a BT NOTI Response that the HM-10 BT device sends back to our MCU/MPU whenever a Get NOTI request to the HM-10 BT device is processed successfully, but without the Notify Information Mode value. */
-static char HM10_Connect_To_Address_response1[] = {'O', 'K', '+', 'C', 'O', '\0', '\0', 'A'};      /**< @brief Pointer to the equivalent data of a successful connecting BT Connect-To-Address Response that the HM-10 BT device sends back to our MCU/MPU whenever a Connect-To-Address request to the HM-10 BT device is processed successfully and the device is trying to connect to a remote BT. @note The two bytes containing a \c NULL value in this variable's declaration (i.e., indexes 5 and 6) must be changed to the corresponding Bluetooth Address Type with which the Connect-To-Address Command was formulated with. */
-static char HM10_Connect_To_Address_response2[] = {'O', 'K', '+', 'C', 'O', 'N', 'N'};                 /**< @brief Pointer to the equivalent data of a successful connected BT Connect-To-Address Response that the HM-10 BT device sends back to our MCU/MPU whenever a Connect-To-Address request to the HM-10 BT device is processed successfully and the device has been able to successfully connect to a remote BT. */
-static char HM10_Reset_resp[] = {'O', 'K', '+', 'R', 'E', 'S', 'E', 'T'};				          /**< @brief Pointer to the equivalent data of a Reset Response that the HM-10 BT device sends back to our MCU/MPU whenever a Software Reset request sent to the HM-10 BT device is processed successfully. */
-static char HM10_Renew_resp[] = {'O', 'K', '+', 'R', 'E', 'N', 'E', 'W'};				          /**< @brief Pointer to the equivalent data of a Renew Response that the HM-10 BT device sends back to our MCU/MPU whenever a Restore to Factory Setup Request sent to the HM-10 BT device is processed successfully. */
-static char HM10_OK_LOST_resp[] = {'O', 'K', '+', 'L', 'O', 'S', 'T'};                                 /**< @brief Pointer to the equivalent data of an OK+LOST Response that the HM-10 BT device sends back to our MCU/MPU whenever, during a Bluetooth Connection, a test request sent to the HM-10 BT device is processed successfully. */
-static char HM10_OK_resp[] = {'O', 'K'};				                                                                  /**< @brief Pointer to the equivalent data of an OK Response that the HM-10 BT device sends back to our MCU/MPU whenever a test request sent to the HM-10 BT device is processed successfully. */
+static const char HM10_Test_cmd[] = {'A', 'T'};                                                                                    /**< @brief Test Command of the HM-10 BT device, which is also its Lost-Connection Command during a Bluetooth Connection. */
+static const char HM10_OK_resp[] = {'O', 'K'};				                                                                      /**< @brief Pointer to the equivalent data of an OK Response that the HM-10 BT device sends back to our MCU/MPU whenever a test request sent to the HM-10 BT device is processed successfully. */
+#if HM10_CMD_RESET
+static const char HM10_Reset_cmd[] = {'A', 'T', '+', 'R', 'E', 'S', 'E', 'T'};                                                      /**< @brief Reset Command of the HM-10 BT device. */
+static const char HM10_Reset_resp[] = {'O', 'K', '+', 'R', 'E', 'S', 'E', 'T'};				                                      /**< @brief Pointer to the equivalent data of a Reset Response that the HM-10 BT device sends back to our MCU/MPU whenever a Software Reset request sent to the HM-10 BT device is processed successfully. */
+#endif
+#if HM10_CMD_RENEW
+static const char HM10_Renew_cmd[] = {'A', 'T', '+', 'R', 'E', 'N', 'E', 'W'};                                                      /**< @brief Renew Command of the HM-10 BT device. */
+static const char HM10_Renew_resp[] = {'O', 'K', '+', 'R', 'E', 'N', 'E', 'W'};				                                      /**< @brief Pointer to the equivalent data of a Renew Response that the HM-10 BT device sends back to our MCU/MPU whenever a Restore to Factory Setup Request sent to the HM-10 BT device is processed successfully. */
+#endif
+#if HM10_CMD_NAME || HM10_CMD_PIN || HM10_CMD_SINGLE_VALUE
+static const uint8_t HM10_Query_value[] = {'?'};                                                                                   /**< @brief Value with which a Set Command of the HM-10 BT device becomes its corresponding Get Command. */
+static const char HM10_Set_resp_without_value[] = {'O', 'K', '+', 'S', 'e', 't', ':'};	                                          /**< @brief Pointer to the equivalent data of the Response that the HM-10 BT device sends back to our MCU/MPU whenever a Set Name, Role, Pin, Type, Mode, IMME or NOTI request to the HM-10 BT device is processed successfully, but without the requested value. */
+#endif
+#if HM10_CMD_PIN || HM10_CMD_SINGLE_VALUE
+static const char HM10_Get_resp_without_value[] = {'O', 'K', '+', 'G', 'e', 't', ':'};	                                          /**< @brief Pointer to the equivalent data of the Response that the HM-10 BT device sends back to our MCU/MPU whenever a Get Role, Pin, Type, Mode, IMME or NOTI request to the HM-10 BT device is processed successfully, but without the requested value. */
+#endif
+#if HM10_CMD_NAME
+static const char HM10_Name_cmd[] = {'A', 'T', '+', 'N', 'A', 'M', 'E'};                                                           /**< @brief Set and Get Name Commands of the HM-10 BT device but without their value. */
+static const char HM10_Get_Name_resp_without_name_value[] = {'O', 'K', '+', 'N', 'A', 'M', 'E', ':'};                              /**< @brief Pointer to the equivalent data of a BT Name Response that the HM-10 BT device sends back to our MCU/MPU whenever a Get Name request to the HM-10 BT device is processed successfully, but without the name value. */
+#endif
+#if HM10_CMD_ROLE
+static const char HM10_Role_cmd[] = {'A', 'T', '+', 'R', 'O', 'L', 'E'};                                                           /**< @brief Set and Get Role Commands of the HM-10 BT device but without their value. */
+#endif
+#if HM10_CMD_PIN
+static const char HM10_Pin_cmd[] = {'A', 'T', '+', 'P', 'A', 'S', 'S'};                                                            /**< @brief Set and Get Pin Commands of the HM-10 BT device but without their value. */
+#endif
+#if HM10_CMD_PIN_CODE_MODE
+static const char HM10_Type_cmd[] = {'A', 'T', '+', 'T', 'Y', 'P', 'E'};                                                           /**< @brief Set and Get Type Commands (i.e., Pin Code Mode) of the HM-10 BT device but without their value. */
+#endif
+#if HM10_CMD_MODULE_WORK_MODE
+static const char HM10_Mode_cmd[] = {'A', 'T', '+', 'M', 'O', 'D', 'E'};                                                           /**< @brief Set and Get Mode Commands (i.e., Module Work Mode) of the HM-10 BT device but without their value. */
+#endif
+#if HM10_CMD_MODULE_WORK_TYPE
+static const char HM10_IMME_cmd[] = {'A', 'T', '+', 'I', 'M', 'M', 'E'};                                                           /**< @brief Set and Get IMME Commands (i.e., Module Work Type) of the HM-10 BT device but without their value. */
+#endif
+#if HM10_CMD_NOTIFY_INFORMATION_MODE
+static const char HM10_NOTI_cmd[] = {'A', 'T', '+', 'N', 'O', 'T', 'I'};                                                           /**< @brief Set and Get NOTI Commands (i.e., Notify Information Mode) of the HM-10 BT device but without their value. */
+#endif
+#if HM10_CMD_CONNECTION
+static const char HM10_Connect_To_Address_cmd[] = {'A', 'T', '+', 'C', 'O'};                                                       /**< @brief Connect-To-Address Command of the HM-10 BT device but without the Bluetooth Address Type and the Bluetooth Address. */
+static const char HM10_Connect_To_Address_response1_without_value[] = {'O', 'K', '+', 'C', 'O'};                                   /**< @brief Pointer to the equivalent data of a successful connecting BT Connect-To-Address Response that the HM-10 BT device sends back to our MCU/MPU whenever a Connect-To-Address request to the HM-10 BT device is processed successfully and the device is trying to connect to a remote BT, but without the two Bluetooth Address Type bytes and the 'A' character that follow it. */
+static const char HM10_Connect_To_Address_response2[] = {'O', 'K', '+', 'C', 'O', 'N', 'N'};                                       /**< @brief Pointer to the equivalent data of a successful connected BT Connect-To-Address Response that the HM-10 BT device sends back to our MCU/MPU whenever a Connect-To-Address request to the HM-10 BT device is processed successfully and the device has been able to successfully connect to a remote BT. */
+static const char HM10_OK_LOST_resp[] = {'O', 'K', '+', 'L', 'O', 'S', 'T'};                                                       /**< @brief Pointer to the equivalent data of an OK+LOST Response that the HM-10 BT device sends back to our MCU/MPU whenever, during a Bluetooth Connection, a test request sent to the HM-10 BT device is processed successfully. */
+#endif
+#if HM10_UART_RX_DMA
+#if (HM10_UART_RX_RING_SIZE & (HM10_UART_RX_RING_SIZE - 1U)) != 0U
+#error "HM10_UART_RX_RING_SIZE must be a power of 2."
+#endif
+static uint8_t rx_ring[HM10_UART_RX_RING_SIZE];                                                                                    /**< @brief Circular buffer into which the DMA of the UART towards which the @ref p_huart Global Pointer points to writes all the data that is received from the HM-10 BT Device. */
+static volatile uint32_t rx_ring_received = 0;                                                                                     /**< @brief Total number of bytes that the DMA has written into the @ref rx_ring buffer, as reported by the @ref handle_hm10_uart_rx_event function. @note This counter is only written from the UART's interrupts and it is allowed to wrap around. */
+static uint32_t rx_ring_consumed = 0;                                                                                              /**< @brief Total number of bytes that have been read from the @ref rx_ring buffer. @note This counter is only written from outside of the UART's interrupts and it is allowed to wrap around. */
+static uint16_t rx_ring_dma_position = 0;                                                                                          /**< @brief Position in the @ref rx_ring buffer up to which the DMA had written at the last Receive-To-Idle Event. */
+#endif
+#if HM10_UART_ERROR_RECOVERY
+static HM10_UART_Error_Stats uart_error_stats;                                                                                     /**< @brief Number of errors that the UART has reported since the last call to the @ref reset_hm10_uart_error_stats function. */
+static uint8_t rx_error_flag = 0;                                                                                                  /**< @brief Flag that indicates whether the data read since the last call to the @ref get_hm10_rx_error_flag function was affected by an error of the UART. */
+#if HM10_UART_RX_DMA
+#if (HM10_UART_RX_ERROR_RECORDS & (HM10_UART_RX_ERROR_RECORDS - 1U)) != 0U
+#error "HM10_UART_RX_ERROR_RECORDS must be a power of 2."
+#endif
+static uint32_t rx_error_starts[HM10_UART_RX_ERROR_RECORDS];                                                                        /**< @brief Value that the @ref rx_ring_received counter had right before the bytes among which each of the UART errors that have not been read past yet was detected. */
+static uint32_t rx_error_ends[HM10_UART_RX_ERROR_RECORDS];                                                                          /**< @brief Value that the @ref rx_ring_received counter had right after the bytes among which each of the UART errors of the @ref rx_error_starts buffer was detected. */
+static volatile uint8_t rx_errors_added = 0;                                                                                       /**< @brief Total number of UART errors that have been recorded into the @ref rx_error_starts and @ref rx_error_ends buffers. @note This counter is only written from the UART's interrupts and it is allowed to wrap around. */
+static uint8_t rx_errors_taken = 0;                                                                                                /**< @brief Total number of the UART errors of the @ref rx_error_starts and @ref rx_error_ends buffers that have been read past. @note This counter is only written from outside of the UART's interrupts and it is allowed to wrap around. */
+static volatile uint8_t rx_errors_overflow = 0;                                                                                    /**< @brief Flag that indicates whether a UART error could not be recorded because the @ref rx_error_starts and @ref rx_error_ends buffers were full, in which case the next read is flagged. */
+static volatile uint8_t rx_ring_restarted = 0;                                                                                     /**< @brief Flag that indicates whether the @ref handle_hm10_uart_error function has restarted the DMA reception since the last read, in which case the bytes that were pending to be read are discarded. */
+static volatile uint32_t rx_ring_restart_position = 0;                                                                             /**< @brief Value of the @ref rx_ring_received counter at which the DMA reception was restarted by the @ref handle_hm10_uart_error function. */
+#endif
+#endif
+#if HM10_UART_TX_QUEUE
+#if (HM10_UART_TX_QUEUE_SIZE & (HM10_UART_TX_QUEUE_SIZE - 1U)) != 0U
+#error "HM10_UART_TX_QUEUE_SIZE must be a power of 2."
+#endif
+static uint8_t tx_queue[HM10_UART_TX_QUEUE_SIZE];                                                                                  /**< @brief Circular buffer that holds the data that is pending to be sent by the UART towards which the @ref p_huart Global Pointer points to. */
+static volatile uint32_t tx_queue_queued = 0;                                                                                      /**< @brief Total number of bytes that have been queued into the @ref tx_queue buffer. @note This counter is only written from outside of the UART's interrupts and it is allowed to wrap around. */
+static volatile uint32_t tx_queue_sent = 0;                                                                                        /**< @brief Total number of bytes of the @ref tx_queue buffer that the UART has finished sending. @note This counter is allowed to wrap around. */
+static volatile uint16_t tx_queue_in_flight = 0;                                                                                   /**< @brief Number of bytes of the @ref tx_queue buffer that the UART is currently sending, or \c 0 if it is idle. */
+#endif
+#if HM10_UART_TX_STREAM
+#if HM10_UART_TX_QUEUE
+#error "HM10_UART_TX_STREAM cannot be enabled together with HM10_UART_TX_QUEUE."
+#endif
+static uint8_t tx_stream_buffers[2][HM10_UART_TX_STREAM_BUFFER_SIZE];                                                               /**< @brief Buffers of the transmit stream, one of which is filled by the application while the DMA of the UART towards which the @ref p_huart Global Pointer points to sends the other one. */
+static volatile uint16_t tx_stream_sizes[2] = {0, 0};                                                                              /**< @brief Number of bytes of each of the @ref tx_stream_buffers buffers that have been handed to the DMA and that have not been sent yet, or \c 0 if that buffer is free. */
+static uint8_t tx_stream_fill = 0;                                                                                                 /**< @brief Index of the @ref tx_stream_buffers buffer that the application fills next. @note This index is only written from outside of the UART's interrupts. */
+static volatile uint8_t tx_stream_sending = 0;                                                                                     /**< @brief Index of the @ref tx_stream_buffers buffer that the DMA is sending, or that it sends next if it is idle. @note This index is only written from the UART's interrupts, or with them disabled. */
+static volatile uint8_t tx_stream_in_flight = 0;                                                                                   /**< @brief Flag that indicates whether the DMA is currently sending the @ref tx_stream_buffers buffer of the @ref tx_stream_sending index. */
+static HM10_TX_Stream_Callback tx_stream_callback = NULL;                                                                          /**< @brief Callback that is called whenever the DMA has finished sending one of the @ref tx_stream_buffers buffers, or \c NULL if there is none. */
+#endif
+static HM10_TX_Watermark_Callback tx_watermark_callback = NULL;                                                                    /**< @brief Callback that is called whenever the @ref tx_queue buffer drains down to @ref HM10_UART_TX_LOW_WATERMARK bytes, or \c NULL if there is none. */
+static const HM10_Port_def_t default_port;                                                                                         /**< @brief Port that is used whenever no other one has been given to the @ref set_hm10_port function. */
+static const HM10_Port_def_t *p_port = &default_port;                                                                              /**< @brief Pointer to the port through which the @ref hm10_ble measures time and waits for events. */
+#if HM10_ACTIVE_TIME_STATS
+static uint32_t activity_start_cycles = 0;                                                                                         /**< @brief Value of the get_cycles() function of the @ref p_port port at the last call to the @ref reset_hm10_activity_stats function. */
+static uint32_t activity_sleep_cycles = 0;                                                                                         /**< @brief Number of cycles slept since the last call to the @ref reset_hm10_activity_stats function. */
+static uint32_t activity_sleeps = 0;                                                                                               /**< @brief Number of sleeps since the last call to the @ref reset_hm10_activity_stats function. */
+#endif
 
 /**@brief	Numbers in ASCII code definitions.
  *
@@ -89,14 +154,300 @@ typedef enum
 
 /**@brief	Flushes the RX of the UART towards which the @ref p_huart Global Pointer points to.
  *
- * @details This function will poll-receive one byte from the RX of the UART previously mentioned with a timeout of @ref
- *          HM10_CUSTOM_HAL_TIMEOUT over and over until a @ref HAL_TIMEOUT HAL Status is received.
+ * @details This function will read the Data Register of the UART previously mentioned for as long as its RXNE Flag
+ *          indicates that it holds a received byte, but no more than @ref HM10_MAX_AT_COMMAND_SIZE times so that it
+ *          always takes a bounded time even if the HM-10 BT Device keeps sending data, and it will then clear the
+ *          Overrun Error (ORE) Flag of that UART if it was set. This function never waits for more data to arrive.
+ * @details If @ref HM10_UART_RX_DMA is enabled, this function will instead discard all the bytes that are pending to be
+ *          read from the @ref rx_ring buffer, including the ones that the DMA has written since its last Receive-To-Idle
+ *          Event, without waiting.
  *
  * @author	César Miranda Meza (cmirandameza3@hotmail.com)
  * @date    November 30, 2023.
+ * @date    LAST UPDATE: October 18, 2026.
  */
 static void HAL_uart_rx_flush();
 
+/**@brief	Receives a certain number of bytes from the RX of the UART towards which the @ref p_huart Global Pointer
+ *          points to.
+ *
+ * @details If @ref HM10_UART_RX_DMA is enabled, this function waits until the requested bytes are available in the @ref
+ *          rx_ring buffer and copies them out of it, so that the bytes that arrive while our MCU/MPU is not waiting for
+ *          them are not lost. Otherwise, this function simply poll-receives them with the HAL_UART_Receive() function.
+ * @details If @ref HM10_UART_ERROR_RECOVERY is enabled, this function raises the @ref rx_error_flag flag whenever it
+ *          returns any of the bytes that may have been affected by an error of the UART.
+ *
+ * @param[out] data Pointer to the Memory Address into which the received bytes will be stored.
+ * @param size      Number of bytes that are desired to be received.
+ * @param timeout   Timeout duration in milliseconds for waiting to receive all the requested bytes.
+ *
+ * @retval  HAL_OK      if all the requested bytes were received.
+ * @retval  HAL_TIMEOUT if not all the requested bytes were received within the \p timeout param, in which case the
+ *                      bytes that did arrive are kept in the @ref rx_ring buffer if @ref HM10_UART_RX_DMA is enabled.
+ * @retval  HAL_ERROR   or \c HAL_BUSY if the HAL_UART_Receive() function failed, or if the DMA had overwritten bytes of
+ *                      the @ref rx_ring buffer that were not read yet, in which case everything that was received so
+ *                      far is discarded.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+static HAL_StatusTypeDef HAL_uart_receive(uint8_t *data, uint16_t size, uint32_t timeout);
+
+#if HM10_UART_RX_DMA
+/**@brief	Gets the number of bytes that are pending to be read from the @ref rx_ring buffer.
+ *
+ * @details If @ref HM10_UART_ERROR_RECOVERY is enabled and the @ref handle_hm10_uart_error function has restarted the
+ *          DMA reception since the last read, then this function first discards the bytes that were pending to be read
+ *          at that moment and raises the @ref rx_error_flag flag.
+ *
+ * @return  The number of bytes that are pending to be read.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+static uint32_t HAL_uart_rx_available();
+#endif
+
+#if HM10_UART_ERROR_RECOVERY
+/**@brief	Gets the errors that are flagged in the Status Register of the UART towards which the @ref p_huart Global
+ *          Pointer points to.
+ *
+ * @return  The flagged errors as a combination of the \c HAL_UART_ERROR_* bits of the HAL, which is \c
+ *          HAL_UART_ERROR_NONE if there are none.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+static uint32_t get_hm10_uart_error_flags();
+
+/**@brief	Counts the errors of the UART into the @ref uart_error_stats Global Structure.
+ *
+ * @param error_code    Errors to count, given as a combination of the \c HAL_UART_ERROR_* bits of the HAL.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+static void count_hm10_uart_errors(uint32_t error_code);
+#endif
+
+#if HM10_UART_RX_DMA && HM10_UART_ERROR_RECOVERY
+/**@brief	Counts the errors that are flagged by the UART and records the bytes that they may have affected.
+ *
+ * @details The error flags are not cleared by reading the Data Register, since that would steal a byte from the DMA.
+ *          Instead, the read of the Status Register made by this function together with the next read of the Data
+ *          Register made by the DMA clear them, as in the STM32F1 family.
+ *
+ * @param start Value of the @ref rx_ring_received counter right before the bytes that may have been affected.
+ * @param end   Value of the @ref rx_ring_received counter right after the bytes that may have been affected.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+static void record_hm10_uart_errors(uint32_t start, uint32_t end);
+#endif
+
+/**@brief	Sends a certain number of bytes through the TX of the UART towards which the @ref p_huart Global Pointer
+ *          points to.
+ *
+ * @details If @ref HM10_UART_TX_QUEUE is enabled, this function waits until there is enough free space in the @ref
+ *          tx_queue buffer, copies the requested bytes into it and returns without waiting for them to be sent.
+ *          Otherwise, this function simply sends them with the blocking HAL_UART_Transmit() function.
+ *
+ * @param[in] data  Pointer to the bytes that are desired to be sent.
+ * @param size      Number of bytes that are desired to be sent.
+ * @param timeout   Timeout duration in milliseconds for waiting to either send or queue all the requested bytes.
+ *
+ * @retval  HAL_OK      if all the requested bytes were either sent or queued.
+ * @retval  HAL_TIMEOUT if the requested bytes could not be either sent or queued within the \p timeout param.
+ * @retval  HAL_ERROR   if the \p size param is larger than @ref HM10_UART_TX_QUEUE_SIZE or if the UART failed,
+ *                      including when it failed to start sending the transmit queue, in which case the queued bytes
+ *                      are kept and retried by the next call.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+static HAL_StatusTypeDef HAL_uart_transmit(uint8_t *data, uint16_t size, uint32_t timeout);
+
+/**@brief	Waits for the next event (i.e., interrupt) through the wait_for_event() function of the @ref p_port port
+ *          whenever @ref HM10_LOW_POWER_WAIT is enabled, while accounting for the time slept if @ref
+ *          HM10_ACTIVE_TIME_STATS is enabled.
+ *
+ * @details This is meant to be called from inside the loops that wait for a condition that is changed by an interrupt,
+ *          which therefore re-evaluate that condition each time that our MCU/MPU wakes up. If @ref HM10_LOW_POWER_WAIT
+ *          is disabled, this function returns immediately so that those loops busy-wait instead.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+static void HAL_wait_for_event();
+
+#if HM10_CMD_RESET || HM10_CMD_RENEW
+/**@brief	Waits for a certain time through the @ref p_port port, sleeping in between its ticks whenever @ref
+ *          HM10_LOW_POWER_WAIT is enabled.
+ *
+ * @param delay	Time in milliseconds that is desired to wait.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+static void HAL_low_power_delay(uint32_t delay);
+#endif
+
+/**@brief	Gets the current time in milliseconds with the SysTick of the HAL, which is the default get_tick() function
+ *          of the @ref HM10_Port_def_t port.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+static uint32_t default_port_get_tick(void);
+
+/**@brief	Makes the Cortex-M core sleep until the next interrupt, which is the default wait_for_event() function of
+ *          the @ref HM10_Port_def_t port.
+ *
+ * @note    Since the SysTick of the HAL interrupts once per millisecond, our MCU/MPU wakes up at least that often.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+static void default_port_wait_for_event(void);
+
+/**@brief	Gets the value of the DWT Cycle Counter of the Cortex-M core, which is the default get_cycles() function of
+ *          the @ref HM10_Port_def_t port.
+ *
+ * @note    On the cores without the DWT Cycle Counter (see @ref HM10_DWT_CYCCNT ), the \c HAL_GetTick() milliseconds
+ *          converted into cycles are returned instead, so that the activity statistics only have a resolution of 1
+ *          millisecond.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+static uint32_t default_port_get_cycles(void);
+
+static const HM10_Port_def_t default_port = {default_port_get_tick, default_port_wait_for_event, default_port_get_cycles};
+
+#if HM10_UART_TX_QUEUE
+/**@brief	Starts sending the next contiguous part of the @ref tx_queue buffer, if the UART is idle and there is
+ *          something pending to be sent.
+ *
+ * @note    This function must be called either from the UART's interrupts or with the interrupts disabled.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+static void HAL_uart_tx_start_next();
+
+/**@brief	Retries to start sending the @ref tx_queue buffer, since the UART may have failed to start it from its
+ *          interrupt, in which case nothing else would start it again.
+ *
+ * @return  \c 1 if some bytes of the @ref tx_queue buffer are pending to be sent while the UART is idle (i.e., if the
+ *          transmit queue is still stalled), or \c 0 otherwise.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+static uint8_t HAL_uart_tx_retry();
+#endif
+
+#if HM10_UART_TX_STREAM
+/**@brief	Starts sending the next buffer of the transmit stream, if the DMA of the UART is idle and the application
+ *          has already handed that buffer to it.
+ *
+ * @note    This function must be called either from the UART's interrupt or with the interrupts disabled.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+static void HAL_uart_tx_stream_start_next();
+
+/**@brief	Retries to start sending the next buffer of the transmit stream while the application waits for it, since
+ *          the UART may have failed to start it from its interrupt, in which case nothing else would start it again.
+ *
+ * @return  \c 1 if a buffer of the transmit stream is pending to be sent while the DMA of the UART is idle (i.e., if the
+ *          transmit stream is still stalled), or \c 0 otherwise.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+static uint8_t HAL_uart_tx_stream_retry();
+#endif
+
+/**@brief	Sends an AT Command to the HM-10 BT Device and receives its Response, whose first bytes are validated.
+ *
+ * @details This is the exchange engine that is shared by all the AT Commands of the @ref hm10_ble . It flushes the RX
+ *          of the UART, populates the \p cmd param followed by the \p value param into the @ref TxRx_Buffer buffer,
+ *          sends them, receives \p resp_size plus \p resp_value_size bytes into the @ref TxRx_Buffer buffer and
+ *          validates that the first \p resp_size bytes of them match the \p resp param. Validating the remaining bytes
+ *          (i.e., the value of the Response) is left to the caller.
+ *
+ * @note    This function is never inlined so that each of the AT Commands costs only a call to it.
+ *
+ * @param[in] cmd       Pointer to the constant part of the AT Command.
+ * @param cmd_size      Length in bytes of the \p cmd param.
+ * @param[in] value     Pointer to the value that follows the \p cmd param in the AT Command, or \c NULL if there is
+ *                      none.
+ * @param value_size    Length in bytes of the \p value param.
+ * @param[in] resp      Pointer to the constant part of the expected Response.
+ * @param resp_size     Length in bytes of the \p resp param.
+ * @param resp_value_size   Length in bytes of the value that follows the \p resp param in the Response.
+ *
+ * @retval	HM10_EC_OK	if the AT Command was sent and the constant part of its Response was received and validated.
+ * @retval  HM10_EC_NR  if the AT Command could not be sent or if its Response was not received.
+ * @retval  HM10_EC_ERR if something went wrong with the HAL or if the constant part of the Response did not match.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+static HM10_Status send_hm10_at_cmd(const char *cmd, uint8_t cmd_size, const uint8_t *value, uint8_t value_size, const char *resp, uint8_t resp_size, uint8_t resp_value_size) __attribute__((noinline));
+
+#if HM10_CMD_SINGLE_VALUE
+/**@brief	Sends a Set Command whose value is a single byte (e.g., "AT+ROLE1") to the HM-10 BT Device and validates
+ *          that its Response (e.g., "OK+Set:1") contains that same value.
+ *
+ * @param[in] cmd   Pointer to the Command but without its value (e.g., "AT+ROLE"), whose length in bytes is @ref
+ *                  HM10_SINGLE_VALUE_CMD_SIZE_WITHOUT_VALUE .
+ * @param value     The value to be set.
+ *
+ * @retval	HM10_EC_OK	if the value was set.
+ * @retval  HM10_EC_NR  if the Command could not be sent or if its Response was not received.
+ * @retval  HM10_EC_ERR if something went wrong with the HAL or if the Response did not match.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+static HM10_Status set_hm10_single_value(const char *cmd, uint8_t value) __attribute__((noinline));
+
+/**@brief	Sends a Get Command whose value is a single byte (e.g., "AT+ROLE?") to the HM-10 BT Device and gets the
+ *          value from its Response (e.g., "OK+Get:1").
+ *
+ * @param[in] cmd       Pointer to the Command but without the '?' character (e.g., "AT+ROLE"), whose length in bytes
+ *                      is @ref HM10_SINGLE_VALUE_CMD_SIZE_WITHOUT_VALUE .
+ * @param[out] value    Pointer to the Memory Address into which the received value will be stored, without being
+ *                      validated.
+ *
+ * @retval	HM10_EC_OK	if the value was received.
+ * @retval  HM10_EC_NR  if the Command could not be sent or if its Response was not received.
+ * @retval  HM10_EC_ERR if something went wrong with the HAL or if the Response did not match.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+static HM10_Status get_hm10_single_value(const char *cmd, uint8_t *value) __attribute__((noinline));
+#endif
+
+#if HM10_CMD_PIN
+/**@brief	Validates that a BT Pin contains only number characters in ASCII code (see @ref Numbers_in_ASCII ).
+ *
+ * @param[in] pin   Pointer to the @ref HM10_PIN_VALUE_SIZE bytes of the BT Pin.
+ *
+ * @retval	HM10_EC_OK	if the BT Pin is valid.
+ * @retval  HM10_EC_ERR otherwise.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+static HM10_Status validate_hm10_pin(const uint8_t *pin);
+#endif
+
 /**@brief	Gets the corresponding @ref HM10_Status value depending on the given @ref HAL_StatusTypeDef value.
  *
  * @param HAL_status	HAL Status value (see @ref HAL_StatusTypeDef ) that wants to be converted into its equivalent
@@ -117,191 +468,381 @@ static HM10_Status HAL_ret_handler(HAL_StatusTypeDef HAL_status);
 void init_hm10_module(UART_HandleTypeDef *huart)
 {
 	p_huart = huart;
+
+	#if HM10_ACTIVE_TIME_STATS
+		#if HM10_DWT_CYCCNT
+			/* Enable the DWT Cycle Counter, which is used by the default port to measure the active time. */
+			CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+			DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+		#endif
+		reset_hm10_activity_stats();
+	#endif
+
+	#if HM10_UART_RX_DMA
+		/* Start receiving everything from the HM-10 BT Device into the circular DMA buffer. */
+		rx_ring_received = 0;
+		rx_ring_consumed = 0;
+		rx_ring_dma_position = 0;
+		#if HM10_UART_ERROR_RECOVERY
+			rx_errors_added = 0;
+			rx_errors_taken = 0;
+			rx_errors_overflow = 0;
+			rx_ring_restarted = 0;
+		#endif
+		HAL_UARTEx_ReceiveToIdle_DMA(p_huart, rx_ring, HM10_UART_RX_RING_SIZE);
+		#if HM10_UART_ERROR_RECOVERY
+			/* Disable the Error Interrupts of the UART so that its errors do not make the HAL abort the reception. */
+			__HAL_UART_DISABLE_IT(p_huart, UART_IT_ERR);
+			__HAL_UART_DISABLE_IT(p_huart, UART_IT_PE);
+		#endif
+	#endif
+	#if HM10_UART_ERROR_RECOVERY
+		rx_error_flag = 0;
+		reset_hm10_uart_error_stats();
+	#endif
+	#if HM10_UART_TX_QUEUE
+		tx_queue_queued = 0;
+		tx_queue_sent = 0;
+		tx_queue_in_flight = 0;
+	#endif
+	#if HM10_UART_TX_STREAM
+		tx_stream_sizes[0] = 0;
+		tx_stream_sizes[1] = 0;
+		tx_stream_fill = 0;
+		tx_stream_sending = 0;
+		tx_stream_in_flight = 0;
+	#endif
 }
 
-HM10_Status send_hm10_test_cmd()
+void handle_hm10_uart_rx_event(UART_HandleTypeDef *huart, uint16_t size)
 {
-    /** <b>Local variable ret:</b> Return value of either a HAL function or a @ref HM10_Status function type. */
-    int16_t  ret;
+	#if HM10_UART_RX_DMA
+		if (huart != p_huart)
+		{
+			return;
+		}
 
-	/* Flush the UART's RX before starting. */
-	HAL_uart_rx_flush();
+		/* Account for the bytes written by the DMA since the last event, where the Full Event reports the end of the buffer. */
+		/** <b>Local variable position:</b> Position in the @ref rx_ring buffer up to which the DMA has written. */
+		uint16_t position = size & (HM10_UART_RX_RING_SIZE - 1);
+		/** <b>Local variable written:</b> Number of bytes written by the DMA since the last event. */
+		uint16_t written = (uint16_t) (position - rx_ring_dma_position) & (HM10_UART_RX_RING_SIZE - 1);
+		#if HM10_UART_ERROR_RECOVERY
+			if (written != 0)
+			{
+				record_hm10_uart_errors(rx_ring_received, rx_ring_received + written);
+			}
+		#endif
+		rx_ring_received += written;
+		rx_ring_dma_position = position;
+	#else
+		(void) huart;
+		(void) size;
+	#endif
+}
 
-	/* Populate the HM-10 Device's Test Command into the Tx/Rx Buffer. */
-	#if ETX_OTA_VERBOSE
-		printf("Sending Test Command to HM-10 BT Device...\r\n");
+void handle_hm10_uart_error(UART_HandleTypeDef *huart)
+{
+	#if HM10_UART_RX_DMA && HM10_UART_ERROR_RECOVERY
+		if (huart != p_huart)
+		{
+			return;
+		}
+
+		/* Count the errors reported by the HAL and clear the error flags of the UART, which can read its Data Register now that the DMA is stopped. */
+		count_hm10_uart_errors(huart->ErrorCode);
+		__HAL_UART_CLEAR_PEFLAG(huart);
+		huart->ErrorCode = HAL_UART_ERROR_NONE;
+		if (huart->RxState != HAL_UART_STATE_READY)
+		{
+			return;
+		}
+
+		/* Since the restarted reception writes again from the beginning of the circular DMA buffer, move the received count up to the end of the current lap and let the next read discard what was pending. */
+		rx_ring_received = (rx_ring_received + HM10_UART_RX_RING_SIZE - 1) & ~((uint32_t) HM10_UART_RX_RING_SIZE - 1);
+		rx_ring_restart_position = rx_ring_received;
+		rx_ring_restarted = 1;
+		rx_ring_dma_position = 0;
+
+		/* Restart the circular DMA reception. */
+		if (HAL_UARTEx_ReceiveToIdle_DMA(huart, rx_ring, HM10_UART_RX_RING_SIZE) == HAL_OK)
+		{
+			__HAL_UART_DISABLE_IT(huart, UART_IT_ERR);
+			__HAL_UART_DISABLE_IT(huart, UART_IT_PE);
+			uart_error_stats.recoveries++;
+		}
+	#else
+		(void) huart;
 	#endif
-	TxRx_Buffer[0] = 'A';
-	TxRx_Buffer[1] = 'T';
+}
 
-	/* Send the HM-10 Device's Test Command. */
-	ret = HAL_UART_Transmit(p_huart, TxRx_Buffer, HM10_TEST_CMD_SIZE, HM10_CUSTOM_HAL_TIMEOUT);
-	ret = HAL_ret_handler(ret);
-	if (ret != HAL_OK)
+void handle_hm10_uart_tx_complete(UART_HandleTypeDef *huart)
+{
+	#if HM10_UART_TX_QUEUE
+		if ((huart != p_huart) || (tx_queue_in_flight == 0))
+		{
+			return;
+		}
+
+		/* Release the part of the transmit queue that has been sent and start sending the next one. */
+		/** <b>Local variable pending_before:</b> Number of bytes that were pending to be sent before this event. */
+		uint32_t pending_before = tx_queue_queued - tx_queue_sent;
+		tx_queue_sent += tx_queue_in_flight;
+		tx_queue_in_flight = 0;
+		HAL_uart_tx_start_next();
+
+		/* Notify the application if the transmit queue has just drained down to its low watermark. */
+		/** <b>Local variable pending:</b> Number of bytes that are still pending to be sent. */
+		uint32_t pending = tx_queue_queued - tx_queue_sent;
+		if ((tx_watermark_callback != NULL) && (pending_before > HM10_UART_TX_LOW_WATERMARK) && (pending <= HM10_UART_TX_LOW_WATERMARK))
+		{
+			HM10_TRACE_POINT(HM10_Trace_Callback_Dispatch, HM10_UART_TX_QUEUE_SIZE - pending);
+			tx_watermark_callback(HM10_UART_TX_QUEUE_SIZE - pending);
+		}
+	#elif HM10_UART_TX_STREAM
+		if ((huart != p_huart) || !tx_stream_in_flight)
+		{
+			return;
+		}
+
+		/* Free the buffer that has been sent and swap to the other one, which is started right away if it is already filled. */
+		tx_stream_sizes[tx_stream_sending] = 0;
+		tx_stream_sending ^= 1;
+		tx_stream_in_flight = 0;
+		HAL_uart_tx_stream_start_next();
+
+		/* Notify the application that it can fill the freed buffer. */
+		if (tx_stream_callback != NULL)
+		{
+			HM10_TRACE_POINT(HM10_Trace_Callback_Dispatch, tx_stream_sending ^ 1);
+			tx_stream_callback();
+		}
+	#else
+		(void) huart;
+	#endif
+}
+
+void set_hm10_tx_watermark_callback(HM10_TX_Watermark_Callback callback)
+{
+	tx_watermark_callback = callback;
+}
+
+uint16_t get_hm10_tx_queue_free_space()
+{
+	#if HM10_UART_TX_QUEUE
+		return HM10_UART_TX_QUEUE_SIZE - (uint16_t) (tx_queue_queued - tx_queue_sent);
+	#else
+		return 0;
+	#endif
+}
+
+#if HM10_UART_TX_STREAM
+HM10_Status get_hm10_tx_stream_buffer(uint8_t **buffer, uint32_t timeout)
+{
+	/* Wait until the DMA has finished sending the buffer that the application fills next. */
+	/** <b>Local variable tickstart:</b> Time in milliseconds at which this function started waiting. */
+	uint32_t tickstart = p_port->get_tick();
+	while (tx_stream_sizes[tx_stream_fill] != 0)
 	{
-		#if ETX_OTA_VERBOSE
-			printf("ERROR: The transmission of the Test Command to HM-10 BT Device has failed.\r\n");
-		#endif
-		return ret;
+		/** <b>Local variable stalled:</b> Flag that indicates whether the UART failed again to start sending the next buffer. */
+		uint8_t stalled = HAL_uart_tx_stream_retry();
+		if ((p_port->get_tick() - tickstart) >= timeout)
+		{
+			return stalled ? HM10_EC_ERR : HM10_EC_NR;
+		}
+		HAL_wait_for_event();
 	}
+	*buffer = tx_stream_buffers[tx_stream_fill];
 
-	/* Receive the HM-10 Device's Test Response. */
-	ret = HAL_UART_Receive(p_huart, TxRx_Buffer, HM10_OK_RESPONSE_SIZE, HM10_CUSTOM_HAL_TIMEOUT);
-	ret = HAL_ret_handler(ret);
-	if (ret != HAL_OK)
+	return HM10_EC_OK;
+}
+
+HM10_Status send_hm10_tx_stream_buffer(uint16_t size)
+{
+	if ((size == 0) || (size > HM10_UART_TX_STREAM_BUFFER_SIZE) || (tx_stream_sizes[tx_stream_fill] != 0))
 	{
-		#if ETX_OTA_VERBOSE
-			printf("ERROR: An OK Response from the HM-10 BT Device was expected, but none was received (HM-10 Exception code = %d)\r\n", ret);
-		#endif
-		return ret;
+		return HM10_EC_ERR;
+	}
+	HM10_TRACE_POINT(HM10_Trace_Send_Start, size);
+
+	/* Hand the buffer to the DMA and swap to the other one, starting to send it if the DMA is idle. */
+	/** <b>Local variable primask:</b> State of the interrupts before disabling them. */
+	uint32_t primask = __get_PRIMASK();
+	__disable_irq();
+	tx_stream_sizes[tx_stream_fill] = size;
+	tx_stream_fill ^= 1;
+	HAL_uart_tx_stream_start_next();
+	/** <b>Local variable started:</b> Flag that indicates whether the DMA is sending a buffer of the transmit stream. */
+	uint8_t started = tx_stream_in_flight;
+	if (!started)
+	{
+		/* Take the buffer back, since the UART failed to start sending it. */
+		tx_stream_fill ^= 1;
+		tx_stream_sizes[tx_stream_fill] = 0;
 	}
+	__set_PRIMASK(primask);
+	HM10_TRACE_POINT(HM10_Trace_Send_Done, size);
 
-	/* Validate the HM-10 Device's Test Response. */
-	for (int i=0; i<HM10_OK_RESPONSE_SIZE; i++)
+	return started ? HM10_EC_OK : HM10_EC_ERR;
+}
+
+HM10_Status flush_hm10_tx_stream(uint32_t timeout)
+{
+	/** <b>Local variable tickstart:</b> Time in milliseconds at which this function started waiting. */
+	uint32_t tickstart = p_port->get_tick();
+	while ((tx_stream_sizes[0] != 0) || (tx_stream_sizes[1] != 0))
 	{
-		if (TxRx_Buffer[i] != HM10_OK_resp[i])
+		/** <b>Local variable stalled:</b> Flag that indicates whether the UART failed again to start sending the next buffer. */
+		uint8_t stalled = HAL_uart_tx_stream_retry();
+		if ((p_port->get_tick() - tickstart) >= timeout)
 		{
-			#if ETX_OTA_VERBOSE
-				printf("ERROR: An OK Response from the HM-10 BT Device was expected, but something else was received instead.\r\n");
-			#endif
-			return HM10_EC_ERR;
+			return stalled ? HM10_EC_ERR : HM10_EC_NR;
 		}
+		HAL_wait_for_event();
 	}
-	#if ETX_OTA_VERBOSE
-		printf("DONE: A Test Command has been successfully sent to the HM-10 BT Device.\r\n");
-	#endif
 
 	return HM10_EC_OK;
 }
 
-HM10_Status send_hm10_reset_cmd()
+void set_hm10_tx_stream_callback(HM10_TX_Stream_Callback callback)
 {
-	/** <b>Local variable ret:</b> Return value of either a HAL function or a @ref HM10_Status function type. */
-	int16_t  ret;
+	tx_stream_callback = callback;
+}
+#endif
+
+void set_hm10_port(const HM10_Port_def_t *port)
+{
+	p_port = (port != NULL) ? port : &default_port;
+}
 
-    /* Flush the UART's RX before starting. */
-    HAL_uart_rx_flush();
+void reset_hm10_activity_stats()
+{
+	#if HM10_ACTIVE_TIME_STATS
+		activity_start_cycles = p_port->get_cycles();
+		activity_sleep_cycles = 0;
+		activity_sleeps = 0;
+	#endif
+}
 
-	/* Populate the HM-10 Device's Reset Command into the Tx/Rx Buffer. */
+HM10_Status get_hm10_activity_stats(HM10_Activity_Stats *stats)
+{
+	#if HM10_ACTIVE_TIME_STATS
+		/** <b>Local variable elapsed:</b> Number of cycles since the last call to the @ref reset_hm10_activity_stats function. */
+		uint32_t elapsed = p_port->get_cycles() - activity_start_cycles;
+		stats->sleep_cycles = activity_sleep_cycles;
+		stats->active_cycles = elapsed - activity_sleep_cycles;
+		stats->sleeps = activity_sleeps;
+		return HM10_EC_OK;
+	#else
+		(void) stats;
+		return HM10_EC_NA;
+	#endif
+}
+
+uint8_t get_hm10_rx_error_flag()
+{
+	#if HM10_UART_ERROR_RECOVERY
+		/** <b>Local variable flag:</b> Value of the @ref rx_error_flag flag before clearing it. */
+		uint8_t flag = rx_error_flag;
+		rx_error_flag = 0;
+		return flag;
+	#else
+		return 0;
+	#endif
+}
+
+void reset_hm10_uart_error_stats()
+{
+	#if HM10_UART_ERROR_RECOVERY
+		memset(&uart_error_stats, 0, sizeof(uart_error_stats));
+	#endif
+}
+
+HM10_Status get_hm10_uart_error_stats(HM10_UART_Error_Stats *stats)
+{
+	#if HM10_UART_ERROR_RECOVERY
+		*stats = uart_error_stats;
+		return HM10_EC_OK;
+	#else
+		(void) stats;
+		return HM10_EC_NA;
+	#endif
+}
+
+HM10_Status send_hm10_test_cmd()
+{
+    /** <b>Local variable ret:</b> Return value of a @ref HM10_Status function type. */
+    HM10_Status ret;
+
+	/* Send the HM-10 Device's Test Command and validate its Response. */
 	#if ETX_OTA_VERBOSE
-		printf("Sending Reset Command to HM-10 BT Device...\r\n");
+		printf("Sending Test Command to HM-10 BT Device...\r\n");
 	#endif
-	TxRx_Buffer[0] = 'A';
-	TxRx_Buffer[1] = 'T';
-	TxRx_Buffer[2] = '+';
-	TxRx_Buffer[3] = 'R';
-	TxRx_Buffer[4] = 'E';
-	TxRx_Buffer[5] = 'S';
-	TxRx_Buffer[6] = 'E';
-	TxRx_Buffer[7] = 'T';
-
-	/* Send the HM-10 Device's Reset Command. */
-	ret = HAL_UART_Transmit(p_huart, TxRx_Buffer, HM10_RESET_CMD_SIZE, HM10_CUSTOM_HAL_TIMEOUT);
-	ret = HAL_ret_handler(ret);
-	if (ret != HAL_OK)
+	ret = send_hm10_at_cmd(HM10_Test_cmd, HM10_TEST_CMD_SIZE, NULL, 0, HM10_OK_resp, HM10_OK_RESPONSE_SIZE, 0);
+	if (ret != HM10_EC_OK)
 	{
-		#if ETX_OTA_VERBOSE
-			printf("ERROR: The transmission of the Reset Command to HM-10 BT Device has failed.\r\n");
-		#endif
 		return ret;
 	}
+	#if ETX_OTA_VERBOSE
+		printf("DONE: A Test Command has been successfully sent to the HM-10 BT Device.\r\n");
+	#endif
 
-	/* Receive the HM-10 Device's Reset Response. */
-	ret = HAL_UART_Receive(p_huart, TxRx_Buffer, HM10_RESET_RESPONSE_SIZE, HM10_CUSTOM_HAL_TIMEOUT);
-	ret = HAL_ret_handler(ret);
-	if (ret != HAL_OK)
-	{
-		#if ETX_OTA_VERBOSE
-			printf("ERROR: A Reset Response from the HM-10 BT Device was expected, but none was received (HM-10 Exception code = %d)\r\n", ret);
-		#endif
-		return ret;
-	}
+	return HM10_EC_OK;
+}
+
+#if HM10_CMD_RESET
+HM10_Status send_hm10_reset_cmd()
+{
+	/** <b>Local variable ret:</b> Return value of a @ref HM10_Status function type. */
+	HM10_Status ret;
 
-	/* Validate the HM-10 Device's Reset Response. */
-	for (int i=0; i<HM10_RESET_RESPONSE_SIZE; i++)
+	/* Send the HM-10 Device's Reset Command and validate its Response. */
+	#if ETX_OTA_VERBOSE
+		printf("Sending Reset Command to HM-10 BT Device...\r\n");
+	#endif
+	ret = send_hm10_at_cmd(HM10_Reset_cmd, HM10_RESET_CMD_SIZE, NULL, 0, HM10_Reset_resp, HM10_RESET_RESPONSE_SIZE, 0);
+	if (ret != HM10_EC_OK)
 	{
-		if (TxRx_Buffer[i] != HM10_Reset_resp[i])
-		{
-			#if ETX_OTA_VERBOSE
-				printf("ERROR: A Reset Response from the HM-10 BT Device was expected, but something else was received instead.\r\n");
-			#endif
-			return HM10_EC_ERR;
-		}
+		return ret;
 	}
 	#if ETX_OTA_VERBOSE
 		printf("DONE: A Reset Command has been successfully sent to the HM-10 BT Device.\r\n");
 	#endif
 
 	/* Generating Delay to allow the HM-10 BT Device to finish resetting correctly before any other action is request to it. */
-	HAL_Delay(HM10_RESET_AND_RENEW_CMDS_DELAY);
+	HAL_low_power_delay(HM10_RESET_AND_RENEW_CMDS_DELAY);
 
 	return HM10_EC_OK;
 }
+#endif
 
+#if HM10_CMD_RENEW
 HM10_Status send_hm10_renew_cmd()
 {
-    /** <b>Local variable ret:</b> Return value of either a HAL function or a @ref HM10_Status function type. */
-    int16_t  ret;
+    /** <b>Local variable ret:</b> Return value of a @ref HM10_Status function type. */
+    HM10_Status ret;
 
-    /* Flush the UART's RX before starting. */
-    HAL_uart_rx_flush();
-
-    /* Populate the HM-10 Device's Renew Command into the Tx/Rx Buffer. */
+    /* Send the HM-10 Device's Renew Command and validate its Response. */
     #if ETX_OTA_VERBOSE
         printf("Sending Renew Command to HM-10 BT Device...\r\n");
     #endif
-    TxRx_Buffer[0] = 'A';
-    TxRx_Buffer[1] = 'T';
-    TxRx_Buffer[2] = '+';
-    TxRx_Buffer[3] = 'R';
-    TxRx_Buffer[4] = 'E';
-    TxRx_Buffer[5] = 'N';
-    TxRx_Buffer[6] = 'E';
-    TxRx_Buffer[7] = 'W';
-
-    /* Send the HM-10 Device's Renew Command. */
-    ret = HAL_UART_Transmit(p_huart, TxRx_Buffer, HM10_RENEW_CMD_SIZE, HM10_CUSTOM_HAL_TIMEOUT);
-    ret = HAL_ret_handler(ret);
-    if (ret != HAL_OK)
+    ret = send_hm10_at_cmd(HM10_Renew_cmd, HM10_RENEW_CMD_SIZE, NULL, 0, HM10_Renew_resp, HM10_RENEW_RESPONSE_SIZE, 0);
+    if (ret != HM10_EC_OK)
     {
-        #if ETX_OTA_VERBOSE
-            printf("ERROR: The transmission of the Renew Command to HM-10 BT Device has failed.\r\n");
-        #endif
-        return ret;
-    }
-
-    /* Receive the HM-10 Device's Renew Response. */
-    ret = HAL_UART_Receive(p_huart, TxRx_Buffer, HM10_RENEW_RESPONSE_SIZE, HM10_CUSTOM_HAL_TIMEOUT);
-    ret = HAL_ret_handler(ret);
-    if (ret != HAL_OK)
-    {
-        #if ETX_OTA_VERBOSE
-            printf("ERROR: A Renew Response from the HM-10 BT Device was expected, but none was received (HM-10 Exception code = %d)\r\n", ret);
-        #endif
         return ret;
     }
-
-    /* Validate the HM-10 Device's Renew Response. */
-    for (int i=0; i<HM10_RENEW_RESPONSE_SIZE; i++)
-    {
-        if (TxRx_Buffer[i] != HM10_Renew_resp[i])
-        {
-            #if ETX_OTA_VERBOSE
-                printf("ERROR: A Renew Response from the HM-10 BT Device was expected, but something else was received instead.\r\n");
-            #endif
-            return HM10_EC_ERR;
-        }
-    }
 	#if ETX_OTA_VERBOSE
         printf("DONE: A Renew Command has been successfully sent to the HM-10 BT Device.\r\n");
     #endif
 
     /* Generating Delay to allow the HM-10 BT Device to finish renewing correctly before any other action is request to it. */
-    HAL_Delay(HM10_RESET_AND_RENEW_CMDS_DELAY);
+    HAL_low_power_delay(HM10_RESET_AND_RENEW_CMDS_DELAY);
 
     return HM10_EC_OK;
 }
+#endif
 
+#if HM10_CMD_NAME
 HM10_Status set_hm10_name(uint8_t *hm10_name, uint8_t size)
 {
 	/* Validating given name. */
@@ -313,79 +854,26 @@ HM10_Status set_hm10_name(uint8_t *hm10_name, uint8_t size)
 		return HM10_EC_ERR;
 	}
 
-	/** <b>Local variable ret:</b> Return value of either a HAL function or a @ref HM10_Status function type. */
-	int16_t  ret;
-	/** <b>Local variable bytes_populated_in_TxRx_Buffer:</b> Currently populated bytes of data into the Tx/Rx Global Buffer. */
-	uint8_t bytes_populated_in_TxRx_Buffer = 0;
+	/** <b>Local variable ret:</b> Return value of a @ref HM10_Status function type. */
+	HM10_Status ret;
 
-    /* Flush the UART's RX before starting. */
-    HAL_uart_rx_flush();
-
-	/* Populate the HM-10 Device's Set Name Command into the Tx/Rx Buffer. */
+	/* Send the HM-10 Device's Set Name Command and validate the first part of its Response. */
 	#if ETX_OTA_VERBOSE
 		printf("Sending Set Name Command to HM-10 BT Device...\r\n");
 	#endif
-	TxRx_Buffer[bytes_populated_in_TxRx_Buffer++] = 'A';
-	TxRx_Buffer[bytes_populated_in_TxRx_Buffer++] = 'T';
-	TxRx_Buffer[bytes_populated_in_TxRx_Buffer++] = '+';
-	TxRx_Buffer[bytes_populated_in_TxRx_Buffer++] = 'N';
-	TxRx_Buffer[bytes_populated_in_TxRx_Buffer++] = 'A';
-	TxRx_Buffer[bytes_populated_in_TxRx_Buffer++] = 'M';
-	TxRx_Buffer[bytes_populated_in_TxRx_Buffer++] = 'E';
-
-	/** <b>Local variable size_with_offset:</b> Either the total size in bytes stated at the \p size param plus the bytes populated in the Tx/Rx Buffer for only the Name Command, or the total size in bytes stated at the \p size param plus the bytes read from the Tx/Rx Buffer for only the Name Response. */
-	uint8_t size_with_offset = size + bytes_populated_in_TxRx_Buffer;
-	for (uint8_t i=0; bytes_populated_in_TxRx_Buffer<size_with_offset; i++)
-	{
-		TxRx_Buffer[bytes_populated_in_TxRx_Buffer++] = hm10_name[i];
-	}
-
-	/* Send the HM-10 Device's Set Name Command. */
-	ret = HAL_UART_Transmit(p_huart, TxRx_Buffer, bytes_populated_in_TxRx_Buffer, HM10_CUSTOM_HAL_TIMEOUT);
-	ret = HAL_ret_handler(ret);
-	if (ret != HAL_OK)
+	ret = send_hm10_at_cmd(HM10_Name_cmd, HM10_NAME_CMD_SIZE_WITHOUT_VALUE, hm10_name, size, HM10_Set_resp_without_value, HM10_SET_GET_RESPONSE_SIZE_WITHOUT_VALUE, size);
+	if (ret != HM10_EC_OK)
 	{
-		#if ETX_OTA_VERBOSE
-			printf("ERROR: The transmission of the Set Name Command to HM-10 BT Device has failed.\r\n");
-		#endif
 		return ret;
 	}
 
-	/* Receive the HM-10 Device's Set Name Response. */
-	bytes_populated_in_TxRx_Buffer = HM10_SET_NAME_RESPONSE_SIZE_WITHOUT_REQUESTED_NAME + size;
-	ret = HAL_UART_Receive(p_huart, TxRx_Buffer, bytes_populated_in_TxRx_Buffer, HM10_CUSTOM_HAL_TIMEOUT);
-	ret = HAL_ret_handler(ret);
-	if (ret != HAL_OK)
+	/* Validate the BT Name of the HM-10 Device's Set Name Response. */
+	if (memcmp(&TxRx_Buffer[HM10_SET_GET_RESPONSE_SIZE_WITHOUT_VALUE], hm10_name, size) != 0)
 	{
 		#if ETX_OTA_VERBOSE
-			printf("ERROR: A Set Name Response from the HM-10 BT Device was expected, but none was received (HM-10 Exception code = %d)\r\n", ret);
+			printf("ERROR: A Set Name Response from the HM-10 BT Device was expected, but something else was received instead.\r\n");
 		#endif
-		return ret;
-	}
-
-	/* Validate the HM-10 Device's Set Name Response. */
-	/** <b>Local variable bytes_compared:</b> Counter for the bytes that have been compared and validated to match between the received Set Name Response (which should be stored in @ref TxRx_Buffer buffer ) and the expected Set Name Response (i.e., @ref HM10_Set_Name_resp_without_name_value ). */
-	uint8_t bytes_compared = 0;
-	for (; bytes_compared<HM10_SET_NAME_RESPONSE_SIZE_WITHOUT_REQUESTED_NAME; bytes_compared++)
-	{
-		if (TxRx_Buffer[bytes_compared] != HM10_Set_Name_resp_without_name_value[bytes_compared])
-		{
-			#if ETX_OTA_VERBOSE
-				printf("ERROR: A Set Name Response from the HM-10 BT Device was expected, but something else was received instead.\r\n");
-			#endif
-			return HM10_EC_ERR;
-		}
-	}
-	size_with_offset = size + bytes_compared;
-	for (uint8_t i=0; bytes_compared<size_with_offset; i++)
-	{
-		if (TxRx_Buffer[bytes_compared++] != hm10_name[i])
-		{
-			#if ETX_OTA_VERBOSE
-				printf("ERROR: A Set Name Response from the HM-10 BT Device was expected, but something else was received instead.\r\n");
-			#endif
-			return HM10_EC_ERR;
-		}
+		return HM10_EC_ERR;
 	}
 	#if ETX_OTA_VERBOSE
 		printf("DONE: A BT Name has been successfully set in the HM-10 BT Device.\r\n");
@@ -399,64 +887,24 @@ HM10_Status get_hm10_name(uint8_t *hm10_name, uint8_t *size)
 	/** <b>Local variable ret:</b> Return value of either a HAL function or a @ref HM10_Status function type. */
 	int16_t  ret;
 
-    /* Flush the UART's RX before starting. */
-    HAL_uart_rx_flush();
-
-	/* Populate the HM-10 Device's Get Name Command into the Tx/Rx Buffer. */
+	/* Send the HM-10 Device's Get Name Command and validate its Response but just before the BT Name bytes. */
 	#if ETX_OTA_VERBOSE
 		printf("Sending Get Name Command to HM-10 BT Device...\r\n");
 	#endif
-	TxRx_Buffer[0] = 'A';
-	TxRx_Buffer[1] = 'T';
-	TxRx_Buffer[2] = '+';
-	TxRx_Buffer[3] = 'N';
-	TxRx_Buffer[4] = 'A';
-	TxRx_Buffer[5] = 'M';
-	TxRx_Buffer[6] = 'E';
-	TxRx_Buffer[7] = '?';
-
-	/* Send the HM-10 Device's Get Name Command. */
-	ret = HAL_UART_Transmit(p_huart, TxRx_Buffer, HM10_GET_NAME_CMD_SIZE, HM10_CUSTOM_HAL_TIMEOUT);
-	ret = HAL_ret_handler(ret);
-	if (ret != HAL_OK)
-	{
-		#if ETX_OTA_VERBOSE
-			printf("ERROR: The transmission of the Get Name Command to HM-10 BT Device has failed.\r\n");
-		#endif
-		return ret;
-	}
-
-	/* Receive the HM-10 Device's Get Name Response but just before the BT Name bytes. */
-	ret = HAL_UART_Receive(p_huart, TxRx_Buffer, HM10_GET_NAME_RESPONSE_SIZE_WITHOUT_REQUESTED_NAME, HM10_CUSTOM_HAL_TIMEOUT);
-	ret = HAL_ret_handler(ret);
-	if (ret != HAL_OK)
+	ret = send_hm10_at_cmd(HM10_Name_cmd, HM10_NAME_CMD_SIZE_WITHOUT_VALUE, HM10_Query_value, HM10_QUERY_VALUE_SIZE, HM10_Get_Name_resp_without_name_value, HM10_GET_NAME_RESPONSE_SIZE_WITHOUT_REQUESTED_NAME, 0);
+	if (ret != HM10_EC_OK)
 	{
-		#if ETX_OTA_VERBOSE
-			printf("ERROR: A Get Name Response from the HM-10 BT Device was expected, but none was received (HM-10 Exception code = %d)\r\n", ret);
-		#endif
 		return ret;
 	}
 
-	/* Validate the HM-10 Device's Get Name Response part that was just received (i.e., The received data just before the BT Name bytes part). */
-	/** <b>Local variable bytes_populated_in_TxRx_Buffer:</b> Currently populated bytes of data into the Tx/Rx Global Buffer. */
-	uint8_t bytes_populated_in_TxRx_Buffer = 0;
-	for (; bytes_populated_in_TxRx_Buffer<HM10_GET_NAME_RESPONSE_SIZE_WITHOUT_REQUESTED_NAME; bytes_populated_in_TxRx_Buffer++)
-	{
-		if (TxRx_Buffer[bytes_populated_in_TxRx_Buffer] != HM10_Get_Name_resp_without_name_value[bytes_populated_in_TxRx_Buffer])
-		{
-			#if ETX_OTA_VERBOSE
-				printf("ERROR: A Get Name Response from the HM-10 BT Device was expected, but something else was received instead.\r\n");
-			#endif
-			return HM10_EC_ERR;
-		}
-	}
-
 	/* Receive the BT Name bytes part from the HM-10 Device's Get Name Response. */
+	/** <b>Local variable bytes_populated_in_TxRx_Buffer:</b> Currently populated bytes of data into the Tx/Rx Global Buffer. */
+	uint8_t bytes_populated_in_TxRx_Buffer = HM10_GET_NAME_RESPONSE_SIZE_WITHOUT_REQUESTED_NAME;
 	*size = 0;
 	do
 	{
 		/* Receive the next byte from the BT Name. */
-		ret = HAL_UART_Receive(p_huart, &TxRx_Buffer[bytes_populated_in_TxRx_Buffer++], 1, HM10_CUSTOM_HAL_TIMEOUT);
+		ret = HAL_uart_receive(&TxRx_Buffer[bytes_populated_in_TxRx_Buffer++], 1, HM10_CUSTOM_HAL_TIMEOUT);
 		(*size)++;
 		ret = HAL_ret_handler(ret);
 		if (ret != HAL_OK)
@@ -503,7 +951,9 @@ HM10_Status get_hm10_name(uint8_t *hm10_name, uint8_t *size)
 
 	return HM10_EC_OK;
 }
+#endif
 
+#if HM10_CMD_ROLE
 HM10_Status set_hm10_role(HM10_Role ble_role)
 {
 	/* Validating given role. */
@@ -519,69 +969,16 @@ HM10_Status set_hm10_role(HM10_Role ble_role)
 			return HM10_EC_ERR;
 	}
 
-	/** <b>Local variable ret:</b> Return value of either a HAL function or a @ref HM10_Status function type. */
-	int16_t  ret;
-
-    /* Flush the UART's RX before starting. */
-    HAL_uart_rx_flush();
-
-	/* Populate the HM-10 Device's Set Role Command into the Tx/Rx Buffer. */
+	/* Send the HM-10 Device's Set Role Command and validate its Response. */
 	#if ETX_OTA_VERBOSE
 		printf("Sending Set Role Command to HM-10 BT Device...\r\n");
 	#endif
-	TxRx_Buffer[0] = 'A';
-	TxRx_Buffer[1] = 'T';
-	TxRx_Buffer[2] = '+';
-	TxRx_Buffer[3] = 'R';
-	TxRx_Buffer[4] = 'O';
-	TxRx_Buffer[5] = 'L';
-	TxRx_Buffer[6] = 'E';
-	TxRx_Buffer[7] = ble_role;
-
-	/* Send the HM-10 Device's Set Role Command. */
-	ret = HAL_UART_Transmit(p_huart, TxRx_Buffer, HM10_SET_ROLE_CMD_SIZE, HM10_CUSTOM_HAL_TIMEOUT);
-	ret = HAL_ret_handler(ret);
-	if (ret != HAL_OK)
-	{
-		#if ETX_OTA_VERBOSE
-			printf("ERROR: The transmission of the Set Role Command to HM-10 BT Device has failed.\r\n");
-		#endif
-		return ret;
-	}
-
-	/* Receive the HM-10 Device's Set Role Response. */
-	ret = HAL_UART_Receive(p_huart, TxRx_Buffer, HM10_ROLE_RESPONSE_SIZE, HM10_CUSTOM_HAL_TIMEOUT);
-	ret = HAL_ret_handler(ret);
-	if (ret != HAL_OK)
+	/** <b>Local variable ret:</b> Return value of a @ref HM10_Status function type. */
+	HM10_Status ret = set_hm10_single_value(HM10_Role_cmd, ble_role);
+	if (ret != HM10_EC_OK)
 	{
-		#if ETX_OTA_VERBOSE
-			printf("ERROR: A Set Role Response from the HM-10 BT Device was expected, but none was received (HM-10 Exception code = %d)\r\n", ret);
-		#endif
 		return ret;
 	}
-
-	/* Validate the HM-10 Device's Set Role Response. */
-	/** <b>Local variable role_resp_size_without_role_value:</b> Size in bytes of the Role Response from the HM-10 BT device but without considering the length of the requested role value. */
-	uint8_t role_resp_size_without_role_value = HM10_ROLE_RESPONSE_SIZE - 1;
-	/** <b>Local variable bytes_compared:</b> Counter for the bytes that have been compared and validated to match between the received Set Role Response (which should be stored in @ref TxRx_Buffer buffer ) and the expected Set Role Response (i.e., @ref HM10_Set_Role_resp_without_role_value ). */
-	uint8_t bytes_compared = 0;
-	for (; bytes_compared<role_resp_size_without_role_value; bytes_compared++)
-	{
-		if (TxRx_Buffer[bytes_compared] != HM10_Set_Role_resp_without_role_value[bytes_compared])
-		{
-			#if ETX_OTA_VERBOSE
-				printf("ERROR: A Set Role Response from the HM-10 BT Device was expected, but something else was received instead.\r\n");
-			#endif
-			return HM10_EC_ERR;
-		}
-	}
-	if (TxRx_Buffer[bytes_compared] != ble_role)
-	{
-		#if ETX_OTA_VERBOSE
-			printf("ERROR: A Set Role Response from the HM-10 BT Device was expected, but something else was received instead.\r\n");
-		#endif
-		return HM10_EC_ERR;
-	}
 	#if ETX_OTA_VERBOSE
 		printf("DONE: A Role has been successfully set in the HM-10 BT Device.\r\n");
 	#endif
@@ -591,74 +988,32 @@ HM10_Status set_hm10_role(HM10_Role ble_role)
 
 HM10_Status get_hm10_role(HM10_Role *ble_role)
 {
-	/** <b>Local variable ret:</b> Return value of either a HAL function or a @ref HM10_Status function type. */
-	int16_t  ret;
+	/** <b>Local variable ret:</b> Return value of a @ref HM10_Status function type. */
+	HM10_Status ret;
+	/** <b>Local variable value:</b> BT Role value received from the HM-10 BT Device. */
+	uint8_t value;
 
-    /* Flush the UART's RX before starting. */
-    HAL_uart_rx_flush();
-
-    /* Populate the HM-10 Device's Get Role Command into the Tx/Rx Buffer. */
+	/* Send the HM-10 Device's Get Role Command and validate its Response. */
 	#if ETX_OTA_VERBOSE
 		printf("Sending Get Role Command to HM-10 BT Device...\r\n");
 	#endif
-	TxRx_Buffer[0] = 'A';
-	TxRx_Buffer[1] = 'T';
-	TxRx_Buffer[2] = '+';
-	TxRx_Buffer[3] = 'R';
-	TxRx_Buffer[4] = 'O';
-	TxRx_Buffer[5] = 'L';
-	TxRx_Buffer[6] = 'E';
-	TxRx_Buffer[7] = '?';
-
-	/* Send the HM-10 Device's Get Role Command. */
-	ret = HAL_UART_Transmit(p_huart, TxRx_Buffer, HM10_GET_ROLE_CMD_SIZE, HM10_CUSTOM_HAL_TIMEOUT);
-	ret = HAL_ret_handler(ret);
-	if (ret != HAL_OK)
-	{
-		#if ETX_OTA_VERBOSE
-			printf("ERROR: The transmission of the Get Role Command to HM-10 BT Device has failed.\r\n");
-		#endif
-		return ret;
-	}
-
-	/* Receive the HM-10 Device's Get Role Response. */
-	ret = HAL_UART_Receive(p_huart, TxRx_Buffer, HM10_ROLE_RESPONSE_SIZE, HM10_CUSTOM_HAL_TIMEOUT);
-	ret = HAL_ret_handler(ret);
-	if (ret != HAL_OK)
+	ret = get_hm10_single_value(HM10_Role_cmd, &value);
+	if (ret != HM10_EC_OK)
 	{
-		#if ETX_OTA_VERBOSE
-			printf("ERROR: A Get Role Response from the HM-10 BT Device was expected, but none was received (HM-10 Exception code = %d)\r\n", ret);
-		#endif
 		return ret;
 	}
-
-	/* Validate the HM-10 Device's Get Role Response. */
-	/** <b>Local variable role_resp_size_without_role_value:</b> Size in bytes of the Role Response from the HM-10 BT device but without considering the length of the role value. */
-	uint8_t role_resp_size_without_role_value = HM10_ROLE_RESPONSE_SIZE - 1;
-	/** <b>Local variable bytes_compared:</b> Counter for the bytes that have been compared and validated to match between the received Get Role Response (which should be stored in @ref TxRx_Buffer buffer ) and the expected Get Role Response (i.e., @ref HM10_Get_Role_resp_without_role_value ). */
-	uint8_t bytes_compared = 0;
-	for (; bytes_compared<role_resp_size_without_role_value; bytes_compared++)
-	{
-		if (TxRx_Buffer[bytes_compared] != HM10_Get_Role_resp_without_role_value[bytes_compared])
-		{
-			#if ETX_OTA_VERBOSE
-				printf("ERROR: A Get Role Response from the HM-10 BT Device was expected, but something else was received instead.\r\n");
-			#endif
-			return HM10_EC_ERR;
-		}
-	}
-	switch (TxRx_Buffer[bytes_compared])
+	switch (value)
 	{
 		case HM10_Role_Peripheral:
 		case HM10_Role_Central:
 			break;
 		default:
 			#if ETX_OTA_VERBOSE
-				printf("ERROR: Received BT Role %d is not recognized.\r\n", TxRx_Buffer[bytes_compared]);
+				printf("ERROR: Received BT Role %d is not recognized.\r\n", value);
 			#endif
 			return HM10_EC_ERR;
 	}
-	*ble_role = TxRx_Buffer[bytes_compared];
+	*ble_role = value;
 
 	#if ETX_OTA_VERBOSE
 		printf("DONE: The BT Role has been successfully received from the HM-10 BT Device.\r\n");
@@ -666,103 +1021,37 @@ HM10_Status get_hm10_role(HM10_Role *ble_role)
 
 	return HM10_EC_OK;
 }
+#endif
 
+#if HM10_CMD_PIN
 HM10_Status set_hm10_pin(uint8_t *pin)
 {
 	/* Validating given pin. */
-	for (uint8_t current_pin_character=0; current_pin_character<HM10_PIN_VALUE_SIZE; current_pin_character++)
+	if (validate_hm10_pin(pin) != HM10_EC_OK)
 	{
-		switch (pin[current_pin_character])
-		{
-			case Number_0_in_ASCII:
-			case Number_1_in_ASCII:
-			case Number_2_in_ASCII:
-			case Number_3_in_ASCII:
-			case Number_4_in_ASCII:
-			case Number_5_in_ASCII:
-			case Number_6_in_ASCII:
-			case Number_7_in_ASCII:
-			case Number_8_in_ASCII:
-			case Number_9_in_ASCII:
-				break;
-			default:
-				#if ETX_OTA_VERBOSE
-					printf("ERROR: Expected a number character value in ASCII code on given pin value at index %d, but the following ASCII value was given instead: %c.\r\n", current_pin_character, pin[current_pin_character]);
-				#endif
-				return HM10_EC_ERR;
-		}
-	}
-
-	/** <b>Local variable ret:</b> Return value of either a HAL function or a @ref HM10_Status function type. */
-	int16_t  ret;
-	/** <b>Local variable bytes_populated_in_TxRx_Buffer:</b> Currently populated bytes of data into the Tx/Rx Global Buffer. */
-	uint8_t bytes_populated_in_TxRx_Buffer = 0;
+		return HM10_EC_ERR;
+	}
 
-    /* Flush the UART's RX before starting. */
-    HAL_uart_rx_flush();
+	/** <b>Local variable ret:</b> Return value of a @ref HM10_Status function type. */
+	HM10_Status ret;
 
-	/* Populate the HM-10 Device's Set Pin Command into the Tx/Rx Buffer. */
+	/* Send the HM-10 Device's Set Pin Command and validate the first part of its Response. */
 	#if ETX_OTA_VERBOSE
 		printf("Sending Set Pin Command to HM-10 BT Device...\r\n");
 	#endif
-	TxRx_Buffer[bytes_populated_in_TxRx_Buffer++] = 'A';
-	TxRx_Buffer[bytes_populated_in_TxRx_Buffer++] = 'T';
-	TxRx_Buffer[bytes_populated_in_TxRx_Buffer++] = '+';
-	TxRx_Buffer[bytes_populated_in_TxRx_Buffer++] = 'P';
-	TxRx_Buffer[bytes_populated_in_TxRx_Buffer++] = 'A';
-	TxRx_Buffer[bytes_populated_in_TxRx_Buffer++] = 'S';
-    TxRx_Buffer[bytes_populated_in_TxRx_Buffer++] = 'S';
-	for (uint8_t current_pin_character=0; bytes_populated_in_TxRx_Buffer<HM10_SET_PIN_CMD_SIZE; current_pin_character++)
-	{
-		TxRx_Buffer[bytes_populated_in_TxRx_Buffer++] = pin[current_pin_character];
-	}
-
-	/* Send the HM-10 Device's Set Pin Command. */
-	ret = HAL_UART_Transmit(p_huart, TxRx_Buffer, HM10_SET_PIN_CMD_SIZE, HM10_CUSTOM_HAL_TIMEOUT);
-	ret = HAL_ret_handler(ret);
-	if (ret != HAL_OK)
+	ret = send_hm10_at_cmd(HM10_Pin_cmd, HM10_PIN_CMD_SIZE_WITHOUT_VALUE, pin, HM10_PIN_VALUE_SIZE, HM10_Set_resp_without_value, HM10_SET_GET_RESPONSE_SIZE_WITHOUT_VALUE, HM10_PIN_VALUE_SIZE);
+	if (ret != HM10_EC_OK)
 	{
-		#if ETX_OTA_VERBOSE
-			printf("ERROR: The transmission of the Set Pin Command to HM-10 BT Device has failed.\r\n");
-		#endif
 		return ret;
 	}
 
-	/* Receive the HM-10 Device's Set Pin Response. */
-	ret = HAL_UART_Receive(p_huart, TxRx_Buffer, HM10_PIN_RESPONSE_SIZE, HM10_CUSTOM_HAL_TIMEOUT);
-	ret = HAL_ret_handler(ret);
-	if (ret != HAL_OK)
+	/* Validate the BT Pin of the HM-10 Device's Set Pin Response. */
+	if (memcmp(&TxRx_Buffer[HM10_SET_GET_RESPONSE_SIZE_WITHOUT_VALUE], pin, HM10_PIN_VALUE_SIZE) != 0)
 	{
 		#if ETX_OTA_VERBOSE
-			printf("ERROR: A Set Pin Response from the HM-10 BT Device was expected, but none was received (HM-10 Exception code = %d)\r\n", ret);
+			printf("ERROR: A Set Pin Response from the HM-10 BT Device was expected, but something else was received instead.\r\n");
 		#endif
-		return ret;
-	}
-
-	/* Validate the HM-10 Device's Set Pin Response. */
-	/** <b>Local variable pin_resp_size_without_pin_value:</b> Size in bytes of the Pin Response from the HM-10 BT device but without considering the length of the pin value. */
-	uint8_t pin_resp_size_without_pin_value = HM10_PIN_RESPONSE_SIZE - HM10_PIN_VALUE_SIZE;
-	/** <b>Local variable bytes_compared:</b> Counter for the bytes that have been compared and validated to match between the received Set Pin Response (which should be stored in @ref TxRx_Buffer buffer ) and the expected Set Pin Response (i.e., @ref HM10_Set_Pin_resp_without_pin_value ). */
-	uint8_t bytes_compared = 0;
-	for (; bytes_compared<pin_resp_size_without_pin_value; bytes_compared++)
-	{
-		if (TxRx_Buffer[bytes_compared] != HM10_Set_Pin_resp_without_pin_value[bytes_compared])
-		{
-			#if ETX_OTA_VERBOSE
-				printf("ERROR: A Set Pin Response from the HM-10 BT Device was expected, but something else was received instead.\r\n");
-			#endif
-			return HM10_EC_ERR;
-		}
-	}
-	for (uint8_t current_pin_character=0; bytes_compared<HM10_PIN_RESPONSE_SIZE; current_pin_character++)
-	{
-		if (TxRx_Buffer[bytes_compared++] != pin[current_pin_character])
-		{
-			#if ETX_OTA_VERBOSE
-				printf("ERROR: A Set Pin Response from the HM-10 BT Device was expected, but something else was received instead.\r\n");
-			#endif
-			return HM10_EC_ERR;
-		}
+		return HM10_EC_ERR;
 	}
 
 	#if ETX_OTA_VERBOSE
@@ -774,88 +1063,27 @@ HM10_Status set_hm10_pin(uint8_t *pin)
 
 HM10_Status get_hm10_pin(uint8_t *pin)
 {
-	/** <b>Local variable ret:</b> Return value of either a HAL function or a @ref HM10_Status function type. */
-	int16_t  ret;
-
-    /* Flush the UART's RX before starting. */
-    HAL_uart_rx_flush();
+	/** <b>Local variable ret:</b> Return value of a @ref HM10_Status function type. */
+	HM10_Status ret;
 
-	/* Populate the HM-10 Device's Get Pin Command into the Tx/Rx Buffer. */
+	/* Send the HM-10 Device's Get Pin Command and validate the first part of its Response. */
 	#if ETX_OTA_VERBOSE
 		printf("Sending Get Pin Command to HM-10 BT Device...\r\n");
 	#endif
-	TxRx_Buffer[0] = 'A';
-	TxRx_Buffer[1] = 'T';
-	TxRx_Buffer[2] = '+';
-	TxRx_Buffer[3] = 'P';
-	TxRx_Buffer[4] = 'A';
-	TxRx_Buffer[5] = 'S';
-	TxRx_Buffer[6] = 'S';
-	TxRx_Buffer[7] = '?';
-
-	/* Send the HM-10 Device's Get Pin Command. */
-	ret = HAL_UART_Transmit(p_huart, TxRx_Buffer, HM10_GET_PIN_CMD_SIZE, HM10_CUSTOM_HAL_TIMEOUT);
-	ret = HAL_ret_handler(ret);
-	if (ret != HAL_OK)
+	ret = send_hm10_at_cmd(HM10_Pin_cmd, HM10_PIN_CMD_SIZE_WITHOUT_VALUE, HM10_Query_value, HM10_QUERY_VALUE_SIZE, HM10_Get_resp_without_value, HM10_SET_GET_RESPONSE_SIZE_WITHOUT_VALUE, HM10_PIN_VALUE_SIZE);
+	if (ret != HM10_EC_OK)
 	{
-		#if ETX_OTA_VERBOSE
-			printf("ERROR: The transmission of the Get Pin Command to HM-10 BT Device has failed.\r\n");
-		#endif
-		return ret;
-	}
-
-	/* Receive the HM-10 Device's Get Pin Response. */
-	ret = HAL_UART_Receive(p_huart, TxRx_Buffer, HM10_PIN_RESPONSE_SIZE, HM10_CUSTOM_HAL_TIMEOUT);
-	ret = HAL_ret_handler(ret);
-	if (ret != HAL_OK)
-	{
-		#if ETX_OTA_VERBOSE
-			printf("ERROR: A Get Pin Response from the HM-10 BT Device was expected, but none was received (HM-10 Exception code = %d)\r\n", ret);
-		#endif
 		return ret;
 	}
 
-	/* Validate the HM-10 Device's Get Pin Response. */
-	/** <b>Local variable pin_resp_size_without_pin_value:</b> Size in bytes of the Pin Response from the HM-10 BT device but without considering the length of the pin value. */
-	uint8_t pin_resp_size_without_pin_value = HM10_PIN_RESPONSE_SIZE - HM10_PIN_VALUE_SIZE;
-	/** <b>Local variable bytes_compared:</b> Counter for the bytes that have been compared and validated to match between the received Get Pin Response (which should be stored in @ref TxRx_Buffer buffer ) and the expected Get Pin Response (i.e., @ref HM10_Get_Pin_resp_without_pin_value ). */
-	uint8_t bytes_compared = 0;
-	for (; bytes_compared<pin_resp_size_without_pin_value; bytes_compared++)
-	{
-		if (TxRx_Buffer[bytes_compared] != HM10_Get_Pin_resp_without_pin_value[bytes_compared])
-		{
-			#if ETX_OTA_VERBOSE
-				printf("ERROR: A Get Pin Response from the HM-10 BT Device was expected, but something else was received instead.\r\n");
-			#endif
-			return HM10_EC_ERR;
-		}
-	}
-	for (uint8_t current_pin_character=0; current_pin_character<HM10_PIN_VALUE_SIZE; current_pin_character++)
+	/* Validate the BT Pin of the HM-10 Device's Get Pin Response. */
+	if (validate_hm10_pin(&TxRx_Buffer[HM10_SET_GET_RESPONSE_SIZE_WITHOUT_VALUE]) != HM10_EC_OK)
 	{
-		switch (TxRx_Buffer[bytes_compared])
-		{
-			case Number_0_in_ASCII:
-			case Number_1_in_ASCII:
-			case Number_2_in_ASCII:
-			case Number_3_in_ASCII:
-			case Number_4_in_ASCII:
-			case Number_5_in_ASCII:
-			case Number_6_in_ASCII:
-			case Number_7_in_ASCII:
-			case Number_8_in_ASCII:
-			case Number_9_in_ASCII:
-				break;
-			default:
-				#if ETX_OTA_VERBOSE
-					printf("ERROR: Expected a number character value in ASCII code on index %d of TxRx-Buffer, where the following ASCII value was received instead: %c.\r\n", bytes_compared, TxRx_Buffer[bytes_compared]);
-				#endif
-				return HM10_EC_ERR;
-		}
-		bytes_compared++;
+		return HM10_EC_ERR;
 	}
 
 	/* Pass the BT Pin from the Buffer that is storing it into the \p pin param. */
-	memcpy(pin, &TxRx_Buffer[pin_resp_size_without_pin_value], HM10_PIN_VALUE_SIZE);
+	memcpy(pin, &TxRx_Buffer[HM10_SET_GET_RESPONSE_SIZE_WITHOUT_VALUE], HM10_PIN_VALUE_SIZE);
 
 	#if ETX_OTA_VERBOSE
 		printf("DONE: The BT Pin has been successfully received from the HM-10 BT Device.\r\n");
@@ -863,7 +1091,9 @@ HM10_Status get_hm10_pin(uint8_t *pin)
 
 	return HM10_EC_OK;
 }
+#endif
 
+#if HM10_CMD_PIN_CODE_MODE
 HM10_Status set_hm10_pin_code_mode(HM10_Pin_Code_Mode pin_code_mode)
 {
 	/* Validating given pin code mode. */
@@ -879,70 +1109,17 @@ HM10_Status set_hm10_pin_code_mode(HM10_Pin_Code_Mode pin_code_mode)
 			return HM10_EC_ERR;
 	}
 
-	/** <b>Local variable ret:</b> Return value of either a HAL function or a @ref HM10_Status function type. */
-	int16_t  ret;
-
-    /* Flush the UART's RX before starting. */
-    HAL_uart_rx_flush();
-
-	/* Populate the HM-10 Device's Set Type Command into the Tx/Rx Buffer. */
+	/* Send the HM-10 Device's Set Type Command and validate its Response. */
 	#if ETX_OTA_VERBOSE
 		printf("Sending Set Type Command to HM-10 BT Device...\r\n");
 	#endif
-	TxRx_Buffer[0] = 'A';
-	TxRx_Buffer[1] = 'T';
-	TxRx_Buffer[2] = '+';
-	TxRx_Buffer[3] = 'T';
-	TxRx_Buffer[4] = 'Y';
-	TxRx_Buffer[5] = 'P';
-	TxRx_Buffer[6] = 'E';
-	TxRx_Buffer[7] = pin_code_mode;
-
-	/* Send the HM-10 Device's Set Type Command. */
-	ret = HAL_UART_Transmit(p_huart, TxRx_Buffer, HM10_SET_TYPE_CMD_SIZE, HM10_CUSTOM_HAL_TIMEOUT);
-	ret = HAL_ret_handler(ret);
-	if (ret != HAL_OK)
-	{
-		#if ETX_OTA_VERBOSE
-			printf("ERROR: The transmission of the Set Type Command to HM-10 BT Device has failed.\r\n");
-		#endif
-		return ret;
-	}
-
-	/* Receive the HM-10 Device's Set Type Response. */
-	ret = HAL_UART_Receive(p_huart, TxRx_Buffer, HM10_TYPE_RESPONSE_SIZE, HM10_CUSTOM_HAL_TIMEOUT);
-	ret = HAL_ret_handler(ret);
-	if (ret != HAL_OK)
+	/** <b>Local variable ret:</b> Return value of a @ref HM10_Status function type. */
+	HM10_Status ret = set_hm10_single_value(HM10_Type_cmd, pin_code_mode);
+	if (ret != HM10_EC_OK)
 	{
-		#if ETX_OTA_VERBOSE
-			printf("ERROR: A Set Type Response from the HM-10 BT Device was expected, but none was received (HM-10 Exception code = %d)\r\n", ret);
-		#endif
 		return ret;
 	}
 
-	/* Validate the HM-10 Device's Set Type Response. */
-	/** <b>Local variable type_resp_size_without_pin_mode_value:</b> Size in bytes of the Type Response from the HM-10 BT device but without considering the length of the Type value. */
-	uint8_t type_resp_size_without_pin_mode_value = HM10_TYPE_RESPONSE_SIZE - 1;
-	/** <b>Local variable bytes_compared:</b> Counter for the bytes that have been compared and validated to match between the received Set Type Response (which should be stored in @ref TxRx_Buffer buffer ) and the expected Set Type Response (i.e., @ref HM10_Set_Type_resp_without_type_value ). */
-	uint8_t bytes_compared = 0;
-	for (; bytes_compared<type_resp_size_without_pin_mode_value; bytes_compared++)
-	{
-		if (TxRx_Buffer[bytes_compared] != HM10_Set_Type_resp_without_type_value[bytes_compared])
-		{
-			#if ETX_OTA_VERBOSE
-				printf("ERROR: A Set Type Response from the HM-10 BT Device was expected, but something else was received instead at index %d. The received value was %c_ASCII and the expected value is %c_ASCII.\r\n", bytes_compared, TxRx_Buffer[bytes_compared], HM10_Set_Type_resp_without_type_value[bytes_compared]);
-			#endif
-			return HM10_EC_ERR;
-		}
-	}
-	if (TxRx_Buffer[bytes_compared] != pin_code_mode)
-	{
-		#if ETX_OTA_VERBOSE
-		printf("ERROR: A Set Type Response from the HM-10 BT Device was expected, but something else was received instead at index %d. The received value was %c_ASCII and the expected value is %c_ASCII.\r\n", bytes_compared, TxRx_Buffer[bytes_compared], pin_code_mode);
-		#endif
-		return HM10_EC_ERR;
-	}
-
 	#if ETX_OTA_VERBOSE
 		printf("DONE: The desired Pin Code Mode has been successfully set in the HM-10 BT Device.\r\n");
 	#endif
@@ -952,76 +1129,32 @@ HM10_Status set_hm10_pin_code_mode(HM10_Pin_Code_Mode pin_code_mode)
 
 HM10_Status get_hm10_pin_code_mode(HM10_Pin_Code_Mode *pin_code_mode)
 {
-	/** <b>Local variable ret:</b> Return value of either a HAL function or a @ref HM10_Status function type. */
-	int16_t  ret;
+	/** <b>Local variable ret:</b> Return value of a @ref HM10_Status function type. */
+	HM10_Status ret;
+	/** <b>Local variable value:</b> Pin Code Mode value received from the HM-10 BT Device. */
+	uint8_t value;
 
-    /* Flush the UART's RX before starting. */
-    HAL_uart_rx_flush();
-
-	/* Populate the HM-10 Device's Get Type Command into the Tx/Rx Buffer. */
+	/* Send the HM-10 Device's Get Type Command and validate its Response. */
 	#if ETX_OTA_VERBOSE
 		printf("Sending Get Type Command to HM-10 BT Device...\r\n");
 	#endif
-	TxRx_Buffer[0] = 'A';
-	TxRx_Buffer[1] = 'T';
-	TxRx_Buffer[2] = '+';
-	TxRx_Buffer[3] = 'T';
-	TxRx_Buffer[4] = 'Y';
-	TxRx_Buffer[5] = 'P';
-	TxRx_Buffer[6] = 'E';
-	TxRx_Buffer[7] = '?';
-
-	/* Send the HM-10 Device's Get Type Command. */
-	ret = HAL_UART_Transmit(p_huart, TxRx_Buffer, HM10_GET_TYPE_CMD_SIZE, HM10_CUSTOM_HAL_TIMEOUT);
-	ret = HAL_ret_handler(ret);
-	if (ret != HAL_OK)
-	{
-		#if ETX_OTA_VERBOSE
-			printf("ERROR: The transmission of the Get Type Command to HM-10 BT Device has failed.\r\n");
-		#endif
-		return ret;
-	}
-
-	/* Receive the HM-10 Device's Get Type Response. */
-	ret = HAL_UART_Receive(p_huart, TxRx_Buffer, HM10_TYPE_RESPONSE_SIZE, HM10_CUSTOM_HAL_TIMEOUT);
-	ret = HAL_ret_handler(ret);
-	if (ret != HAL_OK)
+	ret = get_hm10_single_value(HM10_Type_cmd, &value);
+	if (ret != HM10_EC_OK)
 	{
-		#if ETX_OTA_VERBOSE
-			printf("ERROR: A Get Type Response from the HM-10 BT Device was expected, but none was received (HM-10 Exception code = %d)\r\n", ret);
-		#endif
 		return ret;
 	}
-
-	/* Validate the HM-10 Device's Get Type Response. */
-	/** <b>Local variable type_resp_size_without_type_value:</b> Size in bytes of the Type Response from the HM-10 BT device but without considering the length of the Type value. */
-	uint8_t type_resp_size_without_type_value = HM10_TYPE_RESPONSE_SIZE - 1;
-	/** <b>Local variable bytes_compared:</b> Counter for the bytes that have been compared and validated to match between the received Get Type Response (which should be stored in @ref TxRx_Buffer buffer ) and the expected Get Type Response (i.e., @ref HM10_Get_Type_resp_without_type_value ). */
-	uint8_t bytes_compared = 0;
-	for (; bytes_compared<type_resp_size_without_type_value; bytes_compared++)
-	{
-		if (TxRx_Buffer[bytes_compared] != HM10_Get_Type_resp_without_type_value[bytes_compared])
-		{
-			#if ETX_OTA_VERBOSE
-				printf("ERROR: A Get Type Response from the HM-10 BT Device was expected, but something else was received instead.\r\n");
-			#endif
-			return HM10_EC_ERR;
-		}
-	}
-	switch (TxRx_Buffer[bytes_compared])
+	switch (value)
 	{
 		case HM10_Pin_Code_DISABLED:
 		case HM10_Pin_Code_ENABLED:
 			break;
 		default:
 			#if ETX_OTA_VERBOSE
-				printf("ERROR: An invalid pin code mode value has been received from the HM-10 BT Device: %c_ASCII.\r\n", TxRx_Buffer[bytes_compared]);
+				printf("ERROR: An invalid pin code mode value has been received from the HM-10 BT Device: %c_ASCII.\r\n", value);
 			#endif
 			return HM10_EC_ERR;
 	}
-
-	/* Pass the BT Pin Code Mode from the Buffer that is storing it into the \p pin_code_mode param. */
-	*pin_code_mode = TxRx_Buffer[type_resp_size_without_type_value];
+	*pin_code_mode = value;
 
 	#if ETX_OTA_VERBOSE
 		printf("DONE: The BT Pin Code Mode has been successfully received from the HM-10 BT Device.\r\n");
@@ -1029,7 +1162,9 @@ HM10_Status get_hm10_pin_code_mode(HM10_Pin_Code_Mode *pin_code_mode)
 
 	return HM10_EC_OK;
 }
+#endif
 
+#if HM10_CMD_MODULE_WORK_MODE
 HM10_Status set_hm10_module_work_mode(HM10_Module_Work_Mode module_work_mode)
 {
     /* Validating given module work mode. */
@@ -1046,69 +1181,17 @@ HM10_Status set_hm10_module_work_mode(HM10_Module_Work_Mode module_work_mode)
             return HM10_EC_ERR;
     }
 
-    /** <b>Local variable ret:</b> Return value of either a HAL function or a @ref HM10_Status function type. */
-    int16_t  ret;
-
-    /* Flush the UART's RX before starting. */
-    HAL_uart_rx_flush();
-
-    /* Populate the HM-10 Device's Set Mode Command into the Tx/Rx Buffer. */
+    /* Send the HM-10 Device's Set Mode Command and validate its Response. */
     #if ETX_OTA_VERBOSE
         printf("Sending Set Mode Command to HM-10 BT Device...\r\n");
     #endif
-    TxRx_Buffer[0] = 'A';
-    TxRx_Buffer[1] = 'T';
-    TxRx_Buffer[2] = '+';
-    TxRx_Buffer[3] = 'M';
-    TxRx_Buffer[4] = 'O';
-    TxRx_Buffer[5] = 'D';
-    TxRx_Buffer[6] = 'E';
-    TxRx_Buffer[7] = module_work_mode;
-
-    /* Send the HM-10 Device's Set Mode Command. */
-    ret = HAL_UART_Transmit(p_huart, TxRx_Buffer, HM10_SET_MODE_CMD_SIZE, HM10_CUSTOM_HAL_TIMEOUT);
-    ret = HAL_ret_handler(ret);
-    if (ret != HAL_OK)
+    /** <b>Local variable ret:</b> Return value of a @ref HM10_Status function type. */
+    HM10_Status ret = set_hm10_single_value(HM10_Mode_cmd, module_work_mode);
+    if (ret != HM10_EC_OK)
     {
-        #if ETX_OTA_VERBOSE
-            printf("ERROR: The transmission of the Set Mode Command to HM-10 BT Device has failed.\r\n");
-        #endif
-        return ret;
-    }
-
-    /* Receive the HM-10 Device's Set Mode Response. */
-    ret = HAL_UART_Receive(p_huart, TxRx_Buffer, HM10_MODE_RESPONSE_SIZE, HM10_CUSTOM_HAL_TIMEOUT);
-    ret = HAL_ret_handler(ret);
-    if (ret != HAL_OK)
-    {
-        #if ETX_OTA_VERBOSE
-            printf("ERROR: A Set Mode Response from the HM-10 BT Device was expected, but none was received (HM-10 Exception code = %d)\r\n", ret);
-        #endif
         return ret;
     }
 
-    /* Validate the HM-10 Device's Set Mode Response. */
-    /** <b>Local variable mode_resp_size_without_module_work_mode_value:</b> Size in bytes of the Mode Response from the HM-10 BT device but without considering the length of the Module Work Mode value. */
-    uint8_t mode_resp_size_without_module_work_mode_value = HM10_MODE_RESPONSE_SIZE - 1;
-    /** <b>Local variable bytes_compared:</b> Counter for the bytes that have been compared and validated to match between the received Set Mode Response (which should be stored in @ref TxRx_Buffer buffer ) and the expected Set Mode Response (i.e., @ref HM10_Set_Mode_resp_without_module_work_mode_value ). */
-    uint8_t bytes_compared = 0;
-    for (; bytes_compared<mode_resp_size_without_module_work_mode_value; bytes_compared++)
-    {
-        if (TxRx_Buffer[bytes_compared] != HM10_Set_Mode_resp_without_module_work_mode_value[bytes_compared])
-        {
-            #if ETX_OTA_VERBOSE
-                printf("ERROR: A Set Mode Response from the HM-10 BT Device was expected, but something else was received instead at index %d. The received value was %c_ASCII and the expected value is %c_ASCII.\r\n", bytes_compared, TxRx_Buffer[bytes_compared], HM10_Set_Mode_resp_without_module_work_mode_value[bytes_compared]);
-            #endif
-            return HM10_EC_ERR;
-        }
-    }
-    if (TxRx_Buffer[bytes_compared] != module_work_mode)
-    {
-        #if ETX_OTA_VERBOSE
-            printf("ERROR: A Set Mode Response from the HM-10 BT Device was expected, but something else was received instead at index %d. The received value was %c_ASCII and the expected value is %c_ASCII.\r\n", bytes_compared, TxRx_Buffer[bytes_compared], module_work_mode);
-        #endif
-        return HM10_EC_ERR;
-    }
     #if ETX_OTA_VERBOSE
         printf("DONE: The desired Module Work Mode has been successfully set in the HM-10 BT Device.\r\n");
     #endif
@@ -1118,63 +1201,21 @@ HM10_Status set_hm10_module_work_mode(HM10_Module_Work_Mode module_work_mode)
 
 HM10_Status get_hm10_module_work_mode(HM10_Module_Work_Mode *module_work_mode)
 {
-    /** <b>Local variable ret:</b> Return value of either a HAL function or a @ref HM10_Status function type. */
-    int16_t  ret;
+    /** <b>Local variable ret:</b> Return value of a @ref HM10_Status function type. */
+    HM10_Status ret;
+    /** <b>Local variable value:</b> Module Work Mode value received from the HM-10 BT Device. */
+    uint8_t value;
 
-    /* Flush the UART's RX before starting. */
-    HAL_uart_rx_flush();
-
-    /* Populate the HM-10 Device's Get Mode Command into the Tx/Rx Buffer. */
+    /* Send the HM-10 Device's Get Mode Command and validate its Response. */
     #if ETX_OTA_VERBOSE
         printf("Sending Get Mode Command to HM-10 BT Device...\r\n");
     #endif
-    TxRx_Buffer[0] = 'A';
-    TxRx_Buffer[1] = 'T';
-    TxRx_Buffer[2] = '+';
-    TxRx_Buffer[3] = 'M';
-    TxRx_Buffer[4] = 'O';
-    TxRx_Buffer[5] = 'D';
-    TxRx_Buffer[6] = 'E';
-    TxRx_Buffer[7] = '?';
-
-    /* Send the HM-10 Device's Get Type Command. */
-    ret = HAL_UART_Transmit(p_huart, TxRx_Buffer, HM10_GET_MODE_CMD_SIZE, HM10_CUSTOM_HAL_TIMEOUT);
-    ret = HAL_ret_handler(ret);
-    if (ret != HAL_OK)
-    {
-        #if ETX_OTA_VERBOSE
-            printf("ERROR: The transmission of the Get Mode Command to HM-10 BT Device has failed.\r\n");
-        #endif
-        return ret;
-    }
-
-    /* Receive the HM-10 Device's Get Mode Response. */
-    ret = HAL_UART_Receive(p_huart, TxRx_Buffer, HM10_MODE_RESPONSE_SIZE, HM10_CUSTOM_HAL_TIMEOUT);
-    ret = HAL_ret_handler(ret);
-    if (ret != HAL_OK)
+    ret = get_hm10_single_value(HM10_Mode_cmd, &value);
+    if (ret != HM10_EC_OK)
     {
-        #if ETX_OTA_VERBOSE
-            printf("ERROR: A Get Mode Response from the HM-10 BT Device was expected, but none was received (HM-10 Exception code = %d)\r\n", ret);
-        #endif
         return ret;
     }
-
-    /* Validate the HM-10 Device's Get Mode Response. */
-    /** <b>Local variable mode_resp_size_without_module_work_mode_value:</b> Size in bytes of the Mode Response from the HM-10 BT device but without considering the length of the Module Work Mode value. */
-    uint8_t mode_resp_size_without_module_work_mode_value = HM10_MODE_RESPONSE_SIZE - 1;
-    /** <b>Local variable bytes_compared:</b> Counter for the bytes that have been compared and validated to match between the received Get Mode Response (which should be stored in @ref TxRx_Buffer buffer ) and the expected Get Mode Response (i.e., @ref HM10_Get_Mode_resp_without_module_work_mode_value ). */
-    uint8_t bytes_compared = 0;
-    for (; bytes_compared<mode_resp_size_without_module_work_mode_value; bytes_compared++)
-    {
-        if (TxRx_Buffer[bytes_compared] != HM10_Get_Mode_resp_without_module_work_mode_value[bytes_compared])
-        {
-            #if ETX_OTA_VERBOSE
-                printf("ERROR: A Get Mode Response from the HM-10 BT Device was expected, but something else was received instead.\r\n");
-            #endif
-            return HM10_EC_ERR;
-        }
-    }
-    switch (TxRx_Buffer[bytes_compared])
+    switch (value)
     {
         case HM10_Transmission_Mode:
         case HM10_PIO_Collection_and_Transmission_Mode:
@@ -1182,13 +1223,11 @@ HM10_Status get_hm10_module_work_mode(HM10_Module_Work_Mode *module_work_mode)
             break;
         default:
             #if ETX_OTA_VERBOSE
-                printf("ERROR: An invalid Module Work Mode value has been received from the HM-10 BT Device: %c_ASCII.\r\n", TxRx_Buffer[bytes_compared]);
+                printf("ERROR: An invalid Module Work Mode value has been received from the HM-10 BT Device: %c_ASCII.\r\n", value);
             #endif
             return HM10_EC_ERR;
     }
-
-    /* Pass the HM-10's Module Work Mode from the Buffer that is storing it into the \p module_work_mode param. */
-    *module_work_mode = TxRx_Buffer[mode_resp_size_without_module_work_mode_value];
+    *module_work_mode = value;
 
     #if ETX_OTA_VERBOSE
         printf("DONE: The Module Work Mode has been successfully received from the HM-10 BT Device.\r\n");
@@ -1196,7 +1235,9 @@ HM10_Status get_hm10_module_work_mode(HM10_Module_Work_Mode *module_work_mode)
 
     return HM10_EC_OK;
 }
+#endif
 
+#if HM10_CMD_MODULE_WORK_TYPE
 HM10_Status set_hm10_module_work_type(HM10_Module_Work_Type module_work_type)
 {
     /* Validating given module work type. */
@@ -1212,69 +1253,17 @@ HM10_Status set_hm10_module_work_type(HM10_Module_Work_Type module_work_type)
             return HM10_EC_ERR;
     }
 
-    /** <b>Local variable ret:</b> Return value of either a HAL function or a @ref HM10_Status function type. */
-    int16_t  ret;
-
-    /* Flush the UART's RX before starting. */
-    HAL_uart_rx_flush();
-
-    /* Populate the HM-10 Device's Set IMME Command into the Tx/Rx Buffer. */
+    /* Send the HM-10 Device's Set IMME Command and validate its Response. */
     #if ETX_OTA_VERBOSE
         printf("Sending Set IMME Command to HM-10 BT Device...\r\n");
     #endif
-    TxRx_Buffer[0] = 'A';
-    TxRx_Buffer[1] = 'T';
-    TxRx_Buffer[2] = '+';
-    TxRx_Buffer[3] = 'I';
-    TxRx_Buffer[4] = 'M';
-    TxRx_Buffer[5] = 'M';
-    TxRx_Buffer[6] = 'E';
-    TxRx_Buffer[7] = module_work_type;
-
-    /* Send the HM-10 Device's Set IMME Command. */
-    ret = HAL_UART_Transmit(p_huart, TxRx_Buffer, HM10_SET_IMME_CMD_SIZE, HM10_CUSTOM_HAL_TIMEOUT);
-    ret = HAL_ret_handler(ret);
-    if (ret != HAL_OK)
-    {
-        #if ETX_OTA_VERBOSE
-            printf("ERROR: The transmission of the Set IMME Command to HM-10 BT Device has failed.\r\n");
-        #endif
-        return ret;
-    }
-
-    /* Receive the HM-10 Device's Set IMME Response. */
-    ret = HAL_UART_Receive(p_huart, TxRx_Buffer, HM10_IMME_RESPONSE_SIZE, HM10_CUSTOM_HAL_TIMEOUT);
-    ret = HAL_ret_handler(ret);
-    if (ret != HAL_OK)
+    /** <b>Local variable ret:</b> Return value of a @ref HM10_Status function type. */
+    HM10_Status ret = set_hm10_single_value(HM10_IMME_cmd, module_work_type);
+    if (ret != HM10_EC_OK)
     {
-        #if ETX_OTA_VERBOSE
-            printf("ERROR: A Set IMME Response from the HM-10 BT Device was expected, but none was received (HM-10 Exception code = %d)\r\n", ret);
-        #endif
         return ret;
     }
 
-    /* Validate the HM-10 Device's Set IMME Response. */
-    /** <b>Local variable imme_resp_size_without_module_work_type_value:</b> Size in bytes of the IMME Response from the HM-10 BT device but without considering the length of the Module Work Type value. */
-    uint8_t imme_resp_size_without_module_work_type_value = HM10_IMME_RESPONSE_SIZE - 1;
-    /** <b>Local variable bytes_compared:</b> Counter for the bytes that have been compared and validated to match between the received Set IMME Response (which should be stored in @ref TxRx_Buffer buffer ) and the expected Set IMME Response (i.e., @ref HM10_Set_IMME_resp_without_module_work_type_value ). */
-    uint8_t bytes_compared = 0;
-    for (; bytes_compared<imme_resp_size_without_module_work_type_value; bytes_compared++)
-    {
-        if (TxRx_Buffer[bytes_compared] != HM10_Set_IMME_resp_without_module_work_type_value[bytes_compared])
-        {
-            #if ETX_OTA_VERBOSE
-                printf("ERROR: A Set IMME Response from the HM-10 BT Device was expected, but something else was received instead at index %d. The received value was %c_ASCII and the expected value is %c_ASCII.\r\n", bytes_compared, TxRx_Buffer[bytes_compared], HM10_Set_IMME_resp_without_module_work_type_value[bytes_compared]);
-            #endif
-            return HM10_EC_ERR;
-        }
-    }
-    if (TxRx_Buffer[bytes_compared] != module_work_type)
-    {
-        #if ETX_OTA_VERBOSE
-            printf("ERROR: A Set IMME Response from the HM-10 BT Device was expected, but something else was received instead at index %d. The received value was %c_ASCII and the expected value is %c_ASCII.\r\n", bytes_compared, TxRx_Buffer[bytes_compared], module_work_type);
-        #endif
-        return HM10_EC_ERR;
-    }
     #if ETX_OTA_VERBOSE
         printf("DONE: The desired Module Work Type has been successfully set in the HM-10 BT Device.\r\n");
     #endif
@@ -1284,83 +1273,42 @@ HM10_Status set_hm10_module_work_type(HM10_Module_Work_Type module_work_type)
 
 HM10_Status get_hm10_module_work_type(HM10_Module_Work_Type *module_work_type)
 {
-    /** <b>Local variable ret:</b> Return value of either a HAL function or a @ref HM10_Status function type. */
-    int16_t  ret;
+    /** <b>Local variable ret:</b> Return value of a @ref HM10_Status function type. */
+    HM10_Status ret;
+    /** <b>Local variable value:</b> Module Work Type value received from the HM-10 BT Device. */
+    uint8_t value;
 
-    /* Flush the UART's RX before starting. */
-    HAL_uart_rx_flush();
-
-    /* Populate the HM-10 Device's Get IMME Command into the Tx/Rx Buffer. */
+    /* Send the HM-10 Device's Get IMME Command and validate its Response. */
     #if ETX_OTA_VERBOSE
         printf("Sending Get IMME Command to HM-10 BT Device...\r\n");
     #endif
-    TxRx_Buffer[0] = 'A';
-    TxRx_Buffer[1] = 'T';
-    TxRx_Buffer[2] = '+';
-    TxRx_Buffer[3] = 'I';
-    TxRx_Buffer[4] = 'M';
-    TxRx_Buffer[5] = 'M';
-    TxRx_Buffer[6] = 'E';
-    TxRx_Buffer[7] = '?';
-
-    /* Send the HM-10 Device's Get IMME Command. */
-    ret = HAL_UART_Transmit(p_huart, TxRx_Buffer, HM10_GET_IMME_CMD_SIZE, HM10_CUSTOM_HAL_TIMEOUT);
-    ret = HAL_ret_handler(ret);
-    if (ret != HAL_OK)
-    {
-        #if ETX_OTA_VERBOSE
-            printf("ERROR: The transmission of the Get IMME Command to HM-10 BT Device has failed.\r\n");
-        #endif
-        return ret;
-    }
-
-    /* Receive the HM-10 Device's Get IMME Response. */
-    ret = HAL_UART_Receive(p_huart, TxRx_Buffer, HM10_IMME_RESPONSE_SIZE, HM10_CUSTOM_HAL_TIMEOUT);
-    ret = HAL_ret_handler(ret);
-    if (ret != HAL_OK)
+    ret = get_hm10_single_value(HM10_IMME_cmd, &value);
+    if (ret != HM10_EC_OK)
     {
-        #if ETX_OTA_VERBOSE
-            printf("ERROR: A Get IMME Response from the HM-10 BT Device was expected, but none was received (HM-10 Exception code = %d)\r\n", ret);
-        #endif
         return ret;
     }
-
-    /* Validate the HM-10 Device's Get IMME Response. */
-    /** <b>Local variable imme_resp_size_without_module_work_type_value:</b> Size in bytes of the IMME Response from the HM-10 BT device but without considering the length of the Module Work Type value. */
-    uint8_t imme_resp_size_without_module_work_type_value = HM10_IMME_RESPONSE_SIZE - 1;
-    /** <b>Local variable bytes_compared:</b> Counter for the bytes that have been compared and validated to match between the received Get IMME Response (which should be stored in @ref TxRx_Buffer buffer ) and the expected Get IMME Response (i.e., @ref HM10_Get_IMME_resp_without_module_work_type_value ). */
-    uint8_t bytes_compared = 0;
-    for (; bytes_compared<imme_resp_size_without_module_work_type_value; bytes_compared++)
-    {
-        if (TxRx_Buffer[bytes_compared] != HM10_Get_IMME_resp_without_module_work_type_value[bytes_compared])
-        {
-            #if ETX_OTA_VERBOSE
-                printf("ERROR: A Get IMME Response from the HM-10 BT Device was expected, but something else was received instead.\r\n");
-            #endif
-            return HM10_EC_ERR;
-        }
-    }
-    switch (TxRx_Buffer[bytes_compared])
+    switch (value)
     {
         case HM10_Module_Work_Type_0:
         case HM10_Module_Work_Type_1:
             break;
         default:
             #if ETX_OTA_VERBOSE
-                printf("ERROR: An invalid Module Work Type value has been received from the HM-10 BT Device: %c_ASCII.\r\n", TxRx_Buffer[bytes_compared]);
+                printf("ERROR: An invalid Module Work Type value has been received from the HM-10 BT Device: %c_ASCII.\r\n", value);
             #endif
             return HM10_EC_ERR;
     }
+    *module_work_type = value;
 
-    /* Pass the HM-10's Module Work Type from the Buffer that is storing it into the \p module_work_type param. */
-    *module_work_type = TxRx_Buffer[imme_resp_size_without_module_work_type_value];
     #if ETX_OTA_VERBOSE
         printf("DONE: The Module Work Type has been successfully received from the HM-10 BT Device.\r\n");
     #endif
 
     return HM10_EC_OK;
 }
+#endif
 
+#if HM10_CMD_NOTIFY_INFORMATION_MODE
 HM10_Status set_hm10_notify_information_mode(HM10_Notify_Information_Mode notify_mode)
 {
     /* Validating given Notify Information Mode. */
@@ -1376,69 +1324,17 @@ HM10_Status set_hm10_notify_information_mode(HM10_Notify_Information_Mode notify
             return HM10_EC_ERR;
     }
 
-    /** <b>Local variable ret:</b> Return value of either a HAL function or a @ref HM10_Status function type. */
-    int16_t  ret;
-
-    /* Flush the UART's RX before starting. */
-    HAL_uart_rx_flush();
-
-    /* Populate the HM-10 Device's Set NOTI Command into the Tx/Rx Buffer. */
+    /* Send the HM-10 Device's Set NOTI Command and validate its Response. */
     #if ETX_OTA_VERBOSE
         printf("Sending Set NOTI Command to HM-10 BT Device...\r\n");
     #endif
-    TxRx_Buffer[0] = 'A';
-    TxRx_Buffer[1] = 'T';
-    TxRx_Buffer[2] = '+';
-    TxRx_Buffer[3] = 'N';
-    TxRx_Buffer[4] = 'O';
-    TxRx_Buffer[5] = 'T';
-    TxRx_Buffer[6] = 'I';
-    TxRx_Buffer[7] = notify_mode;
-
-    /* Send the HM-10 Device's Set NOTI Command. */
-    ret = HAL_UART_Transmit(p_huart, TxRx_Buffer, HM10_SET_NOTI_CMD_SIZE, HM10_CUSTOM_HAL_TIMEOUT);
-    ret = HAL_ret_handler(ret);
-    if (ret != HAL_OK)
-    {
-        #if ETX_OTA_VERBOSE
-            printf("ERROR: The transmission of the Set NOTI Command to HM-10 BT Device has failed.\r\n");
-        #endif
-        return ret;
-    }
-
-    /* Receive the HM-10 Device's Set NOTI Response. */
-    ret = HAL_UART_Receive(p_huart, TxRx_Buffer, HM10_NOTI_RESPONSE_SIZE, HM10_CUSTOM_HAL_TIMEOUT);
-    ret = HAL_ret_handler(ret);
-    if (ret != HAL_OK)
+    /** <b>Local variable ret:</b> Return value of a @ref HM10_Status function type. */
+    HM10_Status ret = set_hm10_single_value(HM10_NOTI_cmd, notify_mode);
+    if (ret != HM10_EC_OK)
     {
-        #if ETX_OTA_VERBOSE
-            printf("ERROR: A Set NOTI Response from the HM-10 BT Device was expected, but none was received (HM-10 Exception code = %d)\r\n", ret);
-        #endif
         return ret;
     }
 
-    /* Validate the HM-10 Device's Set NOTI Response. */
-    /** <b>Local variable noti_resp_size_without_notify_mode_value:</b> Size in bytes of the NOTI Response from the HM-10 BT device but without considering the length of the Notify Information Mode value. */
-    uint8_t noti_resp_size_without_notify_mode_value = HM10_NOTI_RESPONSE_SIZE - 1;
-    /** <b>Local variable bytes_compared:</b> Counter for the bytes that have been compared and validated to match between the received Set NOTI Response (which should be stored in @ref TxRx_Buffer buffer ) and the expected Set NOTI Response (i.e., @ref HM10_Set_NOTI_resp_without_notify_mode_value ). */
-    uint8_t bytes_compared = 0;
-    for (; bytes_compared<noti_resp_size_without_notify_mode_value; bytes_compared++)
-    {
-        if (TxRx_Buffer[bytes_compared] != HM10_Set_NOTI_resp_without_notify_mode_value[bytes_compared])
-        {
-            #if ETX_OTA_VERBOSE
-                printf("ERROR: A Set NOTI Response from the HM-10 BT Device was expected, but something else was received instead at index %d. The received value was %c_ASCII and the expected value is %c_ASCII.\r\n", bytes_compared, TxRx_Buffer[bytes_compared], HM10_Set_NOTI_resp_without_notify_mode_value[bytes_compared]);
-            #endif
-            return HM10_EC_ERR;
-        }
-    }
-    if (TxRx_Buffer[bytes_compared] != notify_mode)
-    {
-        #if ETX_OTA_VERBOSE
-            printf("ERROR: A Set NOTI Response from the HM-10 BT Device was expected, but something else was received instead at index %d. The received value was %c_ASCII and the expected value is %c_ASCII.\r\n", bytes_compared, TxRx_Buffer[bytes_compared], notify_mode);
-        #endif
-        return HM10_EC_ERR;
-    }
     #if ETX_OTA_VERBOSE
         printf("DONE: The desired Notify Information Mode has been successfully set in the HM-10 BT Device.\r\n");
     #endif
@@ -1448,83 +1344,42 @@ HM10_Status set_hm10_notify_information_mode(HM10_Notify_Information_Mode notify
 
 HM10_Status get_hm10_notify_information_mode(HM10_Notify_Information_Mode *notify_mode)
 {
-    /** <b>Local variable ret:</b> Return value of either a HAL function or a @ref HM10_Status function type. */
-    int16_t  ret;
-
-    /* Flush the UART's RX before starting. */
-    HAL_uart_rx_flush();
+    /** <b>Local variable ret:</b> Return value of a @ref HM10_Status function type. */
+    HM10_Status ret;
+    /** <b>Local variable value:</b> Notify Information Mode value received from the HM-10 BT Device. */
+    uint8_t value;
 
-    /* Populate the HM-10 Device's Get NOTI Command into the Tx/Rx Buffer. */
+    /* Send the HM-10 Device's Get NOTI Command and validate its Response. */
     #if ETX_OTA_VERBOSE
         printf("Sending Get NOTI Command to HM-10 BT Device...\r\n");
     #endif
-    TxRx_Buffer[0] = 'A';
-    TxRx_Buffer[1] = 'T';
-    TxRx_Buffer[2] = '+';
-    TxRx_Buffer[3] = 'N';
-    TxRx_Buffer[4] = 'O';
-    TxRx_Buffer[5] = 'T';
-    TxRx_Buffer[6] = 'I';
-    TxRx_Buffer[7] = '?';
-
-    /* Send the HM-10 Device's Get NOTI Command. */
-    ret = HAL_UART_Transmit(p_huart, TxRx_Buffer, HM10_GET_NOTI_CMD_SIZE, HM10_CUSTOM_HAL_TIMEOUT);
-    ret = HAL_ret_handler(ret);
-    if (ret != HAL_OK)
-    {
-        #if ETX_OTA_VERBOSE
-            printf("ERROR: The transmission of the Get NOTI Command to HM-10 BT Device has failed.\r\n");
-        #endif
-        return ret;
-    }
-
-    /* Receive the HM-10 Device's Get NOTI Response. */
-    ret = HAL_UART_Receive(p_huart, TxRx_Buffer, HM10_NOTI_RESPONSE_SIZE, HM10_CUSTOM_HAL_TIMEOUT);
-    ret = HAL_ret_handler(ret);
-    if (ret != HAL_OK)
-    {
-        #if ETX_OTA_VERBOSE
-            printf("ERROR: A Get NOTI Response from the HM-10 BT Device was expected, but none was received (HM-10 Exception code = %d)\r\n", ret);
-        #endif
-        return ret;
-    }
-
-    /* Validate the HM-10 Device's Get NOTI Response. */
-    /** <b>Local variable noti_resp_size_without_notify_mode_value:</b> Size in bytes of the NOTI Response from the HM-10 BT device but without considering the length of the Notify Information Mode value. */
-    uint8_t noti_resp_size_without_notify_mode_value = HM10_NOTI_RESPONSE_SIZE - 1;
-    /** <b>Local variable bytes_compared:</b> Counter for the bytes that have been compared and validated to match between the received Get NOTI Response (which should be stored in @ref TxRx_Buffer buffer ) and the expected Get NOTI Response (i.e., @ref HM10_Get_NOTI_resp_without_notify_mode_value ). */
-    uint8_t bytes_compared = 0;
-    for (; bytes_compared<noti_resp_size_without_notify_mode_value; bytes_compared++)
+    ret = get_hm10_single_value(HM10_NOTI_cmd, &value);
+    if (ret != HM10_EC_OK)
     {
-        if (TxRx_Buffer[bytes_compared] != HM10_Get_NOTI_resp_without_notify_mode_value[bytes_compared])
-        {
-            #if ETX_OTA_VERBOSE
-                printf("ERROR: A Get NOTI Response from the HM-10 BT Device was expected, but something else was received instead.\r\n");
-            #endif
-            return HM10_EC_ERR;
-        }
+        return ret;
     }
-    switch (TxRx_Buffer[bytes_compared])
+    switch (value)
     {
         case HM10_Notify_DISABLED:
         case HM10_Notify_ENABLED:
             break;
         default:
             #if ETX_OTA_VERBOSE
-                printf("ERROR: An invalid Notify Information MOde value has been received from the HM-10 BT Device: %c_ASCII.\r\n", TxRx_Buffer[bytes_compared]);
+                printf("ERROR: An invalid Notify Information Mode value has been received from the HM-10 BT Device: %c_ASCII.\r\n", value);
             #endif
             return HM10_EC_ERR;
     }
+    *notify_mode = value;
 
-    /* Pass the HM-10's Notify Information Mode from the Buffer that is storing it into the \p notify_mode param. */
-    *notify_mode = TxRx_Buffer[noti_resp_size_without_notify_mode_value];
     #if ETX_OTA_VERBOSE
         printf("DONE: The Notify Information Mode has been successfully received from the HM-10 BT Device.\r\n");
     #endif
 
     return HM10_EC_OK;
 }
+#endif
 
+#if HM10_CMD_CONNECTION
 HM10_Status connect_hm10_to_bt_address(HM10_BT_Address_Type bt_addr_t, char bt_addr[12])
 {
     /* Validating given Bluetooth Address Type. */
@@ -1544,73 +1399,32 @@ HM10_Status connect_hm10_to_bt_address(HM10_BT_Address_Type bt_addr_t, char bt_a
 
     /** <b>Local variable ret:</b> Return value of either a HAL function or a @ref HM10_Status function type. */
     int16_t  ret;
+    /** <b>Local variable address:</b> Bluetooth Address Type followed by the Bluetooth Address, as they are sent in the Connect-To-Address Command. */
+    uint8_t address[HM10_CONNECT_TO_ADDRESS_CMD_SIZE - HM10_CONNECT_TO_ADDRESS_CMD_SIZE_WITHOUT_VALUE];
+    address[0] = bt_addr_t;
+    memcpy(&address[1], bt_addr, sizeof(address) - 1);
 
-    /* Flush the UART's RX before starting. */
-    HAL_uart_rx_flush();
-
-    /* Populate the HM-10 Device's Connect-To-Address Command into the Tx/Rx Buffer. */
+    /* Send the HM-10 Device's Connect-To-Address Command and validate the part one of its Response. */
     #if ETX_OTA_VERBOSE
         printf("Sending Connect-To-Address Command to HM-10 BT Device...\r\n");
     #endif
-    TxRx_Buffer[0] = 'A';
-    TxRx_Buffer[1] = 'T';
-    TxRx_Buffer[2] = '+';
-    TxRx_Buffer[3] = 'C';
-    TxRx_Buffer[4] = 'O';
-    TxRx_Buffer[5] = bt_addr_t;
-    TxRx_Buffer[6] = bt_addr[0];
-    TxRx_Buffer[7] = bt_addr[1];
-    TxRx_Buffer[8] = bt_addr[2];
-    TxRx_Buffer[9] = bt_addr[3];
-    TxRx_Buffer[10] = bt_addr[4];
-    TxRx_Buffer[11] = bt_addr[5];
-    TxRx_Buffer[12] = bt_addr[6];
-    TxRx_Buffer[13] = bt_addr[7];
-    TxRx_Buffer[14] = bt_addr[8];
-    TxRx_Buffer[15] = bt_addr[9];
-    TxRx_Buffer[16] = bt_addr[10];
-    TxRx_Buffer[17] = bt_addr[11];
-
-    /* Send the HM-10 Device's Connect-To-Address Command. */
-    ret = HAL_UART_Transmit(p_huart, TxRx_Buffer, HM10_CONNECT_TO_ADDRESS_CMD_SIZE, HM10_CUSTOM_HAL_TIMEOUT);
-    ret = HAL_ret_handler(ret);
-    if (ret != HAL_OK)
+    ret = send_hm10_at_cmd(HM10_Connect_To_Address_cmd, HM10_CONNECT_TO_ADDRESS_CMD_SIZE_WITHOUT_VALUE, address, sizeof(address), HM10_Connect_To_Address_response1_without_value, HM10_CONNECT_TO_ADDRESS_RESPONSE1_SIZE_WITHOUT_VALUE, HM10_CONNECT_TO_ADDRESS_RESPONSE1_SIZE - HM10_CONNECT_TO_ADDRESS_RESPONSE1_SIZE_WITHOUT_VALUE);
+    if (ret != HM10_EC_OK)
     {
-        #if ETX_OTA_VERBOSE
-            printf("ERROR: The transmission of the Connect-To-Address Command to HM-10 BT Device has failed.\r\n");
-        #endif
         return ret;
     }
-
-    /* Receive the part one of the HM-10 Device's Connect-To-Address Response. */
-    ret = HAL_UART_Receive(p_huart, TxRx_Buffer, HM10_CONNECT_TO_ADDRESS_RESPONSE1_SIZE, HM10_CUSTOM_HAL_TIMEOUT);
-    ret = HAL_ret_handler(ret);
-    if (ret != HAL_OK)
+    /** <b>Local variable resp_value:</b> Pointer to the part of the first part of the Connect-To-Address Response that should contain the Bluetooth Address Type twice followed by an 'A' character. */
+    uint8_t *resp_value = &TxRx_Buffer[HM10_CONNECT_TO_ADDRESS_RESPONSE1_SIZE_WITHOUT_VALUE];
+    if ((resp_value[0] != bt_addr_t) || (resp_value[1] != bt_addr_t) || (resp_value[2] != 'A'))
     {
         #if ETX_OTA_VERBOSE
-            printf("ERROR: The part one of the Connect-To-Address Response from the HM-10 BT Device was expected, but none was received (HM-10 Exception code = %d)\r\n", ret);
+            printf("ERROR: The first part of the Connect-To-Address Response from the HM-10 BT Device was expected, but something else was received instead. The received value was %c%c%c_ASCII and the expected value is %c%cA_ASCII.\r\n", resp_value[0], resp_value[1], resp_value[2], bt_addr_t, bt_addr_t);
         #endif
-        return ret;
-    }
-
-    /* Validate the part one of the HM-10 Device's Connect-To-Address Response. */
-    /** <b>Local variable bytes_compared:</b> Counter for the bytes that have been compared and validated to match between the received Connect-To-Address Response (which should be stored in @ref TxRx_Buffer buffer ) and the expected Connect-To-Address Response (i.e., either @ref HM10_Connect_To_Address_response1 or @ref HM10_Connect_To_Address_response2 correspondingly). */
-    uint8_t bytes_compared = 0;
-    HM10_Connect_To_Address_response1[5] = bt_addr_t;
-    HM10_Connect_To_Address_response1[6] = bt_addr_t;
-    for (; bytes_compared<HM10_CONNECT_TO_ADDRESS_RESPONSE1_SIZE; bytes_compared++)
-    {
-        if (TxRx_Buffer[bytes_compared] != HM10_Connect_To_Address_response1[bytes_compared])
-        {
-            #if ETX_OTA_VERBOSE
-                printf("ERROR: The first part of the Connect-To-Address Response from the HM-10 BT Device was expected, but something else was received instead at index %d. The received value was %c_ASCII and the expected value is %c_ASCII.\r\n", bytes_compared, TxRx_Buffer[bytes_compared], HM10_Connect_To_Address_response1[bytes_compared]);
-            #endif
-            return HM10_EC_ERR;
-        }
+        return HM10_EC_ERR;
     }
 
     /* Receive the part two of the HM-10 Device's Connect-To-Address Response. */
-    ret = HAL_UART_Receive(p_huart, TxRx_Buffer, HM10_CONNECT_TO_ADDRESS_RESPONSE2_SIZE, HM10_CONNECT_TO_ADDRESS_TIMEOUT);
+    ret = HAL_uart_receive(TxRx_Buffer, HM10_CONNECT_TO_ADDRESS_RESPONSE2_SIZE, HM10_CONNECT_TO_ADDRESS_TIMEOUT);
     ret = HAL_ret_handler(ret);
     if (ret != HAL_OK)
     {
@@ -1621,17 +1435,14 @@ HM10_Status connect_hm10_to_bt_address(HM10_BT_Address_Type bt_addr_t, char bt_a
     }
 
     /* Validate the part two of the HM-10 Device's Connect-To-Address Response. */
-    bytes_compared = 0;
-    for (; bytes_compared<HM10_CONNECT_TO_ADDRESS_RESPONSE2_SIZE; bytes_compared++)
+    if (memcmp(TxRx_Buffer, HM10_Connect_To_Address_response2, HM10_CONNECT_TO_ADDRESS_RESPONSE2_SIZE) != 0)
     {
-        if (TxRx_Buffer[bytes_compared] != HM10_Connect_To_Address_response2[bytes_compared])
-        {
-            #if ETX_OTA_VERBOSE
-                printf("ERROR: The second part of the Connect-To-Address Response from the HM-10 BT Device was expected, but something else was received instead at index %d. The received value was %c_ASCII and the expected value is %c_ASCII.\r\n", bytes_compared, TxRx_Buffer[bytes_compared], HM10_Connect_To_Address_response2[bytes_compared]);
-            #endif
-            return HM10_EC_ERR;
-        }
+        #if ETX_OTA_VERBOSE
+            printf("ERROR: The second part of the Connect-To-Address Response from the HM-10 BT Device was expected, but something else was received instead.\r\n");
+        #endif
+        return HM10_EC_ERR;
     }
+    HM10_TRACE_POINT(HM10_Trace_Parse_Done, HM10_TRACE_TAG(HM10_Connect_To_Address_response2, HM10_CONNECT_TO_ADDRESS_RESPONSE2_SIZE));
     #if ETX_OTA_VERBOSE
         printf("DONE: The HM-10 BT Device has successfully connected to the remote BT that has the requested BT Address of ");
         for (uint8_t i=0; i<10; i+=2)
@@ -1652,54 +1463,18 @@ HM10_BT_Connection_Status disconnect_hm10_from_bt_address()
     /** <b>Local variable ret:</b> Return value of either a HAL function or a @ref HM10_Status function type. */
     int16_t  ret;
 
-    /* Flush the UART's RX before starting. */
-    HAL_uart_rx_flush();
-
-    /* Populate the HM-10 Device's Lost-Connection Command into the Tx/Rx Buffer. */
+    /* Send the HM-10 Device's Lost-Connection Command and validate the first part of its Response. */
     #if ETX_OTA_VERBOSE
         printf("Sending Lost-Connection Command to HM-10 BT Device...\r\n");
     #endif
-    TxRx_Buffer[0] = 'A';
-    TxRx_Buffer[1] = 'T';
-
-    /* Send the HM-10 Device's Lost-Connection Command. */
-    ret = HAL_UART_Transmit(p_huart, TxRx_Buffer, HM10_TEST_CMD_SIZE, HM10_CUSTOM_HAL_TIMEOUT);
-    ret = HAL_ret_handler(ret);
-    if (ret != HAL_OK)
-    {
-        #if ETX_OTA_VERBOSE
-            printf("ERROR: The transmission of the Lost-Connection Command to HM-10 BT Device has failed.\r\n");
-        #endif
-        return HM10_BT_Connection_Status_Unknown;
-    }
-
-    /* Receive the first part of the HM-10 Device's Lost-Connection Response. */
-    ret = HAL_UART_Receive(p_huart, TxRx_Buffer, HM10_OK_RESPONSE_SIZE, HM10_CUSTOM_HAL_TIMEOUT);
-    ret = HAL_ret_handler(ret);
-    if (ret != HAL_OK)
+    ret = send_hm10_at_cmd(HM10_Test_cmd, HM10_TEST_CMD_SIZE, NULL, 0, HM10_OK_LOST_resp, HM10_OK_RESPONSE_SIZE, 0);
+    if (ret != HM10_EC_OK)
     {
-        #if ETX_OTA_VERBOSE
-            printf("ERROR: The first part of the Lost-Connection Response from the HM-10 BT Device was expected, but none was received (HM-10 Exception code = %d)\r\n", ret);
-        #endif
         return HM10_BT_Connection_Status_Unknown;
     }
 
-    /* Validate the first part of the HM-10 Device's Lost-Connection Response. */
-    /** <b>Local variable bytes_compared:</b> Counter for the bytes that have been compared and validated to match between the received Connection-Lost Response (which should be stored in @ref TxRx_Buffer buffer ) and the expected Connection-Lost Response (i.e., @ref HM10_OK_LOST_resp ). */
-    uint8_t bytes_compared = 0;
-    for ( ; bytes_compared<HM10_OK_RESPONSE_SIZE; bytes_compared++)
-    {
-        if (TxRx_Buffer[bytes_compared] != HM10_OK_LOST_resp[bytes_compared])
-        {
-            #if ETX_OTA_VERBOSE
-                printf("ERROR: The first part of the Lost-Connection Response from the HM-10 BT Device was expected, but something else was received instead.\r\n");
-            #endif
-            return HM10_BT_Connection_Status_Unknown;
-        }
-    }
-
     /* Receive the second part of the HM-10 Device's Lost-Connection Response. */
-    ret = HAL_UART_Receive(p_huart, &TxRx_Buffer[bytes_compared], HM10_OK_LOST_RESPONSE_SIZE_WITHOUT_THE_OK_PART, HM10_CUSTOM_HAL_TIMEOUT);
+    ret = HAL_uart_receive(&TxRx_Buffer[HM10_OK_RESPONSE_SIZE], HM10_OK_LOST_RESPONSE_SIZE_WITHOUT_THE_OK_PART, HM10_CUSTOM_HAL_TIMEOUT);
     ret = HAL_ret_handler(ret);
     if (ret != HAL_OK)
     {
@@ -1720,22 +1495,21 @@ HM10_BT_Connection_Status disconnect_hm10_from_bt_address()
     }
 
     /* Validate the second part of the HM-10 Device's Lost-Connection Response. */
-    for ( ; bytes_compared<HM10_OK_LOST_RESPONSE_SIZE; bytes_compared++)
+    if (memcmp(&TxRx_Buffer[HM10_OK_RESPONSE_SIZE], &HM10_OK_LOST_resp[HM10_OK_RESPONSE_SIZE], HM10_OK_LOST_RESPONSE_SIZE_WITHOUT_THE_OK_PART) != 0)
     {
-        if (TxRx_Buffer[bytes_compared] != HM10_OK_LOST_resp[bytes_compared])
-        {
-            #if ETX_OTA_VERBOSE
-                printf("ERROR: The second part of the Lost-Connection Response from the HM-10 BT Device was expected, but something else was received instead.\r\n");
-            #endif
-            return HM10_BT_Connection_Status_Unknown;
-        }
+        #if ETX_OTA_VERBOSE
+            printf("ERROR: The second part of the Lost-Connection Response from the HM-10 BT Device was expected, but something else was received instead.\r\n");
+        #endif
+        return HM10_BT_Connection_Status_Unknown;
     }
+    HM10_TRACE_POINT(HM10_Trace_Parse_Done, HM10_TRACE_TAG(HM10_OK_LOST_resp, HM10_OK_LOST_RESPONSE_SIZE_WITHOUT_THE_OK_PART + HM10_OK_RESPONSE_SIZE));
     #if ETX_OTA_VERBOSE
         printf("DONE: The HM-10 Device has been disconnected from an on-going Bluetooth Connection.\r\n");
     #endif
 
     return HM10_BT_Connection_Lost;
 }
+#endif
 
 HM10_Status send_hm10_ota_data(uint8_t *ble_ota_data, uint16_t size, uint32_t timeout)
 {
@@ -1743,7 +1517,7 @@ HM10_Status send_hm10_ota_data(uint8_t *ble_ota_data, uint16_t size, uint32_t ti
 	int16_t  ret;
 
 	/* Send the requested data Over the Air (OTA) via the HM-10 BT Device. */
-	ret = HAL_UART_Transmit(p_huart, ble_ota_data, size, timeout);
+	ret = HAL_uart_transmit(ble_ota_data, size, timeout);
 	ret = HAL_ret_handler(ret);
 
 	return ret;
@@ -1755,7 +1529,7 @@ HM10_Status get_hm10_ota_data(uint8_t *ble_ota_data, uint16_t size, uint32_t tim
 	int16_t  ret;
 
 	/* Receive the HM-10 Device's BT data that is received Over the Air (OTA), if there is any. */
-	ret = HAL_UART_Receive(p_huart, ble_ota_data, size, timeout);
+	ret = HAL_uart_receive(ble_ota_data, size, timeout);
 	ret = HAL_ret_handler(ret);
 
 	return ret;
@@ -1763,17 +1537,553 @@ HM10_Status get_hm10_ota_data(uint8_t *ble_ota_data, uint16_t size, uint32_t tim
 
 static void HAL_uart_rx_flush()
 {
-	/** <b>Local variable ret:</b> Return value of either a HAL function type. */
-	HAL_StatusTypeDef  ret;
+	#if HM10_UART_RX_DMA
+		/* Account for the bytes that the DMA has written since its last event and discard everything that is pending. */
+		/** <b>Local variable primask:</b> State of the interrupts before disabling them. */
+		uint32_t primask = __get_PRIMASK();
+		__disable_irq();
+		handle_hm10_uart_rx_event(p_huart, HM10_UART_RX_RING_SIZE - __HAL_DMA_GET_COUNTER(p_huart->hdmarx));
+		rx_ring_consumed = rx_ring_received;
+		#if HM10_UART_ERROR_RECOVERY
+			rx_errors_taken = rx_errors_added;
+			rx_errors_overflow = 0;
+			rx_ring_restarted = 0;
+		#endif
+		__set_PRIMASK(primask);
+	#else
+		/* Drain the Data Register of the UART, with a bounded number of reads in case that the line keeps receiving data. */
+		for (uint8_t reads=0; (reads<HM10_MAX_AT_COMMAND_SIZE) && __HAL_UART_GET_FLAG(p_huart, UART_FLAG_RXNE); reads++)
+		{
+			(void) __HAL_UART_FLUSH_DRREGISTER(p_huart);
+		}
 
-	/* Receive the HM-10 Device's BT data that is received Over the Air (OTA), if there is any. */
-	ret = HAL_UART_Receive(p_huart, TxRx_Buffer, 1, HM10_CUSTOM_HAL_TIMEOUT);
-	if (ret != HAL_TIMEOUT)
+		/* Clear the Overrun Error that the bytes received while nobody was reading may have caused. */
+		if (__HAL_UART_GET_FLAG(p_huart, UART_FLAG_ORE))
+		{
+			__HAL_UART_CLEAR_OREFLAG(p_huart);
+		}
+	#endif
+}
+
+static HAL_StatusTypeDef HAL_uart_receive(uint8_t *data, uint16_t size, uint32_t timeout)
+{
+	#if HM10_UART_RX_DMA
+		/** <b>Local variable tickstart:</b> Time in milliseconds at which this function started waiting. */
+		uint32_t tickstart = p_port->get_tick();
+
+		/* Wait until the requested bytes are available in the circular DMA buffer. */
+		/** <b>Local variable available:</b> Number of bytes that are pending to be read from the @ref rx_ring buffer. */
+		uint32_t available;
+		#if HM10_TRACE
+			/** <b>Local variable first_available:</b> Number of bytes that were pending to be read when the first of them was seen, or \c 0 if none has been seen yet. */
+			uint32_t first_available = 0;
+		#endif
+		while ((available = HAL_uart_rx_available()) < size)
+		{
+			#if HM10_TRACE
+				if ((first_available == 0) && (available != 0))
+				{
+					first_available = available;
+					HM10_TRACE_POINT(HM10_Trace_First_RX_Byte, available);
+				}
+			#endif
+			if ((p_port->get_tick() - tickstart) >= timeout)
+			{
+				return HAL_TIMEOUT;
+			}
+			HAL_wait_for_event();
+		}
+		#if HM10_TRACE
+			if (first_available == 0)
+			{
+				HM10_TRACE_POINT(HM10_Trace_First_RX_Byte, available);
+			}
+		#endif
+
+		/* If the DMA has overwritten bytes that were not read yet, then discard everything that was received so far. */
+		if (available > HM10_UART_RX_RING_SIZE)
+		{
+			#if HM10_UART_ERROR_RECOVERY
+				HAL_uart_rx_flush();
+				rx_error_flag = 1;
+			#else
+				rx_ring_consumed = rx_ring_received;
+			#endif
+			return HAL_ERROR;
+		}
+
+		/* Copy the requested bytes out of the circular DMA buffer, which may have to be done in two parts. */
+		/** <b>Local variable tail:</b> Position in the @ref rx_ring buffer from which the requested bytes are read. */
+		uint16_t tail = rx_ring_consumed & (HM10_UART_RX_RING_SIZE - 1);
+		/** <b>Local variable first_part:</b> Number of the requested bytes that are located before the end of the @ref rx_ring buffer. */
+		uint16_t first_part = HM10_UART_RX_RING_SIZE - tail;
+		if (first_part > size)
+		{
+			first_part = size;
+		}
+		memcpy(data, &rx_ring[tail], first_part);
+		memcpy(&data[first_part], rx_ring, size - first_part);
+
+		#if HM10_UART_ERROR_RECOVERY
+			/* Flag this read if it returned any of the bytes that may have been affected by a UART error, and forget the errors whose bytes have all been read. */
+			/** <b>Local variable index:</b> Index of the @ref rx_error_starts and @ref rx_error_ends buffers of the oldest UART error that has not been read past. */
+			uint8_t index;
+			while (rx_errors_taken != rx_errors_added)
+			{
+				index = rx_errors_taken & (HM10_UART_RX_ERROR_RECORDS - 1);
+				if ((int32_t) (rx_error_starts[index] - (rx_ring_consumed + size)) >= 0)
+				{
+					break;
+				}
+				rx_error_flag = 1;
+				if ((int32_t) (rx_error_ends[index] - (rx_ring_consumed + size)) > 0)
+				{
+					break;
+				}
+				rx_errors_taken++;
+			}
+			if (rx_errors_overflow)
+			{
+				rx_errors_overflow = 0;
+				rx_error_flag = 1;
+			}
+		#endif
+		rx_ring_consumed += size;
+		HM10_TRACE_POINT(HM10_Trace_Last_RX_Byte, size);
+
+		return HAL_OK;
+	#else
+		#if HM10_TRACE
+			/* Receive the first byte on its own so that its arrival can be traced, and then the rest of the bytes within what is left of the timeout. */
+			/** <b>Local variable tickstart:</b> Time in milliseconds at which this function started waiting. */
+			uint32_t tickstart = p_port->get_tick();
+			/** <b>Local variable ret:</b> Return value of the HAL_UART_Receive() function. */
+			HAL_StatusTypeDef ret = HAL_UART_Receive(p_huart, data, 1, timeout);
+			if (ret == HAL_OK)
+			{
+				HM10_TRACE_POINT(HM10_Trace_First_RX_Byte, 1);
+				/** <b>Local variable elapsed:</b> Time in milliseconds that has been waited for the first byte. */
+				uint32_t elapsed = p_port->get_tick() - tickstart;
+				if (size > 1)
+				{
+					ret = HAL_UART_Receive(p_huart, &data[1], size - 1, (elapsed < timeout) ? (timeout - elapsed) : 0);
+				}
+				if (ret == HAL_OK)
+				{
+					HM10_TRACE_POINT(HM10_Trace_Last_RX_Byte, size);
+				}
+			}
+		#else
+			/** <b>Local variable ret:</b> Return value of the HAL_UART_Receive() function. */
+			HAL_StatusTypeDef ret = HAL_UART_Receive(p_huart, data, size, timeout);
+		#endif
+		#if HM10_UART_ERROR_RECOVERY
+			/* Count and clear the errors that made the reception fail, so that they do not also affect the next one. */
+			/** <b>Local variable error_code:</b> Errors reported by the HAL and flagged by the UART. */
+			uint32_t error_code;
+			if ((ret != HAL_OK) && ((error_code = p_huart->ErrorCode | get_hm10_uart_error_flags()) != HAL_UART_ERROR_NONE))
+			{
+				count_hm10_uart_errors(error_code);
+				__HAL_UART_CLEAR_PEFLAG(p_huart);
+				p_huart->ErrorCode = HAL_UART_ERROR_NONE;
+				rx_error_flag = 1;
+			}
+		#endif
+		return ret;
+	#endif
+}
+
+#if HM10_UART_RX_DMA
+static uint32_t HAL_uart_rx_available()
+{
+	#if HM10_UART_ERROR_RECOVERY
+		/** <b>Local variable primask:</b> State of the interrupts before disabling them. */
+		uint32_t primask = __get_PRIMASK();
+		__disable_irq();
+		if (rx_ring_restarted)
+		{
+			/* Discard the bytes that were pending to be read when the DMA reception was restarted. */
+			rx_ring_consumed = rx_ring_restart_position;
+			rx_errors_taken = rx_errors_added;
+			rx_ring_restarted = 0;
+			rx_error_flag = 1;
+		}
+		/** <b>Local variable available:</b> Number of bytes that are pending to be read from the @ref rx_ring buffer. */
+		uint32_t available = rx_ring_received - rx_ring_consumed;
+		__set_PRIMASK(primask);
+		return available;
+	#else
+		return rx_ring_received - rx_ring_consumed;
+	#endif
+}
+#endif
+
+#if HM10_UART_ERROR_RECOVERY
+static uint32_t get_hm10_uart_error_flags()
+{
+	/** <b>Local variable error_code:</b> Errors flagged by the UART. */
+	uint32_t error_code = HAL_UART_ERROR_NONE;
+	if (__HAL_UART_GET_FLAG(p_huart, UART_FLAG_ORE))
+	{
+		error_code |= HAL_UART_ERROR_ORE;
+	}
+	if (__HAL_UART_GET_FLAG(p_huart, UART_FLAG_NE))
+	{
+		error_code |= HAL_UART_ERROR_NE;
+	}
+	if (__HAL_UART_GET_FLAG(p_huart, UART_FLAG_FE))
+	{
+		error_code |= HAL_UART_ERROR_FE;
+	}
+	if (__HAL_UART_GET_FLAG(p_huart, UART_FLAG_PE))
+	{
+		error_code |= HAL_UART_ERROR_PE;
+	}
+	return error_code;
+}
+
+static void count_hm10_uart_errors(uint32_t error_code)
+{
+	if (error_code & HAL_UART_ERROR_ORE)
+	{
+		uart_error_stats.overrun++;
+	}
+	if (error_code & HAL_UART_ERROR_NE)
+	{
+		uart_error_stats.noise++;
+	}
+	if (error_code & HAL_UART_ERROR_FE)
+	{
+		uart_error_stats.framing++;
+	}
+	if (error_code & HAL_UART_ERROR_PE)
+	{
+		uart_error_stats.parity++;
+	}
+	if (error_code & HAL_UART_ERROR_DMA)
+	{
+		uart_error_stats.dma++;
+	}
+}
+#endif
+
+#if HM10_UART_RX_DMA && HM10_UART_ERROR_RECOVERY
+static void record_hm10_uart_errors(uint32_t start, uint32_t end)
+{
+	/** <b>Local variable error_code:</b> Errors flagged by the UART. */
+	uint32_t error_code = get_hm10_uart_error_flags();
+	if (error_code == HAL_UART_ERROR_NONE)
+	{
+		return;
+	}
+	count_hm10_uart_errors(error_code);
+
+	/* Record the bytes that may have been affected, or make the next read be flagged if there is no room for them. */
+	if ((uint8_t) (rx_errors_added - rx_errors_taken) < HM10_UART_RX_ERROR_RECORDS)
+	{
+		/** <b>Local variable index:</b> Index of the @ref rx_error_starts and @ref rx_error_ends buffers into which the error is recorded. */
+		uint8_t index = rx_errors_added & (HM10_UART_RX_ERROR_RECORDS - 1);
+		rx_error_starts[index] = start;
+		rx_error_ends[index] = end;
+		rx_errors_added++;
+	}
+	else
+	{
+		rx_errors_overflow = 1;
+	}
+}
+#endif
+
+static HAL_StatusTypeDef HAL_uart_transmit(uint8_t *data, uint16_t size, uint32_t timeout)
+{
+	HM10_TRACE_POINT(HM10_Trace_Send_Start, size);
+	#if HM10_UART_TX_QUEUE
+		if (size > HM10_UART_TX_QUEUE_SIZE)
+		{
+			return HAL_ERROR;
+		}
+
+		/* Wait until there is enough free space in the transmit queue. */
+		/** <b>Local variable tickstart:</b> Time in milliseconds at which this function started waiting. */
+		uint32_t tickstart = p_port->get_tick();
+		while ((HM10_UART_TX_QUEUE_SIZE - (tx_queue_queued - tx_queue_sent)) < size)
+		{
+			/** <b>Local variable stalled:</b> Flag that indicates whether the UART failed again to start sending the transmit queue. */
+			uint8_t stalled = HAL_uart_tx_retry();
+			if ((p_port->get_tick() - tickstart) >= timeout)
+			{
+				return stalled ? HAL_ERROR : HAL_TIMEOUT;
+			}
+			HAL_wait_for_event();
+		}
+
+		/* Copy the requested bytes into the transmit queue, which may have to be done in two parts. */
+		/** <b>Local variable head:</b> Position in the @ref tx_queue buffer into which the requested bytes are written. */
+		uint16_t head = tx_queue_queued & (HM10_UART_TX_QUEUE_SIZE - 1);
+		/** <b>Local variable first_part:</b> Number of the requested bytes that fit before the end of the @ref tx_queue buffer. */
+		uint16_t first_part = HM10_UART_TX_QUEUE_SIZE - head;
+		if (first_part > size)
+		{
+			first_part = size;
+		}
+		memcpy(&tx_queue[head], data, first_part);
+		memcpy(tx_queue, &data[first_part], size - first_part);
+
+		/* Publish the queued bytes and start sending them if the UART is idle. */
+		/** <b>Local variable primask:</b> State of the interrupts before disabling them. */
+		uint32_t primask = __get_PRIMASK();
+		__disable_irq();
+		tx_queue_queued += size;
+		HAL_uart_tx_start_next();
+		__set_PRIMASK(primask);
+		HM10_TRACE_POINT(HM10_Trace_Send_Done, size);
+
+		return HAL_uart_tx_retry() ? HAL_ERROR : HAL_OK;
+	#else
+		#if HM10_UART_TX_STREAM
+			/* Wait until the DMA has finished sending the transmit stream, since the UART can only send one thing at a time. */
+			/** <b>Local variable flush_ret:</b> Return value of the @ref flush_hm10_tx_stream function. */
+			HM10_Status flush_ret = flush_hm10_tx_stream(timeout);
+			if (flush_ret != HM10_EC_OK)
+			{
+				return (flush_ret == HM10_EC_ERR) ? HAL_ERROR : HAL_TIMEOUT;
+			}
+		#endif
+		/** <b>Local variable ret:</b> Return value of the HAL_UART_Transmit() function. */
+		HAL_StatusTypeDef ret = HAL_UART_Transmit(p_huart, data, size, timeout);
+		HM10_TRACE_POINT(HM10_Trace_Send_Done, size);
+		return ret;
+	#endif
+}
+
+#if HM10_UART_TX_QUEUE
+static void HAL_uart_tx_start_next()
+{
+	/** <b>Local variable pending:</b> Number of bytes that are pending to be sent. */
+	uint32_t pending = tx_queue_queued - tx_queue_sent;
+	if ((tx_queue_in_flight != 0) || (pending == 0))
+	{
+		return;
+	}
+
+	/* Send up to the end of the transmit queue, since the UART can only send contiguous bytes. */
+	/** <b>Local variable tail:</b> Position in the @ref tx_queue buffer of the next byte to be sent. */
+	uint16_t tail = tx_queue_sent & (HM10_UART_TX_QUEUE_SIZE - 1);
+	/** <b>Local variable size:</b> Number of bytes that will be sent in this part. */
+	uint16_t size = HM10_UART_TX_QUEUE_SIZE - tail;
+	if (size > pending)
+	{
+		size = pending;
+	}
+	tx_queue_in_flight = size;
+	#if HM10_UART_TX_QUEUE_DMA
+		if (HAL_UART_Transmit_DMA(p_huart, &tx_queue[tail], size) != HAL_OK)
+	#else
+		if (HAL_UART_Transmit_IT(p_huart, &tx_queue[tail], size) != HAL_OK)
+	#endif
+	{
+		tx_queue_in_flight = 0;
+	}
+}
+
+static uint8_t HAL_uart_tx_retry()
+{
+	/** <b>Local variable primask:</b> State of the interrupts before disabling them. */
+	uint32_t primask = __get_PRIMASK();
+	__disable_irq();
+	HAL_uart_tx_start_next();
+	/** <b>Local variable stalled:</b> Flag that indicates whether the UART failed again to start sending the transmit queue. */
+	uint8_t stalled = (tx_queue_in_flight == 0) && (tx_queue_queued != tx_queue_sent);
+	__set_PRIMASK(primask);
+
+	return stalled;
+}
+#endif
+
+#if HM10_UART_TX_STREAM
+static void HAL_uart_tx_stream_start_next()
+{
+	if (tx_stream_in_flight || (tx_stream_sizes[tx_stream_sending] == 0))
+	{
+		return;
+	}
+
+	tx_stream_in_flight = 1;
+	if (HAL_UART_Transmit_DMA(p_huart, tx_stream_buffers[tx_stream_sending], tx_stream_sizes[tx_stream_sending]) != HAL_OK)
+	{
+		tx_stream_in_flight = 0;
+	}
+}
+
+static uint8_t HAL_uart_tx_stream_retry()
+{
+	/** <b>Local variable primask:</b> State of the interrupts before disabling them. */
+	uint32_t primask = __get_PRIMASK();
+	__disable_irq();
+	HAL_uart_tx_stream_start_next();
+	/** <b>Local variable stalled:</b> Flag that indicates whether the UART failed again to start sending the next buffer. */
+	uint8_t stalled = !tx_stream_in_flight && (tx_stream_sizes[tx_stream_sending] != 0);
+	__set_PRIMASK(primask);
+
+	return stalled;
+}
+#endif
+
+static void HAL_wait_for_event()
+{
+	#if HM10_LOW_POWER_WAIT
+		#if HM10_ACTIVE_TIME_STATS
+			/** <b>Local variable start:</b> Value of the get_cycles() function of the @ref p_port port before sleeping. */
+			uint32_t start = p_port->get_cycles();
+			p_port->wait_for_event();
+			activity_sleep_cycles += p_port->get_cycles() - start;
+			activity_sleeps++;
+		#else
+			p_port->wait_for_event();
+		#endif
+	#endif
+}
+
+#if HM10_CMD_RESET || HM10_CMD_RENEW
+static void HAL_low_power_delay(uint32_t delay)
+{
+	/** <b>Local variable tickstart:</b> Time in milliseconds at which this function started waiting. */
+	uint32_t tickstart = p_port->get_tick();
+	while ((p_port->get_tick() - tickstart) < delay)
+	{
+		HAL_wait_for_event();
+	}
+}
+#endif
+
+static uint32_t default_port_get_tick(void)
+{
+	return HAL_GetTick();
+}
+
+static void default_port_wait_for_event(void)
+{
+	__WFI();
+}
+
+static uint32_t default_port_get_cycles(void)
+{
+	#if HM10_DWT_CYCCNT
+		return DWT->CYCCNT;
+	#else
+		return HAL_GetTick()*(SystemCoreClock/1000U);
+	#endif
+}
+
+static HM10_Status send_hm10_at_cmd(const char *cmd, uint8_t cmd_size, const uint8_t *value, uint8_t value_size, const char *resp, uint8_t resp_size, uint8_t resp_value_size)
+{
+	/** <b>Local variable ret:</b> Return value of either a HAL function or a @ref HM10_Status function type. */
+	int16_t  ret;
+
+	/* Flush the UART's RX before starting. */
+	HAL_uart_rx_flush();
+
+	/* Populate the AT Command into the Tx/Rx Buffer. */
+	memcpy(TxRx_Buffer, cmd, cmd_size);
+	if (value_size > 0)
+	{
+		memcpy(&TxRx_Buffer[cmd_size], value, value_size);
+	}
+
+	/* Send the AT Command. */
+	ret = HAL_uart_transmit(TxRx_Buffer, cmd_size + value_size, HM10_CUSTOM_HAL_TIMEOUT);
+	ret = HAL_ret_handler(ret);
+	if (ret != HAL_OK)
+	{
+		#if ETX_OTA_VERBOSE
+			printf("ERROR: The transmission of the %.*s Command to HM-10 BT Device has failed.\r\n", cmd_size, cmd);
+		#endif
+		return ret;
+	}
+
+	/* Receive the Response of the AT Command. */
+	ret = HAL_uart_receive(TxRx_Buffer, resp_size + resp_value_size, HM10_CUSTOM_HAL_TIMEOUT);
+	ret = HAL_ret_handler(ret);
+	if (ret != HAL_OK)
+	{
+		#if ETX_OTA_VERBOSE
+			printf("ERROR: A Response to the %.*s Command from the HM-10 BT Device was expected, but none was received (HM-10 Exception code = %d)\r\n", cmd_size, cmd, ret);
+		#endif
+		return ret;
+	}
+
+	/* Validate the constant part of the Response of the AT Command. */
+	if (memcmp(TxRx_Buffer, resp, resp_size) != 0)
+	{
+		#if ETX_OTA_VERBOSE
+			printf("ERROR: A Response to the %.*s Command from the HM-10 BT Device was expected, but something else was received instead.\r\n", cmd_size, cmd);
+		#endif
+		return HM10_EC_ERR;
+	}
+	HM10_TRACE_POINT(HM10_Trace_Parse_Done, HM10_TRACE_TAG(cmd, cmd_size));
+
+	return HM10_EC_OK;
+}
+
+#if HM10_CMD_SINGLE_VALUE
+static HM10_Status set_hm10_single_value(const char *cmd, uint8_t value)
+{
+	/** <b>Local variable ret:</b> Return value of a @ref HM10_Status function type. */
+	HM10_Status ret;
+
+	/* Send the Set Command and validate the constant part of its Response. */
+	ret = send_hm10_at_cmd(cmd, HM10_SINGLE_VALUE_CMD_SIZE_WITHOUT_VALUE, &value, 1, HM10_Set_resp_without_value, HM10_SET_GET_RESPONSE_SIZE_WITHOUT_VALUE, 1);
+	if (ret != HM10_EC_OK)
+	{
+		return ret;
+	}
+
+	/* Validate the value of the Response. */
+	if (TxRx_Buffer[HM10_SET_GET_RESPONSE_SIZE_WITHOUT_VALUE] != value)
+	{
+		#if ETX_OTA_VERBOSE
+			printf("ERROR: A Set Response from the HM-10 BT Device was expected, but something else was received instead at index %d. The received value was %c_ASCII and the expected value is %c_ASCII.\r\n", HM10_SET_GET_RESPONSE_SIZE_WITHOUT_VALUE, TxRx_Buffer[HM10_SET_GET_RESPONSE_SIZE_WITHOUT_VALUE], value);
+		#endif
+		return HM10_EC_ERR;
+	}
+
+	return HM10_EC_OK;
+}
+
+static HM10_Status get_hm10_single_value(const char *cmd, uint8_t *value)
+{
+	/** <b>Local variable ret:</b> Return value of a @ref HM10_Status function type. */
+	HM10_Status ret;
+
+	/* Send the Get Command and validate the constant part of its Response. */
+	ret = send_hm10_at_cmd(cmd, HM10_SINGLE_VALUE_CMD_SIZE_WITHOUT_VALUE, HM10_Query_value, HM10_QUERY_VALUE_SIZE, HM10_Get_resp_without_value, HM10_SET_GET_RESPONSE_SIZE_WITHOUT_VALUE, 1);
+	if (ret == HM10_EC_OK)
 	{
-		HAL_uart_rx_flush();
+		*value = TxRx_Buffer[HM10_SET_GET_RESPONSE_SIZE_WITHOUT_VALUE];
 	}
+
+	return ret;
+}
+#endif
+
+#if HM10_CMD_PIN
+static HM10_Status validate_hm10_pin(const uint8_t *pin)
+{
+	for (uint8_t current_pin_character=0; current_pin_character<HM10_PIN_VALUE_SIZE; current_pin_character++)
+	{
+		if ((pin[current_pin_character] < Number_0_in_ASCII) || (pin[current_pin_character] > Number_9_in_ASCII))
+		{
+			#if ETX_OTA_VERBOSE
+				printf("ERROR: Expected a number character value in ASCII code on the pin value at index %d, but the following ASCII value was found instead: %c.\r\n", current_pin_character, pin[current_pin_character]);
+			#endif
+			return HM10_EC_ERR;
+		}
+	}
+
+	return HM10_EC_OK;
 }
-HAL_TIMEOUT
+#endif
+
 static HM10_Status HAL_ret_handler(HAL_StatusTypeDef HAL_status)
 {
   switch (HAL_status)
@@ -0,0 +1,290 @@
+/** @addtogroup hm10_ota_delta
+ * @{
+ */
+
+#include "hm10_ota_delta.h"
+#include <string.h>	// Library from which "memset()" and "memcpy()" are located at.
+
+#define HM10_OTA_DELTA_MAX_VARINT_SIZE      (5)     /**< @brief Total maximum bytes of the varint of a 32-bit field. */
+#define HM10_OTA_DELTA_MAX_LAST_BYTE        (0x0FU) /**< @brief Highest value of the last byte of a varint of @ref HM10_OTA_DELTA_MAX_VARINT_SIZE bytes, which only carries the 4 most significant bits of a 32-bit field. */
+
+/**@brief	Encodes a field against its reference according to the mode of a context.
+ *
+ * @param mode          Mode with which the field will be encoded.
+ * @param field         Value of the field.
+ * @param reference     Value of the same field in the reference sample.
+ *
+ * @return  The value that is to be packed as a varint.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+static uint32_t encode_field(HM10_OTA_Delta_Mode mode, uint32_t field, uint32_t reference);
+
+/**@brief	Finds the end of each varint in the payload of a packet.
+ *
+ * @param[in] payload   Pointer to the payload of the packet, which must be able to hold @ref
+ *                      HM10_OTA_DELTA_MAX_PAYLOAD_SIZE bytes.
+ * @param payload_size  Length in bytes of the payload.
+ *
+ * @return  A bit mask where each bit n that is set indicates that the byte n of the payload is the last one of a varint.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+static uint32_t find_varint_ends(uint8_t *payload, uint8_t payload_size);
+
+/**@brief	Reconstructs the fields of a sample from their reference and from their decoded varints.
+ *
+ * @param mode              Mode with which the fields were encoded.
+ * @param field_count       Number of fields of the sample.
+ * @param[in] reference     Pointer to the fields of the reference sample.
+ * @param[in] values        Pointer to the decoded varints of the fields.
+ * @param[out] fields       Pointer to the Memory Address into which the fields of the sample will be stored.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+static void reconstruct_sample(HM10_OTA_Delta_Mode mode, uint8_t field_count, uint32_t *reference, uint32_t *values, uint32_t *fields);
+
+HM10_Status init_hm10_ota_delta_context(HM10_OTA_Delta_Context *ctx, HM10_OTA_Delta_Mode mode, uint8_t field_count)
+{
+    if ((field_count==0) || (field_count>HM10_OTA_DELTA_MAX_FIELDS))
+    {
+        return HM10_EC_ERR;
+    }
+
+    memset(ctx, 0, sizeof(HM10_OTA_Delta_Context));
+    ctx->mode = mode;
+    ctx->field_count = field_count;
+
+    return HM10_EC_OK;
+}
+
+HM10_Status encode_hm10_ota_delta_packet(HM10_OTA_Delta_Context *ctx, int32_t *samples, uint16_t sample_count, uint8_t *packet, uint8_t *packet_size, uint8_t *encoded_samples)
+{
+    if (sample_count == 0)
+    {
+        return HM10_EC_ERR;
+    }
+
+    /** <b>Local variable reference:</b> Pointer to the fields of the sample against which the next sample is encoded. */
+    uint32_t *reference = ctx->acked.fields;
+    /** <b>Local variable zero_sample:</b> Sample with all of its fields equal to 0, which is the reference whenever no packet has been acknowledged yet. */
+    uint32_t zero_sample[HM10_OTA_DELTA_MAX_FIELDS] = {0};
+    if (!ctx->acked.is_valid)
+    {
+        reference = zero_sample;
+    }
+
+    /* Encode the samples, one at a time, while they fit into the packet. */
+    /** <b>Local variable sample_varints:</b> Varints of the fields of the sample that is being encoded. */
+    uint8_t sample_varints[HM10_OTA_DELTA_MAX_FIELDS * HM10_OTA_DELTA_MAX_VARINT_SIZE];
+    /** <b>Local variable sample_size:</b> Length in bytes of the varints of the sample that is being encoded. */
+    uint8_t sample_size;
+    /** <b>Local variable value:</b> Value of the field that is being packed as a varint. */
+    uint32_t value;
+    /** <b>Local variable sample:</b> Pointer to the fields of the sample that is being encoded. */
+    uint32_t *sample = (uint32_t *) samples;
+    /** <b>Local variable out:</b> Length in bytes of the packet that has been populated so far. */
+    uint8_t out = HM10_OTA_DELTA_HEADER_SIZE;
+    /** <b>Local variable count:</b> Number of samples that have been encoded into the packet. */
+    uint8_t count = 0;
+    while ((count<sample_count) && (count<HM10_OTA_DELTA_MAX_SAMPLES))
+    {
+        sample_size = 0;
+        for (uint8_t f=0; f<ctx->field_count; f++)
+        {
+            value = encode_field(ctx->mode, sample[f], reference[f]);
+            while (value >= 0x80U)
+            {
+                sample_varints[sample_size++] = (uint8_t) (value | 0x80U);
+                value >>= 7;
+            }
+            sample_varints[sample_size++] = (uint8_t) value;
+        }
+        if ((out+sample_size) > HM10_OTA_DELTA_PACKET_SIZE)
+        {
+            break;
+        }
+        memcpy(&packet[out], sample_varints, sample_size);
+        out += sample_size;
+        reference = sample;
+        sample += ctx->field_count;
+        count++;
+    }
+    if (count == 0)
+    {
+        return HM10_EC_ERR;
+    }
+
+    /* Populate the Packet Header. */
+    packet[0] = ctx->next_packet_id;
+    packet[1] = ctx->acked.packet_id;
+    packet[2] = (uint8_t) ((ctx->acked.is_valid ? HM10_OTA_DELTA_REFERENCE_FLAG : 0) | count);
+
+    /* Keep the last sample of the packet in case that the receiver acknowledges it. */
+    /** <b>Local variable slot:</b> Pointer to the reference slot of the encoded packet. */
+    HM10_OTA_Delta_Reference *slot = &ctx->references[ctx->next_packet_id % HM10_OTA_DELTA_REFERENCES];
+    slot->packet_id = ctx->next_packet_id;
+    slot->is_valid = 1;
+    memcpy(slot->fields, reference, ctx->field_count * sizeof(uint32_t));
+    ctx->next_packet_id++;
+
+    *packet_size = out;
+    *encoded_samples = count;
+
+    return HM10_EC_OK;
+}
+
+HM10_Status acknowledge_hm10_ota_delta_packet(HM10_OTA_Delta_Context *ctx, uint8_t packet_id)
+{
+    /** <b>Local variable slot:</b> Pointer to the reference slot of the acknowledged packet. */
+    HM10_OTA_Delta_Reference *slot = &ctx->references[packet_id % HM10_OTA_DELTA_REFERENCES];
+    if ((!slot->is_valid) || (slot->packet_id!=packet_id))
+    {
+        return HM10_EC_NA;
+    }
+
+    memcpy(&ctx->acked, slot, sizeof(HM10_OTA_Delta_Reference));
+
+    return HM10_EC_OK;
+}
+
+HM10_Status decode_hm10_ota_delta_packet(HM10_OTA_Delta_Context *ctx, uint8_t *packet, uint8_t packet_size, int32_t *samples, uint8_t *sample_count)
+{
+    if ((packet_size<=HM10_OTA_DELTA_HEADER_SIZE) || (packet_size>HM10_OTA_DELTA_PACKET_SIZE) || ((packet[2]&HM10_OTA_DELTA_RESERVED_MASK)!=0) || ((packet[2]&HM10_OTA_DELTA_COUNT_MASK)==0))
+    {
+        return HM10_EC_ERR;
+    }
+    /** <b>Local variable count:</b> Number of samples in the packet. */
+    uint8_t count = packet[2] & HM10_OTA_DELTA_COUNT_MASK;
+    /** <b>Local variable value_count:</b> Number of varints in the packet. */
+    uint16_t value_count = (uint16_t) count * ctx->field_count;
+    if (value_count > HM10_OTA_DELTA_MAX_PAYLOAD_SIZE)
+    {
+        return HM10_EC_ERR;
+    }
+
+    /* Get the reference of the first sample. */
+    /** <b>Local variable zero_sample:</b> Sample with all of its fields equal to 0. */
+    uint32_t zero_sample[HM10_OTA_DELTA_MAX_FIELDS] = {0};
+    /** <b>Local variable reference:</b> Pointer to the fields of the sample against which the next sample was encoded. */
+    uint32_t *reference = zero_sample;
+    /** <b>Local variable slot:</b> Pointer to a reference slot of the context. */
+    HM10_OTA_Delta_Reference *slot;
+    if (packet[2] & HM10_OTA_DELTA_REFERENCE_FLAG)
+    {
+        slot = &ctx->references[packet[1] % HM10_OTA_DELTA_REFERENCES];
+        if ((!slot->is_valid) || (slot->packet_id!=packet[1]))
+        {
+            return HM10_EC_NA;
+        }
+        reference = slot->fields;
+    }
+
+    /* Find the end of every varint. */
+    /** <b>Local variable payload:</b> Payload of the packet padded with zeros up to @ref HM10_OTA_DELTA_MAX_PAYLOAD_SIZE bytes. */
+    uint8_t payload[HM10_OTA_DELTA_MAX_PAYLOAD_SIZE] = {0};
+    /** <b>Local variable payload_size:</b> Length in bytes of the payload of the packet. */
+    uint8_t payload_size = packet_size - HM10_OTA_DELTA_HEADER_SIZE;
+    memcpy(payload, &packet[HM10_OTA_DELTA_HEADER_SIZE], payload_size);
+    /** <b>Local variable varint_ends:</b> Bit mask of the bytes of the payload that are the last one of a varint. */
+    uint32_t varint_ends = find_varint_ends(payload, payload_size);
+    if (!(varint_ends & (1U << (payload_size-1))))
+    {
+        return HM10_EC_ERR;
+    }
+
+    /* Decode the varints. */
+    /** <b>Local variable values:</b> Decoded varints of the packet. */
+    uint32_t values[HM10_OTA_DELTA_MAX_PAYLOAD_SIZE + 1];
+    /** <b>Local variable decoded:</b> Number of varints that have been decoded so far. */
+    uint8_t decoded = 0;
+    /** <b>Local variable shift:</b> Bit position of the next 7 bits of the varint that is being decoded. */
+    uint8_t shift = 0;
+    values[0] = 0;
+    for (uint8_t i=0; i<payload_size; i++)
+    {
+        /* The last byte of the longest varint must end it and must not carry bits beyond the 32 bits of a field. */
+        if ((shift == (7*(HM10_OTA_DELTA_MAX_VARINT_SIZE-1))) && (payload[i] > HM10_OTA_DELTA_MAX_LAST_BYTE))
+        {
+            return HM10_EC_ERR;
+        }
+        values[decoded] |= ((uint32_t) (payload[i] & 0x7FU)) << shift;
+        shift += 7;
+        if (varint_ends & (1U << i))
+        {
+            if (++decoded > value_count)
+            {
+                return HM10_EC_ERR;
+            }
+            values[decoded] = 0;
+            shift = 0;
+        }
+    }
+    if (decoded != value_count)
+    {
+        return HM10_EC_ERR;
+    }
+
+    /* Reconstruct the samples, each one against the previous one. */
+    /** <b>Local variable sample:</b> Pointer to the fields of the sample that is being reconstructed. */
+    uint32_t *sample = (uint32_t *) samples;
+    for (uint8_t s=0; s<count; s++)
+    {
+        reconstruct_sample(ctx->mode, ctx->field_count, reference, &values[s*ctx->field_count], sample);
+        reference = sample;
+        sample += ctx->field_count;
+    }
+
+    /* Keep the last sample of the packet to be used as a reference. */
+    slot = &ctx->references[packet[0] % HM10_OTA_DELTA_REFERENCES];
+    slot->packet_id = packet[0];
+    slot->is_valid = 1;
+    memcpy(slot->fields, reference, ctx->field_count * sizeof(uint32_t));
+    *sample_count = count;
+
+    return HM10_EC_OK;
+}
+
+static uint32_t encode_field(HM10_OTA_Delta_Mode mode, uint32_t field, uint32_t reference)
+{
+    /** <b>Local variable difference:</b> Difference, modulo 2^32, of the field against its reference. */
+    uint32_t difference = field - reference;
+
+    if (mode == HM10_OTA_Delta_XOR)
+    {
+        return field ^ reference;
+    }
+    return (difference << 1) ^ (uint32_t) -(int32_t) (difference >> 31);
+}
+
+static uint32_t find_varint_ends(uint8_t *payload, uint8_t payload_size)
+{
+    /** <b>Local variable continuation_bits:</b> Bit mask of the bytes of the payload whose continuation bit is set. */
+    uint32_t continuation_bits = 0;
+    for (uint8_t i=0; i<payload_size; i++)
+    {
+        continuation_bits |= (uint32_t) (payload[i] >> 7) << i;
+    }
+
+    return ~continuation_bits & ((1U << payload_size) - 1);
+}
+
+static void reconstruct_sample(HM10_OTA_Delta_Mode mode, uint8_t field_count, uint32_t *reference, uint32_t *values, uint32_t *fields)
+{
+    for (uint8_t f=0; f<field_count; f++)
+    {
+        if (mode == HM10_OTA_Delta_XOR)
+        {
+            fields[f] = reference[f] ^ values[f];
+        }
+        else
+        {
+            fields[f] = reference[f] + ((values[f] >> 1) ^ (uint32_t) -(int32_t) (values[f] & 1U));
+        }
+    }
+}
+
+/** @} */
@@ -0,0 +1,87 @@
+/** @addtogroup hm10_ota_ping
+ * @{
+ */
+
+#include "hm10_ota_ping.h"
+#include <stddef.h> // Library from which "NULL" is located at.
+
+static HM10_OTA_Ping_Clock ping_clock = NULL;   /**< @brief Clock with which the times are taken, or \c NULL to use the SysTick of the HAL. */
+static uint32_t last_tick = 0;                  /**< @brief Last value of the SysTick of the HAL that was read, which is used to detect when it wraps around. */
+static uint64_t tick_wraps = 0;                 /**< @brief Number of milliseconds accumulated by the times that the SysTick of the HAL wrapped around. */
+static uint8_t ping_frame[HM10_OTA_PING_PONG_SIZE]; /**< @brief Buffer that holds the frame that is either being received or sent. */
+
+/**@brief	Encodes a 64-bit time in little endian.
+ *
+ * @param[out] data Pointer to the Memory Address into which the 8 bytes of the time will be stored.
+ * @param time      Time that is desired to be encoded.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+static void put_time(uint8_t *data, uint64_t time);
+
+void set_hm10_ota_ping_clock(HM10_OTA_Ping_Clock clock)
+{
+    ping_clock = clock;
+}
+
+uint64_t get_hm10_ota_ping_time()
+{
+    if (ping_clock != NULL)
+    {
+        return ping_clock();
+    }
+
+    /* Extend the 32-bit SysTick in milliseconds into a 64-bit time in microseconds. */
+    /** <b>Local variable tick:</b> Current value of the SysTick of the HAL. */
+    uint32_t tick = HAL_GetTick();
+    if (tick < last_tick)
+    {
+        tick_wraps += 0x100000000ULL;
+    }
+    last_tick = tick;
+
+    return (tick_wraps + tick)*1000U;
+}
+
+HM10_Status respond_hm10_ota_ping(uint32_t timeout)
+{
+    /** <b>Local variable t2:</b> Time at which the PING frame was received. */
+    uint64_t t2;
+
+    /* Receive the PING frame. */
+    if (get_hm10_ota_data(ping_frame, 1, timeout) != HM10_EC_OK)
+    {
+        return HM10_EC_NR;
+    }
+    t2 = get_hm10_ota_ping_time();
+    if (ping_frame[0] != HM10_OTA_PING_TYPE_PING)
+    {
+        return HM10_EC_NA;
+    }
+    if (get_hm10_ota_data(&ping_frame[1], HM10_OTA_PING_PING_SIZE - 1, timeout) != HM10_EC_OK)
+    {
+        return HM10_EC_NR;
+    }
+
+    /* Send the PONG frame, with the Sequence Number of the PING frame, as late as possible after taking its T3. */
+    ping_frame[0] = HM10_OTA_PING_TYPE_PONG;
+    put_time(&ping_frame[2], t2);
+    put_time(&ping_frame[10], get_hm10_ota_ping_time());
+    if (send_hm10_ota_data(ping_frame, HM10_OTA_PING_PONG_SIZE, timeout) != HM10_EC_OK)
+    {
+        return HM10_EC_ERR;
+    }
+
+    return HM10_EC_OK;
+}
+
+static void put_time(uint8_t *data, uint64_t time)
+{
+    for (uint8_t i=0; i<8; i++)
+    {
+        data[i] = (uint8_t) (time >> (8*i));
+    }
+}
+
+/** @} */
@@ -0,0 +1,288 @@
+/** @addtogroup hm10_rtos
+ * @{
+ */
+
+#include "hm10_rtos.h"
+
+#if HM10_RTOS
+#include <string.h>	// Library from which "memset()" and "memcpy()" are located at.
+#include "semphr.h" // FreeRTOS Library from which the semaphores and mutexes are located at.
+#include "stream_buffer.h" // FreeRTOS Library from which the stream buffers are located at.
+
+#if !HM10_UART_RX_DMA || !HM10_LOW_POWER_WAIT
+#error "The HM-10 FreeRTOS Binding requires both HM10_UART_RX_DMA and HM10_LOW_POWER_WAIT to be enabled."
+#endif
+
+#define HM10_RTOS_FORWARD_CHUNK_SIZE    (32)        /**< @brief Maximum number of received bytes that the driver task forwards into the stream buffer at once. */
+#define HM10_RTOS_LINK_EVENT_SIZE       (7)         /**< @brief Length in bytes of the OK+CONN and OK+LOST notifications of the HM-10 BT Device. */
+
+static SemaphoreHandle_t event_semaphore = NULL;    /**< @brief Binary semaphore that is given from the UART's interrupts so that the task that is waiting for the HM-10 BT Device wakes up. */
+static SemaphoreHandle_t driver_mutex = NULL;       /**< @brief Mutex that grants the exclusive use of the @ref hm10_ble . */
+#if HM10_RTOS_DRIVER_TASK
+static TaskHandle_t driver_task = NULL;             /**< @brief Handle of the driver task. */
+static TaskHandle_t event_task = NULL;              /**< @brief Handle of the task that is notified of the link events, or \c NULL if there is none. */
+static StreamBufferHandle_t rx_stream = NULL;       /**< @brief Stream buffer into which the driver task forwards the received data. */
+static uint32_t dropped_bytes = 0;                  /**< @brief Number of received bytes that did not fit into the @ref rx_stream stream buffer. */
+static uint8_t link_event_window[HM10_RTOS_LINK_EVENT_SIZE]; /**< @brief Last bytes received, in which the link events of the HM-10 BT Device are searched for. */
+static const uint8_t HM10_OK_CONN_event[] = {'O', 'K', '+', 'C', 'O', 'N', 'N'};  /**< @brief Notification that the HM-10 BT Device sends whenever it establishes a Bluetooth Connection. */
+static const uint8_t HM10_OK_LOST_event[] = {'O', 'K', '+', 'L', 'O', 'S', 'T'};  /**< @brief Notification that the HM-10 BT Device sends whenever it loses its Bluetooth Connection. */
+#endif
+
+/**@brief	Gets the current time in milliseconds from the FreeRTOS tick count, which is the get_tick() function of the
+ *          port of this module.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+static uint32_t rtos_port_get_tick(void);
+
+/**@brief	Blocks the calling task until either an interrupt of the UART gives the @ref event_semaphore semaphore or
+ *          one tick elapses, which is the wait_for_event() function of the port of this module.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+static void rtos_port_wait_for_event(void);
+
+/**@brief	Gets the value of the DWT Cycle Counter of the Cortex-M core, which is the get_cycles() function of the port
+ *          of this module.
+ *
+ * @note    On the cores without the DWT Cycle Counter (see @ref HM10_DWT_CYCCNT ), the FreeRTOS tick count converted
+ *          into cycles is returned instead.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+static uint32_t rtos_port_get_cycles(void);
+
+static const HM10_Port_def_t rtos_port = {rtos_port_get_tick, rtos_port_wait_for_event, rtos_port_get_cycles};  /**< @brief Port through which the @ref hm10_ble blocks on FreeRTOS. */
+
+#if HM10_RTOS_DRIVER_TASK
+/**@brief	Driver task, which forwards the data received from the HM-10 BT Device into the @ref rx_stream stream buffer
+ *          each time that it is notified by the @ref handle_hm10_rtos_uart_rx_event function.
+ *
+ * @param argument  Unused.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+static void hm10_driver_task(void *argument);
+
+/**@brief	Searches for the link events of the HM-10 BT Device in the received data and notifies the @ref event_task
+ *          task of them.
+ *
+ * @param byte  Byte that has just been received.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 18, 2026
+ */
+static void detect_link_event(uint8_t byte);
+#endif
+
+HM10_Status init_hm10_rtos(UART_HandleTypeDef *huart)
+{
+    /* Create the objects that are used from the UART's interrupts before starting the reception. */
+    event_semaphore = xSemaphoreCreateBinary();
+    driver_mutex = xSemaphoreCreateMutex();
+    if ((event_semaphore == NULL) || (driver_mutex == NULL))
+    {
+        return HM10_EC_ERR;
+    }
+
+    /* Initialize the HM-10 driver on top of the FreeRTOS port. */
+    set_hm10_port(&rtos_port);
+    init_hm10_module(huart);
+
+    #if HM10_RTOS_DRIVER_TASK
+        /* Create the stream buffer and the driver task that fills it. */
+        memset(link_event_window, 0, sizeof(link_event_window));
+        dropped_bytes = 0;
+        rx_stream = xStreamBufferCreate(HM10_RTOS_STREAM_SIZE, 1);
+        if (rx_stream == NULL)
+        {
+            return HM10_EC_ERR;
+        }
+        if (xTaskCreate(hm10_driver_task, "hm10", HM10_RTOS_TASK_STACK_SIZE, NULL, HM10_RTOS_TASK_PRIORITY, &driver_task) != pdPASS)
+        {
+            return HM10_EC_ERR;
+        }
+    #endif
+
+    return HM10_EC_OK;
+}
+
+void handle_hm10_rtos_uart_rx_event(UART_HandleTypeDef *huart, uint16_t size)
+{
+    /** <b>Local variable woken:</b> Whether a task with a higher priority than the interrupted one was woken up. */
+    BaseType_t woken = pdFALSE;
+
+    handle_hm10_uart_rx_event(huart, size);
+    if (event_semaphore != NULL)
+    {
+        xSemaphoreGiveFromISR(event_semaphore, &woken);
+    }
+    #if HM10_RTOS_DRIVER_TASK
+        if (driver_task != NULL)
+        {
+            vTaskNotifyGiveFromISR(driver_task, &woken);
+        }
+    #endif
+    portYIELD_FROM_ISR(woken);
+}
+
+void handle_hm10_rtos_uart_tx_complete(UART_HandleTypeDef *huart)
+{
+    /** <b>Local variable woken:</b> Whether a task with a higher priority than the interrupted one was woken up. */
+    BaseType_t woken = pdFALSE;
+
+    handle_hm10_uart_tx_complete(huart);
+    if (event_semaphore != NULL)
+    {
+        xSemaphoreGiveFromISR(event_semaphore, &woken);
+    }
+    portYIELD_FROM_ISR(woken);
+}
+
+void handle_hm10_rtos_uart_error(UART_HandleTypeDef *huart)
+{
+    /** <b>Local variable woken:</b> Whether a task with a higher priority than the interrupted one was woken up. */
+    BaseType_t woken = pdFALSE;
+
+    handle_hm10_uart_error(huart);
+    if (event_semaphore != NULL)
+    {
+        xSemaphoreGiveFromISR(event_semaphore, &woken);
+    }
+    #if HM10_RTOS_DRIVER_TASK
+        if (driver_task != NULL)
+        {
+            vTaskNotifyGiveFromISR(driver_task, &woken);
+        }
+    #endif
+    portYIELD_FROM_ISR(woken);
+}
+
+HM10_Status take_hm10_rtos(uint32_t timeout)
+{
+    return (xSemaphoreTake(driver_mutex, pdMS_TO_TICKS(timeout)) == pdTRUE) ? HM10_EC_OK : HM10_EC_NR;
+}
+
+void give_hm10_rtos()
+{
+    xSemaphoreGive(driver_mutex);
+}
+
+#if HM10_RTOS_DRIVER_TASK
+HM10_Status get_hm10_rtos_ota_data(uint8_t *ble_ota_data, uint16_t size, uint32_t timeout)
+{
+    /** <b>Local variable start:</b> Tick count at which this function started waiting. */
+    TickType_t start = xTaskGetTickCount();
+    /** <b>Local variable ticks:</b> The \p timeout param converted into ticks. */
+    TickType_t ticks = pdMS_TO_TICKS(timeout);
+    /** <b>Local variable received:</b> Number of bytes received so far. */
+    size_t received = 0;
+    /** <b>Local variable elapsed:</b> Number of ticks that have elapsed since the @ref start tick count. */
+    TickType_t elapsed = 0;
+
+    /* Keep receiving until either all the expected data has arrived or the timeout expires. */
+    do
+    {
+        received += xStreamBufferReceive(rx_stream, &ble_ota_data[received], size - received, ticks - elapsed);
+        if (received == size)
+        {
+            return HM10_EC_OK;
+        }
+        elapsed = xTaskGetTickCount() - start;
+    }
+    while (elapsed < ticks);
+
+    return HM10_EC_NR;
+}
+
+void set_hm10_rtos_event_task(TaskHandle_t task)
+{
+    event_task = task;
+}
+
+uint32_t get_hm10_rtos_dropped_bytes()
+{
+    return dropped_bytes;
+}
+#endif
+
+static uint32_t rtos_port_get_tick(void)
+{
+    return (uint32_t) pdTICKS_TO_MS(xTaskGetTickCount());
+}
+
+static void rtos_port_wait_for_event(void)
+{
+    xSemaphoreTake(event_semaphore, 1);
+}
+
+static uint32_t rtos_port_get_cycles(void)
+{
+    #if HM10_DWT_CYCCNT
+        return DWT->CYCCNT;
+    #else
+        return (uint32_t) xTaskGetTickCount()*(SystemCoreClock/configTICK_RATE_HZ);
+    #endif
+}
+
+#if HM10_RTOS_DRIVER_TASK
+static void hm10_driver_task(void *argument)
+{
+    (void) argument;
+    /** <b>Local variable chunk:</b> Received bytes that are pending to be forwarded into the @ref rx_stream stream buffer. */
+    uint8_t chunk[HM10_RTOS_FORWARD_CHUNK_SIZE];
+    /** <b>Local variable n:</b> Number of bytes held in the @ref chunk buffer. */
+    uint16_t n;
+
+    for (;;)
+    {
+        /* Wait for the next reception event. */
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+        /* Forward everything that has been received, unless an AT Command is being processed. */
+        xSemaphoreTake(driver_mutex, portMAX_DELAY);
+        do
+        {
+            n = 0;
+            while ((n < HM10_RTOS_FORWARD_CHUNK_SIZE) && (get_hm10_ota_data(&chunk[n], 1, 0) == HM10_EC_OK))
+            {
+                detect_link_event(chunk[n++]);
+            }
+            if (n > 0)
+            {
+                dropped_bytes += n - xStreamBufferSend(rx_stream, chunk, n, 0);
+            }
+        }
+        while (n == HM10_RTOS_FORWARD_CHUNK_SIZE);
+        xSemaphoreGive(driver_mutex);
+    }
+}
+
+static void detect_link_event(uint8_t byte)
+{
+    /* Shift the byte into the window of the last received bytes. */
+    memmove(link_event_window, &link_event_window[1], HM10_RTOS_LINK_EVENT_SIZE - 1);
+    link_event_window[HM10_RTOS_LINK_EVENT_SIZE - 1] = byte;
+
+    if (event_task == NULL)
+    {
+        return;
+    }
+    if (memcmp(link_event_window, HM10_OK_CONN_event, HM10_RTOS_LINK_EVENT_SIZE) == 0)
+    {
+        xTaskNotify(event_task, HM10_RTOS_EVENT_CONN, eSetBits);
+    }
+    else if (memcmp(link_event_window, HM10_OK_LOST_event, HM10_RTOS_LINK_EVENT_SIZE) == 0)
+    {
+        xTaskNotify(event_task, HM10_RTOS_EVENT_LOST, eSetBits);
+    }
+}
+#endif
+
+#endif /* HM10_RTOS */
+
+/** @} */
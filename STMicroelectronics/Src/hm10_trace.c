@@ -0,0 +1,155 @@
+/** @addtogroup hm10_trace
+ * @{
+ */
+
+#include "hm10_trace.h"
+
+#if HM10_TRACE
+#include <stdio.h>	// Library from which "printf()" is located at.
+
+#if (HM10_TRACE_RING_SIZE & (HM10_TRACE_RING_SIZE - 1)) != 0
+#error "HM10_TRACE_RING_SIZE must be a power of 2."
+#endif
+
+#if !HM10_DWT_CYCCNT
+#error "The HM-10 Trace Points require the DWT Cycle Counter, which is only available on the Cortex-M3 cores and above."
+#endif
+
+#define HM10_TRACE_PRINT_CHUNK_SIZE     (8)         /**< @brief Number of records that the @ref print_hm10_trace function reads from the trace ring at once. */
+
+/**@brief	Slot of the trace ring.
+ */
+typedef struct
+{
+    volatile uint32_t sequence;         //!< One plus the number of records that had been claimed before the record of this slot, once that record has been published, or the number of those records while it is being written.
+    volatile HM10_Trace_Record record;  //!< Record of this slot.
+} HM10_Trace_Slot;
+
+static HM10_Trace_Slot trace_ring[HM10_TRACE_RING_SIZE];   /**< @brief Ring of trace records. */
+static volatile uint32_t trace_claimed = 0;                 /**< @brief Total number of records that have been claimed by the trace points. */
+static uint32_t trace_read = 0;                             /**< @brief Total number of records that have been read or lost. */
+static const char *trace_point_names[HM10_Trace_Points_Count] = {"SEND_START", "SEND_DONE", "FIRST_RX_BYTE", "LAST_RX_BYTE", "PARSE_DONE", "CALLBACK_DISPATCH"}; /**< @brief Names with which each trace point is printed by the @ref print_hm10_trace function. */
+
+void init_hm10_trace()
+{
+    /* Enable the DWT Cycle Counter, with which the records are timestamped. */
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    /* Discard all the records. */
+    for (uint16_t slot=0; slot<HM10_TRACE_RING_SIZE; slot++)
+    {
+        trace_ring[slot].sequence = 0;
+    }
+    trace_claimed = 0;
+    trace_read = 0;
+}
+
+void record_hm10_trace(HM10_Trace_Point point, uint16_t arg)
+{
+    /** <b>Local variable timestamp:</b> Value of the DWT Cycle Counter at which the trace point was reached. */
+    uint32_t timestamp = DWT->CYCCNT;
+
+    /* Claim the next record, which is not shared with any other trace point that interrupts or is interrupted by this one. */
+    /** <b>Local variable index:</b> Number of records that had been claimed before the one of this trace point. */
+    uint32_t index = __atomic_fetch_add(&trace_claimed, 1, __ATOMIC_RELAXED);
+    /** <b>Local variable p_slot:</b> Pointer to the slot of the trace ring into which the record is written. */
+    HM10_Trace_Slot *p_slot = &trace_ring[index & (HM10_TRACE_RING_SIZE - 1)];
+
+    /* Write the record while its slot is marked as being written, and then publish it. */
+    __atomic_store_n(&p_slot->sequence, index, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    p_slot->record.timestamp = timestamp;
+    p_slot->record.arg = arg;
+    p_slot->record.point = (uint8_t) point;
+    __atomic_store_n(&p_slot->sequence, index + 1, __ATOMIC_RELEASE);
+}
+
+uint16_t read_hm10_trace(HM10_Trace_Record *records, uint16_t max_records, uint32_t *lost)
+{
+    /** <b>Local variable count:</b> Number of records that have been read. */
+    uint16_t count = 0;
+    /** <b>Local variable lost_records:</b> Number of records that were overwritten before they could be read. */
+    uint32_t lost_records = 0;
+    /** <b>Local variable claimed:</b> Total number of records that had been claimed when the reading started. */
+    uint32_t claimed = __atomic_load_n(&trace_claimed, __ATOMIC_ACQUIRE);
+    /** <b>Local variable p_slot:</b> Pointer to the slot of the trace ring of the record that is being read. */
+    HM10_Trace_Slot *p_slot;
+    /** <b>Local variable sequence:</b> Sequence value that the slot of the record that is being read had before copying it. */
+    uint32_t sequence;
+
+    /* Skip the records that have already been overwritten by newer ones. */
+    if ((claimed - trace_read) > HM10_TRACE_RING_SIZE)
+    {
+        lost_records = claimed - trace_read - HM10_TRACE_RING_SIZE;
+        trace_read = claimed - HM10_TRACE_RING_SIZE;
+    }
+
+    while ((count < max_records) && (trace_read != claimed))
+    {
+        /* Stop at a record that has not been published yet, and skip the ones that were overwritten in the meantime. */
+        p_slot = &trace_ring[trace_read & (HM10_TRACE_RING_SIZE - 1)];
+        sequence = __atomic_load_n(&p_slot->sequence, __ATOMIC_ACQUIRE);
+        if ((int32_t) (sequence - (trace_read + 1)) < 0)
+        {
+            break;
+        }
+        if (sequence != (trace_read + 1))
+        {
+            lost_records++;
+            trace_read++;
+            continue;
+        }
+
+        /* Copy the record and keep it only if it was not overwritten while it was being copied. */
+        records[count].timestamp = p_slot->record.timestamp;
+        records[count].arg = p_slot->record.arg;
+        records[count].point = p_slot->record.point;
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        if (__atomic_load_n(&p_slot->sequence, __ATOMIC_RELAXED) == sequence)
+        {
+            count++;
+        }
+        else
+        {
+            lost_records++;
+        }
+        trace_read++;
+    }
+
+    if (lost != NULL)
+    {
+        *lost = lost_records;
+    }
+
+    return count;
+}
+
+void print_hm10_trace()
+{
+    /** <b>Local variable records:</b> Records that have been read from the trace ring and that are pending to be printed. */
+    HM10_Trace_Record records[HM10_TRACE_PRINT_CHUNK_SIZE];
+    /** <b>Local variable count:</b> Number of records in the @ref records Local Variable. */
+    uint16_t count;
+    /** <b>Local variable lost:</b> Number of records that were lost in the last read of the trace ring. */
+    uint32_t lost;
+    /** <b>Local variable total_lost:</b> Number of records that were lost in all the reads of the trace ring. */
+    uint32_t total_lost = 0;
+
+    printf("HM10_TRACE BEGIN ticks_per_us=%lu timestamp_bits=32\r\n", (unsigned long) (SystemCoreClock/1000000U));
+    do
+    {
+        count = read_hm10_trace(records, HM10_TRACE_PRINT_CHUNK_SIZE, &lost);
+        total_lost += lost;
+        for (uint16_t i=0; i<count; i++)
+        {
+            printf("%s %lu %u\r\n", trace_point_names[records[i].point], (unsigned long) records[i].timestamp, records[i].arg);
+        }
+    }
+    while (count == HM10_TRACE_PRINT_CHUNK_SIZE);
+    printf("HM10_TRACE END lost=%lu\r\n", (unsigned long) total_lost);
+}
+
+#endif /* HM10_TRACE */
+
+/** @} */